@@ -41,6 +41,9 @@ namespace AreaDefs
   typedef word  TileIndex;      // Posicion absoluta de un tile 
   typedef byte  MaskTileAccess; // Mascara de acceso a tile
   typedef word  RoomID;         // Identificador de habitacion
+  typedef word  ComponentID;    // Identificador de componente conexa
+  typedef dword TileAccessInfo; // Info de acceso empaquetada de un tile
+  typedef byte  FloorFlags;     // Flags de dibujado del floor de un tile
 
   // Constantes
   const MaskTileAccess NO_TILE_ACCESS  = 0XFF;   // No hay acceso
@@ -48,6 +51,27 @@ namespace AreaDefs
   const word           MAXROOFS        = 0xFFFF; // Num. maximo de roofs  
   const word           MAX_AREA_WIDTH  = 256;    // Maxima anchura de un area
   const word           MAX_AREA_HEIGHT = 256;    // Maxima anchura de un area
+  const ComponentID    NO_COMPONENT    = 0;      // Tile sin componente conexa
+
+  // Constantes para la codificacion de handles
+  // Nota: [tipo:4][indice de slot:12]. El handle no puede crecer mas alla
+  // de un word pues se empaqueta por pares en los parametros de las
+  // notificaciones (ver CCriature y CVirtualMachine).
+  const word ENTHANDLE_TYPE_SHIFT = 12;     // Desplazamiento del tipo
+  const word ENTHANDLE_TYPE_MASK  = 0xF000; // Mascara del tipo
+  const word ENTHANDLE_INDEX_MASK = 0x0FFF; // Mascara del indice de slot
+  const word MAX_ENTITIES_BY_TYPE = 0x0FFF; // Maximo de entidades por tipo
+
+  // Constantes para el almacenamiento de celdas por bloques
+  // Nota: Los bloques seran de 32 x 32 tiles. Solo limitan la memoria de
+  // las celdas alejadas; el area se sigue cargando completa y su tamao 
+  // maximo sigue acotado por TileIndex
+  const word CELL_CHUNK_SHIFT         = 5;    // Desplazamiento de un bloque
+  const word CELL_CHUNK_MASK          = 0x1F; // Mascara de posicion en bloque
+  const word CELL_CHUNK_TILES         = 1024; // Tiles por bloque
+  const word MAX_RESIDENT_CELL_CHUNKS = 16;   // Bloques residentes maximos
+  const word MAX_CELL_CHUNK_PAGE_OUTS = 2;    // Descargas por actualizacion
+  const word NO_CELL_CHUNK            = 0xFFFF; // Bloque nulo
 
   // Tipos enumerados
   enum {
@@ -61,6 +85,23 @@ namespace AreaDefs
 	DRAW_GFX       = 0x40  // Dibujado de GFXs
   };
 
+  enum {
+	// Campos de la info de acceso empaquetada de un tile (TileAccessInfo)
+	// Nota: La mascara de adyacentes usara el filtro PLAYER | CRIATURE, que
+	// al no ser los tipos de entidad flags, excluira tambien a los objetos
+	// de escenario y a los items
+	TILE_ACCESS_MASK      = 0x000000FF, // Mascara de acceso sin criaturas
+	TILE_WALKABLE         = 0x00000100, // Tile con contenido
+	TILE_WITH_CRIATURE    = 0x00000200, // Tile ocupado por criatura / jugador
+	TILE_ADJ_ACCESS_MASK  = 0x00FF0000, // Mascara de acceso para adyacentes
+	TILE_ADJ_ACCESS_SHIFT = 16          // Desplazamiento de la anterior
+  };
+
+  enum {
+	// Flags del floor de un tile (FloorFlags)
+	FLOOR_WITH_ENTITIES = 0x01 // La celda tiene entidades sobre el floor
+  };
+
   // Estructuras
   struct sTilePos {
 	// Representa una posicion dentro del mapa
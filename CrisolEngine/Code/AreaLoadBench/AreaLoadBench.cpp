@@ -0,0 +1,862 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// AreaLoadBench.cpp
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Descripcion:
+// - Cargador de areas desde la linea de comandos, pensado para ejecuciones
+//   desatendidas. Trabajara sin graficos, sonido ni resto de subsistemas del
+//   motor, y tiene dos modos de uso:
+//    * Carga de archivos de area base. Cada archivo recibido se leera, se
+//      convertira a v2 en memoria si es v1 (con el mismo CAreaFileConverter
+//      que usa el motor) y se recorreran y validaran sus celdas, entidades,
+//      items y techos, creando despues las rejillas del mapa. Por cada fase
+//      se mostrara el tiempo, los bytes leidos, las lecturas y las reservas
+//      de memoria, junto a una linea con el prefijo "AREALOADBENCH;" y los
+//      valores separados por ';'.
+//    * Lectura del log del motor (-l). Se reuniran las lineas "AREALOAD;"
+//      escritas por CAreaLoadProfiler en cada cambio de area, agrupandolas
+//      por area cargada.
+// - En ambos modos se terminara con la relacion de areas ordenadas de mas
+//   a menos lentas, indicando la fase en la que mas tiempo se invierte.
+//
+// Notas:
+// - La carga de archivos no crea entidades, texturas ni ejecuta scripts,
+//   pues para ello se necesita el motor completo. Para medir esas fases se
+//   debera de usar el log de una ejecucion del motor compilado con
+//   AREA_LOAD_PROFILE.
+// - Los archivos se leeran desde disco; los contenidos en un CPAK se
+//   deberan de extraer antes.
+// - Las reservas se contaran a traves del gancho de reservas de la CRT de
+//   depuracion, luego solo estaran disponibles en la version Debug de
+//   Windows. En el resto se mostraran como "-".
+///////////////////////////////////////////////////////////////////////////////
+
+// Pragmas <VC6 / Warnings sobre la stl>
+#pragma warning(disable:4786)
+
+#include "SYSDefs.h"
+#include "CrisolBuilder/cbdefs.h"
+#include "CrisolBuilder/CAreaFileConverter.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <time.h>
+#endif
+#if defined(_WIN32) && defined(_DEBUG)
+#include <crtdbg.h>
+#define AREALOADBENCH_ALLOC_HOOK
+#endif
+
+// Fases de la carga de un archivo de area
+enum ePhase {
+  PHASE_FILE = 0, // Lectura del fichero
+  PHASE_CONVERT,  // Conversion v1 -> v2 en memoria
+  PHASE_CELLS,    // Recorrido y validacion de celdas, techos, entidades e items
+  PHASE_GRIDS,    // Creacion de las rejillas del mapa
+  MAX_PHASES
+};
+
+// Nombres de las fases
+static const sbyte* const szPhaseNames[MAX_PHASES] = {
+  "Fichero",
+  "Conversion",
+  "Celdas",
+  "Rejillas"
+};
+
+// Nombres de las fases del perfilador del motor (CAreaLoadProfiler)
+const byte MAX_ENGINE_PHASES = 8;
+static const sbyte* const szEnginePhaseNames[MAX_ENGINE_PHASES] = {
+  "Preparacion",
+  "Guardado",
+  "Fichero",
+  "Celdas",
+  "Rejillas",
+  "Iluminacion",
+  "MotorIso",
+  "Scripts"
+};
+
+// Tamao de los bloques de lectura
+const dword READ_BLOCK_SIZE = 64 * 1024;
+
+// Datos acumulados en una fase
+struct sPhaseInfo {
+  dword udTime;      // Tiempo (microsegundos)
+  dword udBytesRead; // Bytes leidos
+  dword udNumReads;  // Llamadas de lectura
+  dword udNumAllocs; // Reservas de memoria
+  dword udAllocSize; // Bytes reservados
+};
+
+// Resultado de la carga de un archivo de area
+struct sAreaResult {
+  std::string szFile;        // Archivo
+  word        uwIDArea;      // Identificador del area
+  byte        ubHVersion;    // Version alta del archivo
+  word        uwWidth;       // Anchura
+  word        uwHeight;      // Altura
+  dword       udNumCells;    // Celdas con contenido
+  dword       udNumRoofs;    // Techos
+  dword       udNumEntities; // Obj. de escenario, criaturas y paredes
+  dword       udNumItems;    // Items
+  dword       udTotalTime;   // Tiempo total (microsegundos)
+  sPhaseInfo  Phases[MAX_PHASES]; // Datos por fase
+};
+
+// Datos de las transiciones hacia un area leidas del log del motor
+struct sLogAreaInfo {
+  dword  udNumLoads;  // Cambios de area hacia esta
+  double dTotalTime;  // Suma de tiempos totales (microsegundos)
+  dword  udMaxTime;   // Tiempo total maximo (microsegundos)
+  double dPhaseTime[MAX_ENGINE_PHASES]; // Suma de tiempos por fase
+};
+
+// Opciones de ejecucion
+struct sOptions {
+  std::vector<std::string> Files;     // Archivos de area a cargar
+  std::string              szLogFile; // Log del motor a leer (-l)
+  word                     uwNumRuns; // Cargas por archivo
+  word                     uwTop;     // Areas a mostrar en la relacion
+  // Constructor
+  sOptions(void): uwNumRuns(3),
+				  uwTop(10) { }
+};
+
+// Fase sobre la que se acumulan las reservas (NULL si no se mide)
+static sPhaseInfo* l_pAllocPhase = NULL;
+
+// Funciones
+bool ReadOptions(int argc,
+				 char* argv[],
+				 sOptions& Options);
+bool LoadAreaFile(const std::string& szFile,
+				  sAreaResult& Result,
+				  std::string& szError);
+bool ReadAreaFile(const std::string& szFile,
+				  std::vector<sbyte>& Data,
+				  sPhaseInfo& Phase);
+bool WalkAreaV2(const std::vector<sbyte>& Data,
+				sAreaResult& Result,
+				std::string& szError);
+void BuildGrids(const std::vector<sbyte>& Data,
+				const sAreaResult& Result);
+void WriteResult(const sAreaResult& Result);
+bool ReadEngineLog(const std::string& szLogFile,
+				   const word uwTop);
+sqword GetTimeNs(void);
+void WriteHelp(void);
+
+// Comparacion de resultados por tiempo total, de mayor a menor
+bool
+IsSlowerResult(const sAreaResult& Left,
+			   const sAreaResult& Right)
+{
+  return Left.udTotalTime > Right.udTotalTime;
+}
+
+#ifdef AREALOADBENCH_ALLOC_HOOK
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Gancho de reservas de la CRT de depuracion. Contara cada reserva o
+//   redimensionado de memoria realizado en la fase que se este midiendo.
+// Parametros:
+// - Ver documentacion de _CrtSetAllocHook.
+// Devuelve:
+// - TRUE para permitir siempre la operacion.
+// Notas:
+// - Los bloques internos de la CRT (_CRT_BLOCK) no se contaran.
+///////////////////////////////////////////////////////////////////////////////
+static int __cdecl
+AreaLoadBenchAllocHook(int nAllocType,
+					   void* pvData,
+					   size_t nSize,
+					   int nBlockUse,
+					   long lRequest,
+					   const unsigned char* szFileName,
+					   int nLine)
+{
+  // Se cuentan reservas y redimensionados
+  if (l_pAllocPhase &&
+	  (_HOOK_ALLOC == nAllocType || _HOOK_REALLOC == nAllocType) &&
+	  _CRT_BLOCK != nBlockUse) {
+	++l_pAllocPhase->udNumAllocs;
+	l_pAllocPhase->udAllocSize += nSize;
+  }
+  return TRUE;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Entrada de la aplicacion.
+// Parametros:
+// - argc. Numero de parametros, incluido el propio nombre de la aplicacion.
+// - argv. Array con los parametros.
+// Devuelve:
+// - 0 si todo ha ido bien y 1 en caso contrario.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+int
+main(int argc,
+	 char* argv[])
+{
+  // Se leen las opciones
+  sOptions Options;
+  if (!ReadOptions(argc, argv, Options)) {
+	WriteHelp();
+	return 1;
+  }
+
+  // Se lee el log del motor?
+  if (!Options.szLogFile.empty()) {
+	return ReadEngineLog(Options.szLogFile, Options.uwTop) ? 0 : 1;
+  }
+
+  // Los registros de los archivos de area usan dword de 32 bits
+  if (sizeof(dword) != 4) {
+	std::cout << "Compilado con dword de " << dword(sizeof(dword) * 8) 
+			  << " bits, los archivos de area necesitan 32 (ver Makefile).\n";
+	return 1;
+  }
+
+  // Se instala el gancho de reservas
+  #ifdef AREALOADBENCH_ALLOC_HOOK
+	_CrtSetAllocHook(AreaLoadBenchAllocHook);
+  #endif
+
+  // Se cargan los archivos, quedandose con la carga mas rapida de cada uno
+  std::vector<sAreaResult> Results;
+  bool bAllOk = true;
+  dword udFileIt = 0;
+  for (; udFileIt < Options.Files.size(); ++udFileIt) {
+	sAreaResult BestResult;
+	bool bLoaded = false;
+	word uwRun = 0;
+	for (; uwRun < Options.uwNumRuns; ++uwRun) {
+	  sAreaResult Result;
+	  std::string szError;
+	  if (!LoadAreaFile(Options.Files[udFileIt], Result, szError)) {
+		std::cout << Options.Files[udFileIt] << ": " << szError << "\n";
+		bAllOk = false;
+		break;
+	  }
+	  if (!bLoaded || Result.udTotalTime < BestResult.udTotalTime) {
+		BestResult = Result;
+		bLoaded = true;
+	  }
+	}
+	if (bLoaded) {
+	  WriteResult(BestResult);
+	  Results.push_back(BestResult);
+	}
+  }
+
+  // Se muestran las areas ordenadas de mas a menos lentas
+  std::sort(Results.begin(), Results.end(), IsSlowerResult);
+  std::cout << "\nAreas mas lentas (mejor de " << Options.uwNumRuns << " cargas):\n";
+  dword udIt = 0;
+  for (; udIt < Results.size() && udIt < Options.uwTop; ++udIt) {
+	const sAreaResult& Result = Results[udIt];
+	byte ubSlowest = 0;
+	byte ubPhase = 1;
+	for (; ubPhase < MAX_PHASES; ++ubPhase) {
+	  if (Result.Phases[ubPhase].udTime > Result.Phases[ubSlowest].udTime) {
+		ubSlowest = ubPhase;
+	  }
+	}
+	std::cout << " | " << Result.szFile << " (area " << Result.uwIDArea << "): "
+			  << Result.udTotalTime << " us, fase mas lenta "
+			  << szPhaseNames[ubSlowest] << " (" << Result.Phases[ubSlowest].udTime
+			  << " us).\n";
+  }
+
+  // Retorna
+  return bAllOk ? 0 : 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee las opciones de la linea de comandos:
+//    * -n <num>. Cargas por archivo, tomandose la mas rapida (por defecto 3).
+//    * -t <num>. Areas a mostrar en la relacion final (por defecto 10).
+//    * -l <fichero>. Lee el log del motor en lugar de cargar archivos.
+//    * Resto de parametros. Archivos de area base a cargar.
+// Parametros:
+// - argc, argv. Parametros recibidos.
+// - Options. Opciones a establecer.
+// Devuelve:
+// - Si las opciones son validas true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+ReadOptions(int argc,
+			char* argv[],
+			sOptions& Options)
+{
+  // Se recorren los parametros
+  sword swIt = 1;
+  for (; swIt < argc; ++swIt) {
+	const std::string szOption(argv[swIt]);
+	if ("-n" == szOption && swIt + 1 < argc) {
+	  Options.uwNumRuns = atoi(argv[++swIt]);
+	} else if ("-t" == szOption && swIt + 1 < argc) {
+	  Options.uwTop = atoi(argv[++swIt]);
+	} else if ("-l" == szOption && swIt + 1 < argc) {
+	  Options.szLogFile = argv[++swIt];
+	} else if (!szOption.empty() && '-' == szOption[0]) {
+	  return false;
+	} else {
+	  Options.Files.push_back(szOption);
+	}
+  }
+
+  // Todo correcto
+  return (Options.uwNumRuns > 0 &&
+		  (!Options.szLogFile.empty() || !Options.Files.empty()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Carga un archivo de area base, midiendo cada una de sus fases.
+// Parametros:
+// - szFile. Archivo de area.
+// - Result. Resultado de la carga.
+// - szError. Descripcion del error, si lo hubiera.
+// Devuelve:
+// - Si se ha podido cargar true. En caso contrario false.
+// Notas:
+// - Se realizaran las mismas comprobaciones que CArea al cargar el area.
+///////////////////////////////////////////////////////////////////////////////
+bool
+LoadAreaFile(const std::string& szFile,
+			 sAreaResult& Result,
+			 std::string& szError)
+{
+  // Se inicializa el resultado
+  Result.szFile = szFile;
+  Result.uwIDArea = 0;
+  Result.ubHVersion = 0;
+  Result.uwWidth = 0;
+  Result.uwHeight = 0;
+  Result.udNumCells = 0;
+  Result.udNumRoofs = 0;
+  Result.udNumEntities = 0;
+  Result.udNumItems = 0;
+  memset(Result.Phases, 0, sizeof(Result.Phases));
+  const sqword sqInitTime = GetTimeNs();
+
+  // Se lee el archivo
+  std::vector<sbyte> Data;
+  sqword sqPhaseTime = GetTimeNs();
+  l_pAllocPhase = &Result.Phases[PHASE_FILE];
+  const bool bReadOk = ReadAreaFile(szFile, Data, Result.Phases[PHASE_FILE]);
+  l_pAllocPhase = NULL;
+  Result.Phases[PHASE_FILE].udTime = dword((GetTimeNs() - sqPhaseTime) / 1000);
+  if (!bReadOk) {
+	szError = "No se pudo leer el archivo.";
+	return false;
+  }
+
+  // Se comprueba la cabecera comun a ambos formatos
+  if (Data.size() < CBDefs::AreaV2HeaderPos ||
+	  Data[0] != CBDefs::CBBAreaBaseFile) {
+	szError = "No es un archivo de area base.";
+	return false;
+  }
+  Result.ubHVersion = Data[1];
+  memcpy(&Result.uwIDArea, &Data[3], sizeof(word));
+
+  // Se convierte a v2 si procede
+  sqPhaseTime = GetTimeNs();
+  if (CBDefs::HVersion == Result.ubHVersion) {
+	l_pAllocPhase = &Result.Phases[PHASE_CONVERT];
+	CAreaFileConverter Converter;
+	std::vector<sbyte> V2Data;
+	const bool bConvertOk = Converter.Convert(&Data[0], Data.size(), V2Data);
+	if (bConvertOk) {
+	  Data.swap(V2Data);
+	}
+	l_pAllocPhase = NULL;
+	if (!bConvertOk) {
+	  szError = "No se pudo convertir a v2: " + Converter.GetError();
+	  return false;
+	}
+  } else if (Result.ubHVersion != CBDefs::AreaV2HVersion) {
+	szError = "Version de archivo no soportada.";
+	return false;
+  }
+  Result.Phases[PHASE_CONVERT].udTime = dword((GetTimeNs() - sqPhaseTime) / 1000);
+
+  // Se recorren y validan las celdas
+  sqPhaseTime = GetTimeNs();
+  l_pAllocPhase = &Result.Phases[PHASE_CELLS];
+  const bool bCellsOk = WalkAreaV2(Data, Result, szError);
+  l_pAllocPhase = NULL;
+  Result.Phases[PHASE_CELLS].udTime = dword((GetTimeNs() - sqPhaseTime) / 1000);
+  if (!bCellsOk) {
+	return false;
+  }
+
+  // Se crean las rejillas
+  sqPhaseTime = GetTimeNs();
+  l_pAllocPhase = &Result.Phases[PHASE_GRIDS];
+  BuildGrids(Data, Result);
+  l_pAllocPhase = NULL;
+  Result.Phases[PHASE_GRIDS].udTime = dword((GetTimeNs() - sqPhaseTime) / 1000);
+
+  // Todo correcto
+  Result.udTotalTime = dword((GetTimeNs() - sqInitTime) / 1000);
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee el archivo completo en bloques de READ_BLOCK_SIZE bytes.
+// Parametros:
+// - szFile. Archivo.
+// - Data. Contenido leido.
+// - Phase. Fase en la que acumular lecturas y bytes leidos.
+// Devuelve:
+// - Si se ha podido leer true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+ReadAreaFile(const std::string& szFile,
+			 std::vector<sbyte>& Data,
+			 sPhaseInfo& Phase)
+{
+  // Se abre el archivo y se obtiene su tamao
+  FILE* const pFile = fopen(szFile.c_str(), "rb");
+  if (!pFile) {
+	return false;
+  }
+  fseek(pFile, 0, SEEK_END);
+  const long lSize = ftell(pFile);
+  fseek(pFile, 0, SEEK_SET);
+  if (lSize <= 0) {
+	fclose(pFile);
+	return false;
+  }
+
+  // Se lee
+  Data.resize(lSize);
+  dword udOffset = 0;
+  while (udOffset < dword(lSize)) {
+	const dword udToRead = std::min(READ_BLOCK_SIZE, dword(lSize) - udOffset);
+	const dword udRead = fread(&Data[udOffset], 1, udToRead, pFile);
+	++Phase.udNumReads;
+	Phase.udBytesRead += udRead;
+	if (udRead != udToRead) {
+	  fclose(pFile);
+	  return false;
+	}
+	udOffset += udRead;
+  }
+
+  // Todo correcto
+  fclose(pFile);
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Localiza las secciones del contenido v2 y recorre todas sus celdas,
+//   comprobando techos, entidades, items y cadenas de cada una de ellas tal
+//   y como lo hace CArea al cargarlas.
+// Parametros:
+// - Data. Contenido v2.
+// - Result. Resultado donde dejar dimensiones y contadores.
+// - szError. Descripcion del error, si lo hubiera.
+// Devuelve:
+// - Si el contenido es valido true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+WalkAreaV2(const std::vector<sbyte>& Data,
+		   sAreaResult& Result,
+		   std::string& szError)
+{
+  // Contenido completo?
+  const dword udSize = Data.size();
+  if (udSize < CBDefs::AreaV2HeaderPos + sizeof(CBDefs::sAreaV2Header)) {
+	szError = "Archivo v2 truncado.";
+	return false;
+  }
+
+  // Se comprueba que las secciones se hallen dentro del fichero
+  const sbyte* const psbData = &Data[0];
+  const CBDefs::sAreaV2Header* const pHeader = (const CBDefs::sAreaV2Header*)(psbData + CBDefs::AreaV2HeaderPos);
+  const dword udRecordSizes[CBDefs::AREAV2_MAX_SECTIONS] = {
+	sizeof(sbyte),
+	sizeof(CBDefs::sAreaV2Cell),
+	sizeof(CBDefs::sAreaV2Roof),
+	sizeof(CBDefs::sAreaV2Entity),
+	sizeof(CBDefs::sAreaV2Item)
+  };
+  byte ubIt = 0;
+  for (; ubIt < CBDefs::AREAV2_MAX_SECTIONS; ++ubIt) {
+	const CBDefs::sAreaV2Section& Section = pHeader->Sections[ubIt];
+	if (Section.udOffset > udSize ||
+		Section.udNumRecords > (udSize - Section.udOffset) / udRecordSizes[ubIt]) {
+	  szError = "Seccion v2 no valida.";
+	  return false;
+	}
+  }
+  const CBDefs::sAreaV2Section* const pSections = pHeader->Sections;
+  const sbyte* const psbStrings = psbData + pSections[CBDefs::AREAV2_STRINGS].udOffset;
+  const dword udStringsSize = pSections[CBDefs::AREAV2_STRINGS].udNumRecords;
+  if (!udStringsSize || psbStrings[udStringsSize - 1] != '\0') {
+	szError = "Seccion de cadenas no valida.";
+	return false;
+  }
+  const CBDefs::sAreaV2Cell* const pCells = (const CBDefs::sAreaV2Cell*)(psbData + pSections[CBDefs::AREAV2_CELLS].udOffset);
+  const CBDefs::sAreaV2Roof* const pRoofs = (const CBDefs::sAreaV2Roof*)(psbData + pSections[CBDefs::AREAV2_ROOFS].udOffset);
+  const CBDefs::sAreaV2Entity* const pEntities = (const CBDefs::sAreaV2Entity*)(psbData + pSections[CBDefs::AREAV2_ENTITIES].udOffset);
+  const CBDefs::sAreaV2Item* const pItems = (const CBDefs::sAreaV2Item*)(psbData + pSections[CBDefs::AREAV2_ITEMS].udOffset);
+  Result.uwWidth = pHeader->uwWidth;
+  Result.uwHeight = pHeader->uwHeight;
+  Result.udNumCells = pSections[CBDefs::AREAV2_CELLS].udNumRecords;
+  Result.udNumRoofs = pSections[CBDefs::AREAV2_ROOFS].udNumRecords;
+  const dword udNumEntities = pSections[CBDefs::AREAV2_ENTITIES].udNumRecords;
+  const dword udNumItems = pSections[CBDefs::AREAV2_ITEMS].udNumRecords;
+  if (pHeader->udName >= udStringsSize) {
+	szError = "Nombre de area no valido.";
+	return false;
+  }
+
+  // Se recorren las celdas, resolviendo las cadenas de perfiles y tags
+  // Nota: La suma de longitudes evita que el recorrido se descarte
+  dword udStringsLenght = 0;
+  dword udCell = 0;
+  for (; udCell < Result.udNumCells; ++udCell) {
+	const CBDefs::sAreaV2Cell& Cell = pCells[udCell];
+	if (Cell.uwXTile >= pHeader->uwWidth ||
+		Cell.uwYTile >= pHeader->uwHeight ||
+		Cell.udFloorProfile >= udStringsSize ||
+		Cell.udFirstEntity > udNumEntities ||
+		Cell.uwNumEntities > udNumEntities - Cell.udFirstEntity ||
+		Cell.udFirstItem > udNumItems ||
+		Cell.uwNumItems > udNumItems - Cell.udFirstItem ||
+		(Cell.udRoof != CBDefs::AreaV2NoRecord && Cell.udRoof >= Result.udNumRoofs)) {
+	  char szCell[64];
+	  sprintf(szCell, "Celda %u no valida.", udCell);
+	  szError = szCell;
+	  return false;
+	}
+	udStringsLenght += strlen(psbStrings + Cell.udFloorProfile);
+	if (Cell.udRoof != CBDefs::AreaV2NoRecord) {
+	  const CBDefs::sAreaV2Roof& Roof = pRoofs[Cell.udRoof];
+	  if (Roof.udProfile >= udStringsSize) {
+		szError = "Techo no valido.";
+		return false;
+	  }
+	  udStringsLenght += strlen(psbStrings + Roof.udProfile);
+	}
+	dword udIt = Cell.udFirstEntity;
+	for (; udIt < Cell.udFirstEntity + Cell.uwNumEntities; ++udIt) {
+	  const CBDefs::sAreaV2Entity& Entity = pEntities[udIt];
+	  if (Entity.udProfile >= udStringsSize ||
+		  Entity.udTag >= udStringsSize ||
+		  Entity.udFirstItem > udNumItems ||
+		  Entity.uwNumItems > udNumItems - Entity.udFirstItem ||
+		  Entity.ubType < CBDefs::AREAV2_SCENE_OBJ ||
+		  Entity.ubType > CBDefs::AREAV2_WALL) {
+		szError = "Entidad no valida.";
+		return false;
+	  }
+	  udStringsLenght += strlen(psbStrings + Entity.udProfile);
+	  udStringsLenght += strlen(psbStrings + Entity.udTag);
+	  Result.udNumItems += Entity.uwNumItems;
+	}
+	Result.udNumEntities += Cell.uwNumEntities;
+	Result.udNumItems += Cell.uwNumItems;
+  }
+
+  // Se recorren los items referidos
+  dword udIt = 0;
+  for (; udIt < udNumItems; ++udIt) {
+	const CBDefs::sAreaV2Item& Item = pItems[udIt];
+	if (Item.udProfile >= udStringsSize || Item.udTag >= udStringsSize) {
+	  szError = "Item no valido.";
+	  return false;
+	}
+	udStringsLenght += strlen(psbStrings + Item.udProfile);
+	udStringsLenght += strlen(psbStrings + Item.udTag);
+  }
+
+  // Todo correcto
+  return (udStringsLenght != 0xFFFFFFFF);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Crea las rejillas del mapa (floors, elevaciones, techos y habitaciones)
+//   con las mismas dimensiones que CArea, rellenandolas desde las celdas.
+// Parametros:
+// - Data. Contenido v2 ya validado.
+// - Result. Resultado con las dimensiones del area.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+BuildGrids(const std::vector<sbyte>& Data,
+		   const sAreaResult& Result)
+{
+  // Se crean las rejillas
+  const dword udSize = dword(Result.uwWidth) * dword(Result.uwHeight);
+  std::vector<dword> FloorGrid(udSize, 0);
+  std::vector<word> ElevationGrid(udSize, 0);
+  std::vector<dword> RoofGrid(udSize, CBDefs::AreaV2NoRecord);
+  std::vector<word> RoomGrid(udSize, 0);
+
+  // Se rellenan desde las celdas
+  const sbyte* const psbData = &Data[0];
+  const CBDefs::sAreaV2Header* const pHeader = (const CBDefs::sAreaV2Header*)(psbData + CBDefs::AreaV2HeaderPos);
+  const CBDefs::sAreaV2Cell* const pCells = (const CBDefs::sAreaV2Cell*)(psbData + pHeader->Sections[CBDefs::AREAV2_CELLS].udOffset);
+  dword udCell = 0;
+  for (; udCell < Result.udNumCells; ++udCell) {
+	const CBDefs::sAreaV2Cell& Cell = pCells[udCell];
+	const dword udTileIdx = dword(Cell.uwYTile) * Result.uwWidth + Cell.uwXTile;
+	FloorGrid[udTileIdx] = Cell.udFloorProfile;
+	ElevationGrid[udTileIdx] = Cell.Elevation;
+	RoofGrid[udTileIdx] = Cell.udRoof;
+	RoomGrid[udTileIdx] = Cell.Room;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Muestra el resultado de la carga de un archivo, en formato legible y en
+//   una linea con los campos separados por ';'.
+// Parametros:
+// - Result. Resultado de la carga.
+// Devuelve:
+// Notas:
+// - La linea tendra el formato:
+//   AREALOADBENCH;Archivo;Area;Version;Ancho;Alto;Celdas;Total;<Tiempo;
+//   Bytes;Lecturas;Reservas;BytesReservados> por cada fase, con las
+//   reservas a "-" si no se pueden contar.
+///////////////////////////////////////////////////////////////////////////////
+void
+WriteResult(const sAreaResult& Result)
+{
+  // Informe legible
+  std::cout << Result.szFile << ": area " << Result.uwIDArea
+			<< " v" << dword(Result.ubHVersion) << ", " << Result.uwWidth
+			<< "x" << Result.uwHeight << ", " << Result.udNumCells << " celdas, "
+			<< Result.udNumRoofs << " techos, " << Result.udNumEntities << " entidades, "
+			<< Result.udNumItems << " items, total " << Result.udTotalTime << " us.\n";
+  byte ubIt = 0;
+  for (; ubIt < MAX_PHASES; ++ubIt) {
+	const sPhaseInfo& Phase = Result.Phases[ubIt];
+	char szLine[256];
+	sprintf(szLine, " | %-12s %8u us, %8u bytes en %6u lecturas",
+			szPhaseNames[ubIt], Phase.udTime, Phase.udBytesRead, Phase.udNumReads);
+	std::cout << szLine;
+	#ifdef AREALOADBENCH_ALLOC_HOOK
+	  std::cout << ", " << Phase.udNumAllocs << " reservas ("
+				<< Phase.udAllocSize << " bytes)";
+	#endif
+	std::cout << ".\n";
+  }
+
+  // Linea para herramientas
+  std::cout << "AREALOADBENCH;" << Result.szFile << ";" << Result.uwIDArea << ";"
+			<< dword(Result.ubHVersion) << ";" << Result.uwWidth << ";"
+			<< Result.uwHeight << ";" << Result.udNumCells << ";" << Result.udTotalTime;
+  for (ubIt = 0; ubIt < MAX_PHASES; ++ubIt) {
+	const sPhaseInfo& Phase = Result.Phases[ubIt];
+	std::cout << ";" << Phase.udTime << ";" << Phase.udBytesRead << ";" << Phase.udNumReads;
+	#ifdef AREALOADBENCH_ALLOC_HOOK
+	  std::cout << ";" << Phase.udNumAllocs << ";" << Phase.udAllocSize;
+	#else
+	  std::cout << ";-;-";
+	#endif
+  }
+  std::cout << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee las lineas "AREALOAD;" de un log del motor y muestra las areas cuya
+//   carga es mas lenta de media, junto a la fase que mas tiempo ocupa.
+// Parametros:
+// - szLogFile. Log del motor.
+// - uwTop. Areas a mostrar.
+// Devuelve:
+// - Si se ha podido leer el log y contenia al menos un cambio de area true.
+//   En caso contrario false.
+// Notas:
+// - El formato de las lineas sera el escrito por CAreaLoadProfiler. Las
+//   lineas incompletas se descartaran.
+///////////////////////////////////////////////////////////////////////////////
+bool
+ReadEngineLog(const std::string& szLogFile,
+			  const word uwTop)
+{
+  // Se abre el log
+  std::ifstream LogFile(szLogFile.c_str());
+  if (!LogFile) {
+	std::cout << "No se pudo abrir " << szLogFile << ".\n";
+	return false;
+  }
+
+  // Se leen los cambios de area
+  // Nota: Cada fase tiene 7 campos, el primero de ellos el tiempo
+  const dword udNumFields = 3 + MAX_ENGINE_PHASES * 7;
+  std::map<word, sLogAreaInfo> Areas;
+  dword udNumLoads = 0;
+  dword udNumDiscarded = 0;
+  std::string szLine;
+  while (std::getline(LogFile, szLine)) {
+	// Linea del perfilador?
+	if (szLine.compare(0, 9, "AREALOAD;") != 0) {
+	  continue;
+	}
+
+	// Se toman los campos
+	std::vector<dword> Fields;
+	std::string::size_type Pos = 9;
+	while (Pos <= szLine.size()) {
+	  std::string::size_type End = szLine.find(';', Pos);
+	  if (std::string::npos == End) {
+		End = szLine.size();
+	  }
+	  Fields.push_back(strtoul(szLine.substr(Pos, End - Pos).c_str(), NULL, 10));
+	  Pos = End + 1;
+	}
+	if (Fields.size() != udNumFields) {
+	  ++udNumDiscarded;
+	  continue;
+	}
+
+	// Se acumulan en el area cargada
+	const word uwToArea = word(Fields[1]);
+	std::map<word, sLogAreaInfo>::iterator It(Areas.find(uwToArea));
+	if (It == Areas.end()) {
+	  sLogAreaInfo Info;
+	  memset(&Info, 0, sizeof(sLogAreaInfo));
+	  It = Areas.insert(std::map<word, sLogAreaInfo>::value_type(uwToArea, Info)).first;
+	}
+	sLogAreaInfo& Info = It->second;
+	++Info.udNumLoads;
+	Info.dTotalTime += Fields[2];
+	if (Fields[2] > Info.udMaxTime) {
+	  Info.udMaxTime = Fields[2];
+	}
+	byte ubIt = 0;
+	for (; ubIt < MAX_ENGINE_PHASES; ++ubIt) {
+	  Info.dPhaseTime[ubIt] += Fields[3 + ubIt * 7];
+	}
+	++udNumLoads;
+  }
+  std::cout << szLogFile << ": " << udNumLoads << " cambios de area hacia "
+			<< Areas.size() << " areas";
+  if (udNumDiscarded) {
+	std::cout << ", " << udNumDiscarded << " lineas descartadas";
+  }
+  std::cout << ".\n";
+  if (!udNumLoads) {
+	return false;
+  }
+
+  // Se ordenan por tiempo medio, de mayor a menor
+  std::vector<std::pair<double, word> > Order;
+  std::map<word, sLogAreaInfo>::const_iterator It(Areas.begin());
+  for (; It != Areas.end(); ++It) {
+	Order.push_back(std::make_pair(-(It->second.dTotalTime / It->second.udNumLoads), It->first));
+  }
+  std::sort(Order.begin(), Order.end());
+
+  // Se muestran
+  std::cout << "\nAreas mas lentas (tiempo medio por cambio de area):\n";
+  dword udIt = 0;
+  for (; udIt < Order.size() && udIt < uwTop; ++udIt) {
+	const sLogAreaInfo& Info = Areas[Order[udIt].second];
+	byte ubSlowest = 0;
+	byte ubPhase = 1;
+	for (; ubPhase < MAX_ENGINE_PHASES; ++ubPhase) {
+	  if (Info.dPhaseTime[ubPhase] > Info.dPhaseTime[ubSlowest]) {
+		ubSlowest = ubPhase;
+	  }
+	}
+	std::cout << " | Area " << Order[udIt].second << ": "
+			  << dword(Info.dTotalTime / Info.udNumLoads) << " us de media, maximo "
+			  << Info.udMaxTime << " us en " << Info.udNumLoads << " cargas, fase mas lenta "
+			  << szEnginePhaseNames[ubSlowest] << " ("
+			  << dword(Info.dPhaseTime[ubSlowest] / Info.udNumLoads) << " us de media).\n";
+  }
+
+  // Todo correcto
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el tiempo actual en nanosegundos, para medir intervalos.
+// Parametros:
+// Devuelve:
+// - Tiempo actual en nanosegundos.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+sqword
+GetTimeNs(void)
+{
+  #ifdef _WIN32
+	LARGE_INTEGER Freq;
+	LARGE_INTEGER Count;
+	QueryPerformanceFrequency(&Freq);
+	QueryPerformanceCounter(&Count);
+	return sqword((double(Count.QuadPart) * 1000000000.0) / double(Freq.QuadPart));
+  #else
+	timespec Time;
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+	return sqword(Time.tv_sec) * 1000000000 + Time.tv_nsec;
+  #endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Muestra la ayuda.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+WriteHelp(void)
+{
+  std::cout << "\nAreaLoadBench [-n <num>] [-t <num>] <archivo de area> [...]\n"
+			<< "AreaLoadBench -l <log del motor> [-t <num>]\n"
+			<< "  -n  Cargas por archivo, se toma la mas rapida (por defecto 3).\n"
+			<< "  -t  Areas a mostrar en la relacion de las mas lentas (por defecto 10).\n"
+			<< "  -l  Lee las lineas AREALOAD del log de un motor compilado con\n"
+			<< "      AREA_LOAD_PROFILE en lugar de cargar archivos.\n";
+}
@@ -35,7 +35,11 @@
 #include "iCGameDataBase.h"
 #include "iCEntitySelector.h"
 #include "iCMathUtil.h"
+#include "iCTimer.h"
+#include "iCVirtualMachine.h"
 #include "CrisolBuilder\\CBDefs.h"
+#include "CrisolBuilder\\CAreaFileConverter.h"
+#include "CAreaLoadProfiler.h"
 #include "CEntity.h"
 #include "CItemContainerIt.h"
 #include <algorithm>
@@ -72,6 +76,9 @@ CArea::sNWall::m_MPool(64, sizeof(CArea::sNWall), true);
 CMemoryPool 
 CArea::sNRoof::m_MPool(64, sizeof(CArea::sNRoof), true);
 
+// Bloque de celdas vacio compartido
+CArea::sCellChunk CArea::m_EmptyCellChunk;
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Inicializa la instancia.
@@ -272,13 +279,8 @@ CArea::CriatureObserverNotify(const AreaDefs::EntHandle& hCriature,
 		  // ser recogido por la criatura.
 		  const GraphDefs::Light Light = GetLight(hItem);
 		  if (Light > 0) {
-			// Antes de poder remover la informacion luminosa, debemos de
-			// actualizar sus datos, pues su posicion original sera SEGURO la
-			// posicion que tenga su dueo.
-			LightFocusInfoMapIt FocusIt(m_DinamicLightInfo.LightFocus.find(hItem));
-			CItem* const pItem = GetItem(hItem);
-			ASSERT(pItem);
-			FocusIt->second.TilePos = pItem->GetTilePos();
+			// Nota: La luz se quitara de la region registrada en el foco, que
+			// sera la asociada a la posicion de su dueo.
 			RemoveLight(hItem, true);
 		  }
 		} break;
@@ -363,7 +365,26 @@ CArea::FreeAreaInfo(const bool bRemovePlayerInfo)
   m_bInFreeAreaMode = true;
   
   // Libera informacion sobre tags
-  m_EntityTags.clear();
+  // Nota: Si se conserva la info del jugador, se mantendran los tags de los
+  // items que posea, eliminando el resto a medida que se liberen entidades
+  if (bRemovePlayerInfo) {
+	m_EntityTags.Clear();
+  }
+
+  // Se libera informacion luminosa
+  // Nota: Las luces del jugador y sus items, si se conservan, habran sido
+  // desvinculadas previamente
+  #ifdef LIGHTING_PROFILE
+	LightFocusInfoMapIt FocusIt(m_DinamicLightInfo.LightFocus.begin());
+	for (; FocusIt != m_DinamicLightInfo.LightFocus.end(); ++FocusIt) {
+	  WriteLightFocusProfile(FocusIt->first, FocusIt->second);
+	}
+  #endif
+  m_DinamicLightInfo.LightFocus.clear();
+  if (m_DinamicLightInfo.pTileLight) {
+	delete[] m_DinamicLightInfo.pTileLight;
+	m_DinamicLightInfo.pTileLight = NULL;
+  }
 
   // Se libera informacion sobre habitaciones
   m_Map.RoomInfo.clear();
@@ -371,27 +392,40 @@ CArea::FreeAreaInfo(const bool bRemovePlayerInfo)
   // Se libera informacion sobre techos que muestran lo que tienen por debajo
   m_Map.ShowUnderRoofs.clear();
 
-  // Se libera informacion sobre mascaras de acceso
+  // Se libera informacion sobre mascaras de acceso y conectividad
   m_Map.IndexOfMaskTileAccess.clear();
+  if (m_Map.pAccessGrid) {
+	delete[] m_Map.pAccessGrid;
+	m_Map.pAccessGrid = NULL;
+  }
+  ReleaseConnectivity();
+
+  // Se libera la rejilla espacial de criaturas
+  m_CriatureGrid.End();
 
   // Se liberan entidades / criaturas		
   // Nota: en la liberacion, se debera de desvincular el area como observer
-  CriaturesIt ItCriature(m_Map.Criatures.begin());
-  for (; ItCriature != m_Map.Criatures.end(); ItCriature = m_Map.Criatures.erase(ItCriature)) {
-    ItCriature->second->Criature.RemoveObserver(this);
-    delete ItCriature->second;
+  // Nota: Las tablas se vaciaran desde el final, para evitar recolocaciones
+  while (m_Map.Criatures.GetSize()) {
+	sNCriature* const pNCriature = m_Map.Criatures.Remove(m_Map.Criatures.GetHandleAt(m_Map.Criatures.GetSize() - 1));
+	ASSERT(pNCriature);
+    pNCriature->Criature.RemoveObserver(this);
+    m_EntityTags.Remove(pNCriature->Criature.GetHandle());
+    delete pNCriature;
   }	
 
   // Se liberan entidades / objetos de escenario
-  SObjsIt ItSObj(m_Map.SceneObjs.begin());
-  for (; ItSObj != m_Map.SceneObjs.end(); ItSObj = m_Map.SceneObjs.erase(ItSObj)) {
-    delete ItSObj->second;	  
+  while (m_Map.SceneObjs.GetSize()) {
+	const AreaDefs::EntHandle hSceneObj = m_Map.SceneObjs.GetHandleAt(m_Map.SceneObjs.GetSize() - 1);
+    m_EntityTags.Remove(hSceneObj);
+    delete m_Map.SceneObjs.Remove(hSceneObj);
   }	
 
   // Se liberan entidades / paredes
-  WallsIt ItWall(m_Map.Walls.begin());
-  for (; ItWall != m_Map.Walls.end(); ItWall = m_Map.Walls.erase(ItWall)) { 
-    delete ItWall->second; 	  
+  while (m_Map.Walls.GetSize()) {
+	const AreaDefs::EntHandle hWall = m_Map.Walls.GetHandleAt(m_Map.Walls.GetSize() - 1);
+    m_EntityTags.Remove(hWall);
+    delete m_Map.Walls.Remove(hWall);
   }
 
   // Se liberan entidades / items
@@ -402,44 +436,70 @@ CArea::FreeAreaInfo(const bool bRemovePlayerInfo)
 	  ASSERT(m_PlayerInfo.pPlayer);
 	}
   #endif
-  ItemsIt ItItem(m_Map.Items.begin());
-  while (ItItem != m_Map.Items.end()) {
+  // Nota: Al extraer un item, su posicion la ocupara el ultimo de la tabla,
+  // por lo que se recorrera desde el final
+  word uwItemPos = m_Map.Items.GetSize();
+  while (uwItemPos > 0) {
+	--uwItemPos;
+	const AreaDefs::EntHandle hItem = m_Map.Items.GetHandleAt(uwItemPos);
     // NO se desea eliminar la info asociada al jugador?
     if (!bRemovePlayerInfo) {
 	  // Si, Item en inventario o equipado?
-	  if (m_PlayerInfo.pPlayer->GetItemContainer()->IsItemIn(ItItem->first) ||
-		  m_PlayerInfo.pPlayer->GetEquipmentSlots()->IsItemEquiped(ItItem->first)) {
+	  if (m_PlayerInfo.pPlayer->GetItemContainer()->IsItemIn(hItem) ||
+		  m_PlayerInfo.pPlayer->GetEquipmentSlots()->IsItemEquiped(hItem)) {
   		// Si, luego se pasa a sig. item
-		++ItItem;
 		continue;
 	  }
 	}
 	
     // Se desea eliminar info del jugador o bien el item no se halla
 	// ni en el inventario ni en los slots de equipamiento del jugador
-    delete ItItem->second;
-    ItItem = m_Map.Items.erase(ItItem);			  	  
+    m_EntityTags.Remove(hItem);
+    delete m_Map.Items.Remove(hItem);
   }	
 
   // Se liberan entidades / techos
-  RoofsMapIt RoofsIt(m_Map.Roofs.begin());
-  for (; RoofsIt != m_Map.Roofs.end(); RoofsIt = m_Map.Roofs.erase(RoofsIt)) {
-    delete RoofsIt->second;
-  }
-
-  // Se libera el mapa de celdas
-  const dword udSize = m_Map.uwWidth * m_Map.uwHeight;	
-  AreaDefs::TileIndex Index = 0;
-  for (; Index < udSize; Index++) {	
-    if (m_Map.pMap[Index]) {
-  	  delete m_Map.pMap[Index];
-  	  m_Map.pMap[Index] = NULL;
-	}	  
-  }  
+  while (m_Map.Roofs.GetSize()) {
+    delete m_Map.Roofs.Remove(m_Map.Roofs.GetHandleAt(m_Map.Roofs.GetSize() - 1));
+  }
+
+  // Se liberan los bloques de celdas
+  ReleaseCellChunks();
+
+  // Se borra la rejilla de techos
+  if (m_Map.pRoofGrid) {
+	delete[] m_Map.pRoofGrid;
+	m_Map.pRoofGrid = NULL;
+  }
+
+  // Se borran las rejillas de floors
+  if (m_Map.ppFloorGrid) {
+	delete[] m_Map.ppFloorGrid;
+	m_Map.ppFloorGrid = NULL;
+  }
+  if (m_Map.pElevationGrid) {
+	delete[] m_Map.pElevationGrid;
+	m_Map.pElevationGrid = NULL;
+  }
+  if (m_Map.pFloorFlagsGrid) {
+	delete[] m_Map.pFloorFlagsGrid;
+	m_Map.pFloorFlagsGrid = NULL;
+  }
+
+  // Se borran las rejillas de habitaciones y cubiertas
+  if (m_Map.pRoomGrid) {
+	delete[] m_Map.pRoomGrid;
+	m_Map.pRoomGrid = NULL;
+  }
+  if (m_Map.pCoverGrid) {
+	delete[] m_Map.pCoverGrid;
+	m_Map.pCoverGrid = NULL;
+  }
+  m_Map.UncoveredBits.clear();
 
-  // Se borra el mapa base
-  delete[udSize] m_Map.pMap;
-  m_Map.pMap = NULL;
+  // Se descartan las firmas de las celdas
+  m_Map.CellSignatures.clear();
+  m_Map.udBaseFileSize = 0;
 
   // Se bajan flags
   m_bIsAreaLoaded = false;   
@@ -449,6 +509,9 @@ CArea::FreeAreaInfo(const bool bRemovePlayerInfo)
 //////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Guarda los datos del area actual a su archivo tmp correspondiente.
+// - Si el archivo de area base es v2, solo se guardaran las celdas que
+//   hayan cambiado respecto a como se cargaron de este (formato delta). En
+//   otro caso, se guardaran todas las celdas.
 // Parametros:
 // - bIsChangingArea. Indica si se esta guardando el area por un cambio
 //   o no (por una simple accion de guardar).
@@ -469,135 +532,253 @@ CArea::SaveAreaInfo(const bool bIsChangingArea)
   hFile = m_pFileSys->Open(szFileName, true);
   ASSERT(hFile);
 
+  // Se dispone de las firmas de las celdas del archivo de area base?
+  if (!m_Map.CellSignatures.empty()) {
+	// Si, se guardan solo las celdas modificadas
+	SaveAreaDelta(hFile, udOffset, bIsChangingArea);
+	m_pFileSys->Close(hFile);
+	return;
+  }
+
   // Se guardan los datos de cabecera: tipo de fichero / version / codigo de area
   udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&CBDefs::CBBAreaTmpFile), sizeof(byte));
   udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&CBDefs::HVersion), sizeof(byte));
   udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&CBDefs::LVersion), sizeof(byte));
   udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&m_Map.uwID), sizeof(word));  
 
-  // Se libera informacion en el mismo sentido en que esta es cargada
+  // Se guardan todas las celdas en el mismo sentido en que son cargadas
   AreaDefs::sTilePos TileIt;
   TileIt.YTile = 0;
   for (; TileIt.YTile < m_Map.uwHeight; ++TileIt.YTile) {
 	TileIt.XTile = 0;
 	for (; TileIt.XTile < m_Map.uwWidth; ++TileIt.XTile) {	
-	  // Array de flags
-	  bool bInfoFlags[] = {
-		false, // Floor
-		false, // Roofs
-		false, // Scene objs.
-		false, // Criatures
-		false  // Walls
-	  };
-
-	  // Obtenemos el tile index
-	  const AreaDefs::TileIndex TileIndex = GetTileIdx(TileIt); 
-
-	  // Guardamos offset actual y escribimos flags de info temporales
-	  const dword udFlagsOffset = udOffset;
-	  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)bInfoFlags, sizeof(bool) * 5);
-
-	  // Existe floor asociado?
-	  if (m_Map.pMap[TileIndex]) {
-		// Se establece el flag
-		bInfoFlags[0] = true;
-
-		// Se recorre la lista de entidades y se guarda en otras su contenido 
-		// segun tipo: Item / Scene obj / criature / wall
-		CellEntitiesList Entities[4];
-		CellEntitiesListIt It(m_Map.pMap[TileIndex]->Entities.begin());		
-		for (; It != m_Map.pMap[TileIndex]->Entities.end(); ++It) {
-		  switch(GetEntityType(*It)) {
-			case RulesDefs::ITEM: {
-			  Entities[0].push_back(*It);
-			} break;
-
-			case RulesDefs::SCENE_OBJ: {
-			  Entities[1].push_back(*It);
-			} break;
-
-			case RulesDefs::CRIATURE: {
-			  Entities[2].push_back(*It);
-			} break;
-
-			case RulesDefs::WALL: {
-			  Entities[3].push_back(*It);
-			} break;
-		  }; // ~ switch
-		}		
-
-		// Almacena datos de CFloor
-		// Nota: En CFloor es donde mas almacenamientos no implementados en
-		// la instancia insteresada existiran.
-		// Datos basicos SIN mascara
-		m_Map.pMap[TileIndex]->Floor.Save(hFile, udOffset);
-		
-		// Guarda la mascara de acceso al CFloor
-		bool bAccessFlags[8];
-		const AreaDefs::MaskTileAccess Mask = GetMaskFloorAccess(TileIt);
-		byte ubIt = 0;
-		for (; ubIt < IsoDefs::MAX_DIRECTIONS; ++ubIt) {
-		  // Se establece flag de obstaculizacion segun orientaciona actual
-		  // Nota: Las orientaciones Norte = 0, ... , Noroeste = 7
-		  bAccessFlags[ubIt] = (Mask & (IsoDefs::NORTH_FLAG << ubIt)) ? true : false;
-		} 
-		udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(bAccessFlags), sizeof(bool) * 8);
-		// Elevacion
-		const RulesDefs::Elevation Elevation = m_Map.pMap[TileIndex]->Floor.GetElevation();
-		udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&Elevation), sizeof(RulesDefs::Elevation));
-		// Numero de items sobre el floor
-		if (!SaveEntitiesInfo(hFile, udOffset, Entities[0], bIsChangingArea)) {
-		  // En el caso de no hallarse entidades se indicara que hay 0 entidades
-		  // pues el metodo SaveEntitiesInfo no guarda informacion si no la hay
-		  const word uwNumItems = 0;
-		  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&uwNumItems), sizeof(word));
-		}
+	  SaveCellInfo(hFile, udOffset, TileIt, bIsChangingArea);
+	}
+  }
 
-		// Se guarda el identificador de habitacion
-		AreaDefs::RoomID Room = 0;	  
-		RoomInfoMapIt RoomInfoIt(m_Map.RoomInfo.begin());
-		for (; RoomInfoIt != m_Map.RoomInfo.end(); ++RoomInfoIt) {
-		  const CellsInRoomSetIt CellIt(RoomInfoIt->second.Cells.find(TileIndex));
-		  if (CellIt != RoomInfoIt->second.Cells.end()) {
-			Room = RoomInfoIt->first;
-			break;
-		  }
-		}		
-		udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&Room), sizeof(AreaDefs::RoomID));
+  // Se cierra el archivo
+  m_pFileSys->Close(hFile);
+} 
 
-		// Existe info asociada a techo?
-		if (m_Map.pMap[TileIndex]->hRoof) {		  
-		  // Si, se guarda su informacion
-		  CRoof* const pRoof = GetRoof(m_Map.pMap[TileIndex]->hRoof);
-		  pRoof->Save(hFile, udOffset);
+//////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Guarda el area actual en formato delta, escribiendo solo las celdas
+//   cuyo contenido difiera del que tenian al cargarse del archivo base.
+// Parametros:
+// - hFile. Handle al fichero temporal, vacio.
+// - udOffset. Offset donde depositar los datos.
+// - bIsChangingArea. Indica si se esta guardando el area por un cambio.
+// Devuelve:
+// Notas:
+// - Cada celda se serializara sobre un fichero residente en memoria para
+//   calcular su firma, copiandose al fichero temporal solo si ha cambiado.
+//   Asi, los bytes escritos dependeran de lo modificado y no del tamao
+//   del area.
+// - El tiempo de guardado, sin embargo, NO se reduce: no hay registro de
+//   las entidades modificadas, por lo que en cada guardado se serializaran
+//   y firmaran todas las celdas con contenido, siendo proporcional al
+//   tamao del area como en el guardado completo. Los cambios se registran
+//   por celda (TileIndex) y no por entidad.
+// - Para mas informacion sobre el formato, consultar CBDefs.h.
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::SaveAreaDelta(const FileDefs::FileHandle& hFile,
+					 dword& udOffset,
+					 const bool bIsChangingArea)
+{
+  // SOLO si parametros validos
+  ASSERT(hFile);
+  ASSERT((m_Map.CellSignatures.size() == m_Map.uwWidth * m_Map.uwHeight) != 0);
 
-		  // Se guarda flag indicativo de muestra de lo que hay por debajo
-		  const ShowUnderRoofsSetIt UnderRoofIt(m_Map.ShowUnderRoofs.find(m_Map.pMap[TileIndex]->hRoof));
-		  bool bFlag = (UnderRoofIt != m_Map.ShowUnderRoofs.end()) ? true : false;
-		  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&bFlag), sizeof(bool));
+  // Cabecera: tipo de fichero / version / codigo de area / archivo base
+  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&CBDefs::CBBAreaTmpFile), sizeof(byte));
+  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&CBDefs::AreaTmpDeltaHVersion), sizeof(byte));
+  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&CBDefs::LVersion), sizeof(byte));
+  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&m_Map.uwID), sizeof(word));  
+  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&m_Map.udBaseFileSize), sizeof(dword));  
+  const dword udNumCellsOffset = udOffset;
+  word uwNumCells = 0;
+  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&uwNumCells), sizeof(word));  
+
+  // Se prepara el fichero en memoria sobre el que serializar las celdas
+  std::string szScratchFile;
+  SYSEngine::PassToString(szScratchFile, "tmp\\Area%ucell.tmp", m_Map.uwID);
+  m_pFileSys->CreateMemFile(szScratchFile);
+  const FileDefs::FileHandle hScratchFile = m_pFileSys->Open(szScratchFile, true);
+  ASSERT(hScratchFile);
+
+  // Se recorren las celdas con contenido
+  AreaDefs::sTilePos TileIt;
+  TileIt.YTile = 0;
+  for (; TileIt.YTile < m_Map.uwHeight; ++TileIt.YTile) {
+	TileIt.XTile = 0;
+	for (; TileIt.XTile < m_Map.uwWidth; ++TileIt.XTile) {	
+	  // Celda sin contenido?
+	  const AreaDefs::TileIndex TileIndex = GetTileIdx(TileIt);
+	  if (!IsCellIndexWithContent(TileIndex)) {
+		continue;
+	  }
 
-		  // Se establece el flag
-		  bInfoFlags[1] = true;
-		}
+	  // Se serializa y se compara su firma con la del archivo base
+	  sCellSignature Signature;
+	  const sbyte* const psbData = SaveCellToScratch(hScratchFile, 
+													 szScratchFile, 
+													 TileIt, 
+													 bIsChangingArea, 
+													 Signature);
+	  const sCellSignature& BaseSignature = m_Map.CellSignatures[TileIndex];
+	  if (BaseSignature.udSize &&
+		  BaseSignature.udSize == Signature.udSize &&
+		  BaseSignature.udHash == Signature.udHash) {
+		// Sin cambios, se tomara del archivo base
+		continue;
+	  }
 
-		// Objetos de escenario
-		bInfoFlags[2] = SaveEntitiesInfo(hFile, udOffset, Entities[1], bIsChangingArea);
-		
-		// Criaturas
-		bInfoFlags[3] = SaveEntitiesInfo(hFile, udOffset, Entities[2], bIsChangingArea);
-		
-		// Paredes
-		bInfoFlags[4] = SaveEntitiesInfo(hFile, udOffset, Entities[3], bIsChangingArea);
-		
-		// Se guardan datos relativos al array de offsets
-		m_pFileSys->Write(hFile, udFlagsOffset, (sbyte *)(bInfoFlags), sizeof(bool) * 5);
-	  }	  
+	  // Se guarda el indice de la celda y su contenido
+	  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&TileIndex), sizeof(AreaDefs::TileIndex));
+	  udOffset += m_pFileSys->Write(hFile, udOffset, psbData, Signature.udSize);
+	  ++uwNumCells;
 	}
   }
 
-  // Se cierra el archivo
-  m_pFileSys->Close(hFile);
-} 
+  // Se libera el fichero en memoria
+  m_pFileSys->Close(hScratchFile);
+  m_pFileSys->ReleaseMemFile(szScratchFile);
+
+  // Se escribe el numero de celdas guardadas
+  m_pFileSys->Write(hFile, udNumCellsOffset, (sbyte *)(&uwNumCells), sizeof(word));
+  #ifdef ENGINE_TRACE
+	SYSEngine::GetLogger()->Write("CArea::SaveAreaDelta> rea %u: %u celdas modificadas (%u bytes).\n", 
+								  m_Map.uwID, uwNumCells, udOffset);
+  #endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Guarda los datos de una celda en el formato de los ficheros temporales:
+//   flags de las secciones presentes seguidos de los datos de cada seccion.
+// Parametros:
+// - hFile. Handle al archivo donde guardar los datos.
+// - udOffset. Offset donde depositar los datos.
+// - TilePos. Posicion de la celda.
+// - bIsChangingArea. Indica si se esta guardando el area por un cambio.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::SaveCellInfo(const FileDefs::FileHandle& hFile,
+					dword& udOffset,
+					const AreaDefs::sTilePos& TilePos,
+					const bool bIsChangingArea)
+{
+  // SOLO si parametros validos
+  ASSERT(hFile);
+
+  // Array de flags
+  bool bInfoFlags[] = {
+	false, // Floor
+	false, // Roofs
+	false, // Scene objs.
+	false, // Criatures
+	false  // Walls
+  };
+
+  // Obtenemos el tile index
+  const AreaDefs::TileIndex TileIndex = GetTileIdx(TilePos); 
+
+  // Guardamos offset actual y escribimos flags de info temporales
+  const dword udFlagsOffset = udOffset;
+  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)bInfoFlags, sizeof(bool) * 5);
+
+  // Existe floor asociado?
+  sNCell* const pCell = GetCell(TileIndex);
+  if (pCell) {
+	// Se establece el flag
+	bInfoFlags[0] = true;
+
+	// Se recorre la lista de entidades y se guarda en otras su contenido 
+	// segun tipo: Item / Scene obj / criature / wall
+	CellEntitiesList Entities[4];
+	CellEntitiesListIt It(pCell->Entities.begin());		
+	for (; It != pCell->Entities.end(); ++It) {
+	  switch(GetEntityType(*It)) {
+		case RulesDefs::ITEM: {
+		  Entities[0].push_back(*It);
+		} break;
+
+		case RulesDefs::SCENE_OBJ: {
+		  Entities[1].push_back(*It);
+		} break;
+
+		case RulesDefs::CRIATURE: {
+		  Entities[2].push_back(*It);
+		} break;
+
+		case RulesDefs::WALL: {
+		  Entities[3].push_back(*It);
+		} break;
+	  }; // ~ switch
+	}		
+
+	// Almacena datos de CFloor
+	// Nota: En CFloor es donde mas almacenamientos no implementados en
+	// la instancia insteresada existiran.
+	// Datos basicos SIN mascara
+	pCell->Floor.Save(hFile, udOffset);
+
+	// Guarda la mascara de acceso al CFloor
+	bool bAccessFlags[8];
+	const AreaDefs::MaskTileAccess Mask = GetMaskFloorAccess(TilePos);
+	byte ubIt = 0;
+	for (; ubIt < IsoDefs::MAX_DIRECTIONS; ++ubIt) {
+	  // Se establece flag de obstaculizacion segun orientaciona actual
+	  // Nota: Las orientaciones Norte = 0, ... , Noroeste = 7
+	  bAccessFlags[ubIt] = (Mask & (IsoDefs::NORTH_FLAG << ubIt)) ? true : false;
+	} 
+	udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(bAccessFlags), sizeof(bool) * 8);
+	// Elevacion
+	const RulesDefs::Elevation Elevation = pCell->Floor.GetElevation();
+	udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&Elevation), sizeof(RulesDefs::Elevation));
+	// Numero de items sobre el floor
+	if (!SaveEntitiesInfo(hFile, udOffset, Entities[0], bIsChangingArea)) {
+	  // En el caso de no hallarse entidades se indicara que hay 0 entidades
+	  // pues el metodo SaveEntitiesInfo no guarda informacion si no la hay
+	  const word uwNumItems = 0;
+	  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&uwNumItems), sizeof(word));
+	}
+
+	// Se guarda el identificador de habitacion
+	AreaDefs::RoomID Room = m_Map.pRoomGrid[TileIndex];
+	udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&Room), sizeof(AreaDefs::RoomID));
+
+	// Existe info asociada a techo?
+	if (m_Map.pRoofGrid[TileIndex]) {		  
+	  // Si, se guarda su informacion
+	  CRoof* const pRoof = GetRoof(m_Map.pRoofGrid[TileIndex]);
+	  pRoof->Save(hFile, udOffset);
+
+	  // Se guarda flag indicativo de muestra de lo que hay por debajo
+	  const ShowUnderRoofsSetIt UnderRoofIt(m_Map.ShowUnderRoofs.find(m_Map.pRoofGrid[TileIndex]));
+	  bool bFlag = (UnderRoofIt != m_Map.ShowUnderRoofs.end()) ? true : false;
+	  udOffset += m_pFileSys->Write(hFile, udOffset, (sbyte *)(&bFlag), sizeof(bool));
+
+	  // Se establece el flag
+	  bInfoFlags[1] = true;
+	}
+
+	// Objetos de escenario
+	bInfoFlags[2] = SaveEntitiesInfo(hFile, udOffset, Entities[1], bIsChangingArea);
+
+	// Criaturas
+	bInfoFlags[3] = SaveEntitiesInfo(hFile, udOffset, Entities[2], bIsChangingArea);
+
+	// Paredes
+	bInfoFlags[4] = SaveEntitiesInfo(hFile, udOffset, Entities[3], bIsChangingArea);
+
+	// Se guardan datos relativos al array de offsets
+	m_pFileSys->Write(hFile, udFlagsOffset, (sbyte *)(bInfoFlags), sizeof(bool) * 5);
+  }
+}
 
 //////////////////////////////////////////////////////////////////////////////
 // Descripcion:
@@ -703,6 +884,10 @@ CArea::ChangeArea(const word uwIDArea,
 
   // El area a establecer es DISTINTA al area actual?
   if (uwIDArea != m_Map.uwID) {	
+	#ifdef AREA_LOAD_PROFILE
+	  CAreaLoadProfiler::SetPhase(CAreaLoadProfiler::PHASE_SAVE);
+	#endif
+
   	// Info luminosa del jugador
 	PlayerLightInfoList TempPlayerLightInfo;  
 	TempPlayerLightInfo.push_back(sTempPlayerLightInfo(m_PlayerInfo.pPlayer->GetHandle(),
@@ -741,6 +926,10 @@ CArea::ChangeArea(const word uwIDArea,
 
 	// Intenta cargar area
 	if (LoadArea(uwIDArea)) {	  
+	  #ifdef AREA_LOAD_PROFILE
+		CAreaLoadProfiler::SetPhase(CAreaLoadProfiler::PHASE_LIGHTING);
+	  #endif
+
       // Se inserta de nuevo el jugador en el area de juego
 	  // Si la posicion donde situar al jugador no existe, se intentara
 	  // encontrar una valida en cuanto a que exista como celda, sin tener en
@@ -797,10 +986,30 @@ CArea::ChangeArea(const word uwIDArea,
 // Devuelve:
 // Notas:
 // - Para saber el formato del archivo consultar CrisolBuilder
+// - Los ficheros de area base en formato v2 se leeran de una sola vez a
+//   memoria, usandose sus registros directamente. Los que se hallen en 
+//   formato v1 se convertiran a v2 en memoria (salvo que ya lo hiciera el
+//   precargador de areas), luego toda area base se cargara como v2.
+// - Los ficheros temporales se hallaran en formato delta, con solo las 
+//   celdas modificadas, o en formato v1 completo si se escribieron antes de
+//   que el motor guardara deltas.
 ///////////////////////////////////////////////////////////////////////////////
 bool 
 CArea::LoadArea(const word uwIDArea)
 {
+  #ifdef AREA_LOAD_BENCHMARK
+	// Se toma el instante de inicio de la carga
+	const dword udLoadInitTime = SYSEngine::GetTimer()->GetTime(TimerDefs::TIMER_UNITS_US);
+  #endif
+  #ifdef AREA_LOAD_PROFILE
+	// Si la carga no forma parte de un cambio de area, se perfila por separado
+	const bool bOwnProfile = !CAreaLoadProfiler::IsActive();
+	if (bOwnProfile) {
+	  CAreaLoadProfiler::Begin(m_Map.uwID, uwIDArea);
+	}
+	CAreaLoadProfiler::SetPhase(CAreaLoadProfiler::PHASE_FILE);
+  #endif
+
   // Se forma el nombre del fichero de area base
   std::string szAreaFileName;
   SYSEngine::PassToString(szAreaFileName, 
@@ -813,30 +1022,38 @@ CArea::LoadArea(const word uwIDArea)
   dword udAreaOffset = 0;
 
   // Valida fichero
-  CheckAreaFile(hAreaFile, 
-				udAreaOffset, 
-				CBDefs::CBBAreaBaseFile, 
-				uwIDArea, 
-				szAreaFileName);
+  const byte ubHVersion = CheckAreaFile(hAreaFile, 
+										udAreaOffset, 
+										CBDefs::CBBAreaBaseFile, 
+										uwIDArea, 
+										szAreaFileName);
 	  
-  // Carga datos basicos del area
-  LoadAreaInfo(hAreaFile, udAreaOffset);
+  // Se lee todo el fichero, convirtiendolo si es v1, y se cargan los datos
+  // basicos del area
+  sAreaV2Data AreaData;
+  if (CBDefs::AreaV2HVersion == ubHVersion) {
+	ReadAreaFileV2(hAreaFile, szAreaFileName, AreaData);
+  } else {
+	ConvertAreaFileV1(hAreaFile, szAreaFileName, AreaData);
+  }
+  LoadAreaInfoV2(AreaData);
 
   // Establece identificador del nuevo area
   m_Map.uwID = uwIDArea;
 
   // Existe fichero temporal asociado?
   bool bTmpAreaFile = false;
+  bool bTmpAreaDelta = false;
   SYSEngine::PassToString(szAreaFileName, "tmp\\Area%uTmp.cbb", uwIDArea);
   const FileDefs::FileHandle hAreaTmpFile = m_pFileSys->Open(szAreaFileName);
   if (hAreaTmpFile) {
 	// Si, se valida el fichero
 	dword udAreaBaseOffset = 0;
-	CheckAreaFile(hAreaTmpFile, 
-				  udAreaBaseOffset, 
-				  CBDefs::CBBAreaTmpFile, 
-				  uwIDArea, 
-				  szAreaFileName);	
+	bTmpAreaDelta = (CBDefs::AreaTmpDeltaHVersion == CheckAreaFile(hAreaTmpFile, 
+																   udAreaBaseOffset, 
+																   CBDefs::CBBAreaTmpFile, 
+																   uwIDArea, 
+																   szAreaFileName));
 
 	// Se cierra el fichero de area base y se sustituyen valores por los
 	// relativos al fichero de datos temporales
@@ -847,61 +1064,83 @@ CArea::LoadArea(const word uwIDArea)
   }  
   
   // Procede a cargar las celdas, estableciendo flag de carga
+  #ifdef AREA_LOAD_PROFILE
+	CAreaLoadProfiler::SetPhase(CAreaLoadProfiler::PHASE_CELLS);
+  #endif
   m_bIsAreaLoading = true;
-  AreaDefs::sTilePos TilePos;
-  TilePos.YTile = 0;
-  for (; TilePos.YTile < m_Map.uwHeight; ++TilePos.YTile) {
-	TilePos.XTile = 0;
-	for (; TilePos.XTile < m_Map.uwWidth; ++TilePos.XTile) {	
-	  // Establece indice y carga flags de informacion	  	  
-	  const AreaDefs::TileIndex TileIndex = GetTileIdx(TilePos);  
-	  bool bSectionFlags[5];
-	  udAreaOffset += m_pFileSys->Read(hAreaFile,
-									   (sbyte *)bSectionFlags,
-									   sizeof(bool) * 5,
-									   udAreaOffset);	  
-
-	  // NO hay informacion referida a celdas en esta seccion?
-	  if (!bSectionFlags[0]) {
-		// No, luego se pasa a sig. iteraccion
-		ASSERT((m_Map.pMap[TileIndex] == NULL) != 0);
-		continue;
-	  }
-	  
-	  // Carga datos basicos de la celda      
-	  LoadCells(hAreaFile, udAreaOffset, TilePos, TileIndex, bTmpAreaFile);	  
-
-	  // Carga info de roof
-	  if (bSectionFlags[1]) {
-		LoadRoofs(hAreaFile, udAreaOffset, TileIndex, bTmpAreaFile);
-	  } else {		
-		m_Map.pMap[TileIndex]->hRoof = 0;
-	  }
-
-	  // Objetos de escenario	  
-	  if (bSectionFlags[2]) {
-		LoadSceneObjs(hAreaFile, udAreaOffset, TilePos, TileIndex, bTmpAreaFile);
-	  }
-
-	  // Criatura
-	  if (bSectionFlags[3]) {
-		LoadCriatures(hAreaFile, udAreaOffset, TilePos, TileIndex, bTmpAreaFile);
+  std::vector<bool> DeltaCells;
+  if (!bTmpAreaFile) {
+	// Desde los registros del archivo v2 en memoria
+	LoadCellsV2(AreaData);
+  } else if (bTmpAreaDelta) {
+	// Desde el archivo v2, salvo las celdas modificadas del fichero temporal
+	LoadCellsDelta(AreaData, hAreaFile, udAreaOffset, DeltaCells);
+  } else {
+	// Desde el fichero temporal v1 completo
+	AreaDefs::sTilePos TilePos;
+	TilePos.YTile = 0;
+	for (; TilePos.YTile < m_Map.uwHeight; ++TilePos.YTile) {
+	  TilePos.XTile = 0;
+	  for (; TilePos.XTile < m_Map.uwWidth; ++TilePos.XTile) {	
+		LoadCellInfo(hAreaFile, udAreaOffset, TilePos, bTmpAreaFile);
 	  }
-
-	  // Paredes
-	  if (bSectionFlags[4]) {
-		LoadWalls(hAreaFile, udAreaOffset, TilePos, TileIndex, bTmpAreaFile);
-	  }	  
 	}
   }
 
-  // Se cierra fichero
+  // Se cierra fichero y, en su caso, el que mantenia la vista del v2
   m_pFileSys->Close(hAreaFile);	
+  if (AreaData.hFile) {
+	m_pFileSys->Close(AreaData.hFile);
+  }
 
-  // Todo correcto, establece vbles y retorna  
+  // Todo correcto, establece vbles
   m_Map.bTmpArea = bTmpAreaFile;
   m_bIsAreaLoading = false;
   m_bIsAreaLoaded = true;
+
+  // Se construye la rejilla de accesos y la conectividad
+  #ifdef AREA_LOAD_PROFILE
+	CAreaLoadProfiler::SetPhase(CAreaLoadProfiler::PHASE_GRIDS);
+  #endif
+  BuildAccessGrid();
+  BuildConnectivity();
+
+  // Se construye la rejilla de cubiertas
+  BuildCoverGrid();
+
+  // Se calculan las firmas de las celdas tomadas del archivo base v2, para
+  // poder guardar despues solo las que cambien
+  // Nota: Si se cargo un fichero temporal v1 completo, no habra celdas 
+  // tomadas del archivo base y el area se seguira guardando completa. El
+  // tamao base de un area v1 sera el de su conversion, que siempre sera
+  // el mismo para el mismo archivo
+  if (!bTmpAreaFile || bTmpAreaDelta) {
+	m_Map.udBaseFileSize = AreaData.udSize;
+	BuildCellSignatures(DeltaCells);
+  }
+  #ifdef AREA_LOAD_PROFILE
+	if (bOwnProfile) {
+	  CAreaLoadProfiler::End();
+	}
+  #endif
+  #ifdef CRIATUREGRID_BENCHMARK
+	// Se ejecuta el banco de pruebas de la rejilla de criaturas
+	CCriatureGrid::RunBenchmark(m_Map.uwWidth, m_Map.uwHeight, 500, 100, uwIDArea);
+  #endif
+  #ifdef AREA_TRAVERSAL_BENCHMARK
+	// Se ejecuta el banco de pruebas del recorrido de celdas
+	RunTraversalBenchmark(100);
+  #endif
+  #ifdef AREA_LOAD_BENCHMARK
+	// Se informa del tiempo invertido en la carga
+	SYSEngine::GetLogger()->Write("CArea::LoadArea> Area %u (formato v%u%s) cargada en %u us.\n",
+								  uwIDArea,
+								  ubHVersion,
+								  bTmpAreaFile ? ", temporal" : "",
+								  SYSEngine::GetTimer()->GetTime(TimerDefs::TIMER_UNITS_US) - udLoadInitTime);
+  #endif
+
+  // Todo correcto
   return true;
 }
 
@@ -916,10 +1155,11 @@ CArea::LoadArea(const word uwIDArea)
 // - uwIDArea. Identificador del fichero de area
 // - szArea. Nombre del fichero de area.
 // Devuelve:
+// - La version alta del formato del fichero.
 // Notas:
 // - Para mas informacion sobre el formato, consultar CrisolBuilder.
 ///////////////////////////////////////////////////////////////////////////////
-void 
+byte 
 CArea::CheckAreaFile(const FileDefs::FileHandle& hAreaFile,
 					 dword& udAreaOffset,
 					 const byte ubAreaFileType,
@@ -940,8 +1180,20 @@ CArea::CheckAreaFile(const FileDefs::FileHandle& hAreaFile,
 	SYSEngine::FatalError("Error> Fichero de rea %s no vlido\n", szArea);
   }
   
-  // Salta version
-  udAreaOffset += (sizeof(byte) * 2);
+  // Lee la version alta y salta la baja
+  byte ubHVersion;
+  udAreaOffset += m_pFileSys->Read(hAreaFile, 
+								   (sbyte *)(&ubHVersion), 
+								   sizeof(byte), 
+								   udAreaOffset);
+  udAreaOffset += sizeof(byte);
+  if (ubHVersion != CBDefs::HVersion &&
+	  (ubAreaFileType != CBDefs::CBBAreaBaseFile || 
+	   ubHVersion != CBDefs::AreaV2HVersion) &&
+	  (ubAreaFileType != CBDefs::CBBAreaTmpFile || 
+	   ubHVersion != CBDefs::AreaTmpDeltaHVersion)) {
+	SYSEngine::FatalError("Error> Fichero de rea %s con versin %u no soportada\n", szArea.c_str(), ubHVersion);
+  }
 
   // Comprueba que el codigo del area que se pretende cargar coincide con el que
   // existe guardado en el archivo
@@ -954,66 +1206,140 @@ CArea::CheckAreaFile(const FileDefs::FileHandle& hAreaFile,
 	SYSEngine::FatalError("Fichero de rea %s tiene cdigo %u y se pretende cargar como %u.\n", 
 						  szArea, uwValue, uwIDArea);
   }  
+
+  // Se retorna la version
+  return ubHVersion;
 }
   
 //////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Carga datos base de informacion del area y crea el array principal. 
-// - Tambien preparara la estructura encargada de alojar la informacion de las
-//   habitaciones.
+// - Crea el array principal y las rejillas del mapa segun las dimensiones
+//   ya establecidas, asi como el map de informacion de habitaciones.
 // Parametros:
-// - hAreaFile. Handle al fichero
-// - udAreaOffset. Offset del archivo.
+// - uwNumRooms. Numero de habitaciones del area.
 // Devuelve:
 // Notas:
+// - Las areas base v1 tambien llegaran aqui, una vez convertidas a v2.
 ///////////////////////////////////////////////////////////////////////////////
 void 
-CArea::LoadAreaInfo(const FileDefs::FileHandle& hAreaFile,
-					dword& udAreaOffset)
+CArea::CreateMapInfo(const word uwNumRooms)
 {
-  // SOLO si parametros validos
-  ASSERT(hAreaFile);
-
-  // Obtiene nombre del area  
-  udAreaOffset += m_pFileSys->ReadStringFromBinary(hAreaFile, 
-												   udAreaOffset, 
-												   m_Map.szName);
-  
-  // Obtiene dimensiones y crea el array de elementos
-  udAreaOffset += m_pFileSys->Read(hAreaFile, 
-								   (sbyte*)(&m_Map.uwWidth), 
-								   sizeof(word), 
-								   udAreaOffset);
-  udAreaOffset += m_pFileSys->Read(hAreaFile, 
-								   (sbyte*)(&m_Map.uwHeight), 
-								   sizeof(word), 
-								   udAreaOffset);  
-  ASSERT(!m_Map.pMap);
+  // Crea los bloques de celdas, todos ellos vacios
   const dword udSize = m_Map.uwWidth * m_Map.uwHeight;
-  m_Map.pMap = new sNCell*[udSize];
-  ASSERT(m_Map.pMap);
-  memset(m_Map.pMap, NULL, sizeof(sNCell*) * udSize);  
-
-  // Se lee el valor de iluminacion ambiental
-  udAreaOffset += m_pFileSys->Read(hAreaFile, 
-								   (sbyte *)(&m_Map.AmbientLight), 
-								   sizeof(GraphDefs::Light), 
-								   udAreaOffset);
+  CreateCellChunks();
+
+  // Se crea la rejilla de techos (sin techos)
+  ASSERT(!m_Map.pRoofGrid);
+  m_Map.pRoofGrid = new AreaDefs::EntHandle[udSize];
+  ASSERT(m_Map.pRoofGrid);
+  memset(m_Map.pRoofGrid, 0, sizeof(AreaDefs::EntHandle) * udSize);
+
+  // Se crean las rejillas de floors (sin floors)
+  ASSERT(!m_Map.ppFloorGrid);
+  m_Map.ppFloorGrid = new CFloor*[udSize];
+  ASSERT(m_Map.ppFloorGrid);
+  memset(m_Map.ppFloorGrid, 0, sizeof(CFloor*) * udSize);
+  ASSERT(!m_Map.pElevationGrid);
+  m_Map.pElevationGrid = new RulesDefs::Elevation[udSize];
+  ASSERT(m_Map.pElevationGrid);
+  memset(m_Map.pElevationGrid, 0, sizeof(RulesDefs::Elevation) * udSize);
+  ASSERT(!m_Map.pFloorFlagsGrid);
+  m_Map.pFloorFlagsGrid = new AreaDefs::FloorFlags[udSize];
+  ASSERT(m_Map.pFloorFlagsGrid);
+  memset(m_Map.pFloorFlagsGrid, 0, sizeof(AreaDefs::FloorFlags) * udSize);
+
+  // Se crea la rejilla de habitaciones (sin habitaciones)
+  ASSERT(!m_Map.pRoomGrid);
+  m_Map.pRoomGrid = new AreaDefs::RoomID[udSize];
+  ASSERT(m_Map.pRoomGrid);
+  memset(m_Map.pRoomGrid, 0, sizeof(AreaDefs::RoomID) * udSize);
+
+  // Se inicializa la rejilla espacial de criaturas
+  m_CriatureGrid.Init(m_Map.uwWidth, m_Map.uwHeight);
+
+  // Se crea la rejilla de luz dinamica (todos los vertices a 0)
+  ASSERT(!m_DinamicLightInfo.pTileLight);
+  m_DinamicLightInfo.pTileLight = new GraphDefs::sLight[udSize];
+  ASSERT(m_DinamicLightInfo.pTileLight);
 
   // Se construye el map de informacion de habitaciones segun el numero de estas
-  word uwValue;
-  udAreaOffset += m_pFileSys->Read(hAreaFile, 
-								   (sbyte *)(&uwValue), 
-								   sizeof(word), 
-								   udAreaOffset);
-  if (uwValue) {
+  if (uwNumRooms) {
 	// Como existe al menos una habitacion, se construye el map
 	sRoomInfo RoomInfo;
 	AreaDefs::RoomID RoomIt = 1;
-	for (; RoomIt <= uwValue; ++RoomIt) {
+	for (; RoomIt <= uwNumRooms; ++RoomIt) {
 	  m_Map.RoomInfo.insert(RoomInfoMapValType(RoomIt, RoomInfo));
 	}
   }
+
+  // Se crean los bits de cubiertas, una por habitacion mas la cubierta 0
+  // (tiles sin techo), siempre visible, y la 1 (techos sin habitacion)
+  // Nota: Inicialmente todos los techos seran visibles
+  ASSERT(m_Map.UncoveredBits.empty());
+  m_Map.UncoveredBits.resize((dword(uwNumRooms) + 2 + 31) >> 5, 0);
+  SetCoverUncovered(0, true);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Carga los datos de una celda en el formato v1 de los ficheros de area,
+//   comenzando por los flags de las secciones presentes.
+// Parametros:
+// - hAreaFile. Handle al fichero.
+// - udAreaOffset. Offset del archivo.
+// - TilePos. Posicion de la celda.
+// - bTmpAreaFile. Fichero de area temporal?
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::LoadCellInfo(const FileDefs::FileHandle& hAreaFile,
+					dword& udAreaOffset,
+					const AreaDefs::sTilePos& TilePos,
+					const bool bTmpAreaFile)
+{
+  // SOLO si parametros validos
+  ASSERT(hAreaFile);
+
+  // Establece indice y carga flags de informacion
+  const AreaDefs::TileIndex TileIndex = GetTileIdx(TilePos);
+  bool bSectionFlags[5];
+  udAreaOffset += m_pFileSys->Read(hAreaFile,
+								   (sbyte *)bSectionFlags,
+								   sizeof(bool) * 5,
+								   udAreaOffset);	  
+
+  // NO hay informacion referida a celdas en esta seccion?
+  if (!bSectionFlags[0]) {
+	// No, luego no hay mas datos de la celda
+	ASSERT(!IsCellIndexWithContent(TileIndex));
+	return;
+  }
+
+  // Carga datos basicos de la celda      
+  LoadCells(hAreaFile, udAreaOffset, TilePos, TileIndex, bTmpAreaFile);	  
+
+  // Carga info de roof
+  if (bSectionFlags[1]) {
+	LoadRoofs(hAreaFile, udAreaOffset, TileIndex, bTmpAreaFile);
+  } else {		
+	m_Map.pRoofGrid[TileIndex] = 0;
+  }
+
+  // Objetos de escenario	  
+  if (bSectionFlags[2]) {
+	LoadSceneObjs(hAreaFile, udAreaOffset, TilePos, TileIndex, bTmpAreaFile);
+  }
+
+  // Criatura
+  if (bSectionFlags[3]) {
+	LoadCriatures(hAreaFile, udAreaOffset, TilePos, TileIndex, bTmpAreaFile);
+  }
+
+  // Paredes
+  if (bSectionFlags[4]) {
+	LoadWalls(hAreaFile, udAreaOffset, TilePos, TileIndex, bTmpAreaFile);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -1040,13 +1366,14 @@ CArea::LoadCells(const FileDefs::FileHandle& hAreaFile,
   ASSERT(hAreaFile);
 
   // Crea instancia
-  m_Map.pMap[TileIndex] = new sNCell;  
-  ASSERT(m_Map.pMap[TileIndex]);  
+  sNCell* const pCell = new sNCell;  
+  ASSERT(pCell);  
+  SetCell(TileIndex, pCell);
   
   // Se inicializa instancia segun proceda, leyendo tambien la mascara de acceso
   AreaDefs::MaskTileAccess FloorMaskAccess;
   if (bTmpAreaFile) {	
-	m_Map.pMap[TileIndex]->Floor.Init(hAreaFile, udAreaOffset);
+	pCell->Floor.Init(hAreaFile, udAreaOffset);
 	FloorMaskAccess = LoadFloorMaskAccess(hAreaFile, udAreaOffset);	  
   } else {	
 	std::string szSection;
@@ -1056,10 +1383,10 @@ CArea::LoadCells(const FileDefs::FileHandle& hAreaFile,
 	const FileDefs::FileHandle hFile = m_pGDBase->GetCBBFileHandle(GameDataBaseDefs::CBBF_FLOORPROFILES);
 	dword udOffset = m_pGDBase->GetCBBFileOffset(GameDataBaseDefs::CBBF_FLOORPROFILES,
 												 szSection);  
-	m_Map.pMap[TileIndex]->Floor.Init(hFile, udOffset);		
+	pCell->Floor.Init(hFile, udOffset);		
 	FloorMaskAccess = LoadFloorMaskAccess(hFile, udOffset);	  
   }
-  ASSERT_MSG(m_Map.pMap[TileIndex]->Floor.IsInitOk(), "Problemas creando Floor");
+  ASSERT_MSG(pCell->Floor.IsInitOk(), "Problemas creando Floor");
 
   // Se establece mascara de acceso
   SetMaskFloorAccess(TilePos, FloorMaskAccess); 
@@ -1070,13 +1397,14 @@ CArea::LoadCells(const FileDefs::FileHandle& hAreaFile,
 								   (sbyte *)(&Elevation),
 								   sizeof(RulesDefs::Elevation),
 								   udAreaOffset);
-  m_Map.pMap[TileIndex]->Floor.SetElevation(Elevation);
+  pCell->Floor.SetElevation(Elevation);
+  m_Map.pElevationGrid[TileIndex] = Elevation;
 
   // Items sobre el terreno
   LoadItems(hAreaFile, 
 			udAreaOffset, 
 			NULL,
-			m_Map.pMap[TileIndex]->Floor.GetEntityType(),
+			pCell->Floor.GetEntityType(),
 			TilePos,
 			bTmpAreaFile);		
   
@@ -1092,6 +1420,7 @@ CArea::LoadCells(const FileDefs::FileHandle& hAreaFile,
 	const RoomInfoMapIt RoomInfoIt(m_Map.RoomInfo.find(Room));
 	ASSERT((RoomInfoIt != m_Map.RoomInfo.end()) != 0);
 	RoomInfoIt->second.Cells.insert(TileIndex);
+	m_Map.pRoomGrid[TileIndex] = Room;
   } 
 }
 
@@ -1119,10 +1448,9 @@ CArea::LoadRoofs(const FileDefs::FileHandle& hAreaFile,
   // Se crea instancia y se registra
   sNRoof* const pNRoof = new sNRoof;
   ASSERT(pNRoof);  
-  const AreaDefs::EntHandle hEntity = CreateHandle(RulesDefs::ROOF);
-  ASSERT(hEntity);
+  const AreaDefs::EntHandle hEntity = CreateLoadHandle(RulesDefs::ROOF);
   ASSERT((GetEntityType(hEntity) == RulesDefs::ROOF) != 0);
-  m_Map.Roofs.insert(RoofsMapValType(hEntity, pNRoof));
+  m_Map.Roofs.Insert(hEntity, pNRoof);
   
   // Se inicializa segun proceda
   if (bTmpAreaFile) {	
@@ -1159,7 +1487,7 @@ CArea::LoadRoofs(const FileDefs::FileHandle& hAreaFile,
   }
   
   // Se asocia el handle a la celda
-  m_Map.pMap[TileIndex]->hRoof = hEntity;    
+  m_Map.pRoofGrid[TileIndex] = hEntity;    
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -1237,8 +1565,7 @@ CArea::LoadSceneObjs(const FileDefs::FileHandle& hAreaFile,
 	// Se crea instancia y se obtiene handle
 	sNSceneObj* const pNSceneObj = new sNSceneObj;
 	ASSERT(pNSceneObj);	
-	const AreaDefs::EntHandle hEntity = CreateHandle(RulesDefs::SCENE_OBJ);  
-	ASSERT(hEntity);
+	const AreaDefs::EntHandle hEntity = CreateLoadHandle(RulesDefs::SCENE_OBJ);  
 	ASSERT((GetEntityType(hEntity) == RulesDefs::SCENE_OBJ) != 0);
 	
 	// Se inicializa segun proceda
@@ -1258,7 +1585,7 @@ CArea::LoadSceneObjs(const FileDefs::FileHandle& hAreaFile,
 	ASSERT_MSG(pNSceneObj->SceneObj.IsInitOk(), "Problemas creando SceneObj");
 
 	// Se inserta en el map del area
-	m_Map.SceneObjs.insert(SObjsValType(hEntity, pNSceneObj));
+	m_Map.SceneObjs.Insert(hEntity, pNSceneObj);
 
 	// Lee posible tag asociado
 	LoadEntityTag(hAreaFile, udAreaOffset, hEntity);
@@ -1322,8 +1649,7 @@ CArea::LoadWalls(const FileDefs::FileHandle& hAreaFile,
   // Se itera 
   for (; uwNumWalls > 0; uwNumWalls--) {
 	// Se obtiene handle y crea instancia
-	const AreaDefs::EntHandle hEntity = CreateHandle(RulesDefs::WALL);	
-	ASSERT(hEntity);
+	const AreaDefs::EntHandle hEntity = CreateLoadHandle(RulesDefs::WALL);	
 	ASSERT((GetEntityType(hEntity) == RulesDefs::WALL) != 0);
 	sNWall* pNWall = new sNWall;
 	ASSERT(pNWall);
@@ -1345,7 +1671,7 @@ CArea::LoadWalls(const FileDefs::FileHandle& hAreaFile,
 	ASSERT_MSG(pNWall->Wall.IsInitOk(), "Problemas creando pared");
 
 	// Se inserta en el map del area
-	m_Map.Walls.insert(WallsValType(hEntity, pNWall));
+	m_Map.Walls.Insert(hEntity, pNWall);
 
 	// Lee posible tag asociado
 	LoadEntityTag(hAreaFile, udAreaOffset, hEntity);
@@ -1413,8 +1739,7 @@ CArea::LoadCriatures(const FileDefs::FileHandle& hAreaFile,
 	// Nota: Segun sea el flag leido, se creara criatura temporal o local
 	sNCriature* pNCriature = new sNCriature;
 	ASSERT(pNCriature);
-	const AreaDefs::EntHandle hEntity = CreateHandle(RulesDefs::CRIATURE);
-	ASSERT(hEntity);
+	const AreaDefs::EntHandle hEntity = CreateLoadHandle(RulesDefs::CRIATURE);
 	ASSERT((GetEntityType(hEntity) == RulesDefs::CRIATURE) != 0);
     // Se inicializa segun proceda
 	if (bTmpAreaFile) {	  
@@ -1433,7 +1758,7 @@ CArea::LoadCriatures(const FileDefs::FileHandle& hAreaFile,
 	ASSERT_MSG(pNCriature->Criature.IsInitOk(), "Problemas creando Criature");
 	
 	// Se inserta en el map del area
-	m_Map.Criatures.insert(CriaturesValType(hEntity, pNCriature));
+	m_Map.Criatures.Insert(hEntity, pNCriature);
 	
 	// Se lee flag de criatura temporal
 	bool bTmpCriature;
@@ -1538,8 +1863,7 @@ CArea::LoadItems(const FileDefs::FileHandle& hAreaFile,
 	}	
 
 	// Establece el nuevo handle
-	const AreaDefs::EntHandle hItem = CreateHandle(RulesDefs::ITEM);	
-	ASSERT(hItem);
+	const AreaDefs::EntHandle hItem = CreateLoadHandle(RulesDefs::ITEM);	
 	ASSERT((GetEntityType(hItem) == RulesDefs::ITEM) != 0);
 
 	// Se crea instancia e inicializa segun proceda
@@ -1559,7 +1883,7 @@ CArea::LoadItems(const FileDefs::FileHandle& hAreaFile,
 	// Se establecen valores basicos y se inserta entidad en el map
 	pNewItem->Item.SetOwner(0);
 	pNewItem->Item.SetElevation(0);  	  
-	m_Map.Items.insert(ItemsValType(hItem, pNewItem));      
+	m_Map.Items.Insert(hItem, pNewItem);      
 
 	// Se esta trabajando con un floor?
 	if (EntityType == RulesDefs::FLOOR) {
@@ -1627,8 +1951,7 @@ CArea::LoadEquippedItems(const FileDefs::FileHandle& hAreaFile,
 	}	
 
 	// Establece el nuevo handle
-	const AreaDefs::EntHandle hItem = CreateHandle(RulesDefs::ITEM);	
-	ASSERT(hItem);
+	const AreaDefs::EntHandle hItem = CreateLoadHandle(RulesDefs::ITEM);	
 	ASSERT((GetEntityType(hItem) == RulesDefs::ITEM) != 0);
 
 	// Se crea instancia e inicializa segun proceda
@@ -1652,7 +1975,7 @@ CArea::LoadEquippedItems(const FileDefs::FileHandle& hAreaFile,
 	// Se establecen valores basicos y se inserta entidad en el map
 	pNewItem->Item.SetOwner(0);
 	pNewItem->Item.SetElevation(0);  	  
-	m_Map.Items.insert(ItemsValType(hItem, pNewItem));      
+	m_Map.Items.Insert(hItem, pNewItem);      
 
 	// Se inserta el item en el slot y se equipa
 	pCriature->InitEquipmentSlots(hItem, Slot); 	
@@ -1665,14 +1988,16 @@ CArea::LoadEquippedItems(const FileDefs::FileHandle& hAreaFile,
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Metodo que se encarga de crear handles a partir del tipo recibido. En la
-//   creacion de handles se localizaran posibles valores de forma aleatoria que
-//   no debera de existir previamente.
+// - Metodo que se encarga de crear handles a partir del tipo recibido. El
+//   handle se obtendra reservando un slot en la tabla asociada al tipo, de
+//   tal forma que codificara el indice del slot.
 // Parametros:
 // - EntityType. Tipo de entidad.
 // Devuelve:
-// - Handle creado
+// - Handle creado. Si la tabla esta llena se devolvera 0.
 // Notas:
+// - Tras crear el handle, el nodo de la entidad se debera de insertar en
+//   la tabla correspondiente.
 ///////////////////////////////////////////////////////////////////////////////
 AreaDefs::EntHandle 
 CArea::CreateHandle(const RulesDefs::eEntityType& EntityType)
@@ -1680,56 +2005,63 @@ CArea::CreateHandle(const RulesDefs::eEntityType& EntityType)
   // SOLO si instancia inicializada
   ASSERT(IsInitOk());
 
-  // Segun sea el tipo, se debera de trabajar con un map
-  const AreaDefs::EntHandle hEntity = (EntityType << 12);
-  word uwBaseValue = 0;
-  iCMathUtil* const pMathUtil = SYSEngine::GetMathUtil();
-  ASSERT(pMathUtil);	  	  
-  pMathUtil->GenSeed();
-  const word uwMinValue = 0;
-  const word uwMaxValue = 0x0FFF - 1;
+  // Segun sea el tipo, se reservara el slot en la tabla que proceda
   switch(EntityType) {
-	case RulesDefs::SCENE_OBJ: {
+	case RulesDefs::SCENE_OBJ: 
 	  // Objetos de escenario
-	  do {
-		uwBaseValue = pMathUtil->GetRandValue(uwMinValue, uwMaxValue);
-	  } while (m_Map.SceneObjs.find(hEntity + uwBaseValue) != m_Map.SceneObjs.end());
-	} break;
-
-	case RulesDefs::CRIATURE: {
+	  return m_Map.SceneObjs.Alloc();
+	  
+	case RulesDefs::CRIATURE: 
 	  // Npcs
-	  do {
-		uwBaseValue = pMathUtil->GetRandValue(uwMinValue, uwMaxValue);
-	  } while (m_Map.Criatures.find(hEntity + uwBaseValue) != m_Map.Criatures.end());
-	} break;
+	  return m_Map.Criatures.Alloc();
 
-	case RulesDefs::WALL: {
+	case RulesDefs::WALL: 
 	  // Paredes
-	  do {
-		uwBaseValue = pMathUtil->GetRandValue(uwMinValue, uwMaxValue);
-	  } while (m_Map.Walls.find(hEntity + uwBaseValue) != m_Map.Walls.end());
-	} break;
-
-	case RulesDefs::ITEM: {
+	  return m_Map.Walls.Alloc();
+	  
+	case RulesDefs::ITEM: 
 	  // Items
-	  do {
-		uwBaseValue = pMathUtil->GetRandValue(uwMinValue, uwMaxValue);
-	  } while (m_Map.Items.find(hEntity + uwBaseValue) != m_Map.Items.end());
-	} break;
-
-	case RulesDefs::ROOF: {
+	  return m_Map.Items.Alloc();
+	  
+	case RulesDefs::ROOF: 
 	  // Techos
-	  do {
-		uwBaseValue = pMathUtil->GetRandValue(uwMinValue, uwMaxValue);
-	  } while (m_Map.Roofs.find(hEntity + uwBaseValue) != m_Map.Roofs.end());
-	} break;
-
+	  return m_Map.Roofs.Alloc();
+	  
 	default:
 	  ASSERT(0);
   }; // ~ switch
 
-  // Se retorna valor
-  return (hEntity + uwBaseValue); 
+  // Tipo no valido
+  return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Crea un handle para una entidad que se esta cargando desde el archivo
+//   del area. A diferencia de la creacion en tiempo de juego, no hay forma
+//   de prescindir de la entidad, asi que una tabla llena sera un error fatal.
+// Parametros:
+// - EntityType. Tipo de entidad.
+// Devuelve:
+// - Handle creado.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+AreaDefs::EntHandle 
+CArea::CreateLoadHandle(const RulesDefs::eEntityType& EntityType)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se crea el handle
+  const AreaDefs::EntHandle hEntity = CreateHandle(EntityType);
+  if (!hEntity) {
+	SYSEngine::FatalError("Error> rea %u con ms de %u entidades de tipo %u\n", 
+						  m_Map.uwID, AreaDefs::MAX_ENTITIES_BY_TYPE, EntityType);
+  }
+  
+  // Se retorna
+  ASSERT((GetEntityType(hEntity) == EntityType) != 0);
+  return hEntity;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1770,7 +2102,8 @@ CArea::LoadEntityTag(const FileDefs::FileHandle& hAreaFile,
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Inserta un tag asociado a una entidad. El tag si ya existe sera 
-//   sobreescrito.
+//   sobreescrito. Una entidad solo podra tener un tag, luego si ya tenia
+//   uno distinto, este sera sustituido.
 // Parametros:
 // - hEntity. Handle asociado a la entidad con el tag.
 // - szTag. Tag a insertar.
@@ -1790,15 +2123,9 @@ CArea::InsertTag(const AreaDefs::EntHandle& hEntity,
     std::string szTagLower(szTag);
     SYSEngine::MakeLowercase(szTagLower);
 
-	// Ya existia el tag?
-    const TagMapIt It(m_EntityTags.find(szTagLower));
-	if (It != m_EntityTags.end()) {
-	  // Si, se cambia handle asociado
-	  It->second = hEntity;
-	} else {
-	  // No, se inserta por primera vez
-	  m_EntityTags.insert(TagMapValType(szTagLower, hEntity));
-	}
+	// Se inserta en el indice
+	// Nota: Si ya existia el tag, se cambiara el handle asociado
+	m_EntityTags.Insert(hEntity, szTagLower);
   }
 }  
 
@@ -1835,24 +2162,1174 @@ CArea::LoadLightValue(const FileDefs::FileHandle& hAreaFile,
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Completa los datos de un archivo de partida salvada, almacenando toda 
-//   la informacion realativa al jugador y a las areas temporales.
+// - Lee de una sola vez el fichero de area base en formato v2 y localiza sus
+//   secciones, validando que todas ellas se hallen dentro del fichero.
+// - Si el fichero se halla en un CPAK proyectado en memoria, no se copiara
+//   y se trabajara directamente sobre la vista, reteniendo el fichero 
+//   abierto en AreaData.hFile hasta que se cierre desde LoadArea.
 // Parametros:
-// - hFile. Handle al fichero que hace de partida guardada.
-// - udOffset. Offset donde comenzar a depositar los datos.
+// - hAreaFile. Handle al fichero.
+// - szArea. Nombre del fichero de area.
+// - AreaData. Estructura donde depositar el contenido del fichero.
 // Devuelve:
 // Notas:
+// - Cualquier inconsistencia en el fichero producira un error fatal.
 ///////////////////////////////////////////////////////////////////////////////
-void 
-CArea::SaveGame(const FileDefs::FileHandle& hFile,
-				dword& udOffset)
+void
+CArea::ReadAreaFileV2(const FileDefs::FileHandle& hAreaFile,
+					  const std::string& szArea,
+					  sAreaV2Data& AreaData)
 {
-  // SOLO si instancia inicializada y cargada
-  ASSERT(IsInitOk());
-  ASSERT(IsAreaLoaded());
   // SOLO si parametros validos
-  ASSERT(hFile);
-
+  ASSERT(hAreaFile);
+  ASSERT(!szArea.empty());
+
+  // Se puede acceder al contenido sin copiarlo?
+  AreaData.psbData = m_pFileSys->GetFileData(hAreaFile, AreaData.udSize);
+  if (AreaData.psbData) {
+	// Si, se mantendra el fichero abierto mientras se use la vista
+	AreaData.hFile = m_pFileSys->Open(szArea);
+	ASSERT(AreaData.hFile);
+  } else {
+	// No, se lee el fichero completo
+	AreaData.udSize = m_pFileSys->GetFileSize(hAreaFile);
+	if (AreaData.udSize) {
+	  AreaData.Data.resize(AreaData.udSize);
+	  if (m_pFileSys->Read(hAreaFile, &AreaData.Data[0], AreaData.udSize, 0) != AreaData.udSize) {
+		SYSEngine::FatalError("Error> No se pudo leer el fichero de rea %s\n", szArea.c_str());
+	  }
+	  AreaData.psbData = &AreaData.Data[0];
+	}
+  }
+
+  // Se localizan las secciones
+  LocateSectionsV2(szArea, AreaData);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Convierte a formato v2, en memoria, el fichero de area base en formato
+//   v1, dejando el resultado en AreaData.Data y localizando sus secciones.
+// Parametros:
+// - hAreaFile. Handle al fichero.
+// - szArea. Nombre del fichero de area.
+// - AreaData. Estructura donde depositar el contenido convertido.
+// Devuelve:
+// Notas:
+// - Cualquier inconsistencia en el fichero producira un error fatal.
+// - La conversion sera la misma que realiza CrisolBuilder y que el 
+//   precargador de areas realiza fuera del hilo principal, luego su 
+//   tamao, que se usara para validar los ficheros temporales delta, no 
+//   dependera de quien la haya realizado.
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::ConvertAreaFileV1(const FileDefs::FileHandle& hAreaFile,
+						 const std::string& szArea,
+						 sAreaV2Data& AreaData)
+{
+  // SOLO si parametros validos
+  ASSERT(hAreaFile);
+  ASSERT(!szArea.empty());
+
+  // Se obtiene el contenido v1, sin copiarlo si es posible
+  dword udV1Size = 0;
+  const sbyte* psbV1Data = m_pFileSys->GetFileData(hAreaFile, udV1Size);
+  std::vector<sbyte> V1Data;
+  if (!psbV1Data) {
+	udV1Size = m_pFileSys->GetFileSize(hAreaFile);
+	if (udV1Size) {
+	  V1Data.resize(udV1Size);
+	  if (m_pFileSys->Read(hAreaFile, &V1Data[0], udV1Size, 0) != udV1Size) {
+		SYSEngine::FatalError("Error> No se pudo leer el fichero de rea %s\n", szArea.c_str());
+	  }
+	  psbV1Data = &V1Data[0];
+	}
+  }
+
+  // Se convierte
+  CAreaFileConverter Converter;
+  if (!psbV1Data ||
+	  !Converter.Convert(psbV1Data, udV1Size, AreaData.Data)) {
+	SYSEngine::FatalError("Error> No se pudo convertir el fichero de rea %s: %s\n", 
+						  szArea.c_str(),
+						  Converter.GetError().c_str());
+  }
+
+  // Se localizan las secciones
+  AreaData.psbData = &AreaData.Data[0];
+  AreaData.udSize = AreaData.Data.size();
+  LocateSectionsV2(szArea, AreaData);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Localiza las secciones del contenido v2 ya depositado en AreaData,
+//   validando que todas ellas se hallen dentro del mismo.
+// Parametros:
+// - szArea. Nombre del fichero de area.
+// - AreaData. Contenido v2, con psbData y udSize establecidos.
+// Devuelve:
+// Notas:
+// - Cualquier inconsistencia producira un error fatal.
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::LocateSectionsV2(const std::string& szArea,
+						sAreaV2Data& AreaData)
+{
+  // Contenido completo?
+  const dword udSize = AreaData.udSize;
+  if (!AreaData.psbData ||
+	  udSize < CBDefs::AreaV2HeaderPos + sizeof(CBDefs::sAreaV2Header)) {
+	SYSEngine::FatalError("Error> Fichero de rea %s v2 truncado\n", szArea.c_str());
+  }
+
+  // Se comprueba que las secciones se hallen dentro del fichero
+  const sbyte* const psbData = AreaData.psbData;
+  AreaData.pHeader = (const CBDefs::sAreaV2Header*)(psbData + CBDefs::AreaV2HeaderPos);
+  const dword udRecordSizes[CBDefs::AREAV2_MAX_SECTIONS] = {
+	sizeof(sbyte),
+	sizeof(CBDefs::sAreaV2Cell),
+	sizeof(CBDefs::sAreaV2Roof),
+	sizeof(CBDefs::sAreaV2Entity),
+	sizeof(CBDefs::sAreaV2Item)
+  };
+  byte ubIt = 0;
+  for (; ubIt < CBDefs::AREAV2_MAX_SECTIONS; ++ubIt) {
+	const CBDefs::sAreaV2Section& Section = AreaData.pHeader->Sections[ubIt];
+	if (Section.udOffset > udSize ||
+		Section.udNumRecords > (udSize - Section.udOffset) / udRecordSizes[ubIt]) {
+	  SYSEngine::FatalError("Error> Fichero de rea %s v2 con seccin %u no vlida\n", szArea.c_str(), ubIt);
+	}
+  }
+
+  // Se localizan las secciones
+  // Nota: La seccion de cadenas debera de terminar en caracter nulo
+  const CBDefs::sAreaV2Section* const pSections = AreaData.pHeader->Sections;
+  AreaData.psbStrings = psbData + pSections[CBDefs::AREAV2_STRINGS].udOffset;
+  AreaData.udStringsSize = pSections[CBDefs::AREAV2_STRINGS].udNumRecords;
+  if (!AreaData.udStringsSize ||
+	  AreaData.psbStrings[AreaData.udStringsSize - 1] != '\0') {
+	SYSEngine::FatalError("Error> Fichero de rea %s v2 con cadenas no vlidas\n", szArea.c_str());
+  }
+  AreaData.pCells = (const CBDefs::sAreaV2Cell*)(psbData + pSections[CBDefs::AREAV2_CELLS].udOffset);
+  AreaData.pRoofs = (const CBDefs::sAreaV2Roof*)(psbData + pSections[CBDefs::AREAV2_ROOFS].udOffset);
+  AreaData.pEntities = (const CBDefs::sAreaV2Entity*)(psbData + pSections[CBDefs::AREAV2_ENTITIES].udOffset);
+  AreaData.pItems = (const CBDefs::sAreaV2Item*)(psbData + pSections[CBDefs::AREAV2_ITEMS].udOffset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Establece los datos base del area desde la cabecera v2 y crea el mapa.
+// Parametros:
+// - AreaData. Fichero v2 en memoria.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::LoadAreaInfoV2(const sAreaV2Data& AreaData)
+{
+  // SOLO si parametros validos
+  ASSERT(AreaData.pHeader);
+
+  // Se toman los datos y se crea el mapa
+  m_Map.szName = GetStringV2(AreaData, AreaData.pHeader->udName);
+  m_Map.uwWidth = AreaData.pHeader->uwWidth;
+  m_Map.uwHeight = AreaData.pHeader->uwHeight;
+  m_Map.AmbientLight = AreaData.pHeader->AmbientLight;
+  CreateMapInfo(AreaData.pHeader->uwNumRooms);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Carga todas las celdas con contenido desde la seccion de celdas v2,
+//   con su floor, techo, items y entidades.
+// Parametros:
+// - AreaData. Fichero v2 en memoria.
+// Devuelve:
+// Notas:
+// - Las celdas se hallaran en el mismo orden que en el formato v1, luego las
+//   entidades se crearan en el mismo orden que en este.
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::LoadCellsV2(const sAreaV2Data& AreaData)
+{
+  // SOLO si parametros validos
+  ASSERT(AreaData.pHeader);
+
+  // Se recorren las celdas
+  const dword udNumCells = AreaData.pHeader->Sections[CBDefs::AREAV2_CELLS].udNumRecords;
+  dword udCell = 0;
+  for (; udCell < udNumCells; ++udCell) {
+	LoadCellV2(AreaData, udCell);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Carga una celda desde la seccion de celdas v2, con su floor, techo,
+//   items y entidades.
+// Parametros:
+// - AreaData. Fichero v2 en memoria.
+// - udCell. Indice del registro de la celda.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::LoadCellV2(const sAreaV2Data& AreaData,
+				  const dword udCell)
+{
+  // SOLO si parametros validos
+  ASSERT(AreaData.pHeader);
+  ASSERT((udCell < AreaData.pHeader->Sections[CBDefs::AREAV2_CELLS].udNumRecords) != 0);
+
+  // Se valida la posicion de la celda y sus entidades
+  const dword udNumEntities = AreaData.pHeader->Sections[CBDefs::AREAV2_ENTITIES].udNumRecords;
+  const CBDefs::sAreaV2Cell& Cell = AreaData.pCells[udCell];
+  if (Cell.uwXTile >= m_Map.uwWidth ||
+	  Cell.uwYTile >= m_Map.uwHeight ||
+	  Cell.udFirstEntity > udNumEntities ||
+	  Cell.uwNumEntities > udNumEntities - Cell.udFirstEntity) {
+	SYSEngine::FatalError("Error> rea %u con celda %u no vlida\n", m_Map.uwID, udCell);
+  }
+  AreaDefs::sTilePos TilePos;
+  TilePos.XTile = Cell.uwXTile;
+  TilePos.YTile = Cell.uwYTile;
+  const AreaDefs::TileIndex TileIndex = GetTileIdx(TilePos);
+  ASSERT(!IsCellIndexWithContent(TileIndex));
+
+  // Crea instancia y se inicializa el floor, junto a su mascara de acceso
+  sNCell* const pCell = new sNCell;
+  ASSERT(pCell);
+  SetCell(TileIndex, pCell);
+  const FileDefs::FileHandle hFile = m_pGDBase->GetCBBFileHandle(GameDataBaseDefs::CBBF_FLOORPROFILES);
+  dword udOffset = m_pGDBase->GetCBBFileOffset(GameDataBaseDefs::CBBF_FLOORPROFILES,
+											   GetStringV2(AreaData, Cell.udFloorProfile));
+  pCell->Floor.Init(hFile, udOffset);
+  ASSERT_MSG(pCell->Floor.IsInitOk(), "Problemas creando Floor");
+  SetMaskFloorAccess(TilePos, LoadFloorMaskAccess(hFile, udOffset));
+  pCell->Floor.SetElevation(Cell.Elevation);
+  m_Map.pElevationGrid[TileIndex] = Cell.Elevation;
+
+  // Items sobre el terreno
+  LoadItemsV2(AreaData,
+			  Cell.udFirstItem,
+			  Cell.uwNumItems,
+			  NULL,
+			  NULL,
+			  pCell->Floor.GetEntityType(),
+			  TilePos);
+
+  // Identificador de habitacion
+  if (Cell.Room) {
+	const RoomInfoMapIt RoomInfoIt(m_Map.RoomInfo.find(Cell.Room));
+	if (RoomInfoIt == m_Map.RoomInfo.end()) {
+	  SYSEngine::FatalError("Error> rea %u con habitacin %u no vlida\n", m_Map.uwID, Cell.Room);
+	}
+	RoomInfoIt->second.Cells.insert(TileIndex);
+	m_Map.pRoomGrid[TileIndex] = Cell.Room;
+  }
+
+  // Techo
+  if (Cell.udRoof != CBDefs::AreaV2NoRecord) {
+	LoadRoofV2(AreaData, Cell.udRoof, TileIndex);
+  }
+
+  // Entidades, en el orden en que se hallen
+  dword udEntity = Cell.udFirstEntity;
+  const dword udEndEntity = udEntity + Cell.uwNumEntities;
+  for (; udEntity < udEndEntity; ++udEntity) {
+	LoadEntityV2(AreaData, udEntity, TilePos);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Carga las celdas de un area cuyo fichero temporal se halle en formato
+//   delta. Las celdas presentes en el fichero temporal se cargaran desde
+//   este y el resto desde la seccion de celdas v2.
+// Parametros:
+// - AreaData. Fichero v2 en memoria.
+// - hTmpFile. Handle al fichero temporal.
+// - udTmpOffset. Offset tras la cabecera comun del fichero temporal.
+// - DeltaCells. Se marcaran las celdas cargadas desde el fichero temporal.
+// Devuelve:
+// Notas:
+// - Tanto las celdas v2 como las del fichero temporal se hallaran en orden
+//   creciente de indice, por lo que se recorreran a la vez.
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::LoadCellsDelta(const sAreaV2Data& AreaData,
+					  const FileDefs::FileHandle& hTmpFile,
+					  dword& udTmpOffset,
+					  std::vector<bool>& DeltaCells)
+{
+  // SOLO si parametros validos
+  ASSERT(AreaData.pHeader);
+  ASSERT(hTmpFile);
+
+  // Se comprueba que los cambios correspondan al archivo base actual
+  dword udBaseFileSize;
+  udTmpOffset += m_pFileSys->Read(hTmpFile, 
+								  (sbyte *)(&udBaseFileSize), 
+								  sizeof(dword), 
+								  udTmpOffset);
+  if (udBaseFileSize != AreaData.udSize) {
+	SYSEngine::FatalError("Error> Fichero de rea temporal %u no corresponde al rea base\n", m_Map.uwID);
+  }
+
+  // Se lee el numero de celdas modificadas y el indice de la primera
+  word uwNumDeltaCells;
+  udTmpOffset += m_pFileSys->Read(hTmpFile, 
+								  (sbyte *)(&uwNumDeltaCells), 
+								  sizeof(word), 
+								  udTmpOffset);
+  const dword udMapSize = m_Map.uwWidth * m_Map.uwHeight;
+  DeltaCells.assign(udMapSize, false);
+  dword udDeltaIndex = udMapSize;
+  if (uwNumDeltaCells) {
+	AreaDefs::TileIndex TileIndex;
+	udTmpOffset += m_pFileSys->Read(hTmpFile, 
+									(sbyte *)(&TileIndex), 
+									sizeof(AreaDefs::TileIndex), 
+									udTmpOffset);
+	udDeltaIndex = TileIndex;
+  }
+
+  // Se recorren las celdas v2 intercalando las modificadas
+  const dword udNumCells = AreaData.pHeader->Sections[CBDefs::AREAV2_CELLS].udNumRecords;
+  dword udCell = 0;
+  while (udCell < udNumCells || uwNumDeltaCells) {
+	// Se obtiene el indice de la siguiente celda v2
+	dword udBaseIndex = udMapSize;
+	if (udCell < udNumCells) {
+	  const CBDefs::sAreaV2Cell& Cell = AreaData.pCells[udCell];
+	  udBaseIndex = dword(Cell.uwYTile) * m_Map.uwWidth + Cell.uwXTile;
+	}
+
+	// Corresponde cargar una celda modificada?
+	if (uwNumDeltaCells && udDeltaIndex <= udBaseIndex) {
+	  // Si, se valida y se carga desde el fichero temporal
+	  if (udDeltaIndex >= udMapSize || DeltaCells[udDeltaIndex]) {
+		SYSEngine::FatalError("Error> Fichero de rea temporal %u con celda %u no vlida\n", 
+							  m_Map.uwID, udDeltaIndex);
+	  }
+	  AreaDefs::sTilePos TilePos;
+	  TilePos.XTile = udDeltaIndex % m_Map.uwWidth;
+	  TilePos.YTile = udDeltaIndex / m_Map.uwWidth;
+	  LoadCellInfo(hTmpFile, udTmpOffset, TilePos, true);
+	  DeltaCells[udDeltaIndex] = true;
+
+	  // La celda v2 equivalente, si existe, se descarta
+	  if (udDeltaIndex == udBaseIndex) {
+		++udCell;
+	  }
+
+	  // Se lee el indice de la siguiente celda modificada
+	  if (--uwNumDeltaCells) {
+		AreaDefs::TileIndex TileIndex;
+		udTmpOffset += m_pFileSys->Read(hTmpFile, 
+										(sbyte *)(&TileIndex), 
+										sizeof(AreaDefs::TileIndex), 
+										udTmpOffset);
+		udDeltaIndex = TileIndex;
+	  }
+	} else {
+	  // No, se carga la celda v2
+	  LoadCellV2(AreaData, udCell);
+	  ++udCell;
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Crea el techo asociado a una celda desde la seccion de techos v2.
+// Parametros:
+// - AreaData. Fichero v2 en memoria.
+// - udRoof. Indice del registro del techo.
+// - TileIndex. Indice de la celda.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::LoadRoofV2(const sAreaV2Data& AreaData,
+				  const dword udRoof,
+				  const AreaDefs::TileIndex& TileIndex)
+{
+  // Se valida el registro
+  if (udRoof >= AreaData.pHeader->Sections[CBDefs::AREAV2_ROOFS].udNumRecords) {
+	SYSEngine::FatalError("Error> rea %u con techo %u no vlido\n", m_Map.uwID, udRoof);
+  }
+  const CBDefs::sAreaV2Roof& Roof = AreaData.pRoofs[udRoof];
+
+  // Se crea instancia y se registra
+  sNRoof* const pNRoof = new sNRoof;
+  ASSERT(pNRoof);  
+  const AreaDefs::EntHandle hEntity = CreateLoadHandle(RulesDefs::ROOF);
+  ASSERT((GetEntityType(hEntity) == RulesDefs::ROOF) != 0);
+  m_Map.Roofs.Insert(hEntity, pNRoof);
+  
+  // Se inicializa
+  dword udOffset = m_pGDBase->GetCBBFileOffset(GameDataBaseDefs::CBBF_ROOFPROFILES,
+											   GetStringV2(AreaData, Roof.udProfile));  
+  pNRoof->Roof.Init(m_pGDBase->GetCBBFileHandle(GameDataBaseDefs::CBBF_ROOFPROFILES), 
+					udOffset, 
+					hEntity);
+  ASSERT_MSG(pNRoof->Roof.IsInitOk(), "Problemas creando Roof");	
+  pNRoof->Roof.SetElevation(Roof.Elevation);
+  if (Roof.ubShowUnder) {
+	m_Map.ShowUnderRoofs.insert(hEntity);	
+  }
+  
+  // Se asocia el handle a la celda
+  m_Map.pRoofGrid[TileIndex] = hEntity;    
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Crea una entidad (objeto de escenario, criatura o pared) desde la
+//   seccion de entidades v2, junto a sus posibles items.
+// Parametros:
+// - AreaData. Fichero v2 en memoria.
+// - udEntity. Indice del registro de la entidad.
+// - TilePos. Posicion de la celda.
+// Devuelve:
+// Notas:
+// - Se seguiran los mismos pasos que en LoadSceneObjs, LoadCriatures y
+//   LoadWalls para los ficheros v1.
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::LoadEntityV2(const sAreaV2Data& AreaData,
+					const dword udEntity,
+					const AreaDefs::sTilePos& TilePos)
+{
+  // Se toma el registro y el nombre de su perfil
+  const CBDefs::sAreaV2Entity& Entity = AreaData.pEntities[udEntity];
+  const std::string szProfile(GetStringV2(AreaData, Entity.udProfile));
+
+  // Se crea segun sea el tipo
+  switch(Entity.ubType) {
+	case CBDefs::AREAV2_SCENE_OBJ: {
+	  // Objeto de escenario
+	  sNSceneObj* const pNSceneObj = new sNSceneObj;
+	  ASSERT(pNSceneObj);	
+	  const AreaDefs::EntHandle hEntity = CreateLoadHandle(RulesDefs::SCENE_OBJ);  
+	  dword udOffset = m_pGDBase->GetCBBFileOffset(GameDataBaseDefs::CBBF_SCENEOBJPROFILES,
+												   szProfile);  
+	  pNSceneObj->SceneObj.Init(m_pGDBase->GetCBBFileHandle(GameDataBaseDefs::CBBF_SCENEOBJPROFILES), 
+								udOffset, 
+								hEntity);
+	  ASSERT_MSG(pNSceneObj->SceneObj.IsInitOk(), "Problemas creando SceneObj");
+	  m_Map.SceneObjs.Insert(hEntity, pNSceneObj);
+	  InsertTag(hEntity, GetStringV2(AreaData, Entity.udTag));
+	  pNSceneObj->SceneObj.SetElevation(Entity.Elevation);
+	  InsertWorldEntityInTile(hEntity, TilePos);
+	  SetLight(hEntity, Entity.Light);
+
+	  // Items en contenedor
+	  // Nota: Si el objeto de escenario no fuera contenedor, no se le cargara nada	
+	  LoadItemsV2(AreaData,
+				  Entity.udFirstItem,
+				  Entity.uwNumItems,
+				  pNSceneObj->SceneObj.GetItemContainer(), 
+				  NULL,
+				  pNSceneObj->SceneObj.GetEntityType(),
+				  TilePos);
+	} break;
+
+	case CBDefs::AREAV2_CRIATURE: {
+	  // Criatura
+	  sNCriature* const pNCriature = new sNCriature;
+	  ASSERT(pNCriature);
+	  const AreaDefs::EntHandle hEntity = CreateLoadHandle(RulesDefs::CRIATURE);
+	  dword udOffset = m_pGDBase->GetCBBFileOffset(GameDataBaseDefs::CBBF_CRIATUREPROFILES,
+												   szProfile);  		  
+	  pNCriature->Criature.Init(m_pGDBase->GetCBBFileHandle(GameDataBaseDefs::CBBF_CRIATUREPROFILES), 
+								udOffset, 
+								hEntity);	  
+	  ASSERT_MSG(pNCriature->Criature.IsInitOk(), "Problemas creando Criature");
+	  m_Map.Criatures.Insert(hEntity, pNCriature);
+	  pNCriature->Criature.SetTempCriature((Entity.ubFlags & CBDefs::AREAV2_TMP_CRIATURE) != 0);
+	  InsertTag(hEntity, GetStringV2(AreaData, Entity.udTag));
+	  pNCriature->Criature.SetElevation(Entity.Elevation);
+	  InsertWorldEntityInTile(hEntity, TilePos);
+	  SetLight(hEntity, Entity.Light);
+
+	  // Items en inventario y equipados
+	  LoadItemsV2(AreaData,
+				  Entity.udFirstItem,
+				  Entity.uwNumItems,
+				  pNCriature->Criature.GetItemContainer(), 
+				  &pNCriature->Criature,
+				  pNCriature->Criature.GetEntityType(),
+				  TilePos);
+
+	  // Se asocia area como observer de la criatura
+	  pNCriature->Criature.AddObserver(this);	
+	} break;
+
+	case CBDefs::AREAV2_WALL: {
+	  // Pared
+	  // Nota: Por defecto una pared se hallara bloqueada
+	  const AreaDefs::EntHandle hEntity = CreateLoadHandle(RulesDefs::WALL);	
+	  sNWall* const pNWall = new sNWall;
+	  ASSERT(pNWall);
+	  dword udOffset = m_pGDBase->GetCBBFileOffset(GameDataBaseDefs::CBBF_WALLPROFILES,
+												   szProfile);  	
+	  pNWall->Wall.Init(m_pGDBase->GetCBBFileHandle(GameDataBaseDefs::CBBF_WALLPROFILES), 
+						udOffset, 
+						hEntity);
+	  ASSERT_MSG(pNWall->Wall.IsInitOk(), "Problemas creando pared");
+	  m_Map.Walls.Insert(hEntity, pNWall);
+	  InsertTag(hEntity, GetStringV2(AreaData, Entity.udTag));
+	  pNWall->Wall.SetElevation(Entity.Elevation);
+	  InsertWorldEntityInTile(hEntity, TilePos);
+	  SetLight(hEntity, Entity.Light);
+	  if (!(Entity.ubFlags & CBDefs::AREAV2_BLOCK_ACCESS)) {
+		pNWall->Wall.UnblockAccess();	
+	  } 
+	} break;
+
+	default:
+	  SYSEngine::FatalError("Error> rea %u con entidad %u de tipo no vlido\n", m_Map.uwID, udEntity);
+  }; // ~ switch
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Crea los items de una lista de la seccion de items v2, situandolos en
+//   el suelo, en el contenedor o equipandolos segun proceda.
+// Parametros:
+// - AreaData. Fichero v2 en memoria.
+// - udFirstItem. Indice del primer registro de item.
+// - uwNumItems. Numero de items.
+// - pContainer. Contenedor, si procede.
+// - pCriature. Criatura en la que equipar los items, si procede.
+// - EntityType. Tipo de la entidad propietaria de la lista.
+// - TilePos. Posicion de la celda.
+// Devuelve:
+// Notas:
+// - Los items asociados a objetos de escenario no contenedores se ignoraran,
+//   tal y como sucede con los ficheros v1.
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::LoadItemsV2(const sAreaV2Data& AreaData,
+				   const dword udFirstItem,
+				   const word uwNumItems,
+				   iCItemContainer* const pContainer,
+				   CCriature* const pCriature,
+				   const RulesDefs::eEntityType& EntityType,
+				   const AreaDefs::sTilePos& TilePos)
+{
+  // Lista vacia o de un obj. de escenario NO contenedor?
+  if (!uwNumItems ||
+	  (RulesDefs::SCENE_OBJ == EntityType && !pContainer)) {
+	return;
+  }
+
+  // Se valida la lista
+  const dword udNumItems = AreaData.pHeader->Sections[CBDefs::AREAV2_ITEMS].udNumRecords;
+  if (udFirstItem > udNumItems || uwNumItems > udNumItems - udFirstItem) {
+	SYSEngine::FatalError("Error> rea %u con lista de items %u no vlida\n", m_Map.uwID, udFirstItem);
+  }
+
+  // Se itera
+  const CBDefs::sAreaV2Item* pItem = AreaData.pItems + udFirstItem;
+  const CBDefs::sAreaV2Item* const pEndItem = pItem + uwNumItems;
+  for (; pItem < pEndItem; ++pItem) {
+	// Establece el nuevo handle y se crea instancia
+	const AreaDefs::EntHandle hItem = CreateLoadHandle(RulesDefs::ITEM);	
+	sNItem* const pNewItem = new sNItem;
+	ASSERT(pNewItem);
+	dword udOffset = m_pGDBase->GetCBBFileOffset(GameDataBaseDefs::CBBF_ITEMPROFILES,
+												 GetStringV2(AreaData, pItem->udProfile));
+	pNewItem->Item.Init(m_pGDBase->GetCBBFileHandle(GameDataBaseDefs::CBBF_ITEMPROFILES), 
+						udOffset, 
+						hItem);
+	ASSERT(pNewItem->Item.IsInitOk());	  
+  	
+	// Se establecen valores basicos y se inserta entidad en el map
+	pNewItem->Item.SetOwner(0);
+	pNewItem->Item.SetElevation(0);  	  
+	m_Map.Items.Insert(hItem, pNewItem);      
+
+	// Se situa en el universo, en el contenedor o en el slot
+	if (EntityType == RulesDefs::FLOOR) {
+	  InsertWorldEntityInTile(hItem, TilePos);
+	} else if (pItem->ubSlot != CBDefs::AreaV2NoSlot) {
+	  ASSERT(pCriature);
+	  pCriature->InitEquipmentSlots(hItem, RulesDefs::eIDEquipmentSlot(pItem->ubSlot));
+	} else {
+	  ASSERT(pContainer);
+	  pContainer->Insert(hItem);	
+	}  
+
+	// Tag y luz asociada	
+	InsertTag(hItem, GetStringV2(AreaData, pItem->udTag));
+	SetLight(hItem, pItem->Light);  
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene una cadena de la seccion de cadenas v2.
+// Parametros:
+// - AreaData. Fichero v2 en memoria.
+// - udOffset. Offset de la cadena en la seccion.
+// Devuelve:
+// - La cadena, terminada en nulo.
+// Notas:
+// - La validez de la terminacion de la seccion ya se comprobo al leerla.
+///////////////////////////////////////////////////////////////////////////////
+const sbyte*
+CArea::GetStringV2(const sAreaV2Data& AreaData,
+				   const dword udOffset)
+{
+  // Se valida el offset y se retorna la cadena
+  if (udOffset >= AreaData.udStringsSize) {
+	SYSEngine::FatalError("Error> rea %u con cadena %u no vlida\n", m_Map.uwID, udOffset);
+  }
+  return AreaData.psbStrings + udOffset;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Calcula las firmas de las celdas con contenido tal y como se acaban de
+//   cargar del archivo de area base v2.
+// Parametros:
+// - DeltaCells. Celdas cargadas desde el fichero temporal, que no tendran
+//   firma (vacio si no se cargo ninguna).
+// Devuelve:
+// Notas:
+// - Se llamara al final de la carga, antes de ejecutar cualquier script,
+//   luego las firmas representaran el contenido original de las celdas.
+// - Las firmas incluiran las criaturas temporales, de tal forma que las
+//   celdas que las contengan se guarden sin ellas en los cambios de area.
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::BuildCellSignatures(const std::vector<bool>& DeltaCells)
+{
+  // SOLO si area cargada
+  ASSERT(IsAreaLoaded());
+
+  // Se prepara el vector de firmas
+  const dword udMapSize = m_Map.uwWidth * m_Map.uwHeight;
+  m_Map.CellSignatures.clear();
+  m_Map.CellSignatures.resize(udMapSize);
+
+  // Se prepara el fichero en memoria sobre el que serializar las celdas
+  std::string szScratchFile;
+  SYSEngine::PassToString(szScratchFile, "tmp\\Area%ucell.tmp", m_Map.uwID);
+  m_pFileSys->CreateMemFile(szScratchFile);
+  const FileDefs::FileHandle hScratchFile = m_pFileSys->Open(szScratchFile, true);
+  ASSERT(hScratchFile);
+
+  // Se calculan las firmas de las celdas tomadas del archivo base
+  AreaDefs::sTilePos TileIt;
+  TileIt.YTile = 0;
+  for (; TileIt.YTile < m_Map.uwHeight; ++TileIt.YTile) {
+	TileIt.XTile = 0;
+	for (; TileIt.XTile < m_Map.uwWidth; ++TileIt.XTile) {	
+	  const AreaDefs::TileIndex TileIndex = GetTileIdx(TileIt);
+	  if (IsCellIndexWithContent(TileIndex) &&
+		  (DeltaCells.empty() || !DeltaCells[TileIndex])) {
+		SaveCellToScratch(hScratchFile, 
+						  szScratchFile, 
+						  TileIt, 
+						  false, 
+						  m_Map.CellSignatures[TileIndex]);
+	  }
+	}
+  }
+
+  // Se libera el fichero en memoria
+  m_pFileSys->Close(hScratchFile);
+  m_pFileSys->ReleaseMemFile(szScratchFile);
+
+  // Un area sin cambios no debera de producir celdas modificadas
+  ASSERT_MSG((0 == CountModifiedCells()) != 0, "rea sin cambios con celdas modificadas");
+}
+
+#ifdef _SYSASSERT
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Cuenta las celdas firmadas cuyo contenido actual ya no coincide con su
+//   firma, es decir, las que SaveAreaDelta guardaria por haber cambiado.
+// Parametros:
+// Devuelve:
+// - El numero de celdas modificadas.
+// Notas:
+// - Solo se usara para comprobar, justo tras calcular las firmas, que un
+//   area sin cambios no produce ninguna celda en el fichero delta. Las
+//   celdas sin firma (las cargadas del fichero temporal) no se contaran.
+///////////////////////////////////////////////////////////////////////////////
+word
+CArea::CountModifiedCells(void)
+{
+  // SOLO si area cargada
+  ASSERT(IsAreaLoaded());
+
+  // Se prepara el fichero en memoria sobre el que serializar las celdas
+  std::string szScratchFile;
+  SYSEngine::PassToString(szScratchFile, "tmp\\Area%ucell.tmp", m_Map.uwID);
+  m_pFileSys->CreateMemFile(szScratchFile);
+  const FileDefs::FileHandle hScratchFile = m_pFileSys->Open(szScratchFile, true);
+  ASSERT(hScratchFile);
+
+  // Se comparan las celdas firmadas con su firma
+  word uwNumCells = 0;
+  AreaDefs::sTilePos TileIt;
+  TileIt.YTile = 0;
+  for (; TileIt.YTile < m_Map.uwHeight; ++TileIt.YTile) {
+	TileIt.XTile = 0;
+	for (; TileIt.XTile < m_Map.uwWidth; ++TileIt.XTile) {	
+	  const AreaDefs::TileIndex TileIndex = GetTileIdx(TileIt);
+	  const sCellSignature& BaseSignature = m_Map.CellSignatures[TileIndex];
+	  if (IsCellIndexWithContent(TileIndex) && BaseSignature.udSize) {
+		sCellSignature Signature;
+		SaveCellToScratch(hScratchFile, szScratchFile, TileIt, false, Signature);
+		if (BaseSignature.udSize != Signature.udSize ||
+			BaseSignature.udHash != Signature.udHash) {
+		  ++uwNumCells;
+		}
+	  }
+	}
+  }
+
+  // Se libera el fichero en memoria y se retorna
+  m_pFileSys->Close(hScratchFile);
+  m_pFileSys->ReleaseMemFile(szScratchFile);
+  return uwNumCells;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Serializa una celda al comienzo de un fichero residente en memoria y
+//   calcula su firma.
+// Parametros:
+// - hScratchFile. Handle al fichero residente.
+// - szScratchFile. Nombre del fichero residente.
+// - TilePos. Posicion de la celda.
+// - bIsChangingArea. Indica si se esta guardando el area por un cambio.
+// - Signature. Firma de la celda.
+// Devuelve:
+// - El contenido serializado, de Signature.udSize bytes.
+// Notas:
+// - El contenido solo sera valido hasta la siguiente escritura.
+// - Se utilizara el hash FNV-1a de 32 bits.
+///////////////////////////////////////////////////////////////////////////////
+const sbyte* const
+CArea::SaveCellToScratch(const FileDefs::FileHandle& hScratchFile,
+						 const std::string& szScratchFile,
+						 const AreaDefs::sTilePos& TilePos,
+						 const bool bIsChangingArea,
+						 sCellSignature& Signature)
+{
+  // SOLO si parametros validos
+  ASSERT(hScratchFile);
+
+  // Se serializa la celda
+  dword udSize = 0;
+  SaveCellInfo(hScratchFile, udSize, TilePos, bIsChangingArea);
+  const sbyte* const psbData = m_pFileSys->GetMemFileData(szScratchFile);
+  ASSERT(psbData);
+
+  // Se calcula la firma
+  dword udHash = 2166136261;
+  dword udIt = 0;
+  for (; udIt < udSize; ++udIt) {
+	udHash = (udHash ^ byte(psbData[udIt])) * 16777619;
+  }
+  Signature.udSize = udSize;
+  Signature.udHash = udHash;
+
+  // Se retorna el contenido
+  return psbData;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Crea la tabla de bloques de celdas segun las dimensiones del area. Todos
+//   los bloques referiran inicialmente al bloque vacio compartido.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::CreateCellChunks(void)
+{
+  // SOLO si no hay bloques creados
+  ASSERT(!m_Map.ppCellChunks);
+
+  // Se calculan las dimensiones de la tabla de bloques
+  m_Map.uwCellChunksWidth = (m_Map.uwWidth + AreaDefs::CELL_CHUNK_MASK) >> AreaDefs::CELL_CHUNK_SHIFT;
+  m_Map.uwCellChunksHeight = (m_Map.uwHeight + AreaDefs::CELL_CHUNK_MASK) >> AreaDefs::CELL_CHUNK_SHIFT;
+  
+  // Se crea la tabla, con todos los bloques vacios
+  const word uwNumChunks = m_Map.uwCellChunksWidth * m_Map.uwCellChunksHeight;
+  m_Map.ppCellChunks = new sCellChunk*[uwNumChunks];
+  ASSERT(m_Map.ppCellChunks);
+  word uwIt = 0;
+  for (; uwIt < uwNumChunks; ++uwIt) {
+	m_Map.ppCellChunks[uwIt] = &m_EmptyCellChunk;
+  }
+  m_Map.uwNumPagedInChunks = 0;
+  m_Map.udCellChunksUpdate = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Libera la tabla de bloques de celdas junto a las celdas residentes.
+// Parametros:
+// Devuelve:
+// Notas:
+// - Las celdas descargadas no tendran instancias asociadas, bastara con
+//   liberar el bloque.
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::ReleaseCellChunks(void)
+{
+  // Hay bloques creados?
+  if (m_Map.ppCellChunks) {
+	// Si, se liberan los bloques con celdas
+	const word uwNumChunks = m_Map.uwCellChunksWidth * m_Map.uwCellChunksHeight;
+	word uwChunkIt = 0;
+	for (; uwChunkIt < uwNumChunks; ++uwChunkIt) {
+	  sCellChunk* const pChunk = m_Map.ppCellChunks[uwChunkIt];
+	  if (pChunk != &m_EmptyCellChunk) {
+		word uwCellIt = 0;
+		for (; uwCellIt < AreaDefs::CELL_CHUNK_TILES; ++uwCellIt) {
+		  if (pChunk->Cells[uwCellIt]) {
+			delete pChunk->Cells[uwCellIt];
+		  }
+		}
+		delete pChunk;
+	  }
+	}
+
+	// Se borra la tabla
+	delete[] m_Map.ppCellChunks;
+	m_Map.ppCellChunks = NULL;
+  }
+
+  // Se resetean vbles
+  m_Map.uwCellChunksWidth = 0;
+  m_Map.uwCellChunksHeight = 0;
+  m_Map.uwNumPagedInChunks = 0;
+  m_Map.udCellChunksUpdate = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Asocia una celda recien creada a su posicion, creando el bloque en el
+//   que se halle si este aun era el bloque vacio compartido.
+// Parametros:
+// - TileIdx. Indice de la celda.
+// - pCell. Instancia a la celda.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::SetCell(const AreaDefs::TileIndex& TileIdx,
+			   sNCell* const pCell)
+{
+  // SOLO si parametros validos
+  ASSERT(pCell);
+
+  // Se localiza el bloque, creandolo si procede
+  word uwChunk;
+  word uwCell;
+  GetCellChunkPos(TileIdx, uwChunk, uwCell);
+  sCellChunk* pChunk = m_Map.ppCellChunks[uwChunk];
+  if (pChunk == &m_EmptyCellChunk) {
+	pChunk = new sCellChunk;
+	ASSERT(pChunk);
+	pChunk->udLastUse = m_Map.udCellChunksUpdate;
+	m_Map.ppCellChunks[uwChunk] = pChunk;
+	++m_Map.uwNumPagedInChunks;
+  }
+
+  // Se asocia la celda y se marca como celda con contenido
+  ASSERT(!pChunk->bPagedOut);
+  ASSERT(!pChunk->Cells[uwCell]);
+  pChunk->Cells[uwCell] = pCell;
+  pChunk->udContent[uwCell >> 5] |= (1 << (uwCell & 0x1F));
+
+  // Se asocia el floor en la rejilla de floors
+  ASSERT(!m_Map.ppFloorGrid[TileIdx]);
+  m_Map.ppFloorGrid[TileIdx] = &pCell->Floor;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Vuelve a crear las celdas descargadas de un bloque.
+// Parametros:
+// - uwChunk. Indice del bloque.
+// Devuelve:
+// Notas:
+// - Las celdas se reconstruiran con el mismo formato con el que se guarda
+//   el floor en los ficheros temporales, a traves de un fichero residente
+//   en memoria.
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::PageInCellChunk(const word uwChunk)
+{
+  // SOLO si bloque con celdas descargadas
+  sCellChunk* const pChunk = m_Map.ppCellChunks[uwChunk];
+  ASSERT(pChunk->bPagedOut);
+  ASSERT(!pChunk->PagedCells.empty());
+
+  // Se prepara el fichero en memoria con los datos de las celdas
+  std::string szScratchFile;
+  SYSEngine::PassToString(szScratchFile, "tmp\\Area%upage.tmp", m_Map.uwID);
+  m_pFileSys->CreateMemFile(szScratchFile);
+  const FileDefs::FileHandle hScratchFile = m_pFileSys->Open(szScratchFile, true);
+  ASSERT(hScratchFile);
+  const dword udSize = pChunk->PagedCells.size();
+  m_pFileSys->Write(hScratchFile, 0, &pChunk->PagedCells[0], udSize);
+
+  // Se crean las celdas: posicion en el bloque / elevacion / floor
+  dword udOffset = 0;
+  while (udOffset < udSize) {
+	word uwCell;
+	udOffset += m_pFileSys->Read(hScratchFile, 
+								 (sbyte *)(&uwCell), 
+								 sizeof(word), 
+								 udOffset);
+	RulesDefs::Elevation Elevation;
+	udOffset += m_pFileSys->Read(hScratchFile, 
+								 (sbyte *)(&Elevation), 
+								 sizeof(RulesDefs::Elevation), 
+								 udOffset);
+	ASSERT((uwCell < AreaDefs::CELL_CHUNK_TILES) != 0);
+	ASSERT(!pChunk->Cells[uwCell]);
+	sNCell* const pCell = new sNCell;
+	ASSERT(pCell);
+	pCell->Floor.Init(hScratchFile, udOffset);
+	ASSERT_MSG(pCell->Floor.IsInitOk(), "Problemas creando Floor");
+	pCell->Floor.SetElevation(Elevation);
+	pChunk->Cells[uwCell] = pCell;
+	m_Map.ppFloorGrid[GetCellChunkTileIdx(uwChunk, uwCell)] = &pCell->Floor;
+  }
+
+  // Se libera el fichero en memoria y los datos de las celdas
+  m_pFileSys->Close(hScratchFile);
+  m_pFileSys->ReleaseMemFile(szScratchFile);
+  std::vector<sbyte>().swap(pChunk->PagedCells);
+
+  // Se actualiza el estado del bloque
+  pChunk->bPagedOut = false;
+  ++m_Map.uwNumPagedInChunks;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Descarga las celdas de un bloque que solo contengan el floor, guardando
+//   los datos necesarios para volver a crearlas.
+// Parametros:
+// - uwChunk. Indice del bloque.
+// Devuelve:
+// - Si se descargo alguna celda true. En caso contrario false.
+// Notas:
+// - Las celdas con entidades, o cuyo floor tenga scripts pendientes, se
+//   mantendran siempre residentes.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CArea::PageOutCellChunk(const word uwChunk)
+{
+  // SOLO si bloque con todas sus celdas residentes
+  sCellChunk* const pChunk = m_Map.ppCellChunks[uwChunk];
+  ASSERT((pChunk != &m_EmptyCellChunk) != 0);
+  ASSERT(!pChunk->bPagedOut);
+
+  // Se prepara el fichero en memoria sobre el que guardar las celdas
+  std::string szScratchFile;
+  SYSEngine::PassToString(szScratchFile, "tmp\\Area%upage.tmp", m_Map.uwID);
+  m_pFileSys->CreateMemFile(szScratchFile);
+  const FileDefs::FileHandle hScratchFile = m_pFileSys->Open(szScratchFile, true);
+  ASSERT(hScratchFile);
+
+  // Se guardan y liberan las celdas que solo contengan el floor
+  iCVirtualMachine* const pVMachine = SYSEngine::GetVirtualMachine();
+  ASSERT(pVMachine);
+  dword udOffset = 0;
+  word uwCell = 0;
+  for (; uwCell < AreaDefs::CELL_CHUNK_TILES; ++uwCell) {
+	sNCell* const pCell = pChunk->Cells[uwCell];
+	if (!pCell ||
+		!pCell->Entities.empty() ||
+		pVMachine->IsClientWithScripts(&pCell->Floor)) {
+	  continue;
+	}
+	udOffset += m_pFileSys->Write(hScratchFile, udOffset, (sbyte *)(&uwCell), sizeof(word));
+	const RulesDefs::Elevation Elevation = pCell->Floor.GetElevation();
+	udOffset += m_pFileSys->Write(hScratchFile, udOffset, (sbyte *)(&Elevation), sizeof(RulesDefs::Elevation));
+	pCell->Floor.Save(hScratchFile, udOffset);
+	delete pCell;
+	pChunk->Cells[uwCell] = NULL;
+	m_Map.ppFloorGrid[GetCellChunkTileIdx(uwChunk, uwCell)] = NULL;
+  }
+
+  // Se descargo alguna celda?
+  if (udOffset) {
+	// Si, se toman los datos y se actualiza el estado del bloque
+	const sbyte* const psbData = m_pFileSys->GetMemFileData(szScratchFile);
+	ASSERT(psbData);
+	pChunk->PagedCells.assign(psbData, psbData + udOffset);
+	pChunk->bPagedOut = true;
+	--m_Map.uwNumPagedInChunks;
+  }
+
+  // Se libera el fichero en memoria
+  m_pFileSys->Close(hScratchFile);
+  m_pFileSys->ReleaseMemFile(szScratchFile);
+  return pChunk->bPagedOut;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Actualiza los bloques de celdas residentes. Se mantendran los bloques
+//   visibles y los que rodeen a estos o a las criaturas, descargandose el
+//   resto, por orden de antiguedad de uso, mientras el numero de bloques 
+//   residentes supere el maximo permitido.
+// - Para repartir el trabajo entre actualizaciones, se cargara por
+//   adelantado como mucho un bloque descargado de los que rodean a la zona
+//   visible y se descargaran como mucho MAX_CELL_CHUNK_PAGE_OUTS bloques.
+// Parametros:
+// - InitTilePos, EndTilePos. Region de tiles visible.
+// Devuelve:
+// Notas:
+// - Las celdas descargadas se volveran a cargar desde GetCell en cuanto se
+//   acceda a ellas, por lo que nunca se pierde informacion; solo se limita
+//   la memoria ocupada por las celdas alejadas. Con la carga adelantada, 
+//   un desplazamiento normal de la camara no encontrara bloques descargados
+//   al dibujar.
+///////////////////////////////////////////////////////////////////////////////
+void
+CArea::UpdateCellChunks(const AreaDefs::sTilePos& InitTilePos,
+						const AreaDefs::sTilePos& EndTilePos)
+{
+  // SOLO si area cargada
+  ASSERT(IsInitOk() && IsAreaLoaded());
+
+  // Se marcan como usados los bloques visibles y sus adyacentes, cargando
+  // por adelantado uno de ellos si estuviera descargado
+  ++m_Map.udCellChunksUpdate;
+  const word uwPagedOutChunk = MarkCellChunksInUse(InitTilePos, EndTilePos);
+  if (uwPagedOutChunk != AreaDefs::NO_CELL_CHUNK) {
+	PageInCellChunk(uwPagedOutChunk);
+  }
+  
+  // NO se supera el maximo de bloques residentes?
+  if (m_Map.uwNumPagedInChunks <= AreaDefs::MAX_RESIDENT_CELL_CHUNKS) {
+	return;
+  }
+
+  // Se marcan como usados los bloques que rodean a las criaturas
+  if (m_PlayerInfo.pPlayer) {
+	MarkCellChunksInUse(m_PlayerInfo.pPlayer->GetTilePos(), 
+						m_PlayerInfo.pPlayer->GetTilePos());
+  }
+  word uwIt = 0;
+  for (; uwIt < m_Map.Criatures.GetSize(); ++uwIt) {
+	CCriature* const pCriature = &m_Map.Criatures.GetAt(uwIt)->Criature;
+	MarkCellChunksInUse(pCriature->GetTilePos(), pCriature->GetTilePos());
+  }
+
+  // Se ordenan los bloques residentes no usados por antiguedad de uso
+  typedef std::vector<std::pair<dword, word> > ChunkUseVector;
+  ChunkUseVector Chunks;
+  const word uwNumChunks = m_Map.uwCellChunksWidth * m_Map.uwCellChunksHeight;
+  for (uwIt = 0; uwIt < uwNumChunks; ++uwIt) {
+	const sCellChunk* const pChunk = m_Map.ppCellChunks[uwIt];
+	if (pChunk != &m_EmptyCellChunk &&
+		!pChunk->bPagedOut &&
+		pChunk->udLastUse != m_Map.udCellChunksUpdate) {
+	  Chunks.push_back(std::make_pair(pChunk->udLastUse, uwIt));
+	}
+  }
+  std::sort(Chunks.begin(), Chunks.end());
+
+  // Se descargan hasta no superar el maximo o el limite por actualizacion
+  ChunkUseVector::iterator It(Chunks.begin());
+  word uwNumPageOuts = 0;
+  for (; 
+	   It != Chunks.end() && 
+	   m_Map.uwNumPagedInChunks > AreaDefs::MAX_RESIDENT_CELL_CHUNKS &&
+	   uwNumPageOuts < AreaDefs::MAX_CELL_CHUNK_PAGE_OUTS; 
+	   ++It) {
+	if (PageOutCellChunk(It->second)) {
+	  ++uwNumPageOuts;
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Marca como usados en la actualizacion actual los bloques de celdas que
+//   contengan la region recibida, asi como los adyacentes a esta.
+// Parametros:
+// - InitTilePos, EndTilePos. Region de tiles.
+// Devuelve:
+// - El primer bloque marcado con celdas descargadas o NO_CELL_CHUNK.
+// Notas:
+// - No se cargaran las celdas de los bloques marcados; eso se hara al
+//   acceder a ellas o desde UpdateCellChunks.
+///////////////////////////////////////////////////////////////////////////////
+word
+CArea::MarkCellChunksInUse(const AreaDefs::sTilePos& InitTilePos,
+						   const AreaDefs::sTilePos& EndTilePos)
+{
+  // Se calcula la region de bloques, ampliada en un bloque y ajustada
+  sword swInitX = (InitTilePos.XTile >> AreaDefs::CELL_CHUNK_SHIFT) - 1;
+  sword swInitY = (InitTilePos.YTile >> AreaDefs::CELL_CHUNK_SHIFT) - 1;
+  sword swEndX = (EndTilePos.XTile >> AreaDefs::CELL_CHUNK_SHIFT) + 1;
+  sword swEndY = (EndTilePos.YTile >> AreaDefs::CELL_CHUNK_SHIFT) + 1;
+  if (swInitX < 0) { swInitX = 0; }
+  if (swInitY < 0) { swInitY = 0; }
+  if (swEndX >= m_Map.uwCellChunksWidth) { swEndX = m_Map.uwCellChunksWidth - 1; }
+  if (swEndY >= m_Map.uwCellChunksHeight) { swEndY = m_Map.uwCellChunksHeight - 1; }
+
+  // Se marcan los bloques, tomando el primero con celdas descargadas
+  word uwPagedOutChunk = AreaDefs::NO_CELL_CHUNK;
+  sword swY = swInitY;
+  for (; swY <= swEndY; ++swY) {
+	sword swX = swInitX;
+	for (; swX <= swEndX; ++swX) {
+	  const word uwChunk = swY * m_Map.uwCellChunksWidth + swX;
+	  sCellChunk* const pChunk = m_Map.ppCellChunks[uwChunk];
+	  pChunk->udLastUse = m_Map.udCellChunksUpdate;
+	  if (pChunk->bPagedOut && AreaDefs::NO_CELL_CHUNK == uwPagedOutChunk) {
+		uwPagedOutChunk = uwChunk;
+	  }
+	}
+  }
+
+  // Se retorna
+  return uwPagedOutChunk;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Completa los datos de un archivo de partida salvada, almacenando toda 
+//   la informacion realativa al jugador y a las areas temporales.
+// Parametros:
+// - hFile. Handle al fichero que hace de partida guardada.
+// - udOffset. Offset donde comenzar a depositar los datos.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::SaveGame(const FileDefs::FileHandle& hFile,
+				dword& udOffset)
+{
+  // SOLO si instancia inicializada y cargada
+  ASSERT(IsInitOk());
+  ASSERT(IsAreaLoaded());
+  // SOLO si parametros validos
+  ASSERT(hFile);
+
   // Identificador del area actual
   udOffset += m_pFileSys->Write(hFile, 
 								udOffset, 
@@ -2168,6 +3645,8 @@ CArea::SetLight(const AreaDefs::EntHandle& hEntity,
 // - bUpdatePos. Indica si se esta actualizando o no una posicion.
 // Devuelve:
 // Notas:
+// - La region a recorrer sera la que el foco tenga registrada, por lo que no
+//   sera necesario actualizar su posicion antes de quitar su luz.
 ///////////////////////////////////////////////////////////////////////////////
 void
 CArea::RemoveLight(const AreaDefs::EntHandle& hEntity,
@@ -2182,60 +3661,29 @@ CArea::RemoveLight(const AreaDefs::EntHandle& hEntity,
   const LightFocusInfoMapIt FocusIt(m_DinamicLightInfo.LightFocus.find(hEntity));
   ASSERT((FocusIt != m_DinamicLightInfo.LightFocus.end()) != 0);
   
-  // Se calcula la region que abarca el foco
-  AreaDefs::sTilePos InitTilePos, EndTilePos;
-  CalculeLightFocusRegion(FocusIt->second.TilePos, 
-						  FocusIt->second.LightIntensity,
-						  InitTilePos,
-						  EndTilePos);
-
-  // Estructura de luz vacia para comparar
-  const GraphDefs::sLight CmpLightValue;
-
-  // Se recorre la region que abarca el foco y para cada posicion, se obtendra
-  // la posible entrada asociada con informacion de iluminacion.
-  AreaDefs::sTilePos TilePosIt(InitTilePos);
-  for (; TilePosIt.YTile < EndTilePos.YTile; ++TilePosIt.YTile) {
-	TilePosIt.XTile = InitTilePos.XTile;
-	for (; TilePosIt.XTile <= EndTilePos.XTile; ++TilePosIt.XTile) {
-	  // Se crea indice asociado a la posicion
-	  const AreaDefs::TileIndex TileIdx = GetTileIdx(TilePosIt);
-	  // Hay nodo de info. luminosa asociada a la posicion?
-	  const LightInTilePosInfoMapIt LightInfoIt(m_DinamicLightInfo.LightInTilePos.find(TileIdx));
-	  if (LightInfoIt != m_DinamicLightInfo.LightInTilePos.end()) {
-		// Si, para cada vertice, se hallara la entrada del foco y se eliminara
-		// recalculando el valor maximo de luz en el vertice si fuera necesario
-		byte ubVertex = 0;
-		for (; ubVertex < 4; ++ubVertex) {
-		  // Hay informacion del foco asociada?
-		  const VertexTileLightMapIt FocusLightIt(LightInfoIt->second.LightsInVertex[ubVertex].find(hEntity));
-		  if (FocusLightIt != LightInfoIt->second.LightsInVertex[ubVertex].end()) {
-			// Se borra nodo de informacion, guardando su valor de luz
-			const GraphDefs::Light FocusLight = FocusLightIt->second;
-			LightInfoIt->second.LightsInVertex[ubVertex].erase(FocusLightIt);
-			// Hay que recalcular el valor maximo de luz?
-		    // Nota: lo sera si el valor del luz es igual a la intensidad del foco.
-		    // (no podra ser mayor, ya que el valor mayor siempre ser el valor
-		    // de luz asociado al vertice).			
-		    if (LightInfoIt->second.TileLight.VertexLight[ubVertex] == FocusLight) {
-			  // Si, se calcula cual es la intensidad de luz asociado al vertice
-			  CalculeAndSetMaxLightInTilePos(LightInfoIt, ubVertex);
-			}		  			
-		  }		  
-		} // ~ for
-
-		// La luz que incide sobre la posicion es 0 en todos los vertices?
-		if (LightInfoIt->second.TileLight == CmpLightValue) {
-		  // Si, luego ya no hay informacion y se borrara el nodo
-		  m_DinamicLightInfo.LightInTilePos.erase(LightInfoIt);
-		}
-	  }
-	}	
+  // El foco incide sobre la rejilla de luz?
+  if (FocusIt->second.bInMap) {
+	// Si, se desvincula y se recorre la region en donde incidia, de tal forma
+	// que en los vertices donde su luz fuera la maxima se recalcule esta
+	const sLightFocusInfo PrevFocusInfo(FocusIt->second);
+	FocusIt->second.bInMap = false;
+	dword udVisitedTiles = 0;
+	dword udRecalcTiles = 0;
+	UpdateLightFocusRegion(PrevFocusInfo.InitTilePos,
+						   PrevFocusInfo.EndTilePos,
+						   PrevFocusInfo,
+						   FocusIt->second,
+						   false,
+						   udVisitedTiles,
+						   udRecalcTiles);
   }
 
   // NO se estaba actualizando una posicion?
   if (!bUpdatePos) {
 	// No se estaba, luego se borrara la entrada del foco luminoso
+	#ifdef LIGHTING_PROFILE
+	  WriteLightFocusProfile(hEntity, FocusIt->second);
+	#endif
 	m_DinamicLightInfo.LightFocus.erase(FocusIt);
   }
 }
@@ -2246,9 +3694,9 @@ CArea::RemoveLight(const AreaDefs::EntHandle& hEntity,
 //   para ajustar valores. En caso de que se reciba el flag bNewFocus levantado,
 //   significara que el foco es nuevo y se debera de crear una entrada para
 //   el mismo. En caso contrario, que se trata de una modificacion de intensidad.
-// - Cuando el establecimiento se deba a una actualizacion, se debera de recorrer
-//   el rango que comprende la posicion original de la entidad y la nueva, 
-//   realizando identicas operaciones.
+// - Cuando el establecimiento se deba a una actualizacion, se recorrera la 
+//   nueva region del foco y, de la region original, solo aquellas posiciones
+//   que hayan quedado fuera de la nueva.
 // Parametros:
 // - hEntity. Entidad a la que asociar luz.
 // - LightIntensity. Intensidad de la luz. 
@@ -2258,7 +3706,8 @@ CArea::RemoveLight(const AreaDefs::EntHandle& hEntity,
 // - bNewFocus. Flag de nuevo foco.
 // Devuelve:
 // Notas:
-// - 
+// - Al compilar con LIGHTING_PROFILE, se acumulara el coste de cada 
+//   actualizacion de posicion en el propio foco.
 ///////////////////////////////////////////////////////////////////////////////
 void 
 CArea::SetLightFocusInArea(const AreaDefs::EntHandle& hEntity,
@@ -2292,150 +3741,287 @@ CArea::SetLightFocusInArea(const AreaDefs::EntHandle& hEntity,
 	return;
   }
 
-  // Estructura de luz vacia para comparar
-  const GraphDefs::sLight CmpLightValue;
+  // Se toma el nodo de informacion del foco
+  const LightFocusInfoMapIt FocusIt(m_DinamicLightInfo.LightFocus.find(hEntity));
+  ASSERT((FocusIt != m_DinamicLightInfo.LightFocus.end()) != 0);
+  sLightFocusInfo& FocusInfo = FocusIt->second;
+
+  // El foco ya incide desde esa misma posicion y con esa misma intensidad?
+  if (FocusInfo.bInMap &&
+	  FocusInfo.TilePos == pEntity->GetTilePos() &&
+	  FocusInfo.LightIntensity == LightIntensity) {
+	// Si, no hay nada que actualizar
+	return;
+  }
 
-  // Se halla la posicion universal del foco
-  sPosition WorldFocusPos = m_pWorld->PassTilePosToWorldPos(pEntity->GetTilePos());
-  WorldFocusPos.swXPos += IsoDefs::TILE_WIDTH_DIV;
-  WorldFocusPos.swYPos += IsoDefs::TILE_HEIGHT_DIV;
+  #ifdef LIGHTING_PROFILE
+	iCTimer* const pTimer = SYSEngine::GetTimer();
+	ASSERT(pTimer);
+	const sqword sqInitTime = pTimer->GetTime(TimerDefs::TIMER_UNITS_US);
+  #endif
 
-  // Se calcula la region que abarca el foco
-  AreaDefs::sTilePos InitTilePos, EndTilePos;
-  CalculeLightFocusRegion(pEntity->GetTilePos(),
-						  LightIntensity,
-						  InitTilePos,
-						  EndTilePos);
+  // Se guarda el estado previo del foco y se actualiza posicion y region
+  const sLightFocusInfo PrevFocusInfo(FocusInfo);
+  FocusInfo.LightIntensity = LightIntensity;
+  FocusInfo.TilePos = pEntity->GetTilePos();
+  FocusInfo.WorldPos = m_pWorld->PassTilePosToWorldPos(FocusInfo.TilePos);
+  FocusInfo.WorldPos.swXPos += IsoDefs::TILE_WIDTH_DIV;
+  FocusInfo.WorldPos.swYPos += IsoDefs::TILE_HEIGHT_DIV;
+  CalculeLightFocusRegion(FocusInfo.TilePos,
+						  FocusInfo.LightIntensity,
+						  FocusInfo.InitTilePos,
+						  FocusInfo.EndTilePos);
+  FocusInfo.bInMap = true;
+
+  // Se recorre la nueva region del foco y, si el foco ya incidia, la parte de 
+  // la region previa que no se solape con la nueva
+  dword udVisitedTiles = 0;
+  dword udRecalcTiles = 0;
+  UpdateLightFocusRegion(FocusInfo.InitTilePos,
+						 FocusInfo.EndTilePos,
+						 PrevFocusInfo,
+						 FocusInfo,
+						 false,
+						 udVisitedTiles,
+						 udRecalcTiles);
+  if (PrevFocusInfo.bInMap) {
+	UpdateLightFocusRegion(PrevFocusInfo.InitTilePos,
+						   PrevFocusInfo.EndTilePos,
+						   PrevFocusInfo,
+						   FocusInfo,
+						   true,
+						   udVisitedTiles,
+						   udRecalcTiles);
+  }
 
-  // Es una actualizacion de posicion?
-  if (bUpdatePos) {
-	// Se tiene en cuenta las posiciones originales del foco
-	const LightFocusInfoMapIt FocusIt(m_DinamicLightInfo.LightFocus.find(hEntity));
-	ASSERT((FocusIt != m_DinamicLightInfo.LightFocus.end()) != 0);
-	
-	// Se halla rango en posiciones previas y se recalculan posiciones del actual
-    AreaDefs::sTilePos TmpInitTilePos, TmpEndTilePos;
-	CalculeLightFocusRegion(FocusIt->second.TilePos,
-							LightIntensity,
-							TmpInitTilePos,
-							TmpEndTilePos);
-	if (InitTilePos.XTile > TmpInitTilePos.XTile) {
-	  InitTilePos.XTile = TmpInitTilePos.XTile;
-	}
-	if (InitTilePos.YTile > TmpInitTilePos.YTile) {
-	  InitTilePos.YTile = TmpInitTilePos.YTile;
-	}
-	if (EndTilePos.XTile < TmpEndTilePos.XTile) {
-	  EndTilePos.XTile = TmpEndTilePos.XTile;
+  #ifdef LIGHTING_PROFILE
+	// Se trataba de un movimiento del foco?
+	if (bUpdatePos) {
+	  // Si, se acumula el coste
+	  const dword udTime = dword(pTimer->GetTime(TimerDefs::TIMER_UNITS_US) - sqInitTime);
+	  ++FocusInfo.udNumUpdates;
+	  FocusInfo.udVisitedTiles += udVisitedTiles;
+	  FocusInfo.udRecalcTiles += udRecalcTiles;
+	  FocusInfo.udTotalTime += udTime;
+	  if (udTime > FocusInfo.udMaxTime) {
+		FocusInfo.udMaxTime = udTime;
+	  }
 	}
-	if (EndTilePos.YTile < TmpEndTilePos.YTile) {
-	  EndTilePos.YTile = TmpEndTilePos.YTile;
-	}  	
+  #endif
+}
 
-	// Se actualiza la info de posicion en el nodo de informacion del foco luminoso
-	FocusIt->second.TilePos = pEntity->GetTilePos();	
-  }
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Recorre una region de la rejilla de luz actualizando cada posicion tras
+//   el cambio de estado de un foco.
+// Parametros:
+// - InitTilePos, EndTilePos. Region a recorrer. La ultima fila no se 
+//   considerara parte de la region.
+// - PrevFocusInfo. Estado previo del foco.
+// - FocusInfo. Estado actual del foco.
+// - bSkipFocusRegion. Si vale true, se saltaran las posiciones incluidas en
+//   la region actual del foco (por haber sido ya recorridas).
+// - udVisitedTiles. Contador de posiciones actualizadas.
+// - udRecalcTiles. Contador de posiciones en las que se recalculo el maximo.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::UpdateLightFocusRegion(const AreaDefs::sTilePos& InitTilePos,
+							  const AreaDefs::sTilePos& EndTilePos,
+							  const sLightFocusInfo& PrevFocusInfo,
+							  const sLightFocusInfo& FocusInfo,
+							  const bool bSkipFocusRegion,
+							  dword& udVisitedTiles,
+							  dword& udRecalcTiles)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk() && IsAreaLoaded());
+  ASSERT(m_DinamicLightInfo.pTileLight);
 
-  // Se recorre la region que abarca el foco y para cada posicion, se obtendra
-  // la posible entrada asociada con informacion de iluminacion.
+  // Se recorre la region
   AreaDefs::sTilePos TilePosIt(InitTilePos);
   for (; TilePosIt.YTile < EndTilePos.YTile; ++TilePosIt.YTile) {
 	TilePosIt.XTile = InitTilePos.XTile;
 	for (; TilePosIt.XTile <= EndTilePos.XTile; ++TilePosIt.XTile) {
-	  // Se crea indice asociado a la posicion
-	  const AreaDefs::TileIndex TileIdx = GetTileIdx(TilePosIt);
-	  
-	  // Se toma iterador a nodo de informacion luminosa asociada a la posicion
-	  LightInTilePosInfoMapIt LightInfoIt(m_DinamicLightInfo.LightInTilePos.find(TileIdx));
-	  
-	  // NO hay info. luminosa?
-	  if (LightInfoIt == m_DinamicLightInfo.LightInTilePos.end()) {	
-		// Se crea, se inserta en el map y se asocia iterador
-		sLightInTilePosInfo LightInTilePosInfo(m_pWorld->PassTilePosToWorldPos(TilePosIt));
-		m_DinamicLightInfo.LightInTilePos.insert(LightInTilePosInfoMapValType(TileIdx, LightInTilePosInfo));
-		LightInfoIt = m_DinamicLightInfo.LightInTilePos.find(TileIdx);
+	  // Hay que saltar la posicion por estar en la region actual del foco?
+	  if (bSkipFocusRegion &&
+		  IsTilePosInLightRegion(TilePosIt, FocusInfo)) {
+		// Si, se salta el tramo de la fila que ocupa la region actual
+		TilePosIt.XTile = FocusInfo.EndTilePos.XTile;
+		continue;
 	  }
 
-	  // Se halla la posicion de cada uno de los vertices del tile en
-	  // terminos de posicion universal.	  
-	  sPosition VertexPos[4];
-	  ASSERT((LightInfoIt != m_DinamicLightInfo.LightInTilePos.end()) != 0);
-	  CalculeWorldVertexOfTilePos(LightInfoIt, VertexPos);
+	  // Se actualiza la posicion
+	  ++udVisitedTiles;
+	  if (UpdateLightInTilePos(TilePosIt, PrevFocusInfo, FocusInfo)) {
+		++udRecalcTiles;
+	  }
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Actualiza la luz de una posicion tras el cambio de estado de un foco. 
+//   Cuando en algun vertice la luz maxima fuera la aportada por el foco y esta
+//   disminuya, se recalculara la luz de la posicion a partir de todos los 
+//   focos que incidan en ella. En caso contrario, bastara con quedarse con el
+//   maximo entre la luz actual y la nueva aportacion del foco.
+// Parametros:
+// - TilePos. Posicion a actualizar.
+// - PrevFocusInfo. Estado previo del foco.
+// - FocusInfo. Estado actual del foco.
+// Devuelve:
+// - Si fue necesario recalcular la luz de la posicion true. En caso 
+//   contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+CArea::UpdateLightInTilePos(const AreaDefs::sTilePos& TilePos,
+							const sLightFocusInfo& PrevFocusInfo,
+							const sLightFocusInfo& FocusInfo)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk() && IsAreaLoaded());
+
+  // Se hallan los vertices de la posicion y la luz previa y actual del foco
+  sPosition VertexPos[4];
+  CalculeWorldVertexOfTilePos(TilePos, VertexPos);
+  GraphDefs::sLight PrevFocusLight;
+  if (IsTilePosInLightRegion(TilePos, PrevFocusInfo)) {
+	CalculeFocusLightInTilePos(PrevFocusInfo, VertexPos, PrevFocusLight);
+  }
+  GraphDefs::sLight FocusLight;
+  if (IsTilePosInLightRegion(TilePos, FocusInfo)) {
+	CalculeFocusLightInTilePos(FocusInfo, VertexPos, FocusLight);
+  }
+
+  // En algun vertice la luz maxima era la del foco y esta disminuye?
+  GraphDefs::sLight& TileLight = m_DinamicLightInfo.pTileLight[GetTileIdx(TilePos)];
+  byte ubVertex = 0;
+  for (; ubVertex < 4; ++ubVertex) {
+	if (TileLight.VertexLight[ubVertex] == PrevFocusLight.VertexLight[ubVertex] &&
+	    FocusLight.VertexLight[ubVertex] < PrevFocusLight.VertexLight[ubVertex]) {
+	  // Si, se recalcula la luz de la posicion
+	  CalculeMaxLightInTilePos(TilePos, VertexPos, TileLight);
+	  return true;
+	}
+  }
+
+  // No, se combina la luz actual con la aportada por el foco
+  for (ubVertex = 0; ubVertex < 4; ++ubVertex) {
+	if (FocusLight.VertexLight[ubVertex] > TileLight.VertexLight[ubVertex]) {
+	  TileLight.VertexLight[ubVertex] = FocusLight.VertexLight[ubVertex];
+	}
+  }
+  return false;
+}
 
-	  // Se halla la intensidad de luz proviniente del foco que alcanza
-	  // a cada uno de los vertices de la posicion sobre la que trabajar
-	  iCMathUtil* const pMathUtil = SYSEngine::GetMathUtil();
-	  ASSERT(pMathUtil);
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Calcula la luz de cada uno de los vertices de una posicion, tomando el
+//   valor maximo de entre los aportados por los focos que inciden en ella.
+// Parametros:
+// - TilePos. Posicion.
+// - pVertexPos. Posiciones universales de los vertices de la posicion.
+// - TileLight. Luz a establecer.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::CalculeMaxLightInTilePos(const AreaDefs::sTilePos& TilePos,
+								const sPosition* pVertexPos,
+								GraphDefs::sLight& TileLight)
+{
+  // SOLO si insancia inicializada
+  ASSERT(IsInitOk() && IsAreaLoaded());
+  // SOLO si parametros validos
+  ASSERT(pVertexPos);
+
+  // Se recorren los focos que inciden sobre la posicion
+  TileLight = m_DinamicLightInfo.CommonLight;
+  LightFocusInfoMapIt FocusIt(m_DinamicLightInfo.LightFocus.begin());
+  for (; FocusIt != m_DinamicLightInfo.LightFocus.end(); ++FocusIt) {
+	if (IsTilePosInLightRegion(TilePos, FocusIt->second)) {
+	  // Se halla la luz del foco y se queda el maximo en cada vertice
+	  GraphDefs::sLight FocusLight;
+	  CalculeFocusLightInTilePos(FocusIt->second, pVertexPos, FocusLight);
 	  byte ubVertex = 0;
 	  for (; ubVertex < 4; ++ubVertex) {
-		// Se halla distancia del foco al vertice
-		const sword swDistance = pMathUtil->GetEuclideanDistance(VertexPos[ubVertex],
-																 WorldFocusPos);
-		
-		// Es mayor la intensidad luminosa del foco que la distancia?
-		GraphDefs::Light NewVertexLight;
-		if (swDistance < LightIntensity) {
-		  // Si, se halla la diferencia entre la distancia y la intensidad
-		  NewVertexLight = LightIntensity - swDistance;		  
-		} else {
-		  // La luz no llega con la minima intensidad al vertice
-		  NewVertexLight = 0;		  
+		if (FocusLight.VertexLight[ubVertex] > TileLight.VertexLight[ubVertex]) {
+		  TileLight.VertexLight[ubVertex] = FocusLight.VertexLight[ubVertex];
 		}
-
-		// Se obtiene iterador al nodo con info asociada al foco
-		const VertexTileLightMapIt FocusIt(LightInfoIt->second.LightsInVertex[ubVertex].find(hEntity));
-
-		// Hay informacion luminosa para ese vertice?
-		if (NewVertexLight > 0) {
-		  // Habia nodo de informacion asociado al foco?
-		  if (FocusIt != LightInfoIt->second.LightsInVertex[ubVertex].end()) {
-			// Se reemplaza el por el nuevo valor, guardando el previo
-			const GraphDefs::Light PrevLight = FocusIt->second;
-			FocusIt->second = NewVertexLight;
-			// El valor asociado era igual al previo? Y
-			// El valor nuevo es MAYOR que el previo?
-			if (PrevLight == LightInfoIt->second.TileLight.VertexLight[ubVertex] &&
-				PrevLight < NewVertexLight) {
-			  // Se sustituye el valor de luz por el nuevo
-			  LightInfoIt->second.TileLight.VertexLight[ubVertex] = NewVertexLight;
-			} else {
-			  // Se debe de recalcular el valor maximo
-			  CalculeAndSetMaxLightInTilePos(LightInfoIt, ubVertex);
-			} 			
-		  } else {
-			// No habia nodo de informacion:
-			// Se inserta un nuevo nodo con la informacion
-			LightInfoIt->second.LightsInVertex[ubVertex].insert(VertextTileLightMapValType(hEntity, NewVertexLight));
-			// El valor es mayor que el actualmente configurado en la posicion?
-			if (NewVertexLight > LightInfoIt->second.TileLight.VertexLight[ubVertex]) {
-			  // Si, luego se reemplaza
-			  LightInfoIt->second.TileLight.VertexLight[ubVertex] = NewVertexLight;
-			}
-		  }		  
-		} else {		  
-		  // No hay informacion luminosa:
-		  // Habia nodo de informacion asociado al foco?
-		  if (FocusIt != LightInfoIt->second.LightsInVertex[ubVertex].end()) {
-			// Se borra nodo de informacion, guardando el valor previo de luz
-			const GraphDefs::Light PrevLight = FocusIt->second;
-			LightInfoIt->second.LightsInVertex[ubVertex].erase(FocusIt);
-			// El valor del foco ERA el mismo que el que esta establecido?
-			if (LightInfoIt->second.TileLight.VertexLight[ubVertex] == PrevLight) {
-			  // Se debe de recalcular el valor maximo
-			  CalculeAndSetMaxLightInTilePos(LightInfoIt, ubVertex);
-			}
-		  }	
-		}
-	  } // ~ for
-	  
-      // No hay luz que incida en la posicion?
-	  if (LightInfoIt->second.TileLight == CmpLightValue) {
-		// No, luego ya no hay informacion luminosa y se borrara el nodo
-		m_DinamicLightInfo.LightInTilePos.erase(LightInfoIt);
 	  }
-	}	
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Halla la intensidad de luz proviniente de un foco que alcanza a cada uno
+//   de los vertices de una posicion.
+// Parametros:
+// - FocusInfo. Foco de luz.
+// - pVertexPos. Posiciones universales de los vertices de la posicion.
+// - FocusLight. Luz del foco en cada vertice.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::CalculeFocusLightInTilePos(const sLightFocusInfo& FocusInfo,
+								  const sPosition* pVertexPos,
+								  GraphDefs::sLight& FocusLight)
+{
+  // SOLO si parametros validos
+  ASSERT(pVertexPos);
+
+  // Se recorren los vertices
+  iCMathUtil* const pMathUtil = SYSEngine::GetMathUtil();
+  ASSERT(pMathUtil);
+  byte ubVertex = 0;
+  for (; ubVertex < 4; ++ubVertex) {
+	// Se halla distancia del foco al vertice
+	const sword swDistance = pMathUtil->GetEuclideanDistance(pVertexPos[ubVertex],
+															 FocusInfo.WorldPos);
+	
+	// Es mayor la intensidad luminosa del foco que la distancia?
+	// Si, se halla la diferencia entre la distancia y la intensidad. En caso
+	// contrario, la luz no llega con la minima intensidad al vertice.
+	FocusLight.VertexLight[ubVertex] = (swDistance < FocusInfo.LightIntensity) ? 
+									   FocusInfo.LightIntensity - swDistance : 0;
+  }
+}
+
+#ifdef LIGHTING_PROFILE
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Vuelca al log el coste acumulado de las actualizaciones de posicion de
+//   un foco de luz.
+// Parametros:
+// - hEntity. Foco de luz.
+// - FocusInfo. Info asociada al foco.
+// Devuelve:
+// Notas:
+// - Solo disponible al compilar con LIGHTING_PROFILE.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::WriteLightFocusProfile(const AreaDefs::EntHandle& hEntity,
+							  const sLightFocusInfo& FocusInfo)
+{
+  // Se movio el foco alguna vez?
+  if (FocusInfo.udNumUpdates) {
+	// Si, se vuelca la informacion
+	SYSEngine::GetLogger()->Write("CArea::LightProfile> Foco %u (intensidad %u), %u actualizaciones.\n", 
+								  hEntity, FocusInfo.LightIntensity, FocusInfo.udNumUpdates);
+	SYSEngine::GetLogger()->Write("                   | Tiles recorridos: %u (medio %u), recalculados: %u.\n", 
+								  FocusInfo.udVisitedTiles, FocusInfo.udVisitedTiles / FocusInfo.udNumUpdates, 
+								  FocusInfo.udRecalcTiles);
+	SYSEngine::GetLogger()->Write("                   | Tiempo medio: %u us, maximo: %u us.\n", 
+								  FocusInfo.udTotalTime / FocusInfo.udNumUpdates, FocusInfo.udMaxTime);
   }
 }
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
@@ -2486,41 +4072,6 @@ CArea::CanEntityFocusAffectInMap(const AreaDefs::EntHandle& hEntity)
   return true;
 }
 
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Dado el nodo de informacion luminosa asociada a un tile, calcula el valor
-//   maximo de luz asociado al vertice ubVertex, de entre el map de focos
-//   luminosos asociado al vertice. En caso de no hallar informacion en el
-//   vertice, establecera el valor 0 en el mismo.
-// Parametros:
-// - LightInfoIt. Iterador al nodo de informacion luminosa del vertice.
-// - ubVertex. Identificador del vertice con el que trabajar.
-// Devuelve:
-// Notas:
-///////////////////////////////////////////////////////////////////////////////
-void 
-CArea::CalculeAndSetMaxLightInTilePos(const LightInTilePosInfoMapIt& LightInfoIt, 
-									  const byte ubVertex)
-{
-  // SOLO si insancia inicializada
-  ASSERT(IsInitOk() && IsAreaLoaded());
-  // SOLO si parametros validos
-  ASSERT((LightInfoIt != m_DinamicLightInfo.LightInTilePos.end()) != 0);
-  ASSERT((ubVertex < 4) != 0);
-
-  // Busca entre el map asociado al vertice ubVertex el valor maximo de luz
-  GraphDefs::Light MaxLightIntensity = 0;
-  VertexTileLightMapIt VertexIt(LightInfoIt->second.LightsInVertex[ubVertex].begin());
-  for (; VertexIt != LightInfoIt->second.LightsInVertex[ubVertex].end(); ++VertexIt) {
-	if (VertexIt->second > MaxLightIntensity) {
-	  MaxLightIntensity = VertexIt->second;
-	}
-  }
-
-  // Establece el valor conseguido
-  LightInfoIt->second.TileLight.VertexLight[ubVertex] = MaxLightIntensity;
-}
-
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Calcula la region que abarca el foco de luz y la deposita en una posicion
@@ -2579,16 +4130,13 @@ CArea::GetLightAt(const AreaDefs::sTilePos& TilePos)
   ASSERT(IsCellValid(TilePos));
   ASSERT(IsCellWithContent(TilePos));
 
-  // Llega alguna luz a la posicion?
+  // Se obtiene el valor maximo para cada uno de los vertices
+  const GraphDefs::sLight& TileLight = m_DinamicLightInfo.pTileLight[GetTileIdx(TilePos)];
   GraphDefs::Light Light = 0;	
-  const LightInTilePosInfoMapIt LightIt(m_DinamicLightInfo.LightInTilePos.find(GetTileIdx(TilePos)));
-  if (LightIt != m_DinamicLightInfo.LightInTilePos.end()) {
-	// Si, se obtiene el valor maximo para cada uno de los vertices
-	byte ubIt = 0;
-	for (; ubIt < 4; ++ubIt) {
-	  if (Light < LightIt->second.TileLight.VertexLight[ubIt]) {
-		Light = LightIt->second.TileLight.VertexLight[ubIt];
-	  }
+  byte ubIt = 0;
+  for (; ubIt < 4; ++ubIt) {
+	if (Light < TileLight.VertexLight[ubIt]) {
+	  Light = TileLight.VertexLight[ubIt];
 	}
   }
 
@@ -2617,30 +4165,26 @@ CArea::DrawFloor(const AreaDefs::sTilePos& TilePos,
   // SOLO si parametros validos
   ASSERT(IsCellValid(TilePos));
   	
-  // Toma indice de posicion asociada al tile
+  // Toma indice de posicion asociada al tile y su floor
+  // Nota: Si la celda tiene contenido pero no floor, estara descargada
   const AreaDefs::TileIndex TileIdx = GetTileIdx(TilePos);
-  sNCell* const pCell = m_Map.pMap[TileIdx];
+  CFloor* pFloor = m_Map.ppFloorGrid[TileIdx];
+  if (!pFloor && IsCellIndexWithContent(TileIdx)) {
+	pFloor = &GetCell(TileIdx)->Floor;
+  }
 
   // Celda CON datos?
-  if (pCell) { 
-	// Se toma instancia a posible techo
-	CRoof* const pRoof = pCell->hRoof ? GetRoof(pCell->hRoof) : NULL;
-
+  if (pFloor) { 
 	// NO hay techo? o
 	// El techo es NO visible? o
 	// El techo muestra lo que tiene por debajo?
-	if (!pRoof ||
-	    !pRoof->IsVisible() ||
-		(m_Map.ShowUnderRoofs.find(pCell->hRoof) != m_Map.ShowUnderRoofs.end())) {
+	if (IsTileUncovered(TileIdx)) {
 	  // Si, luego se dibuja Floor
 	  // Se establece info luminosa para el tile
-	  const LightInTilePosInfoMapIt LightIt(m_DinamicLightInfo.LightInTilePos.find(TileIdx));
-	  GraphDefs::sLight& Light = (LightIt != m_DinamicLightInfo.LightInTilePos.end()) ?	
-								  LightIt->second.TileLight :
-								  m_DinamicLightInfo.CommonLight;
+	  GraphDefs::sLight& Light = m_DinamicLightInfo.pTileLight[TileIdx];
 	  
 	  // Se dibuja el floor
-	  pCell->Floor.Draw(swXScreen, swYScreen, Light);
+	  pFloor->Draw(swXScreen, swYScreen, Light);
 
 	  // Hay que dibujar tile de seleccion?
 	  if (m_FloorSelector.pSelector &&
@@ -2675,34 +4219,31 @@ CArea::DrawOnFloor(const AreaDefs::sTilePos& TilePos,
   ASSERT(IsCellValid(TilePos));
   	
   // Toma indice de posicion asociada al tile
+  // Nota: Solo se accedera a la celda si tiene entidades, en cuyo caso
+  // siempre estara residente
   const AreaDefs::TileIndex TileIdx = GetTileIdx(TilePos);
-  sNCell* const pCell = m_Map.pMap[GetTileIdx(TilePos)];
 
   // Celda CON datos?
-  if (pCell) { 
-	// Se toma instancia a posible techo
-	CRoof* const pRoof = pCell->hRoof ? GetRoof(pCell->hRoof) : NULL;
-
+  if (IsCellIndexWithContent(TileIdx)) { 
 	// NO hay techo? o
 	// El techo es NO visible? o
 	// El techo muestra lo que tiene por debajo?
-	if (!pRoof ||
-	    !pRoof->IsVisible() ||
-		(m_Map.ShowUnderRoofs.find(pCell->hRoof) != m_Map.ShowUnderRoofs.end())) {	  	  
-	  // Se obtiene la elevacion del terreno
-	  const sword swYElevationScreen = swYScreen - pCell->Floor.GetElevation();
-
+	if (IsTileUncovered(TileIdx)) {	  	  
 	  // Hay al menos una entidad?
-	  if (!pCell->Entities.empty()) {
+	  if (m_Map.pFloorFlagsGrid[TileIdx] & AreaDefs::FLOOR_WITH_ENTITIES) {
 		// Si, se procederan a dibujar
+		// Se obtiene la elevacion del terreno
+		const sword swYElevationScreen = swYScreen - m_Map.pElevationGrid[TileIdx];
+		
 		// Se establece info luminosa para el tile
-		LightInTilePosInfoMapIt LightIt(m_DinamicLightInfo.LightInTilePos.find(TileIdx));
-		GraphDefs::sLight& Light = (LightIt != m_DinamicLightInfo.LightInTilePos.end()) ?	
-									LightIt->second.TileLight :
-									m_DinamicLightInfo.CommonLight;
+		GraphDefs::sLight& Light = m_DinamicLightInfo.pTileLight[TileIdx];
+		
+		// Se toma la celda
+		const sNCell* const pCell = GetCell(TileIdx);
+		ASSERT(pCell);
 
 		// Obtiene los handles asociados al tile y los dibuja    
-		CellEntitiesListIt It(pCell->Entities.begin());  
+		CellEntitiesList::const_iterator It(pCell->Entities.begin());  
 		for(; It != pCell->Entities.end(); ++It) {
 		  // HAY permiso de dibujado?	
 		  // if (CanDrawWorldEntity(*It, ubDrawFlags)) { 
@@ -2714,13 +4255,87 @@ CArea::DrawOnFloor(const AreaDefs::sTilePos& TilePos,
 	}	
 
 	// Se dibuja el posible techo
-	if (pRoof) {
+	const AreaDefs::EntHandle hRoof = m_Map.pRoofGrid[TileIdx];
+	if (hRoof) {
+	  CRoof* const pRoof = GetRoof(hRoof);
+	  ASSERT(pRoof);
 	  // Nota: El techo NO tendran en cuenta la elevacion del terreno ni la luz
 	  pRoof->Draw(swXScreen, swYScreen, m_DinamicLightInfo.CommonLight);
 	}
   }    
 }
 
+#ifdef AREA_TRAVERSAL_BENCHMARK
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Recorre todos los tiles del area tal y como lo haria el dibujado de
+//   un frame (floor, elevacion, techo, luz y entidades sobre el suelo) sin
+//   llegar a dibujar nada, volcando al log el tiempo medio y maximo por
+//   frame.
+// Parametros:
+// - uwNumFrames. Numero de frames a simular.
+// Devuelve:
+// Notas:
+// - Solo disponible al compilar con AREA_TRAVERSAL_BENCHMARK.
+// - La suma de control evita que el compilador descarte el recorrido y
+//   permite comparar resultados entre distintas disposiciones de celdas.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::RunTraversalBenchmark(const word uwNumFrames)
+{
+  // SOLO si area inicializada
+  ASSERT(IsInitOk() && IsAreaLoaded());
+  // SOLO si parametros validos
+  ASSERT(uwNumFrames);
+
+  // Se simulan los frames
+  iCTimer* const pTimer = SYSEngine::GetTimer();
+  ASSERT(pTimer);
+  const dword udSize = m_Map.uwWidth * m_Map.uwHeight;
+  dword udTotalTime = 0;
+  dword udMaxTime = 0;
+  dword udCheckSum = 0;
+  word uwFrame = 0;
+  for (; uwFrame < uwNumFrames; ++uwFrame) {
+	const dword udInitTime = pTimer->GetTime(TimerDefs::TIMER_UNITS_US);
+	// Nota: El indice sera dword, pues un TileIndex desbordaria en un
+	// area de dimensiones maximas
+	dword udTileIdx = 0;
+	for (; udTileIdx < udSize; ++udTileIdx) {
+	  // Celda CON datos?
+	  const AreaDefs::TileIndex TileIdx = AreaDefs::TileIndex(udTileIdx);
+	  if (IsCellIndexWithContent(TileIdx)) {
+		// Se acumulan floor, elevacion, techo y luz
+		udCheckSum += m_Map.ppFloorGrid[TileIdx] ? 1 : 0;
+		udCheckSum += m_Map.pElevationGrid[TileIdx];
+		udCheckSum += m_Map.pRoofGrid[TileIdx];
+		udCheckSum += m_DinamicLightInfo.pTileLight[TileIdx].VertexLight[GraphDefs::VERTEX_0];
+		// Hay entidades?
+		if (m_Map.pFloorFlagsGrid[TileIdx] & AreaDefs::FLOOR_WITH_ENTITIES) {
+		  const sNCell* const pCell = GetCell(TileIdx);
+		  ASSERT(pCell);
+		  CellEntitiesList::const_iterator It(pCell->Entities.begin());
+		  for (; It != pCell->Entities.end(); ++It) {
+			udCheckSum += *It;
+		  }
+		}
+	  }
+	}
+	const dword udTime = pTimer->GetTime(TimerDefs::TIMER_UNITS_US) - udInitTime;
+	udTotalTime += udTime;
+	if (udTime > udMaxTime) {
+	  udMaxTime = udTime;
+	}
+  }
+
+  // Se vuelca la informacion
+  SYSEngine::GetLogger()->Write("CArea::TraversalBenchmark> Area %u (%ux%u), %u frames.\n", 
+								GetIDArea(), m_Map.uwWidth, m_Map.uwHeight, uwNumFrames);
+  SYSEngine::GetLogger()->Write("                         | Tiempo medio: %u us, maximo: %u us (control %u).\n", 
+								udTotalTime / uwNumFrames, udMaxTime, udCheckSum);
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Comprueba si una entidad puede dibujarse a partir de los flags de dibujado
@@ -2810,12 +4425,15 @@ CArea::CreateCriature(const std::string& szProfile,
 	return 0;
   }
 
-  // Se crea instancia y obtiene handle
-  sNCriature* pNCriature = new sNCriature;
-  ASSERT(pNCriature);
+  // Se obtiene handle y crea instancia
+  // Nota: Si la tabla de criaturas esta llena, se abandonara
   const AreaDefs::EntHandle hEntity = CreateHandle(RulesDefs::CRIATURE);
-  ASSERT(hEntity);
+  if (!hEntity) {
+	return 0;
+  }
   ASSERT((GetEntityType(hEntity) == RulesDefs::CRIATURE) != 0);
+  sNCriature* pNCriature = new sNCriature;
+  ASSERT(pNCriature);
 
   // Se cargan datos del archivo de perfil
   dword udOffset = m_pGDBase->GetCBBFileOffset(GameDataBaseDefs::CBBF_CRIATUREPROFILES, szProfile);
@@ -2825,7 +4443,7 @@ CArea::CreateCriature(const std::string& szProfile,
   ASSERT_MSG(pNCriature->Criature.IsInitOk(), "Problemas creando criatura");
 
   // Se inserta en el map del area
-  m_Map.Criatures.insert(CriaturesValType(hEntity, pNCriature));
+  m_Map.Criatures.Insert(hEntity, pNCriature);
   
   // Inserta posible tag pasado
   InsertTag(hEntity, szTag);
@@ -2873,8 +4491,11 @@ CArea::_CreateItem(const std::string& szProfile)
   }
 
   // Se obtiene handle y crea instancia
+  // Nota: Si la tabla de items esta llena, se abandonara
   const AreaDefs::EntHandle hEntity = CreateHandle(RulesDefs::ITEM);	
-  ASSERT(hEntity);
+  if (!hEntity) {
+	return NULL;
+  }
   ASSERT((GetEntityType(hEntity) == RulesDefs::ITEM) != 0);
   sNItem* pNItem = new sNItem;
   ASSERT(pNItem);
@@ -2889,7 +4510,7 @@ CArea::_CreateItem(const std::string& szProfile)
   // Se establecen valores basicos y se inserta entidad en el map
   pNItem->Item.SetOwner(0);
   pNItem->Item.SetElevation(0);  	  
-  m_Map.Items.insert(ItemsValType(hEntity, pNItem));      
+  m_Map.Items.Insert(hEntity, pNItem);      
 
   // Retorna instancia creada
   return &pNItem->Item;
@@ -3040,8 +4661,11 @@ CArea::CreateWall(const std::string& szProfile,
   }
 
   // Se obtiene handle y crea instancia
+  // Nota: Si la tabla de paredes esta llena, se abandonara
   const AreaDefs::EntHandle hEntity = CreateHandle(RulesDefs::WALL);	
-  ASSERT(hEntity);
+  if (!hEntity) {
+	return 0;
+  }
   ASSERT((GetEntityType(hEntity) == RulesDefs::WALL) != 0);
   sNWall* pNWall = new sNWall;
   ASSERT(pNWall);
@@ -3054,7 +4678,7 @@ CArea::CreateWall(const std::string& szProfile,
   ASSERT_MSG(pNWall->Wall.IsInitOk(), "Problemas creando pared");
 
   // Se inserta en el map del area
-  m_Map.Walls.insert(WallsValType(hEntity, pNWall));
+  m_Map.Walls.Insert(hEntity, pNWall);
 
   // Inserta posible tag pasado
   InsertTag(hEntity, szTag);
@@ -3116,12 +4740,15 @@ CArea::CreateSceneObj(const std::string& szProfile,
 	return 0;
   }
 
-  // Se crea instancia y se obtiene handle
-  sNSceneObj* const pNSceneObj = new sNSceneObj;
-  ASSERT(pNSceneObj);	
+  // Se obtiene handle y se crea instancia
+  // Nota: Si la tabla de objetos de escenario esta llena, se abandonara
   const AreaDefs::EntHandle hEntity = CreateHandle(RulesDefs::SCENE_OBJ);  
-  ASSERT(hEntity);
+  if (!hEntity) {
+	return 0;
+  }
   ASSERT((GetEntityType(hEntity) == RulesDefs::SCENE_OBJ) != 0);
+  sNSceneObj* const pNSceneObj = new sNSceneObj;
+  ASSERT(pNSceneObj);	
 	
   // Se cargan datos del archivo de perfiles
   dword udOffset = m_pGDBase->GetCBBFileOffset(GameDataBaseDefs::CBBF_SCENEOBJPROFILES, szProfile);
@@ -3131,7 +4758,7 @@ CArea::CreateSceneObj(const std::string& szProfile,
   ASSERT_MSG(pNSceneObj->SceneObj.IsInitOk(), "Problemas creando pared");
 
   // Se inserta en el map del area
-  m_Map.SceneObjs.insert(SObjsValType(hEntity, pNSceneObj));
+  m_Map.SceneObjs.Insert(hEntity, pNSceneObj);
 
   // Inserta posible tag pasado
   InsertTag(hEntity, szTag);
@@ -3175,10 +4802,9 @@ CArea::DestroyEntity(const AreaDefs::EntHandle& hEntity)
 	  RemoveWorldEntityFromTile(hEntity);
 
 	  // Se borra instancia 
-	  WallsIt MapIt(m_Map.Walls.find(hEntity));
-	  ASSERT((MapIt != m_Map.Walls.end()) != 0);
-	  delete MapIt->second;
-	  m_Map.Walls.erase(MapIt);
+	  sNWall* const pN = m_Map.Walls.Remove(hEntity);
+	  ASSERT(pN);
+	  delete pN;
 	} break;
 
 	case RulesDefs::SCENE_OBJ: {	  
@@ -3205,10 +4831,9 @@ CArea::DestroyEntity(const AreaDefs::EntHandle& hEntity)
 	  RemoveWorldEntityFromTile(hEntity);
 	  
 	  // Se borra instancia 
-	  SObjsIt MapIt(m_Map.SceneObjs.find(hEntity));
-	  ASSERT((MapIt != m_Map.SceneObjs.end()) != 0);
-	  delete MapIt->second;
-	  m_Map.SceneObjs.erase(MapIt);	  
+	  sNSceneObj* const pN = m_Map.SceneObjs.Remove(hEntity);
+	  ASSERT(pN);
+	  delete pN;
 	} break;
 
 	case RulesDefs::CRIATURE: {
@@ -3252,10 +4877,9 @@ CArea::DestroyEntity(const AreaDefs::EntHandle& hEntity)
 	  RemoveWorldEntityFromTile(hEntity);
 
 	  // Se borra instancia 
-	  CriaturesIt MapIt(m_Map.Criatures.find(hEntity));
-	  ASSERT((MapIt != m_Map.Criatures.end()) != 0);
-	  delete MapIt->second;
-	  m_Map.Criatures.erase(MapIt);
+	  sNCriature* const pN = m_Map.Criatures.Remove(hEntity);
+	  ASSERT(pN);
+	  delete pN;
 	} break;
 
 	case RulesDefs::ITEM: {
@@ -3289,10 +4913,9 @@ CArea::DestroyEntity(const AreaDefs::EntHandle& hEntity)
 	  }	  
 
 	  // Se borra instancia 	  
-	  ItemsIt MapIt(m_Map.Items.find(hEntity));	  
-	  ASSERT((MapIt != m_Map.Items.end()) != 0);
-	  delete MapIt->second;	  
-	  m_Map.Items.erase(MapIt);	  
+	  sNItem* const pN = m_Map.Items.Remove(hEntity);
+	  ASSERT(pN);
+	  delete pN;
 	} break;
 
 	default:
@@ -3377,8 +5000,8 @@ CArea::GetCriature(const AreaDefs::EntHandle& hCriature)
 	
 	case RulesDefs::CRIATURE:
 	  // Npcs	  
-	  const CriaturesIt It(m_Map.Criatures.find(hCriature));
-	  return (It != m_Map.Criatures.end()) ? &It->second->Criature : NULL;		
+	  sNCriature* const pNCriature = m_Map.Criatures.Find(hCriature);
+	  return pNCriature ? &pNCriature->Criature : NULL;		
 	  break;
   };
 
@@ -3402,59 +5025,114 @@ CArea::GetRoomAt(const AreaDefs::sTilePos& TilePos)
   // SOLO si instancia inicializada
   ASSERT(IsInitOk() && IsAreaLoaded());
 
-  // Se obtiene IndexPos asociada a TilePos
-  const AreaDefs::TileIndex TileIdx = GetTileIdx(TilePos);
+  // Se retorna el identificador asociado al tile
+  return m_Map.pRoomGrid[GetTileIdx(TilePos)];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Establece el techo de una habitacion visible / invisible.
+// Parametros:
+// - RoomID. Identificador de la habitacion.
+// - bVisible. Flag con la orden de establecimiento.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::SetRoomRoofVisible(const AreaDefs::RoomID& RoomID,
+						  const bool bVisible)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk() && IsAreaLoaded());
+  // SOLO si parametros validos
+  ASSERT(RoomID);
+
+  // Obtiene iterador al nodo
+  const RoomInfoMapIt RoomIt(m_Map.RoomInfo.find(RoomID));
+  ASSERT((RoomIt != m_Map.RoomInfo.end()) != 0);
+
+  // El flag actual es distinto al recibido?
+  if (RoomIt->second.bIsRoofVisible != bVisible) {	
+	// Se realiza la operacion
+	CellsInRoomSetIt CellIt(RoomIt->second.Cells.begin());
+	for (; CellIt != RoomIt->second.Cells.end(); ++CellIt) {
+	  // Hay roof?
+	  if (m_Map.pRoofGrid[*CellIt]) {
+		// Si, se establece el flag de visibilidad que proceda
+		CRoof* pRoof = GetRoof(m_Map.pRoofGrid[*CellIt]);
+		ASSERT(pRoof);
+		pRoof->SetVisible(bVisible);
+	  }	  
+	}
+	// Se cambia el flag de visibilidad de roofs asociados a room
+	RoomIt->second.bIsRoofVisible = bVisible;
+
+	// Se actualiza el bit de la cubierta asociada a la habitacion
+	SetCoverUncovered(RoomID + 1, !bVisible);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Construye la rejilla de cubiertas, asociando a cada tile con un techo
+//   que oculte lo que tiene debajo la cubierta de su habitacion. De esta
+//   forma, el dibujado podra saber con un unico bit si ha de mostrar el
+//   contenido de un tile.
+// Parametros:
+// Devuelve:
+// Notas:
+// - Se construira una vez cargados todos los techos del area, pues es
+//   entonces cuando se conoce que techos muestran lo que tienen debajo.
+//   Dichos techos no cambian durante la vida del area.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::BuildCoverGrid(void)
+{
+  // SOLO si parametros validos
+  ASSERT(m_Map.pRoofGrid);
+  ASSERT(m_Map.pRoomGrid);
+  ASSERT(!m_Map.pCoverGrid);
 
-  // Procede a comprobar si el tile recibido pertenece a una habitacion
-  RoomInfoMapIt RoomIt(m_Map.RoomInfo.begin());
-  for (; RoomIt != m_Map.RoomInfo.end(); ++RoomIt) {
-	if (RoomIt->second.Cells.find(TileIdx) != RoomIt->second.Cells.end()) {
-	  // Si, se retorna el identificador
-	  return RoomIt->first;
+  // Se crea la rejilla y se asocia la cubierta a cada tile
+  const dword udSize = m_Map.uwWidth * m_Map.uwHeight;
+  m_Map.pCoverGrid = new AreaDefs::RoomID[udSize];
+  ASSERT(m_Map.pCoverGrid);
+  AreaDefs::TileIndex TileIdx = 0;
+  for (; TileIdx < udSize; ++TileIdx) {
+	// Hay techo y NO muestra lo que tiene por debajo?
+	const AreaDefs::EntHandle hRoof = m_Map.pRoofGrid[TileIdx];
+	if (hRoof && 
+		m_Map.ShowUnderRoofs.find(hRoof) == m_Map.ShowUnderRoofs.end()) {
+	  // Si, la cubierta sera la de la habitacion
+	  m_Map.pCoverGrid[TileIdx] = m_Map.pRoomGrid[TileIdx] + 1;
+	} else {
+	  // No, sin cubierta
+	  m_Map.pCoverGrid[TileIdx] = 0;
 	}
   }
-
-  // No, se retorna identificador nulo
-  return 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Establece el techo de una habitacion visible / invisible.
+// - Establece si el contenido bajo una cubierta es o no visible.
 // Parametros:
-// - RoomID. Identificador de la habitacion.
-// - bVisible. Flag con la orden de establecimiento.
+// - CoverID. Identificador de la cubierta.
+// - bUncovered. Contenido visible?
 // Devuelve:
 // Notas:
 ///////////////////////////////////////////////////////////////////////////////
 void 
-CArea::SetRoomRoofVisible(const AreaDefs::RoomID& RoomID,
-						  const bool bVisible)
+CArea::SetCoverUncovered(const AreaDefs::RoomID& CoverID,
+						 const bool bUncovered)
 {
-  // SOLO si instancia inicializada
-  ASSERT(IsInitOk() && IsAreaLoaded());
   // SOLO si parametros validos
-  ASSERT(RoomID);
-
-  // Obtiene iterador al nodo
-  const RoomInfoMapIt RoomIt(m_Map.RoomInfo.find(RoomID));
-  ASSERT((RoomIt != m_Map.RoomInfo.end()) != 0);
+  ASSERT(((CoverID >> 5) < m_Map.UncoveredBits.size()) != 0);
 
-  // El flag actual es distinto al recibido?
-  if (RoomIt->second.bIsRoofVisible != bVisible) {	
-	// Se realiza la operacion
-	CellsInRoomSetIt CellIt(RoomIt->second.Cells.begin());
-	for (; CellIt != RoomIt->second.Cells.end(); ++CellIt) {
-	  // Hay roof?
-	  if (m_Map.pMap[*CellIt]->hRoof) {
-		// Si, se establece el flag de visibilidad que proceda
-		CRoof* pRoof = GetRoof(m_Map.pMap[*CellIt]->hRoof);
-		ASSERT(pRoof);
-		pRoof->SetVisible(bVisible);
-	  }	  
-	}
-	// Se cambia el flag de visibilidad de roofs asociados a room
-	RoomIt->second.bIsRoofVisible = bVisible;
+  // Se establece el bit
+  if (bUncovered) {
+	m_Map.UncoveredBits[CoverID >> 5] |= (1UL << (CoverID & 31));
+  } else {
+	m_Map.UncoveredBits[CoverID >> 5] &= ~(1UL << (CoverID & 31));
   }
 }
 
@@ -3479,31 +5157,9 @@ CArea::FindCriaturesInRangeAt(const AreaDefs::sTilePos& Pos,
   // SOLO si parametros correctos
   ASSERT(IsCellValid(Pos));
   
-  // Se procede a iterar por las posiciones, introduciendo los handles de
-  // las criaturas que se hallen en el rango de vision
-  const AreaDefs::sTilePos MaxPos(Pos.XTile + Range, Pos.YTile + Range);
-  CCellIterator CellIt;
-  AreaDefs::sTilePos PosIt;
-  PosIt.YTile = Pos.YTile - Range;
-  for (; PosIt.YTile < MaxPos.YTile; ++PosIt.YTile) {
-	PosIt.XTile = Pos.XTile - Range;
-	for (; PosIt.XTile < MaxPos.XTile; ++PosIt.XTile) {	  
-	  // Si, se itera por entre las entidades si procede		
-	  // Nota: La comprobacion de que la celda es valida y
-	  // posee contenido, se realizara al intentar inicializar el iterador	  
-	  if (CellIt.Init(this, PosIt)) {
-	    for (; CellIt.IsItValid(); CellIt.Next()) {
-	  	  // El handle de entidad pertenece a criatura o jugador?		  
-		  const RulesDefs::eEntityType Type = GetEntityType(CellIt.GetWorldEntity());
-		  if (Type == RulesDefs::CRIATURE ||
-		  	  Type == RulesDefs::PLAYER) {
-			// Si, se introduce en conjunto
-			InRangeSet.insert(CellIt.GetWorldEntity());
-		  }
-		}
-	  }
-	}
-  }
+  // Se consulta la rejilla espacial, que solo recorrera las cubetas que
+  // solapen con el rango
+  m_CriatureGrid.FindInRange(Pos, Range, InRangeSet);
 }
  
 ///////////////////////////////////////////////////////////////////////////////
@@ -3544,14 +5200,15 @@ CArea::IsCriatureInRangeAt(const AreaDefs::EntHandle& hCriature,
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Recorrera todas las criaturas existentes en el area de juego y comprobara
-//   si la recibida se halla en el rango de ellas, en caso de ser asi insertara
-//   el handle de estas en el conjunto recibido.
+// - Localizara las criaturas del area que contengan en su rango a la
+//   recibida e insertara el handle de estas en el conjunto recibido.
 // - No se tendra en cuenta a la criatura que sea igual al handle recibido ni
 //   aquella que ya contuvieran a la criatura recibida.
 // Parametros:
 // Devuelve:
 // Notas:
+// - Solo se comprobaran las criaturas de las cubetas de la rejilla espacial
+//   cercanas a la criatura recibida.
 ///////////////////////////////////////////////////////////////////////////////
 void 
 CArea::FindCriaturesContainingCriatureInRange(const AreaDefs::EntHandle& hCriature,
@@ -3562,28 +5219,59 @@ CArea::FindCriaturesContainingCriatureInRange(const AreaDefs::EntHandle& hCriatu
   // SOLO si parametros correctos
   ASSERT(hCriature);  
 
-  // Recorre las criaturas existentes, si procede
-  CCriatureIterator CriatureIt;
-  if (CriatureIt.Init(this)) {
-	for (; CriatureIt.IsItValid(); CriatureIt.Next()) {
-	  // Handle diferene al recibido? y
-	  // Criature recibida NO se halla ACTUALMENTE en el rango de la misma?
-	  CCriature* const pCriature = CriatureIt.GetEntity();
-	  ASSERT(pCriature);
-	  if (pCriature->GetHandle() != hCriature &&
-		  !pCriature->IsInRange(hCriature)) {	  
-		// Si, se comprueba si la criatura recibida se halla en el rango de la misma
-		if (IsCriatureInRangeAt(hCriature, 
-								pCriature->GetTilePos(), 
-								pCriature->GetRange())) {
-		  // Se halla en rango, por lo que se aadira handle al conjunto
-		  InRangeSet.insert(pCriature->GetHandle());
-		}
-	  }
+  // Se obtienen las criaturas que contienen en su rango a la recibida
+  CCriature* const pCriature = GetCriature(hCriature);
+  ASSERT(pCriature);
+  std::set<AreaDefs::EntHandle> ContainingSet;
+  m_CriatureGrid.FindContaining(pCriature->GetTilePos(), ContainingSet);
+
+  // Se descartan la propia criatura, el jugador y las que ya la contuvieran
+  // Nota: El jugador nunca se ha tenido en cuenta en esta busqueda
+  std::set<AreaDefs::EntHandle>::const_iterator It(ContainingSet.begin());
+  for (; It != ContainingSet.end(); ++It) {
+	// Handle diferente al recibido? y NO es el jugador? y
+	// Criatura recibida NO se halla ACTUALMENTE en el rango de la misma?
+	if (*It != hCriature &&
+		GetEntityType(*It) == RulesDefs::CRIATURE &&
+		!GetCriature(*It)->IsInRange(hCriature)) {
+	  // Se aadira handle al conjunto
+	  InRangeSet.insert(*It);
 	}
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Compara el conjunto InRangeSet, con las criaturas que se hallaban en el
+//   rango Range asociado a Pos, con las que se hallan ahora en el, 
+//   depositando en EnteredSet las que han entrado en el rango y en LeftSet
+//   las que han salido.
+// Parametros:
+// - Pos. Posicion.
+// - Range. Rango.
+// - InRangeSet. Criaturas que estaban en rango.
+// - EnteredSet. Criaturas que han entrado en rango.
+// - LeftSet. Criaturas que han salido del rango.
+// Devuelve:
+// Notas:
+// - Si en Pos hubiera una criatura, esta podra aparecer en EnteredSet.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::FindCriaturesRangeDelta(const AreaDefs::sTilePos& Pos,
+							   const RulesDefs::CriatureRange& Range,
+							   const std::set<AreaDefs::EntHandle>& InRangeSet,
+							   std::set<AreaDefs::EntHandle>& EnteredSet,
+							   std::set<AreaDefs::EntHandle>& LeftSet)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros correctos
+  ASSERT(IsCellValid(Pos));
+
+  // Se delega en la rejilla espacial
+  m_CriatureGrid.FindRangeDelta(Pos, Range, InRangeSet, EnteredSet, LeftSet);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Inserta la entidad con handle hEntity en el tile de posicion NewPos.
@@ -3606,7 +5294,7 @@ CArea::InsertWorldEntityInTile(const AreaDefs::EntHandle& hEntity,
   // La celda tiene contenido?
   if (IsCellWithContent(NewPos)) {
 	// Se obtiene el tile donde insertar a la entidad
-	sNCell* const pCell = m_Map.pMap[GetTileIdx(NewPos)];
+	sNCell* const pCell = GetCell(GetTileIdx(NewPos));
 	ASSERT(pCell);
  
 	// Se Halla la posicion donde insertar a la entidad y se inserta
@@ -3618,11 +5306,34 @@ CArea::InsertWorldEntityInTile(const AreaDefs::EntHandle& hEntity,
 	  ++It;	
 	}
 	pCell->Entities.insert(It, hEntity);
+	UpdateFloorEntitiesFlag(GetTileIdx(NewPos), pCell);
+
+	// Se registra en la rejilla espacial si es criatura
+	// Nota: Antes de asociar la posicion, pues las criaturas actualizaran
+	// su conjunto de criaturas en rango al recibirla
+	if (EntityType == RulesDefs::CRIATURE ||
+	    EntityType == RulesDefs::PLAYER) {
+	  CCriature* const pCriature = GetCriature(hEntity);
+	  ASSERT(pCriature);
+	  m_CriatureGrid.Insert(hEntity, NewPos, pCriature->GetRange());
+	}
 
 	// Se asocia la posicion a la misma
 	CWorldEntity* const pEntity = GetWorldEntity(hEntity);
 	ASSERT(pEntity);	
 	pEntity->SetTilePos(NewPos); 
+
+	// Se actualiza la rejilla de accesos si procede
+	if (EntityType == RulesDefs::CRIATURE ||
+	    EntityType == RulesDefs::PLAYER) {
+	  // Criatura, se marca el tile como ocupado
+	  if (m_Map.pAccessGrid) {
+		m_Map.pAccessGrid[GetTileIdx(NewPos)] |= AreaDefs::TILE_WITH_CRIATURE;
+	  }
+	} else if (pEntity->GetObstacleMask() != AreaDefs::ALL_TILE_ACCESS) {
+	  // Obstaculo, se actualizan mascaras y conectividad
+	  UpdateAccessInfoAt(NewPos);
+	}
   }  
 }
 
@@ -3645,7 +5356,7 @@ CArea::RemoveWorldEntityFromTile(const AreaDefs::EntHandle& hEntity)
   // Se obtiene el tile donde quitar a la entidad
   CWorldEntity* const pEntity = GetWorldEntity(hEntity);
   ASSERT(pEntity);  
-  sNCell* const pCell = m_Map.pMap[GetTileIdx(pEntity->GetTilePos())];
+  sNCell* const pCell = GetCell(GetTileIdx(pEntity->GetTilePos()));
   ASSERT(pCell);
  
   // Se quita del tile en donde se halle
@@ -3654,6 +5365,22 @@ CArea::RemoveWorldEntityFromTile(const AreaDefs::EntHandle& hEntity)
 							            hEntity));
   ASSERT((It != pCell->Entities.end()) != 0);
   pCell->Entities.erase(It);
+  UpdateFloorEntitiesFlag(GetTileIdx(pEntity->GetTilePos()), pCell);
+
+  // Se actualiza la rejilla de accesos si procede
+  const RulesDefs::eEntityType EntityType = GetEntityType(hEntity);
+  if (EntityType == RulesDefs::CRIATURE ||
+	  EntityType == RulesDefs::PLAYER) {
+	// Criatura, se comprueba si el tile sigue ocupado
+	if (m_Map.pAccessGrid) {
+	  SetAccessGridCriatureFlag(GetTileIdx(pEntity->GetTilePos()));
+	}
+	// Se quita de la rejilla espacial
+	m_CriatureGrid.Remove(hEntity, pEntity->GetTilePos());
+  } else if (pEntity->GetObstacleMask() != AreaDefs::ALL_TILE_ACCESS) {
+	// Obstaculo, se actualizan mascaras y conectividad
+	UpdateAccessInfoAt(pEntity->GetTilePos());
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3690,16 +5417,17 @@ CArea::ChangeLocationForVisuals(const AreaDefs::EntHandle& hEntity,
 	// Posiciones distintas?
 	if (OriginalPos != VisualPos) {
 	  // Extrae de la posicion original
-	  sNCell* pCell = m_Map.pMap[GetTileIdx(OriginalPos)];
+	  sNCell* pCell = GetCell(GetTileIdx(OriginalPos));
 	  ASSERT(pCell);
 	  CellEntitiesListIt It(std::find(pCell->Entities.begin(),
   									  pCell->Entities.end(),
 									  hEntity));
 	  ASSERT((It != pCell->Entities.end()) != 0);
 	  pCell->Entities.erase(It);
+	  UpdateFloorEntitiesFlag(GetTileIdx(OriginalPos), pCell);
 
 	  // Inserta en la nueva  
-	  pCell = m_Map.pMap[GetTileIdx(VisualPos)];
+	  pCell = GetCell(GetTileIdx(VisualPos));
 	  ASSERT(pCell);  
 	  const RulesDefs::eEntityType EntityType = GetEntityType(hEntity);
 	  ASSERT((EntityType != RulesDefs::NO_ENTITY) != 0);  
@@ -3709,6 +5437,7 @@ CArea::ChangeLocationForVisuals(const AreaDefs::EntHandle& hEntity,
 		++It;	
 	  }
 	  pCell->Entities.insert(It, hEntity);
+	  UpdateFloorEntitiesFlag(GetTileIdx(VisualPos), pCell);
 
 	  // Correcto
 	  return true;
@@ -3756,14 +5485,14 @@ CArea::ChangeLocation(const AreaDefs::EntHandle& hEntity,
 	    // Extraccion y evento de extraccion de la entidad de un tile
 	    CWorldEntity* const pEntity = GetWorldEntity(hEntity);
 	    ASSERT(pEntity);
-	    sNCell* pCell = m_Map.pMap[GetTileIdx(pEntity->GetTilePos())];  
+	    sNCell* pCell = GetCell(GetTileIdx(pEntity->GetTilePos()));  
 	    ASSERT(pCell);
 	    RemoveWorldEntityFromTile(hEntity);
 	    pCell->Floor.OnSetOut(pEntity->GetTilePos(), hEntity);
 			
 	    // Intercambio de posicion y evento de insercion
 	    InsertWorldEntityInTile(hEntity, NewPos);
-	    pCell = m_Map.pMap[GetTileIdx(NewPos)];  
+	    pCell = GetCell(GetTileIdx(NewPos));  
 	    ASSERT(pCell);
 	    pCell->Floor.OnSetIn(NewPos, hEntity);
 
@@ -3789,7 +5518,7 @@ CArea::ChangeLocation(const AreaDefs::EntHandle& hEntity,
 		  // y se deposita sobre otro diferente.
 		  CWorldEntity* const pEntity = GetWorldEntity(hEntity);
 		  ASSERT(pEntity);
-		  sNCell* pCell = m_Map.pMap[GetTileIdx(pEntity->GetTilePos())];  		  
+		  sNCell* pCell = GetCell(GetTileIdx(pEntity->GetTilePos()));  		  
 		  ASSERT(pCell);
 		  RemoveWorldEntityFromTile(hEntity);
 		  pCell->Floor.OnSetOut(pEntity->GetTilePos(), hEntity);			
@@ -3797,7 +5526,7 @@ CArea::ChangeLocation(const AreaDefs::EntHandle& hEntity,
 			
 		// Establecimiento en la nueva posicion y evento de insercion
 		InsertWorldEntityInTile(hEntity, NewPos);
-		sNCell* const pCell = m_Map.pMap[GetTileIdx(NewPos)];  
+		sNCell* const pCell = GetCell(GetTileIdx(NewPos));  
 		ASSERT(pCell);
 		pCell->Floor.OnSetIn(NewPos, hEntity);
 
@@ -3846,7 +5575,7 @@ CArea::ChangeLocation(const AreaDefs::EntHandle& hItem,
   	  // Toma celda donde esta el item
 	  // Nota: Se tomara antes de ingresar el item porque despues la
 	  // posicion del mismo sera la de su dueo
-	  sNCell* pCell = m_Map.pMap[GetTileIdx(pItem->GetTilePos())];  		  
+	  sNCell* pCell = GetCell(GetTileIdx(pItem->GetTilePos()));  		  
 	  ASSERT(pCell);  
 
 	  // Se elimina el item del tile donde este	  
@@ -3975,6 +5704,76 @@ void CArea::UnsetPlayer(void)
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene la mascara de acceso al tile teniendo en cuenta la mascara del
+//   floor, de todos las entidades que estan por encima de esta y de las
+//   paredes adyacentes.
+// - Una vez cargada el area, la informacion estatica (todo salvo criaturas)
+//   se tomara directamente de la rejilla de accesos, consultandose la celda
+//   solo si la rejilla indica que en el tile hay criaturas.
+// - Con el filtro PLAYER | CRIATURE se retornara la mascara de adyacentes
+//   de la rejilla, calculada con ese mismo filtro.
+// Parametros:
+// - TilePos. Posicion del mapa de donde obtener la mascara de acceso.
+// - udNoEntitiesToCheck. Los tipos de entidades que NO se desean chequear.
+//   Por defecto se querra chequear todas.
+// Devuelve:
+// - Mascara de acceso.
+// Notas:
+// - La rejilla solo se usara cuando se pidan todas las entidades o todas
+//   salvo las criaturas (PLAYER | CRIATURE), que son los unicos usos del
+//   motor. En cualquier otro caso se calculara recorriendo la celda.
+///////////////////////////////////////////////////////////////////////////////
+AreaDefs::MaskTileAccess 
+CArea::GetMaskTileAccess(const AreaDefs::sTilePos& TilePos,
+						 const dword udNoEntitiesToCheck)
+{
+  // SOLO si entidad inicializada
+  ASSERT(IsInitOk() && IsAreaLoaded());
+
+  // Se dispone de rejilla de accesos y se puede usar?
+  const dword udCriatures = RulesDefs::PLAYER | RulesDefs::CRIATURE;
+  if (m_Map.pAccessGrid &&
+	  (RulesDefs::NO_ENTITY == udNoEntitiesToCheck || udCriatures == udNoEntitiesToCheck)) {
+	// Si, se toma la mascara estatica
+	const AreaDefs::TileIndex TileIdx = GetTileIdx(TilePos);
+	const AreaDefs::TileAccessInfo AccessInfo = m_Map.pAccessGrid[TileIdx];
+	if (udCriatures == udNoEntitiesToCheck) {
+	  // Se excluyen criaturas, se toma la mascara de adyacentes
+	  return AreaDefs::MaskTileAccess((AccessInfo & AreaDefs::TILE_ADJ_ACCESS_MASK) >> 
+									  AreaDefs::TILE_ADJ_ACCESS_SHIFT);
+	}
+	AreaDefs::MaskTileAccess MaskTileAccess = AccessInfo & AreaDefs::TILE_ACCESS_MASK;
+
+	// Hay alguna criatura en el tile?
+	if ((AccessInfo & AreaDefs::TILE_WITH_CRIATURE) &&
+		MaskTileAccess != AreaDefs::NO_TILE_ACCESS) {
+	  // Si, se toma la mascara de las que no esten en movimiento
+	  sNCell* const pCell = GetCell(TileIdx);
+	  ASSERT(pCell);
+	  CellEntitiesListIt It(pCell->Entities.begin());
+	  for (; It != pCell->Entities.end(); ++It) {
+		const RulesDefs::eEntityType EntityType = GetEntityType(*It);
+		if (EntityType == RulesDefs::CRIATURE ||
+			EntityType == RulesDefs::PLAYER) {
+		  CCriature* const pCriature = GetCriature(*It);
+		  ASSERT(pCriature);
+		  if (!pCriature->IsWalking()) {
+			MaskTileAccess |= pCriature->GetObstacleMask();
+		  }
+		}
+	  }
+	}
+
+	// Se retorna
+	return MaskTileAccess;
+  }
+
+  // No, se calcula recorriendo la celda
+  return CalculeMaskTileAccess(TilePos, udNoEntitiesToCheck, false);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Calcula la mascara de acceso al tile teniendo en cuenta la mascara del
@@ -3985,7 +5784,8 @@ void CArea::UnsetPlayer(void)
 // Parametros:
 // - TilePos. Posicion del mapa de donde obtener la mascara de acceso.
 // - udNoEntitiesToCheck. Los tipos de entidades que NO se desean chequear.
-//   Por defecto se querra chequear todas.
+// - bSkipCriatures. Si vale true, no se tendran en cuenta ni criaturas ni
+//   jugador (usado para calcular la mascara estatica de la rejilla).
 // Devuelve:
 // - Mascara de acceso.
 // Notas:
@@ -3996,18 +5796,19 @@ void CArea::UnsetPlayer(void)
 //   para las criaturas.
 ///////////////////////////////////////////////////////////////////////////////
 AreaDefs::MaskTileAccess 
-CArea::GetMaskTileAccess(const AreaDefs::sTilePos& TilePos,
-						 const dword udNoEntitiesToCheck)
+CArea::CalculeMaskTileAccess(const AreaDefs::sTilePos& TilePos,
+							 const dword udNoEntitiesToCheck,
+							 const bool bSkipCriatures)
 {
   // SOLO si entidad inicializada
-  ASSERT(IsInitOk() && IsAreaLoaded());
+  ASSERT(IsInitOk());
 
   // Obtiene mascara de acceso asociada al floor
   AreaDefs::MaskTileAccess MaskTileAccess = GetMaskFloorAccess(TilePos);
   
   // Calcula la mascara de acceso final con las entidades sobre el floor
   // Nota: Solo en caso de que en dicha celda exista contenido  
-  sNCell* const pCell = m_Map.pMap[GetTileIdx(TilePos)];
+  sNCell* const pCell = GetCell(GetTileIdx(TilePos));
   if (pCell) {
 	CellEntitiesListIt It(pCell->Entities.begin());
 	while (It != pCell->Entities.end() && 
@@ -4021,7 +5822,7 @@ CArea::GetMaskTileAccess(const AreaDefs::sTilePos& TilePos,
 			EntityType != RulesDefs::PLAYER) {
 		  // Si, se toma la mascara directamente
 		  MaskTileAccess |= GetWorldEntity(*It)->GetObstacleMask();
-		} else {
+		} else if (!bSkipCriatures) {
 		  // No, se tomara la mascara SOLO si no hay movimiento
 		  CCriature* const pCriature = GetCriature(*It);
 		  ASSERT(pCriature);
@@ -4110,7 +5911,7 @@ CArea::IsAdjWallBlocked(const AreaDefs::sTilePos& TilePosSrc,
 	// Celda valida y con contenido?
 	if (IsCellValid(AdjTilePos) && IsCellWithContent(AdjTilePos)) {
 	  // Se navega por la celda
-	  sNCell* const pCell = m_Map.pMap[GetTileIdx(AdjTilePos)];
+	  sNCell* const pCell = GetCell(GetTileIdx(AdjTilePos));
 	  ASSERT(pCell);
 	  CellEntitiesListIt It(pCell->Entities.begin());
 	  for (; It != pCell->Entities.end(); ++It) {
@@ -4234,7 +6035,7 @@ CArea::SetFloorAccess(const AreaDefs::sTilePos& TilePos,
   AreaDefs::MaskTileAccess MaskFloorAccess = GetMaskFloorAccess(TilePos);
   if (bCanAccess) {	
 	// Se puede acceder, luego se pone un 0 en el bit asociado a la direccion
-	MaskFloorAccess &= !Orientation;
+	MaskFloorAccess &= ~Orientation;
   } else {
 	// No se puede acceder, luego se pone un 1 en el bit asociado a la direccion
 	MaskFloorAccess |= Orientation;
@@ -4257,8 +6058,9 @@ CArea::SetFloorAccess(const AreaDefs::sTilePos& TilePos,
 // - MaskTileAccess. Mascara de acceso.
 // Devuelve:
 // Notas:
-// - Debido a que este metodo se llamara en etapa de configuracion, no se
-//   debera de encontrar informacion previa asociada a un tile
+// - En etapa de configuracion no se encontrara informacion previa asociada 
+//   al tile, pero desde SetFloorAccess si podra existir, en cuyo caso se
+//   sustituira y se actualizara la conectividad.
 ///////////////////////////////////////////////////////////////////////////////
 void
 CArea::SetMaskFloorAccess(const AreaDefs::sTilePos& TilePos,
@@ -4267,48 +6069,446 @@ CArea::SetMaskFloorAccess(const AreaDefs::sTilePos& TilePos,
   // SOLO si instancia inicializada
   ASSERT(IsInitOk() && IsAreaLoaded());
 
-  // Se obtiene posible entrada en el indice de mascaras de accesos
+  // Se elimina posible entrada previa en el indice de mascaras de accesos
   const AreaDefs::TileIndex TileIdx = GetTileIdx(TilePos);
-  ASSERT((m_Map.IndexOfMaskTileAccess.find(TileIdx) == m_Map.IndexOfMaskTileAccess.end()) != 0);
+  const MaskTileAccessMapIt It(m_Map.IndexOfMaskTileAccess.find(TileIdx));
+  if (It != m_Map.IndexOfMaskTileAccess.end()) {
+	m_Map.IndexOfMaskTileAccess.erase(It);
+  }
 
   // No es acceso total?
   if (AreaDefs::ALL_TILE_ACCESS != MaskTileAccess) {
 	// Se crea entrada asociando mascara
     m_Map.IndexOfMaskTileAccess.insert(MaskTileAccessMapValType(TileIdx, MaskTileAccess));
   }
+
+  // Se actualiza la conectividad
+  UpdateAccessInfoAt(TilePos);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Obtiene el iterador al map donde se localizan los tags. Se obtendra via
-//   handle a la entidad de la que se desea averiguar si tiene tag asociado.
+// - Construye la rejilla de accesos del area. Por cada tile se guardara en
+//   un dword la mascara de acceso estatica (floor, entidades que no sean
+//   criaturas y paredes adyacentes), la mascara con el filtro que usa el
+//   pathfinder para los tiles adyacentes, si el tile tiene contenido y si
+//   esta ocupado por alguna criatura o el jugador.
 // Parametros:
-// - hEntity. Handle a la entidad.
 // Devuelve:
-// - Iterador al posible tag asociado (sera nulo si no hay)
+// Notas:
+// - Se construira una vez cargadas todas las entidades del area, pues las
+//   paredes de un tile influyen en las mascaras de sus adyacentes. A partir
+//   de ese momento se mantendra sincronizada desde SetMaskFloorAccess y la
+//   insercion / extraccion de entidades en tiles.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::BuildAccessGrid(void)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk() && IsAreaLoaded());
+  ASSERT(!m_Map.pAccessGrid);
+
+  // Se crea la rejilla
+  const dword udSize = m_Map.uwWidth * m_Map.uwHeight;
+  m_Map.pAccessGrid = new AreaDefs::TileAccessInfo[udSize];
+  ASSERT(m_Map.pAccessGrid);
+
+  // Se establece la informacion de cada tile
+  dword udIdx = 0;
+  for (; udIdx < udSize; ++udIdx) {
+	// Tile con contenido?
+	if (IsCellIndexWithContent(udIdx)) {
+	  // Si, se establece mascara y flags
+	  m_Map.pAccessGrid[udIdx] = AreaDefs::TILE_WALKABLE;
+	  SetAccessGridMask(udIdx);
+	  SetAccessGridCriatureFlag(udIdx);
+	} else {
+	  // No, sera infranqueable
+	  m_Map.pAccessGrid[udIdx] = AreaDefs::NO_TILE_ACCESS | 
+								 (AreaDefs::NO_TILE_ACCESS << AreaDefs::TILE_ADJ_ACCESS_SHIFT);
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Recalcula las mascaras de acceso estatica y de adyacentes de un tile en
+//   la rejilla, conservando el resto de flags.
+// Parametros:
+// - TileIdx. Indice del tile.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::SetAccessGridMask(const AreaDefs::TileIndex& TileIdx)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk() && IsAreaLoaded());
+  ASSERT(m_Map.pAccessGrid);
+  ASSERT(IsCellIndexWithContent(TileIdx));
+
+  // Se calculan sin criaturas y se establecen
+  const AreaDefs::sTilePos TilePos(GetTilePosFromIdx(TileIdx));
+  const AreaDefs::MaskTileAccess Mask = CalculeMaskTileAccess(TilePos,
+															  RulesDefs::NO_ENTITY,
+															  true);
+  const AreaDefs::MaskTileAccess AdjMask = CalculeMaskTileAccess(TilePos,
+																 RulesDefs::PLAYER | RulesDefs::CRIATURE,
+																 true);
+  AreaDefs::TileAccessInfo& AccessInfo = m_Map.pAccessGrid[TileIdx];
+  AccessInfo = (AccessInfo & ~(AreaDefs::TILE_ACCESS_MASK | AreaDefs::TILE_ADJ_ACCESS_MASK)) | 
+			   Mask | 
+			   (AreaDefs::TileAccessInfo(AdjMask) << AreaDefs::TILE_ADJ_ACCESS_SHIFT);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Establece en la rejilla el flag de ocupacion por criatura de un tile,
+//   segun existan o no criaturas (o el jugador) en su celda.
+// Parametros:
+// - TileIdx. Indice del tile.
+// Devuelve:
 // Notas:
 ///////////////////////////////////////////////////////////////////////////////
-CArea::TagMapIt 
-CArea::GetMapTagIt(const AreaDefs::EntHandle& hEntity)
+void 
+CArea::SetAccessGridCriatureFlag(const AreaDefs::TileIndex& TileIdx)
 {
   // SOLO si instancia inicializada
   ASSERT(IsInitOk());
-  ASSERT(IsAreaLoaded());
+  ASSERT(m_Map.pAccessGrid);
+  ASSERT(IsCellIndexWithContent(TileIdx));
+
+  // Se busca alguna criatura en la celda
+  AreaDefs::TileAccessInfo& AccessInfo = m_Map.pAccessGrid[TileIdx];
+  AccessInfo &= ~AreaDefs::TILE_WITH_CRIATURE;
+  sNCell* const pCell = GetCell(TileIdx);
+  CellEntitiesListIt It(pCell->Entities.begin());
+  for (; It != pCell->Entities.end(); ++It) {
+	const RulesDefs::eEntityType EntityType = GetEntityType(*It);
+	if (EntityType == RulesDefs::CRIATURE ||
+		EntityType == RulesDefs::PLAYER) {
+	  AccessInfo |= AreaDefs::TILE_WITH_CRIATURE;
+	  break;
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Construye desde cero la informacion de conectividad del area. Cada tile
+//   con contenido recibira el identificador de la componente conexa a la
+//   que pertenezca, de tal forma que dos tiles con distinto identificador
+//   nunca podran unirse mediante un camino.
+// Parametros:
+// Devuelve:
+// Notas:
+// - Para calcular las componentes se tomaran las mascaras de acceso de la
+//   rejilla, que no tienen en cuenta criaturas pues estas se moveran, y se
+//   considerara que dos tiles adyacentes estan unidos si se puede pasar del
+//   uno al otro en al menos uno de los dos sentidos. De esta forma, la 
+//   informacion sera siempre una sobreestimacion segura de la que usa el 
+//   pathfinder.
+// - Se podra llamar tambien con la informacion ya construida, en cuyo caso
+//   se recalculara por completo (util cuando se agoten identificadores).
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::BuildConnectivity(void)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk() && IsAreaLoaded());
+  ASSERT(m_Map.pAccessGrid);
+
+  // Se reserva el array si procede y se resetean las componentes
+  const dword udSize = m_Map.uwWidth * m_Map.uwHeight;
+  if (!m_Connectivity.pTileComponent) {
+	m_Connectivity.pTileComponent = new AreaDefs::ComponentID[udSize];
+	ASSERT(m_Connectivity.pTileComponent);
+  }
+  memset(m_Connectivity.pTileComponent, 
+		 AreaDefs::NO_COMPONENT, 
+		 sizeof(AreaDefs::ComponentID) * udSize);
+
+  // Se resetean contadores
+  // Nota: La posicion 0 del vector de tamaos correspondera a NO_COMPONENT
+  m_Connectivity.ComponentSize.clear();
+  m_Connectivity.ComponentSize.push_back(0);
+  m_Connectivity.uwNumComponents = 0;
+  m_Connectivity.NextComponent = AreaDefs::NO_COMPONENT + 1;
+
+  // Se etiqueta cada tile con contenido aun no visitado
+  std::vector<AreaDefs::TileIndex> TilesToVisit;
+  dword udIdx = 0;
+  for (; udIdx < udSize; ++udIdx) {
+	if (IsCellIndexWithContent(udIdx) &&
+	    AreaDefs::NO_COMPONENT == m_Connectivity.pTileComponent[udIdx]) {
+	  FloodComponent(udIdx, 
+					 m_Connectivity.NextComponent++, 
+					 AreaDefs::NO_COMPONENT + 1,
+					 TilesToVisit);
+	}
+  }
+
+  #ifdef ENGINE_TRACE
+	// Se calculan estadisticas sobre las componentes halladas
+	dword udMaxSize = 0;
+	word  uwIsolated = 0;
+	std::vector<dword>::iterator SizeIt(m_Connectivity.ComponentSize.begin());
+	for (; SizeIt != m_Connectivity.ComponentSize.end(); ++SizeIt) {
+	  if (*SizeIt > udMaxSize) { 
+		udMaxSize = *SizeIt; 
+	  }
+	  if (1 == *SizeIt) { 
+		++uwIsolated; 
+	  }
+	}
+	SYSEngine::GetLogger()->Write("CArea::BuildConnectivity> Area %u: %u componentes, la mayor con %u tiles y %u tiles aislados.\n", 
+								  m_Map.uwID, m_Connectivity.uwNumComponents, udMaxSize, uwIsolated);
+  #endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Libera la informacion de conectividad.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::ReleaseConnectivity(void)
+{
+  // Se libera array
+  if (m_Connectivity.pTileComponent) {
+	delete[] m_Connectivity.pTileComponent;
+	m_Connectivity.pTileComponent = NULL;
+  }
+
+  // Se resetean contadores
+  m_Connectivity.ComponentSize.clear();
+  m_Connectivity.uwNumComponents = 0;
+  m_Connectivity.NextComponent = AreaDefs::NO_COMPONENT + 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Asocia la componente Component a todos los tiles alcanzables desde 
+//   TileIdx. Los tiles con componente igual o superior a FirstValidComponent
+//   se consideraran ya visitados, pudiendo sobreescribirse el resto.
+// Parametros:
+// - TileIdx. Tile desde donde comenzar.
+// - Component. Componente a asociar.
+// - FirstValidComponent. Primera componente que se considerara ya asentada.
+// - TilesToVisit. Pila de trabajo (se recibe para evitar reservas).
+// Devuelve:
+// Notas:
+// - Los tamaos de las componentes se actualizaran a la vez que se asocian.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::FloodComponent(const AreaDefs::TileIndex& TileIdx,
+					  const AreaDefs::ComponentID& Component,
+					  const AreaDefs::ComponentID& FirstValidComponent,
+					  std::vector<AreaDefs::TileIndex>& TilesToVisit)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk() && IsAreaLoaded());
   // SOLO si parametros validos
-  ASSERT(hEntity);
+  ASSERT(IsCellIndexWithContent(TileIdx));
+  ASSERT((Component >= FirstValidComponent) != 0);
+  ASSERT((Component == m_Connectivity.ComponentSize.size()) != 0);
+
+  // Se registra la nueva componente
+  m_Connectivity.ComponentSize.push_back(0);
+  ++m_Connectivity.uwNumComponents;
+
+  // Se recorren todos los tiles alcanzables
+  TilesToVisit.clear();
+  TilesToVisit.push_back(TileIdx);
+  while (!TilesToVisit.empty()) {
+	// Se toma tile
+	const AreaDefs::TileIndex ActIdx = TilesToVisit.back();
+	TilesToVisit.pop_back();
+
+	// Ya visitado?
+	AreaDefs::ComponentID& ActComponent = m_Connectivity.pTileComponent[ActIdx];
+	if (ActComponent >= FirstValidComponent) {
+	  continue;
+	}
+
+	// Se desvincula de la componente previa y se asocia a la nueva
+	if (AreaDefs::NO_COMPONENT != ActComponent) {
+	  ASSERT(m_Connectivity.ComponentSize[ActComponent]);
+	  if (0 == --m_Connectivity.ComponentSize[ActComponent]) {
+		--m_Connectivity.uwNumComponents;
+	  }
+	}
+	ActComponent = Component;
+	++m_Connectivity.ComponentSize[Component];
 
-  // Realiza una busqueda en el map de tags
-  TagMapIt It(m_EntityTags.begin());
-  for (; It != m_EntityTags.end(); ++It) {
-	// Handle buscado?
-	if (It->second == hEntity) {
-	  // Se retorna
-	  return It;
+	// Se exploran los adyacentes
+	const AreaDefs::sTilePos ActPos(GetTilePosFromIdx(ActIdx));
+	byte ubIt = 0;
+	for (; ubIt < IsoDefs::MAX_DIRECTIONS; ++ubIt) {
+	  // Existe tile adyacente no visitado?
+	  const IsoDefs::eDirectionIndex Dir = IsoDefs::eDirectionIndex(ubIt);
+	  AreaDefs::sTilePos AdjPos;
+	  if (GetAdjacentTilePos(ActPos, Dir, AdjPos)) {
+		const AreaDefs::TileIndex AdjIdx = GetTileIdx(AdjPos);
+		if (m_Connectivity.pTileComponent[AdjIdx] < FirstValidComponent) {
+		  // Si, se puede franquear en alguno de los dos sentidos?
+		  const IsoDefs::eDirectionIndex InvDir = IsoDefs::eDirectionIndex((ubIt + 4) % IsoDefs::MAX_DIRECTIONS);
+		  if (CanCrossInConnectivity(ActPos, Dir) ||
+			  CanCrossInConnectivity(AdjPos, InvDir)) {
+			TilesToVisit.push_back(AdjIdx);
+		  }
+		}
+	  }
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprueba si desde TileSrc se puede pasar al tile adyacente en la 
+//   direccion Dir, usando las mascaras estaticas de la rejilla de accesos.
+// Parametros:
+// - TileSrc. Tile origen.
+// - Dir. Direccion al tile destino.
+// Devuelve:
+// - Si se puede pasar true. En caso contrario false.
+// Notas:
+// - Se replicaran las mismas reglas que usa el pathfinder (incluida la
+//   comprobacion de los tiles adyacentes al destino para las direcciones
+//   norte, este, sur y oeste, con su misma mascara) salvo la comprobacion
+//   de criaturas.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CArea::CanCrossInConnectivity(const AreaDefs::sTilePos& TileSrc,
+							  const IsoDefs::eDirectionIndex& Dir)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk() && IsAreaLoaded());
+  ASSERT(m_Map.pAccessGrid);
+  // SOLO si parametros validos
+  ASSERT((Dir != IsoDefs::NO_DIRECTION_INDEX) != 0);
+
+  // La mascara del tile destino permite la entrada?
+  // Nota: Se debera de chequear siempre la direccion simetrica a Dir
+  AreaDefs::sTilePos TileDest;
+  if (!GetAdjacentTilePos(TileSrc, Dir, TileDest)) {
+	return false;
+  }
+  const byte ubInvFlag = IsoDefs::NORTH_FLAG << ((Dir + 4) % IsoDefs::MAX_DIRECTIONS);
+  if (m_Map.pAccessGrid[GetTileIdx(TileDest)] & ubInvFlag) {
+	return false;
+  }
+
+  // Es una direccion diagonal?
+  if (Dir & 1) {
+	// Si, no hay que comprobar adyacentes
+	return true;
+  }
+
+  // Se comprueba si alguna de las dos direcciones adyacentes a Dir puede
+  // ser accedida desde el origen
+  const IsoDefs::eDirectionIndex AdjacentDirs[2] = {
+	IsoDefs::eDirectionIndex((Dir + IsoDefs::MAX_DIRECTIONS - 1) % IsoDefs::MAX_DIRECTIONS),
+	IsoDefs::eDirectionIndex((Dir + 1) % IsoDefs::MAX_DIRECTIONS)
+  };
+  byte ubIt = 0;
+  for (; ubIt < 2; ++ubIt) {
+	AreaDefs::sTilePos AdjPos;
+	if (GetAdjacentTilePos(TileSrc, AdjacentDirs[ubIt], AdjPos)) {
+	  const byte ubAdjInvFlag = IsoDefs::NORTH_FLAG << ((AdjacentDirs[ubIt] + 4) % IsoDefs::MAX_DIRECTIONS);
+	  const AreaDefs::TileAccessInfo AdjAccessInfo = m_Map.pAccessGrid[GetTileIdx(AdjPos)];
+	  if (!((AdjAccessInfo >> AreaDefs::TILE_ADJ_ACCESS_SHIFT) & ubAdjInvFlag)) {
+		return true;
+	  }
+	}
+  }
+
+  // No hay posibilidad de acceso
+  return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Actualiza la rejilla de accesos y la informacion de conectividad tras un
+//   cambio en los accesos del tile TilePos (bloqueo / desbloqueo de una 
+//   pared, cambio de la mascara de un floor, insercion o extraccion de un 
+//   obstaculo, etc).
+// - Un cambio en TilePos afectara a la mascara de el mismo y a la de sus
+//   adyacentes (por las paredes), y por lo tanto a los pasos que partan de
+//   los adyacentes de estos. Se recalcularan las mascaras de la rejilla 
+//   afectadas y se volveran a etiquetar, con nuevos identificadores, las
+//   componentes que toquen dicha region. Asi, tanto la union de componentes
+//   (desbloqueo) como su posible division (bloqueo) quedaran resueltas sin
+//   tener que recalcular el area completa.
+// Parametros:
+// - TilePos. Posicion en donde se produjo el cambio.
+// Devuelve:
+// Notas:
+// - Si la rejilla no esta construida (carga del area) no se hara nada.
+// - Cualquier componente que quede dividida contendra necesariamente algun
+//   tile de la region, por lo que bastara con etiquetar desde estos.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CArea::UpdateAccessInfoAt(const AreaDefs::sTilePos& TilePos)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Hay rejilla construida y es una posicion con contenido?
+  if (!m_Map.pAccessGrid ||
+	  !IsCellValid(TilePos) ||
+	  !IsCellWithContent(TilePos)) {
+	return;
+  }
+
+  // Se halla el tile y sus adyacentes, recalculando sus mascaras
+  std::vector<AreaDefs::TileIndex> ChangedTiles;
+  ChangedTiles.push_back(GetTileIdx(TilePos));
+  byte ubIt = 0;
+  for (; ubIt < IsoDefs::MAX_DIRECTIONS; ++ubIt) {
+	AreaDefs::sTilePos AdjPos;
+	if (GetAdjacentTilePos(TilePos, IsoDefs::eDirectionIndex(ubIt), AdjPos)) {
+	  ChangedTiles.push_back(GetTileIdx(AdjPos));
+	}
+  }
+  std::vector<AreaDefs::TileIndex>::iterator TileIt(ChangedTiles.begin());
+  for (; TileIt != ChangedTiles.end(); ++TileIt) {
+	SetAccessGridMask(*TileIt);
+  }
+
+  // Se podrian agotar los identificadores de componentes?
+  if (m_Connectivity.NextComponent > 0xFFFF - 128) {
+	// Si, se reconstruye toda la conectividad
+	BuildConnectivity();
+	return;
+  }
+
+  // Se forma la region afectada, aadiendo los adyacentes de los anteriores
+  std::vector<AreaDefs::TileIndex> Region(ChangedTiles);
+  for (TileIt = ChangedTiles.begin(); TileIt != ChangedTiles.end(); ++TileIt) {
+	const AreaDefs::sTilePos ChangedPos(GetTilePosFromIdx(*TileIt));
+	for (ubIt = 0; ubIt < IsoDefs::MAX_DIRECTIONS; ++ubIt) {
+	  AreaDefs::sTilePos AdjPos;
+	  if (GetAdjacentTilePos(ChangedPos, IsoDefs::eDirectionIndex(ubIt), AdjPos)) {
+		Region.push_back(GetTileIdx(AdjPos));
+	  }
 	}
   }
 
-  // No se encontro
-  return m_EntityTags.end();
+  // Se vuelven a etiquetar las componentes que tocan la region
+  // Nota: Los tiles ya visitados tendran componente >= FirstValidComponent
+  const AreaDefs::ComponentID FirstValidComponent = m_Connectivity.NextComponent;
+  std::vector<AreaDefs::TileIndex> TilesToVisit;
+  for (TileIt = Region.begin(); TileIt != Region.end(); ++TileIt) {
+	if (m_Connectivity.pTileComponent[*TileIt] < FirstValidComponent) {
+	  FloodComponent(*TileIt, 
+					 m_Connectivity.NextComponent++, 
+					 FirstValidComponent,
+					 TilesToVisit);
+	}
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4347,9 +6547,8 @@ bool CCellIterator::Init(CArea* const pArea,
   }
 
   // Se obtiene la lista asociada al tile y se almacena
-  ASSERT(pArea->m_Map.pMap);
-  ASSERT(pArea->m_Map.pMap[pArea->GetTileIdx(TilePos)]);
-  m_pList = &pArea->m_Map.pMap[pArea->GetTileIdx(TilePos)]->Entities;
+  ASSERT(pArea->m_Map.ppCellChunks);
+  m_pList = &pArea->GetCell(pArea->GetTileIdx(TilePos))->Entities;
   ASSERT(m_pList);
 
   // Se inicializan resto de vbles de miembro  
@@ -100,6 +100,18 @@
 #ifndef _CROOF_H_
 #include "CRoof.h"
 #endif
+#ifndef _CENTITYTABLE_H_
+#include "CEntityTable.h"
+#endif
+#ifndef _CTAGINDEX_H_
+#include "CTagIndex.h"
+#endif
+#ifndef _CCRIATUREGRID_H_
+#include "CCriatureGrid.h"
+#endif
+#ifndef _CCELLENTITIES_H_
+#include "CCellEntities.h"
+#endif
 #ifndef _LIST_H_
 #include <list>
 #define _LIST_H_
@@ -120,6 +132,10 @@
 #include <set>
 #define _SET_H_
 #endif
+#ifndef _VECTOR_H_
+#include <vector>
+#define _VECTOR_H_
+#endif
 
 // Definicion de clases / estructuras / espacios de nombres
 struct iCGameDataBase;
@@ -127,6 +143,13 @@ struct iCEntitySelector;
 struct iCWorld;
 class CWorldEntity;
 class CSprite;
+namespace CBDefs {
+  struct sAreaV2Header;
+  struct sAreaV2Cell;
+  struct sAreaV2Roof;
+  struct sAreaV2Entity;
+  struct sAreaV2Item;
+}
 
 // Clase CArea
 class CArea: public iCCriatureObserver
@@ -212,29 +235,15 @@ private:
 
 private:
   // Tipos de uso durante el trabajo con el area
-  // Objetos de escenario  
-  typedef std::map<AreaDefs::EntHandle, sNSceneObj*> SObjsMap;
-  typedef SObjsMap::value_type                       SObjsValType;
-  typedef SObjsMap::iterator                         SObjsIt;
-  // Items
-  typedef std::map<AreaDefs::EntHandle, sNItem*> ItemsMap;
-  typedef ItemsMap::value_type                   ItemsValType;
-  typedef ItemsMap::iterator                     ItemsIt;
-  // Criaturas  
-  typedef std::map<AreaDefs::EntHandle, sNCriature*> CriaturesMap;
-  typedef CriaturesMap::value_type                   CriaturesValType;
-  typedef CriaturesMap::iterator                     CriaturesIt;
-  // Paredes  
-  typedef std::map<AreaDefs::EntHandle, sNWall*> WallsMap;
-  typedef WallsMap::value_type                   WallsValType;
-  typedef WallsMap::iterator                     WallsIt;    
-  // Techos
-  typedef std::map<AreaDefs::EntHandle, sNRoof*> RoofsMap;
-  typedef RoofsMap::iterator                     RoofsMapIt;
-  typedef RoofsMap::value_type                   RoofsMapValType;
+  // Nota: Las tablas de entidades se indexaran directamente por handle
+  typedef CEntityTable<sNSceneObj> SObjsMap;     // Objetos de escenario
+  typedef CEntityTable<sNItem>     ItemsMap;     // Items
+  typedef CEntityTable<sNCriature> CriaturesMap; // Criaturas
+  typedef CEntityTable<sNWall>     WallsMap;     // Paredes
+  typedef CEntityTable<sNRoof>     RoofsMap;     // Techos
   // Entidades asociadas a una celda
-  typedef std::list<AreaDefs::EntHandle> CellEntitiesList;
-  typedef CellEntitiesList::iterator     CellEntitiesListIt;
+  typedef CCellEntities              CellEntitiesList;
+  typedef CellEntitiesList::iterator CellEntitiesListIt;
   // Mapeado de las mascaras de acceso
   typedef std::map<AreaDefs::TileIndex, AreaDefs::MaskTileAccess> MaskTileAccessMap;
   typedef MaskTileAccessMap::iterator                             MaskTileAccessMapIt;
@@ -248,32 +257,86 @@ private:
   typedef std::set<AreaDefs::EntHandle> ShowUnderRoofsSet;
   typedef ShowUnderRoofsSet::iterator   ShowUnderRoofsSetIt;
 
+  // Conjunto de bits con las cubiertas que dejan ver lo que tienen debajo
+  typedef std::vector<dword> UncoveredBitsVector;
+
+private:
+  // Estructuras
+  struct sCellSignature {
+	// Firma del contenido de una celda en el formato de los ficheros
+	// temporales. Un tamao 0 indicara que la celda no procede del archivo
+	// de area base, por lo que siempre se considerara modificada.
+	// Nota: Las firmas reducen lo que se escribe al guardar, no el tiempo de
+	// guardado; cada guardado seguira serializando y firmando todas las
+	// celdas con contenido (ver SaveAreaDelta).
+	dword udSize; // Tamao del contenido
+	dword udHash; // Hash del contenido
+	// Constructor
+	sCellSignature(void): udSize(0), udHash(0) { }
+  };
+
+private:
+  // Tipos
+  // Firmas de las celdas del archivo de area base
+  typedef std::vector<sCellSignature> CellSignatureVector;
+
 private:
   // Estructuras
   struct sNCell {
 	// Representa a un tile
+	// Nota: El posible techo se hallara en la rejilla de techos del mapa
 	CFloor		        Floor;    // Floor del tile 
 	CellEntitiesList    Entities; // Entidades del universo & elementos dibujables SOBRE el floor	
-	AreaDefs::EntHandle hRoof;    // Handle al posible techo
-	// Constructor por defecto
-	sNCell(void): hRoof(0) { }
 	// Pool de memoria
 	static CMemoryPool m_MPool;
 	static void* operator new(const size_t size) { return m_MPool.AllocMem(size); }
 	static void operator delete(void* pItem) { m_MPool.FreeMem(pItem); } 
   };
 
+  struct sCellChunk {
+	// Bloque de celdas de 32 x 32 tiles
+	// Nota: Las celdas sin entidades de los bloques alejados de la camara y
+	// de las criaturas podran descargarse, guardandose su floor en PagedCells.
+	// Las celdas con entidades seguiran siempre residentes
+	sNCell*            Cells[AreaDefs::CELL_CHUNK_TILES]; // Celdas del bloque
+	dword              udContent[AreaDefs::CELL_CHUNK_TILES / 32]; // Bits de celdas con contenido
+	std::vector<sbyte> PagedCells; // Celdas descargadas
+	dword              udLastUse;  // Ultima actualizacion en que se uso
+	bool               bPagedOut;  // Hay celdas descargadas?
+	// Constructor
+	sCellChunk(void): udLastUse(0),
+					  bPagedOut(false) {
+	  memset(Cells, 0, sizeof(Cells));
+	  memset(udContent, 0, sizeof(udContent));
+	}
+  };
+
   struct sLightFocusInfo {
 	// Informacion asociada a un foco de luz
 	GraphDefs::Light   LightIntensity; // Intensidad de la luz
 	AreaDefs::sTilePos TilePos;        // Pos. del foco en tile
+	// Region y posicion universal con las que el foco incide en la rejilla
+	sPosition          WorldPos;       // Pos. universal del centro del foco
+	AreaDefs::sTilePos InitTilePos;    // Inicio de la region de incidencia
+	AreaDefs::sTilePos EndTilePos;     // Final de la region de incidencia
+	bool               bInMap;         // Incide sobre la rejilla?
+	#ifdef LIGHTING_PROFILE
+	  // Coste de las actualizaciones por movimiento del foco
+	  dword udNumUpdates;   // Actualizaciones realizadas
+	  dword udVisitedTiles; // Tiles recorridos
+	  dword udRecalcTiles;  // Tiles en los que se recalculo el maximo
+	  dword udTotalTime;    // Tiempo total invertido (microsegundos)
+	  dword udMaxTime;      // Tiempo maximo de una actualizacion
+	#endif
 	// Constructor
-	sLightFocusInfo(const sLightFocusInfo& LightFocusInfo): LightIntensity(LightFocusInfo.LightIntensity),
-															TilePos(LightFocusInfo.TilePos) { }
-						
 	sLightFocusInfo(const GraphDefs::Light& aLightIntensity,
 					const AreaDefs::sTilePos& aTilePos): LightIntensity(aLightIntensity),
-														 TilePos(aTilePos) { }
+														 TilePos(aTilePos),
+														 bInMap(false) {
+	  #ifdef LIGHTING_PROFILE
+		udNumUpdates = udVisitedTiles = udRecalcTiles = udTotalTime = udMaxTime = 0;
+	  #endif
+	}
   };
 
 private:
@@ -282,43 +345,30 @@ private:
   typedef std::map<AreaDefs::EntHandle, sLightFocusInfo> LightFocusInfoMap;
   typedef LightFocusInfoMap::iterator                    LightFocusInfoMapIt;
   typedef LightFocusInfoMap::value_type                  LightFocusInfoMapValType;
-  // Map que representa un vertice de un tile con todos las intensidades de luz
-  // que inciden en el mismo, asociadas a los dueos (focos) de las mismas
-  typedef std::map<AreaDefs::EntHandle, GraphDefs::Light> VertexTileLightsMap;
-  typedef VertexTileLightsMap::iterator                   VertexTileLightMapIt;
-  typedef VertexTileLightsMap::value_type                 VertextTileLightMapValType;
-
+  
 private:
   // Estructuras
-  struct sLightInTilePosInfo {
-	// Informacion referida a la luz reflejada sobre una posicion
-	VertexTileLightsMap LightsInVertex[4]; // Luz asociada a cada vertice
-	GraphDefs::sLight   TileLight;         // Luz actual de la posicion
-	sPosition           WorldPos;          // Posicion universal del tile
-	// Constructores
-	sLightInTilePosInfo(const sPosition& aWorldPos): WorldPos(aWorldPos) { }
-	sLightInTilePosInfo(const sLightInTilePosInfo& LightInTilePosInfo): TileLight(LightInTilePosInfo.TileLight),
-																		WorldPos(LightInTilePosInfo.WorldPos) {
-	  LightsInVertex[0] = LightInTilePosInfo.LightsInVertex[0];
-	  LightsInVertex[1] = LightInTilePosInfo.LightsInVertex[1];
-	  LightsInVertex[2] = LightInTilePosInfo.LightsInVertex[2];
-	  LightsInVertex[3] = LightInTilePosInfo.LightsInVertex[3];
-	}
+  struct sAreaV2Data {
+	// Archivo de area base en formato v2 alojado en memoria
+	// Nota: Los punteros referiran a las secciones dentro de psbData, que
+	// sera la vista del CPAK proyectado (con hFile abierto) o bien Data
+	std::vector<sbyte>           Data;          // Contenido leido del archivo
+	FileDefs::FileHandle         hFile;         // Handle que mantiene la vista
+	const sbyte*                 psbData;       // Contenido del archivo
+	dword                        udSize;        // Tamao del archivo
+	const CBDefs::sAreaV2Header* pHeader;       // Cabecera
+	const sbyte*                 psbStrings;    // Seccion de cadenas
+	dword                        udStringsSize; // Tamao de la seccion de cadenas
+	const CBDefs::sAreaV2Cell*   pCells;        // Seccion de celdas
+	const CBDefs::sAreaV2Roof*   pRoofs;        // Seccion de techos
+	const CBDefs::sAreaV2Entity* pEntities;     // Seccion de entidades
+	const CBDefs::sAreaV2Item*   pItems;        // Seccion de items
+	// Constructor
+	sAreaV2Data(void): hFile(0),
+					   psbData(NULL),
+					   udSize(0) { }
   };
 
-private:
-  // Tipos
-  // Map asociado a los tags del area actual
-  typedef std::map<std::string, AreaDefs::EntHandle> TagMap;
-  typedef TagMap::value_type                         TagMapValType;
-  typedef TagMap::iterator                           TagMapIt;
-  // Map con todas las posiciones del universo de juego que estan afectadas por luz
-  typedef std::map<AreaDefs::TileIndex, sLightInTilePosInfo> LightInTilePosInfoMap;
-  typedef LightInTilePosInfoMap::iterator                    LightInTilePosInfoMapIt;
-  typedef LightInTilePosInfoMap::value_type					 LightInTilePosInfoMapValType;
-  
-private:
-  // Estructuras
   struct sMapInfo {	
 	// Informacion referida al mapa del area
 	// Datos
@@ -328,9 +378,38 @@ private:
 	word			 uwWidth;      // Num. tiles a lo ancho
 	word			 uwHeight;     // Num. tiles a lo alto	
 	bool             bTmpArea;     // Area temporal?
-	sNCell**		 pMap;         // Mapa del area			
+	// Bloques de celdas del mapa del area
+	// Nota: Los bloques sin celdas referiran al bloque vacio compartido
+	sCellChunk**     ppCellChunks;        // Bloques de celdas
+	word             uwCellChunksWidth;   // Num. bloques a lo ancho
+	word             uwCellChunksHeight;  // Num. bloques a lo alto
+	word             uwNumPagedInChunks;  // Num. bloques con celdas y sin descargar
+	dword            udCellChunksUpdate;  // Actualizacion actual de los bloques
 	// Map con mascaras de accesos para tiles
 	MaskTileAccessMap IndexOfMaskTileAccess; 
+	// Rejilla con la info de acceso empaquetada de cada tile
+	AreaDefs::TileAccessInfo* pAccessGrid;
+	// Rejilla con el handle al posible techo de cada tile
+	AreaDefs::EntHandle* pRoofGrid;
+	// Rejillas con el floor, su elevacion y sus flags para cada tile
+	// Nota: Se mantienen en paralelo a las celdas para que el recorrido de
+	// dibujado no tenga que acceder a estas. El floor sera NULL en los tiles
+	// sin contenido o cuya celda se halle descargada.
+	CFloor**              ppFloorGrid;
+	RulesDefs::Elevation* pElevationGrid;
+	AreaDefs::FloorFlags* pFloorFlagsGrid;
+	// Rejillas con la habitacion y la cubierta asociadas a cada tile
+	// Nota: La cubierta sera 0 si el tile no tiene techo o este muestra lo
+	// que tiene debajo y RoomID + 1 en otro caso. El bit de cada cubierta
+	// en UncoveredBits indicara si en ese momento su contenido es visible.
+	AreaDefs::RoomID*   pRoomGrid;
+	AreaDefs::RoomID*   pCoverGrid;
+	UncoveredBitsVector UncoveredBits;
+	// Firmas de las celdas tal y como se cargaron del archivo de area base
+	// Nota: Solo se usaran con archivos v2, guardandose entonces en el
+	// fichero temporal unicamente las celdas cuya firma haya cambiado
+	CellSignatureVector CellSignatures;
+	dword               udBaseFileSize; // Tamao del archivo de area base v2
 	// Entidades
 	SObjsMap     SceneObjs;  // Map con los objetos de escenario
 	ItemsMap     Items;      // Map con los items
@@ -341,14 +420,49 @@ private:
 	RoomInfoMap       RoomInfo;       // Relacion habitaciones / celdas
 	ShowUnderRoofsSet ShowUnderRoofs; // Techos que muestran lo que tienen debajo
 	// Constructor por defecto
-	sMapInfo(void): pMap(NULL), AmbientLight(0) { }
+	sMapInfo(void): ppCellChunks(NULL), 
+					uwCellChunksWidth(0),
+					uwCellChunksHeight(0),
+					uwNumPagedInChunks(0),
+					udCellChunksUpdate(0),
+					pAccessGrid(NULL), 
+					pRoofGrid(NULL), 
+					ppFloorGrid(NULL),
+					pElevationGrid(NULL),
+					pFloorFlagsGrid(NULL),
+					pRoomGrid(NULL), 
+					pCoverGrid(NULL), 
+					udBaseFileSize(0),
+					AmbientLight(0),
+					SceneObjs(RulesDefs::SCENE_OBJ),
+					Items(RulesDefs::ITEM),
+					Walls(RulesDefs::WALL),
+					Criatures(RulesDefs::CRIATURE),
+					Roofs(RulesDefs::ROOF) { }
   };
 
   struct sDinamicLightInfo {
 	// Info asociada al trabajo con el sistema de luz dinamica
-	LightFocusInfoMap     LightFocus;     // Focos de luz
-	LightInTilePosInfoMap LightInTilePos; // Luz asociada a posiciones
-	GraphDefs::sLight     CommonLight;    // Luz comun a todos los tiles (0)
+	// Nota: La rejilla tendra una entrada por tile con la luz de sus 4 
+	// vertices, que sera el maximo de la aportada por los focos que incidan
+	LightFocusInfoMap  LightFocus;  // Focos de luz
+	GraphDefs::sLight* pTileLight;  // Rejilla con la luz de cada tile
+	GraphDefs::sLight  CommonLight; // Luz comun a todos los tiles (0)
+	// Constructor por defecto
+	sDinamicLightInfo(void): pTileLight(NULL) { }
+  };
+
+  struct sConnectivityInfo {
+	// Info asociada a las componentes conexas del area
+	// Nota: Dos tiles en distinta componente NUNCA podran unirse por camino
+	AreaDefs::ComponentID* pTileComponent;  // Componente de cada tile
+	std::vector<dword>     ComponentSize;   // Num. tiles por componente
+	word                   uwNumComponents; // Num. componentes con tiles
+	AreaDefs::ComponentID  NextComponent;   // Sig. identificador libre
+	// Constructor por defecto
+	sConnectivityInfo(void): pTileComponent(NULL), 
+							 uwNumComponents(0),
+							 NextComponent(AreaDefs::NO_COMPONENT + 1) { }
   };
 
   struct sPlayerInfo {
@@ -375,14 +489,21 @@ private:
 
   // Resto de vbles
   sMapInfo			 m_Map;              // Info sobre el mapa asociado al area 
-  TagMap             m_EntityTags;       // Tags asociados a las entidades
+  CTagIndex          m_EntityTags;       // Tags asociados a las entidades
+  CCriatureGrid      m_CriatureGrid;     // Rejilla espacial de criaturas
   sDinamicLightInfo  m_DinamicLightInfo; // Info sobre el sistema dinamico de luz
+  sConnectivityInfo  m_Connectivity;     // Info sobre componentes conexas
   sPlayerInfo		 m_PlayerInfo;		 // Info referida al jugador  
   sFloorSelectorInfo m_FloorSelector;    // Datos sobre el selector actual asociado
   bool				 m_bIsInitOk;		 // Clase correctamente inicializada?  
   bool				 m_bIsAreaLoading;	 // Se esta cargando un area?
   bool               m_bIsAreaLoaded;    // Area cargada?
   bool               m_bInFreeAreaMode;  // Se esta liberando el area?
+
+private:
+  // Vbles static
+  // Bloque vacio, compartido por todos los bloques sin celdas
+  static sCellChunk m_EmptyCellChunk;
       
 public:
   // Constructor / destructor
@@ -420,18 +541,28 @@ private:
   // Metodos de apoyo para la carga de datos
   void FreeAreaInfo(const bool bRemovePlayerInfo);
   void SaveAreaInfo(const bool bIsChangingArea);
+  void SaveAreaDelta(const FileDefs::FileHandle& hFile,
+					 dword& udOffset,
+					 const bool bIsChangingArea);
+  void SaveCellInfo(const FileDefs::FileHandle& hFile,
+					dword& udOffset,
+					const AreaDefs::sTilePos& TilePos,
+					const bool bIsChangingArea);
   bool SaveEntitiesInfo(const FileDefs::FileHandle& hFile,
 					    dword& udOffset,
 						CellEntitiesList& Entities,
 						const bool bIsChangingArea);
   bool LoadArea(const word uwIDArea);
-  void CheckAreaFile(const FileDefs::FileHandle& hAreaFile,
+  byte CheckAreaFile(const FileDefs::FileHandle& hAreaFile,
 					 dword& udAreaOffset,
 					 const byte ubAreaFileType,
 					 const word uwIDArea,
 					 const std::string& szArea);
-  void LoadAreaInfo(const FileDefs::FileHandle& hAreaFile,
-					dword& udAreaOffset);	
+  void CreateMapInfo(const word uwNumRooms);
+  void LoadCellInfo(const FileDefs::FileHandle& hAreaFile,
+					dword& udAreaOffset,
+					const AreaDefs::sTilePos& TilePos,
+					const bool bTmpAreaFile);
   void LoadCells(const FileDefs::FileHandle& hAreaFile,
 				 dword& udAreaOffset,
 			     const AreaDefs::sTilePos& TilePos,
@@ -477,6 +608,118 @@ private:
 					  const AreaDefs::EntHandle& hEntity);
   void LoadPlayer(const FileDefs::FileHandle& hFile,
 				  dword& udOffset);
+private:
+  // Metodos de apoyo para la carga de archivos de area base v2
+  void ReadAreaFileV2(const FileDefs::FileHandle& hAreaFile,
+					  const std::string& szArea,
+					  sAreaV2Data& AreaData);
+  void ConvertAreaFileV1(const FileDefs::FileHandle& hAreaFile,
+						 const std::string& szArea,
+						 sAreaV2Data& AreaData);
+  void LocateSectionsV2(const std::string& szArea,
+						sAreaV2Data& AreaData);
+  void LoadAreaInfoV2(const sAreaV2Data& AreaData);
+  void LoadCellsV2(const sAreaV2Data& AreaData);
+  void LoadCellV2(const sAreaV2Data& AreaData,
+				  const dword udCell);
+  void LoadCellsDelta(const sAreaV2Data& AreaData,
+					  const FileDefs::FileHandle& hTmpFile,
+					  dword& udTmpOffset,
+					  std::vector<bool>& DeltaCells);
+  void LoadRoofV2(const sAreaV2Data& AreaData,
+				  const dword udRoof,
+				  const AreaDefs::TileIndex& TileIndex);
+  void LoadEntityV2(const sAreaV2Data& AreaData,
+					const dword udEntity,
+					const AreaDefs::sTilePos& TilePos);
+  void LoadItemsV2(const sAreaV2Data& AreaData,
+				   const dword udFirstItem,
+				   const word uwNumItems,
+				   iCItemContainer* const pContainer,
+				   CCriature* const pCriature,
+				   const RulesDefs::eEntityType& EntityType,
+				   const AreaDefs::sTilePos& TilePos);
+  const sbyte* GetStringV2(const sAreaV2Data& AreaData,
+						   const dword udOffset);
+private:
+  // Metodos de apoyo para el trabajo con las firmas de las celdas
+  void BuildCellSignatures(const std::vector<bool>& DeltaCells);
+  const sbyte* const SaveCellToScratch(const FileDefs::FileHandle& hScratchFile,
+									   const std::string& szScratchFile,
+									   const AreaDefs::sTilePos& TilePos,
+									   const bool bIsChangingArea,
+									   sCellSignature& Signature);
+  #ifdef _SYSASSERT
+  word CountModifiedCells(void);
+  #endif
+
+private:
+  // Metodos de apoyo para el trabajo con los bloques de celdas
+  void CreateCellChunks(void);
+  void ReleaseCellChunks(void);
+  void SetCell(const AreaDefs::TileIndex& TileIdx,
+			   sNCell* const pCell);
+  void PageInCellChunk(const word uwChunk);
+  bool PageOutCellChunk(const word uwChunk);
+  word MarkCellChunksInUse(const AreaDefs::sTilePos& InitTilePos,
+						   const AreaDefs::sTilePos& EndTilePos);
+  inline void GetCellChunkPos(const AreaDefs::TileIndex& TileIdx,
+							  word& uwChunk,
+							  word& uwCell) const {
+	ASSERT(m_Map.ppCellChunks);
+	// Se obtiene el bloque y la posicion de la celda en el mismo
+	const word uwXTile = TileIdx % m_Map.uwWidth;
+	const word uwYTile = TileIdx / m_Map.uwWidth;
+	uwChunk = (uwYTile >> AreaDefs::CELL_CHUNK_SHIFT) * m_Map.uwCellChunksWidth + 
+			  (uwXTile >> AreaDefs::CELL_CHUNK_SHIFT);
+	uwCell = ((uwYTile & AreaDefs::CELL_CHUNK_MASK) << AreaDefs::CELL_CHUNK_SHIFT) + 
+			 (uwXTile & AreaDefs::CELL_CHUNK_MASK);
+  }
+  inline sNCell* const GetCell(const AreaDefs::TileIndex& TileIdx) {
+	// Se localiza el bloque, cargando sus celdas si estuvieran descargadas
+	word uwChunk;
+	word uwCell;
+	GetCellChunkPos(TileIdx, uwChunk, uwCell);
+	sCellChunk* const pChunk = m_Map.ppCellChunks[uwChunk];
+	if (pChunk->bPagedOut) {
+	  PageInCellChunk(uwChunk);
+	}
+	pChunk->udLastUse = m_Map.udCellChunksUpdate;
+	// Se retorna la celda
+	return pChunk->Cells[uwCell];
+  }
+  inline bool IsCellIndexWithContent(const AreaDefs::TileIndex& TileIdx) const {
+	// Comprueba si la celda tiene contenido, sin necesidad de cargarla
+	word uwChunk;
+	word uwCell;
+	GetCellChunkPos(TileIdx, uwChunk, uwCell);
+	const sCellChunk* const pChunk = m_Map.ppCellChunks[uwChunk];
+	return (pChunk->udContent[uwCell >> 5] & (1 << (uwCell & 0x1F))) ? true : false;
+  }
+  inline AreaDefs::TileIndex GetCellChunkTileIdx(const word uwChunk,
+												 const word uwCell) const {
+	ASSERT(m_Map.ppCellChunks);
+	// Se obtiene el indice del tile a partir del bloque y la posicion en este
+	const word uwXTile = ((uwChunk % m_Map.uwCellChunksWidth) << AreaDefs::CELL_CHUNK_SHIFT) + 
+						 (uwCell & AreaDefs::CELL_CHUNK_MASK);
+	const word uwYTile = ((uwChunk / m_Map.uwCellChunksWidth) << AreaDefs::CELL_CHUNK_SHIFT) + 
+						 (uwCell >> AreaDefs::CELL_CHUNK_SHIFT);
+	return uwYTile * m_Map.uwWidth + uwXTile;
+  }
+  inline void UpdateFloorEntitiesFlag(const AreaDefs::TileIndex& TileIdx,
+									  const sNCell* const pCell) {
+	ASSERT(m_Map.pFloorFlagsGrid);
+	// Se sube o baja el flag segun la celda tenga o no entidades
+	if (pCell->Entities.empty()) {
+	  m_Map.pFloorFlagsGrid[TileIdx] &= ~AreaDefs::FLOOR_WITH_ENTITIES;
+	} else {
+	  m_Map.pFloorFlagsGrid[TileIdx] |= AreaDefs::FLOOR_WITH_ENTITIES;
+	}
+  }
+public:
+  // Actualizacion de los bloques de celdas residentes
+  void UpdateCellChunks(const AreaDefs::sTilePos& InitTilePos,
+						const AreaDefs::sTilePos& EndTilePos);
 
 public:
   // Guarda / carga una partida
@@ -522,6 +765,9 @@ public:
   void DrawOnFloor(const AreaDefs::sTilePos& TilePos,
 				   const sword& swXScreen, 
 				   const sword& swYScreen);
+  #ifdef AREA_TRAVERSAL_BENCHMARK
+	void RunTraversalBenchmark(const word uwNumFrames);
+  #endif
 private:  
   bool CanDrawWorldEntity(const AreaDefs::EntHandle& hHandle, const byte ubDrawFlags);
   byte GetDrawZone(const AreaDefs::EntHandle& hHandle);
@@ -532,9 +778,8 @@ public:
 	ASSERT(IsInitOk());
 	ASSERT(IsAreaLoaded());  
 	ASSERT(hEntity);
-	// Obtiene el iterador y retorna tag si lo localiza
-	const TagMapIt It(GetMapTagIt(hEntity));
-	return (It != m_EntityTags.end()) ? It->first : "";
+	// Retorna tag si lo localiza
+	return m_EntityTags.GetTag(hEntity);
   }
   inline AreaDefs::EntHandle GetHandleFromTag(const std::string& szTag) {
 	ASSERT(IsInitOk());
@@ -542,22 +787,17 @@ public:
 	// Retorna handle si encuentra tag
 	std::string szTagLower(szTag);
 	SYSEngine::MakeLowercase(szTagLower);
-	const TagMapIt It(m_EntityTags.find(szTagLower));
-	return (It != m_EntityTags.end()) ? It->second : 0;
+	return m_EntityTags.GetHandle(szTagLower);
   }
 private:
-  TagMapIt GetMapTagIt(const AreaDefs::EntHandle& hEntity);
   void InsertTag(const AreaDefs::EntHandle& hEntity,
 				 const std::string& szTag);
   inline void RemoveTag(const AreaDefs::EntHandle& hEntity) {
 	ASSERT(IsInitOk());
 	ASSERT(IsAreaLoaded());  
 	ASSERT(hEntity);
-	// Obtiene el iterador y lo elimina del map si procede	
-	const TagMapIt It(GetMapTagIt(hEntity));
-	if (It != m_EntityTags.end()) {
-	  m_EntityTags.erase(It);
-	}
+	// Elimina el posible tag del indice
+	m_EntityTags.Remove(hEntity);
   }  
 
 public:
@@ -574,8 +814,8 @@ public:
   }  
 private:
   // Metodos de apoyo
-  void CArea::RemoveLight(const AreaDefs::EntHandle& hEntity,
-						  const bool bUpdatePos);
+  void RemoveLight(const AreaDefs::EntHandle& hEntity,
+				   const bool bUpdatePos);
   void SetLightFocusInArea(const AreaDefs::EntHandle& hEntity,
 						   const GraphDefs::Light& LightIntensity,
 						   const bool bUpdatePos,
@@ -585,22 +825,48 @@ private:
 							   const GraphDefs::Light& LightIntensity, 
 							   AreaDefs::sTilePos& InitRegionTilePos, 
 							   AreaDefs::sTilePos& EndRegionTilePos);
-  void CalculeAndSetMaxLightInTilePos(const LightInTilePosInfoMapIt& LightInfoIt, 
-									  const byte ubVertex);
-  inline void CalculeWorldVertexOfTilePos(const LightInTilePosInfoMapIt& LightInfoIt,
+  void UpdateLightFocusRegion(const AreaDefs::sTilePos& InitTilePos,
+							  const AreaDefs::sTilePos& EndTilePos,
+							  const sLightFocusInfo& PrevFocusInfo,
+							  const sLightFocusInfo& FocusInfo,
+							  const bool bSkipFocusRegion,
+							  dword& udVisitedTiles,
+							  dword& udRecalcTiles);
+  bool UpdateLightInTilePos(const AreaDefs::sTilePos& TilePos,
+							const sLightFocusInfo& PrevFocusInfo,
+							const sLightFocusInfo& FocusInfo);
+  void CalculeMaxLightInTilePos(const AreaDefs::sTilePos& TilePos,
+								const sPosition* pVertexPos,
+								GraphDefs::sLight& TileLight);
+  void CalculeFocusLightInTilePos(const sLightFocusInfo& FocusInfo,
+								  const sPosition* pVertexPos,
+								  GraphDefs::sLight& FocusLight);
+  #ifdef LIGHTING_PROFILE
+	void WriteLightFocusProfile(const AreaDefs::EntHandle& hEntity,
+								const sLightFocusInfo& FocusInfo);
+  #endif
+  inline bool IsTilePosInLightRegion(const AreaDefs::sTilePos& TilePos,
+									 const sLightFocusInfo& FocusInfo) const {
+	// Comprueba si la posicion esta dentro de la region en donde incide el
+	// foco, teniendo en cuenta que la ultima fila NO pertenecera a la region
+	return (FocusInfo.bInMap &&
+			TilePos.XTile >= FocusInfo.InitTilePos.XTile &&
+			TilePos.XTile <= FocusInfo.EndTilePos.XTile &&
+			TilePos.YTile >= FocusInfo.InitTilePos.YTile &&
+			TilePos.YTile < FocusInfo.EndTilePos.YTile);
+  }
+  inline void CalculeWorldVertexOfTilePos(const AreaDefs::sTilePos& TilePos,
 										  sPosition* pVertexPos) {
 	ASSERT(IsInitOk() && IsAreaLoaded());
-	ASSERT((LightInfoIt != m_DinamicLightInfo.LightInTilePos.end()) != 0);
 	ASSERT(pVertexPos);
 	// Se halla la posicion de cada uno de los vertices del tile en
     // terminos de posicion universal, a partir de la posicion universal del 
-	// vertice 0, que se conoce al recibir el iterador al nodo de informacion
-	// luminosa de la posicion
-	pVertexPos[0] = LightInfoIt->second.WorldPos;
-	pVertexPos[1].swXPos = LightInfoIt->second.WorldPos.swXPos + IsoDefs::TILE_WIDTH;
-	pVertexPos[1].swYPos = LightInfoIt->second.WorldPos.swYPos;
-	pVertexPos[2].swXPos = LightInfoIt->second.WorldPos.swXPos;
-	pVertexPos[2].swYPos = LightInfoIt->second.WorldPos.swYPos + IsoDefs::TILE_HEIGHT;
+	// vertice 0, que coincidira con la posicion universal del tile
+	pVertexPos[0] = m_pWorld->PassTilePosToWorldPos(TilePos);
+	pVertexPos[1].swXPos = pVertexPos[0].swXPos + IsoDefs::TILE_WIDTH;
+	pVertexPos[1].swYPos = pVertexPos[0].swYPos;
+	pVertexPos[2].swXPos = pVertexPos[0].swXPos;
+	pVertexPos[2].swYPos = pVertexPos[0].swYPos + IsoDefs::TILE_HEIGHT;
 	pVertexPos[3].swXPos = pVertexPos[1].swXPos;
 	pVertexPos[3].swYPos = pVertexPos[2].swYPos;
   }
@@ -634,6 +900,11 @@ public:
 						   const RulesDefs::CriatureRange& Range);
   void FindCriaturesContainingCriatureInRange(const AreaDefs::EntHandle& hCriature,
 									          std::set<AreaDefs::EntHandle>& InRangeSet);
+  void FindCriaturesRangeDelta(const AreaDefs::sTilePos& Pos,
+							   const RulesDefs::CriatureRange& Range,
+							   const std::set<AreaDefs::EntHandle>& InRangeSet,
+							   std::set<AreaDefs::EntHandle>& EnteredSet,
+							   std::set<AreaDefs::EntHandle>& LeftSet);
 
 private:
   // Operaciones de localizacion de entidades en tiles  
@@ -689,47 +960,40 @@ public:
   inline CSceneObj* const GetSceneObj(const AreaDefs::EntHandle& hSceneObj) {	  
 	ASSERT(IsInitOk() && IsAreaLoaded());  
 	// Localiza y retorna
-	const SObjsIt It(m_Map.SceneObjs.find(hSceneObj));  
-	return (It != m_Map.SceneObjs.end()) ? &It->second->SceneObj : NULL;
+	sNSceneObj* const pNSceneObj = m_Map.SceneObjs.Find(hSceneObj);  
+	return pNSceneObj ? &pNSceneObj->SceneObj : NULL;
   }
   inline CItem* const GetItem(const AreaDefs::EntHandle& hItem) {	  
 	ASSERT(IsInitOk() && IsAreaLoaded());  
 	// Se localiza y retorna
-	const ItemsIt It(m_Map.Items.find(hItem));  
-	return (It != m_Map.Items.end()) ? &It->second->Item : NULL;
+	sNItem* const pNItem = m_Map.Items.Find(hItem);  
+	return pNItem ? &pNItem->Item : NULL;
   }  
   inline CWall* const GetWall(const AreaDefs::EntHandle& hWall) {
 	ASSERT(IsInitOk() && IsAreaLoaded());  
 	// Se localiza y retorna
-	const WallsIt It(m_Map.Walls.find(hWall));
-	return (It != m_Map.Walls.end()) ? &It->second->Wall : NULL;
+	sNWall* const pNWall = m_Map.Walls.Find(hWall);
+	return pNWall ? &pNWall->Wall : NULL;
   }
   inline CFloor* const GetFloor(const AreaDefs::sTilePos& TilePos) {
 	ASSERT(IsInitOk() && IsAreaLoaded());
 	ASSERT(IsCellValid(TilePos));
 	// Localiza y retorna
 	const AreaDefs::TileIndex TileIdx = GetTileIdx(TilePos);
-	return &m_Map.pMap[TileIdx]->Floor;
+	return &GetCell(TileIdx)->Floor;
   }
   inline CRoof* const GetRoof(const AreaDefs::EntHandle& hRoof) {
 	ASSERT(IsInitOk() && IsAreaLoaded());
 	// Se localiza y retorna
-	const RoofsMapIt It(m_Map.Roofs.find(hRoof));
-	return (It != m_Map.Roofs.end()) ? &It->second->Roof : NULL;
+	sNRoof* const pNRoof = m_Map.Roofs.Find(hRoof);
+	return pNRoof ? &pNRoof->Roof : NULL;
   }
   inline CRoof* const GetRoof(const AreaDefs::sTilePos& TilePos) {
 	ASSERT(IsInitOk() && IsAreaLoaded());
 	ASSERT(IsCellValid(TilePos));
 	// Localiza y retorna
-	sNCell* const pCell = m_Map.pMap[GetTileIdx(TilePos)];
-	if (pCell) {	  
-	  if (pCell->hRoof) {
-		return GetRoof(pCell->hRoof);
-	  }
-	} 
-	
-	// No se encontro
-	return NULL;	
+	const AreaDefs::EntHandle hRoof = m_Map.pRoofGrid[GetTileIdx(TilePos)];
+	return hRoof ? GetRoof(hRoof) : NULL;
   }
 
 public:
@@ -737,12 +1001,13 @@ public:
   inline RulesDefs::eEntityType GetEntityType(const AreaDefs::EntHandle& hHandle) const {
 	ASSERT(IsInitOk() && IsAreaLoaded());
 	// El tipo de entidad se halla en los 4 bits superiores	
-	return RulesDefs::eEntityType(hHandle >> 12);
+	return RulesDefs::eEntityType(hHandle >> AreaDefs::ENTHANDLE_TYPE_SHIFT);
   }
 
 private:
   // Creacion de handles
   AreaDefs::EntHandle CreateHandle(const RulesDefs::eEntityType& EntityType);
+  AreaDefs::EntHandle CreateLoadHandle(const RulesDefs::eEntityType& EntityType);
   
 public:
   // Trabajo con la instancia al jugador
@@ -771,6 +1036,17 @@ public:
 	ASSERT((RoomIt != m_Map.RoomInfo.end()) != 0);
 	return RoomIt->second.bIsRoofVisible;
   }
+private:
+  // Metodos de apoyo
+  void BuildCoverGrid(void);
+  void SetCoverUncovered(const AreaDefs::RoomID& CoverID,
+						 const bool bUncovered);
+  inline bool IsTileUncovered(const AreaDefs::TileIndex& TileIdx) const {
+	ASSERT(m_Map.pCoverGrid);
+	// Comprueba si el contenido del tile es visible bajo su posible techo
+	const AreaDefs::RoomID CoverID = m_Map.pCoverGrid[TileIdx];
+	return (m_Map.UncoveredBits[CoverID >> 5] & (1UL << (CoverID & 31))) != 0;
+  }
 
 public:
   // Trabajo con la mascara de acceso
@@ -779,8 +1055,21 @@ public:
   void SetFloorAccess(const AreaDefs::sTilePos& TilePos,
 					  const IsoDefs::eDirectionFlag& Orientation,
 					  const bool bCanAccess);
+  inline AreaDefs::TileAccessInfo GetAccessInfo(const AreaDefs::sTilePos& TilePos) const {
+	ASSERT(IsInitOk() && IsAreaLoaded());
+	ASSERT(m_Map.pAccessGrid);
+	ASSERT(IsCellValid(TilePos));
+	// Retorna la info de acceso empaquetada del tile
+	return m_Map.pAccessGrid[GetTileIdx(TilePos)];
+  }
 private:
   // Metodos de apoyo
+  AreaDefs::MaskTileAccess CalculeMaskTileAccess(const AreaDefs::sTilePos& TilePos,
+												 const dword udNoEntitiesToCheck,
+												 const bool bSkipCriatures);
+  void BuildAccessGrid(void);
+  void SetAccessGridMask(const AreaDefs::TileIndex& TileIdx);
+  void SetAccessGridCriatureFlag(const AreaDefs::TileIndex& TileIdx);
   void SetMaskFloorAccess(const AreaDefs::sTilePos& TilePos,
 					      const AreaDefs::MaskTileAccess& MaskTileAccess);
   inline AreaDefs::MaskTileAccess GetMaskFloorAccess(const AreaDefs::sTilePos& TilePos) {
@@ -793,6 +1082,43 @@ private:
   bool IsAdjWallBlocked(const AreaDefs::sTilePos& TilePosSrc,
 					    const IsoDefs::eDirectionIndex& AdjTileDirection,
 						const RulesDefs::eWallOrientation& WallOrientation);  
+
+public:
+  // Trabajo con la conectividad del area
+  void UpdateAccessInfoAt(const AreaDefs::sTilePos& TilePos);
+  inline AreaDefs::ComponentID GetComponentAt(const AreaDefs::sTilePos& TilePos) const {
+	ASSERT(IsInitOk() && IsAreaLoaded());
+	ASSERT(IsCellValid(TilePos));
+	// Retorna la componente conexa asociada al tile
+	return m_Connectivity.pTileComponent ? 
+		   m_Connectivity.pTileComponent[GetTileIdx(TilePos)] : AreaDefs::NO_COMPONENT;
+  }
+  inline bool AreTilesConnected(const AreaDefs::sTilePos& TileSrc,
+								const AreaDefs::sTilePos& TileDest) const {
+	ASSERT(IsInitOk() && IsAreaLoaded());
+	// Comprueba si ambos tiles pertenecen a la misma componente conexa
+	// Nota: Sin informacion de conectividad no se podra descartar nada
+	if (!m_Connectivity.pTileComponent) {
+	  return true;
+	}
+	return (GetComponentAt(TileSrc) == GetComponentAt(TileDest));
+  }
+private:
+  // Metodos de apoyo
+  void BuildConnectivity(void);
+  void ReleaseConnectivity(void);
+  void FloodComponent(const AreaDefs::TileIndex& TileIdx,
+					  const AreaDefs::ComponentID& Component,
+					  const AreaDefs::ComponentID& FirstValidComponent,
+					  std::vector<AreaDefs::TileIndex>& TilesToVisit);
+  bool CanCrossInConnectivity(const AreaDefs::sTilePos& TileSrc,
+							  const IsoDefs::eDirectionIndex& Dir);
+  inline AreaDefs::sTilePos GetTilePosFromIdx(const AreaDefs::TileIndex& TileIdx) const {
+	ASSERT(IsInitOk());
+	// Se retorna la posicion asociada al indice
+	return AreaDefs::sTilePos(TileIdx % m_Map.uwWidth, TileIdx / m_Map.uwWidth);
+  }
+
 public:
   // Manipulacion de posicion en tiles
   inline bool IsCellValid(const AreaDefs::sTilePos& TilePos) const {		
@@ -806,7 +1132,7 @@ public:
 	ASSERT(IsInitOk());
 	ASSERT(IsCellValid(TilePos));
 	// Comprueba si la celda en TilePos tiene contenido asociado o no
-	return (NULL != m_Map.pMap[GetTileIdx(TilePos)]);
+	return IsCellIndexWithContent(GetTileIdx(TilePos));
   }
   inline AreaDefs::TileIndex GetTileIdx(const AreaDefs::sTilePos& TilePos) const {	
 	ASSERT((TilePos.XTile >= 0 || TilePos.XTile < m_Map.uwWidth) != 0);
@@ -845,19 +1171,12 @@ public:
 // Clase CCellIterator
 class CCellIterator
 {
-private:
-  // Tipos
-  // Lista de entidades
-  typedef std::list<AreaDefs::EntHandle> EntityList; 
-  typedef EntityList::iterator           ItEntityList;
-
 private:
   // Vbles de miembro 
-  EntityList*  m_pList;     // Lista a los handles del tile concreto
-  ItEntityList m_It;        // Iterador a la lista de handles  
-  CArea*       m_pArea;     // Area a la que esta asociado
-  word         m_uwPos;     // Controla la posicion y al iterador	  
-  bool         m_bIsInitOk; // Iterador inicializado bien?
+  CCellEntities* m_pList;     // Handles del tile concreto
+  CArea*         m_pArea;     // Area a la que esta asociado
+  word           m_uwPos;     // Posicion actual (0 y Size() + 1 no validas)
+  bool           m_bIsInitOk; // Iterador inicializado bien?
 	  
 public:
   // Constructor / destructor
@@ -879,19 +1198,14 @@ public:
   inline void SetAtFront(void) { 
 	ASSERT(IsInitOk());
 	// Establece iterador al frente
-	m_It = m_pList->begin(); 
-	if (m_It == m_pList->end()) { m_uwPos = 0; }
-	else { m_uwPos = 1; }
+	m_uwPos = m_pList->empty() ? 0 : 1;
   }
   
   inline void SetAtBack(void) {  
 	ASSERT(IsInitOk());
 	// Establece iterador al final
 	m_uwPos = m_pList->size();
-	if (m_uwPos) { 
-	  m_It = m_pList->end();
-	  --m_It; 		  
-	} else { 
+	if (!m_uwPos) { 
 	  ++m_uwPos; 
 	}
   }
@@ -903,7 +1217,6 @@ public:
 	// Sig elemento
 	if (m_uwPos <= m_pList->size()) {
 	  m_uwPos++;
-	  ++m_It;
 	}
   }  
   inline void Prev(void) { 
@@ -911,7 +1224,6 @@ public:
 	// Elemento anterior
 	if (m_uwPos >= 1) {
 	  --m_uwPos;
-	  --m_It;
 	}
   }
 	  
@@ -920,7 +1232,7 @@ public:
   inline AreaDefs::EntHandle GetWorldEntity(void) const {	
 	ASSERT(IsInitOk());
 	// Devuelve entidad del universo de juego
-	return IsItValid() ? *m_It : 0;
+	return IsItValid() ? (*m_pList)[m_uwPos - 1] : 0;
   }
   inline word Size(void) const { 
 	ASSERT(IsInitOk());
@@ -982,18 +1294,18 @@ class CCriatureIterator: public CEntitiesIterator
 {
 private:
   // Vbles de miembro 
-  CArea::CriaturesIt m_It; // Iterador
+  word m_uwPos; // Posicion en la tabla de entidades
   
 public:
   // Constructor / destructor
-  CCriatureIterator(void) { }
+  CCriatureIterator(void): m_uwPos(0xFFFF) { }
   ~CCriatureIterator(void) { End(); }
 	  
 protected:
   // Desvincula puntero
   void ReleaseIt(void) {
 	ASSERT(CEntitiesIterator::IsInitOk());
-	m_It = CEntitiesIterator::GetArea()->m_Map.Criatures.end();
+	m_uwPos = 0xFFFF;
   }    
 	  
 public:
@@ -1001,7 +1313,7 @@ public:
   void SetAtFront(void) {	
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Establece iterador
-	m_It = CEntitiesIterator::GetArea()->m_Map.Criatures.begin();
+	m_uwPos = 0;
   }
   	  
 public:
@@ -1009,7 +1321,7 @@ public:
    void Next(void) {
 	 ASSERT(CEntitiesIterator::IsInitOk());
 	 // Avanza
-	 ++m_It;
+	 ++m_uwPos;
    }
 	  
 public:
@@ -1017,12 +1329,12 @@ public:
   CCriature* const GetEntity(void) const {
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Retorna instancia
-	return IsItValid() ? &m_It->second->Criature : NULL;	
+	return IsItValid() ? &CEntitiesIterator::GetArea()->m_Map.Criatures.GetAt(m_uwPos)->Criature : NULL;	
   }
   bool IsItValid(void) const {
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Retorna flag
-	return (m_It != CEntitiesIterator::GetArea()->m_Map.Criatures.end());
+	return (m_uwPos < CEntitiesIterator::GetArea()->m_Map.Criatures.GetSize());
   }
 }; // ~ CCriatureIterator
 
@@ -1031,18 +1343,18 @@ class CItemIterator: public CEntitiesIterator
 {
 private:
   // Vbles de miembro 
-  CArea::ItemsIt m_It; // Iterador
+  word m_uwPos; // Posicion en la tabla de entidades
   
 public:
   // Constructor / destructor
-  CItemIterator(void) { }
+  CItemIterator(void): m_uwPos(0xFFFF) { }
   ~CItemIterator(void) { End(); }
 	  
 protected:
   // Desvincula puntero
   void ReleaseIt(void) {
 	ASSERT(CEntitiesIterator::IsInitOk());
-	m_It = CEntitiesIterator::GetArea()->m_Map.Items.end();
+	m_uwPos = 0xFFFF;
   }    
 	  
 public:
@@ -1050,7 +1362,7 @@ public:
   void SetAtFront(void) {	
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Establece iterador
-	m_It = CEntitiesIterator::GetArea()->m_Map.Items.begin();
+	m_uwPos = 0;
   }
   	  
 public:
@@ -1058,7 +1370,7 @@ public:
    void Next(void) {
 	 ASSERT(CEntitiesIterator::IsInitOk());
 	 // Avanza
-	 ++m_It;
+	 ++m_uwPos;
    }
 	  
 public:
@@ -1066,12 +1378,12 @@ public:
   CItem* const GetEntity(void) const {
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Retorna instancia
-	return IsItValid() ? &m_It->second->Item : NULL;	
+	return IsItValid() ? &CEntitiesIterator::GetArea()->m_Map.Items.GetAt(m_uwPos)->Item : NULL;	
   }
   bool IsItValid(void) const {
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Retorna flag
-	return (m_It != CEntitiesIterator::GetArea()->m_Map.Items.end());
+	return (m_uwPos < CEntitiesIterator::GetArea()->m_Map.Items.GetSize());
   }
 }; // ~ CItemIterator
 
@@ -1080,18 +1392,18 @@ class CWallIterator: public CEntitiesIterator
 {
 private:
   // Vbles de miembro 
-  CArea::WallsIt m_It; // Iterador
+  word m_uwPos; // Posicion en la tabla de entidades
   
 public:
   // Constructor / destructor
-  CWallIterator(void) { }
+  CWallIterator(void): m_uwPos(0xFFFF) { }
   ~CWallIterator(void) { End(); }
 	  
 protected:
   // Desvincula puntero
   void ReleaseIt(void) {
 	ASSERT(CEntitiesIterator::IsInitOk());
-	m_It = CEntitiesIterator::GetArea()->m_Map.Walls.end();
+	m_uwPos = 0xFFFF;
   }    
 	  
 public:
@@ -1099,7 +1411,7 @@ public:
   void SetAtFront(void) {	
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Establece iterador
-	m_It = CEntitiesIterator::GetArea()->m_Map.Walls.begin();
+	m_uwPos = 0;
   }
   	  
 public:
@@ -1107,7 +1419,7 @@ public:
    void Next(void) {
 	 ASSERT(CEntitiesIterator::IsInitOk());
 	 // Avanza
-	 ++m_It;
+	 ++m_uwPos;
    }
 	  
 public:
@@ -1115,12 +1427,12 @@ public:
   CWall* const GetEntity(void) const {
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Retorna instancia
-	return IsItValid() ? &m_It->second->Wall : NULL;	
+	return IsItValid() ? &CEntitiesIterator::GetArea()->m_Map.Walls.GetAt(m_uwPos)->Wall : NULL;	
   }
   bool IsItValid(void) const {
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Retorna flag
-	return (m_It != CEntitiesIterator::GetArea()->m_Map.Walls.end());
+	return (m_uwPos < CEntitiesIterator::GetArea()->m_Map.Walls.GetSize());
   }
 }; // ~ CWallIterator
 
@@ -1129,18 +1441,18 @@ class CSceneObjIterator: public CEntitiesIterator
 {
 private:
   // Vbles de miembro 
-  CArea::SObjsIt m_It; // Iterador
+  word m_uwPos; // Posicion en la tabla de entidades
   
 public:
   // Constructor / destructor
-  CSceneObjIterator(void) { }
+  CSceneObjIterator(void): m_uwPos(0xFFFF) { }
   ~CSceneObjIterator(void) { End(); }
 	  
 protected:
   // Desvincula puntero
   void ReleaseIt(void) {
 	ASSERT(CEntitiesIterator::IsInitOk());
-	m_It = CEntitiesIterator::GetArea()->m_Map.SceneObjs.end();
+	m_uwPos = 0xFFFF;
   }    
 	  
 public:
@@ -1148,7 +1460,7 @@ public:
   void SetAtFront(void) {	
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Establece iterador
-	m_It = CEntitiesIterator::GetArea()->m_Map.SceneObjs.begin();
+	m_uwPos = 0;
   }
   	  
 public:
@@ -1156,7 +1468,7 @@ public:
    void Next(void) {
 	 ASSERT(CEntitiesIterator::IsInitOk());
 	 // Avanza
-	 ++m_It;
+	 ++m_uwPos;
    }
 	  
 public:
@@ -1164,12 +1476,12 @@ public:
   CSceneObj* const GetEntity(void) const {
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Retorna instancia
-	return IsItValid() ? &m_It->second->SceneObj : NULL;	
+	return IsItValid() ? &CEntitiesIterator::GetArea()->m_Map.SceneObjs.GetAt(m_uwPos)->SceneObj : NULL;	
   }
   bool IsItValid(void) const {
 	ASSERT(CEntitiesIterator::IsInitOk());
 	// Retorna flag
-	return (m_It != CEntitiesIterator::GetArea()->m_Map.SceneObjs.end());
+	return (m_uwPos < CEntitiesIterator::GetArea()->m_Map.SceneObjs.GetSize());
   }
 }; // ~ CSceneObjIterator
 
@@ -0,0 +1,230 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CAreaLoadProfiler.cpp
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Consultar CAreaLoadProfiler.h para mas detalles.
+///////////////////////////////////////////////////////////////////////////////
+#include "CAreaLoadProfiler.h"
+
+#ifdef AREA_LOAD_PROFILE
+
+#include "SYSEngine.h"
+#include "iCTimer.h"
+#include "iCLogger.h"
+#include <string.h>
+
+// Vbles estaticas
+CAreaLoadProfiler::sReport CAreaLoadProfiler::m_Report;
+CAreaLoadProfiler::ePhase  CAreaLoadProfiler::m_Phase = CAreaLoadProfiler::PHASE_PREPARE;
+dword                      CAreaLoadProfiler::m_udPhaseTime = 0;
+dword                      CAreaLoadProfiler::m_udInitTime = 0;
+bool                       CAreaLoadProfiler::m_bIsActive = false;
+#ifdef _DEBUG
+_CRT_ALLOC_HOOK            CAreaLoadProfiler::m_PrevAllocHook = NULL;
+dword                      CAreaLoadProfiler::m_udThreadID = 0;
+#endif
+
+// Nombres de las fases para el informe
+static const sbyte* const szPhaseNames[CAreaLoadProfiler::MAX_PHASES] = {
+  "Preparacion",
+  "Guardado",
+  "Fichero",
+  "Celdas",
+  "Rejillas",
+  "Iluminacion",
+  "MotorIso",
+  "Scripts"
+};
+
+#ifdef _DEBUG
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Gancho de reservas de la CRT de depuracion. Contara cada reserva o
+//   redimensionado de memoria realizado por el hilo perfilado durante la
+//   carga de un area, pasando despues el control al gancho previo.
+// Parametros:
+// - Ver documentacion de _CrtSetAllocHook.
+// Devuelve:
+// - Lo que devuelva el gancho previo o TRUE si no lo hay.
+// Notas:
+// - Los bloques internos de la CRT (_CRT_BLOCK) no se contaran.
+///////////////////////////////////////////////////////////////////////////////
+int __cdecl 
+CAreaLoadProfiler::AllocHook(int nAllocType, 
+							 void* pvData, 
+							 size_t nSize, 
+							 int nBlockUse, 
+							 long lRequest, 
+							 const unsigned char* szFileName, 
+							 int nLine)
+{
+  // Se cuentan reservas y redimensionados del hilo perfilado
+  if ((_HOOK_ALLOC == nAllocType || _HOOK_REALLOC == nAllocType) &&
+	  _CRT_BLOCK != nBlockUse &&
+	  GetCurrentThreadId() == m_udThreadID) {
+	AddAlloc(nSize);
+  }
+
+  // Se pasa el control al gancho previo
+  return m_PrevAllocHook ? m_PrevAllocHook(nAllocType, pvData, nSize, nBlockUse, 
+										   lRequest, szFileName, nLine) : TRUE;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comienza el perfilado de un cambio de area, en la fase de preparacion.
+// Parametros:
+// - uwFromArea. Area que se abandona.
+// - uwToArea. Area que se carga.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaLoadProfiler::Begin(const word uwFromArea,
+						 const word uwToArea)
+{
+  // Se inicializa el informe y se toma el instante de inicio
+  memset(&m_Report, 0, sizeof(sReport));
+  m_Report.uwFromArea = uwFromArea;
+  m_Report.uwToArea = uwToArea;
+  m_Phase = CAreaLoadProfiler::PHASE_PREPARE;
+  m_udInitTime = SYSEngine::GetTimer()->GetTime(TimerDefs::TIMER_UNITS_US);
+  m_udPhaseTime = m_udInitTime;
+  m_bIsActive = true;
+
+  // Se instala el gancho de reservas si no lo estaba ya
+  #ifdef _DEBUG
+	m_udThreadID = GetCurrentThreadId();
+	const _CRT_ALLOC_HOOK PrevAllocHook = _CrtSetAllocHook(CAreaLoadProfiler::AllocHook);
+	if (PrevAllocHook != CAreaLoadProfiler::AllocHook) {
+	  m_PrevAllocHook = PrevAllocHook;
+	}
+  #endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Cierra la fase en curso, acumulando su tiempo, y pasa a la recibida.
+// Parametros:
+// - Phase. Nueva fase.
+// Devuelve:
+// Notas:
+// - Si no hay perfilado en curso no se hara nada.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaLoadProfiler::SetPhase(const ePhase& Phase)
+{
+  // SOLO si parametros validos
+  ASSERT((Phase < CAreaLoadProfiler::MAX_PHASES) != 0);
+
+  // Hay perfilado en curso?
+  if (m_bIsActive) {
+	const dword udTime = SYSEngine::GetTimer()->GetTime(TimerDefs::TIMER_UNITS_US);
+	m_Report.Phases[m_Phase].udTime += udTime - m_udPhaseTime;
+	m_udPhaseTime = udTime;
+	m_Phase = Phase;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Finaliza el perfilado en curso y escribe el informe.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaLoadProfiler::End(void)
+{
+  // Hay perfilado en curso?
+  if (m_bIsActive) {
+	// Se cierra la fase en curso y se escribe el informe
+	const dword udTime = SYSEngine::GetTimer()->GetTime(TimerDefs::TIMER_UNITS_US);
+	m_Report.Phases[m_Phase].udTime += udTime - m_udPhaseTime;
+	m_Report.udTotalTime = udTime - m_udInitTime;
+	m_bIsActive = false;
+
+	// Se restaura el gancho de reservas previo
+	#ifdef _DEBUG
+	  _CrtSetAllocHook(m_PrevAllocHook);
+	  m_PrevAllocHook = NULL;
+	#endif
+	WriteReport();
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Escribe en el log el informe del ultimo cambio de area, en formato
+//   legible y en una linea con los campos separados por ';'.
+// Parametros:
+// Devuelve:
+// Notas:
+// - La linea tendra el formato:
+//   AREALOAD;Desde;Hasta;Total;<Tiempo;Bytes;Lecturas;Reservas;
+//   BytesReservados;Texturas;TiempoTexturas> por cada fase.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaLoadProfiler::WriteReport(void)
+{
+  // Informe legible
+  iCLogger* const pLogger = SYSEngine::GetLogger();
+  ASSERT(pLogger);
+  pLogger->Write("CAreaLoadProfiler> Area %u -> %u, total %u us.\n",
+				 m_Report.uwFromArea, m_Report.uwToArea, m_Report.udTotalTime);
+  byte ubIt = 0;
+  for (; ubIt < CAreaLoadProfiler::MAX_PHASES; ++ubIt) {
+	const sPhaseInfo& Phase = m_Report.Phases[ubIt];
+	pLogger->Write("                  | %-12s %8u us, %8u bytes en %6u lecturas, %6u reservas (%u bytes), %u texturas (%u us).\n",
+				   szPhaseNames[ubIt],
+				   Phase.udTime,
+				   Phase.udBytesRead,
+				   Phase.udNumReads,
+				   Phase.udNumAllocs,
+				   Phase.udAllocSize,
+				   Phase.udNumTextures,
+				   Phase.udTextureTime);
+  }
+  #ifndef _DEBUG
+	pLogger->Write("                  | Reservas no disponibles (solo en _DEBUG).\n");
+  #endif
+
+  // Linea para herramientas
+  pLogger->Write("AREALOAD;%u;%u;%u", 
+				 m_Report.uwFromArea, m_Report.uwToArea, m_Report.udTotalTime);
+  for (ubIt = 0; ubIt < CAreaLoadProfiler::MAX_PHASES; ++ubIt) {
+	const sPhaseInfo& Phase = m_Report.Phases[ubIt];
+	pLogger->Write(";%u;%u;%u;%u;%u;%u;%u",
+				   Phase.udTime,
+				   Phase.udBytesRead,
+				   Phase.udNumReads,
+				   Phase.udNumAllocs,
+				   Phase.udAllocSize,
+				   Phase.udNumTextures,
+				   Phase.udTextureTime);
+  }
+  pLogger->Write("\n");
+}
+
+#endif // ~ #ifdef AREA_LOAD_PROFILE
@@ -0,0 +1,164 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CAreaLoadProfiler.h
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Clase:
+// - CAreaLoadProfiler
+//
+// Descripcion:
+// - Perfilador de la carga de areas. Divide cada cambio de area en fases
+//   consecutivas y, por cada una de ellas, acumula el tiempo invertido, los
+//   bytes leidos y el numero de lecturas realizadas sobre el subsistema de
+//   ficheros, las reservas de memoria y las texturas creadas junto al tiempo
+//   empleado en crearlas.
+// - Al finalizar cada cambio de area se escribira un informe en el log. Junto
+//   al informe legible se escribira una linea con el prefijo "AREALOAD;" y los
+//   valores separados por ';', pensada para ser filtrada por herramientas
+//   que procesen el log de forma desatendida.
+//
+// Notas:
+// - Solo se compilara cuando se halle definido AREA_LOAD_PROFILE. Todas las
+//   llamadas al perfilador deberan de realizarse dentro de bloques
+//   #ifdef AREA_LOAD_PROFILE.
+// - Las reservas se contaran a traves del gancho de reservas de la CRT de
+//   depuracion, luego solo estaran disponibles en las versiones _DEBUG (en
+//   el resto apareceran a 0). Solo se contaran las del hilo que comenzo el
+//   perfilado, quedando fuera las del hilo de precarga de areas. Las
+//   realizadas desde pools de memoria solo se contaran cuando estos crezcan.
+// - Las texturas se crearan dentro de otras fases (normalmente la de
+//   celdas), por lo que su tiempo tambien formara parte del de estas.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _CAREALOADPROFILER_H_
+#define _CAREALOADPROFILER_H_
+
+#ifdef AREA_LOAD_PROFILE
+
+// Cabeceras
+#ifndef _SYSDEFS_H_
+#include "SYSDefs.h"
+#endif
+#ifdef _DEBUG
+#include <crtdbg.h>
+#endif
+
+// Clase CAreaLoadProfiler
+class CAreaLoadProfiler
+{
+public:
+  // Enumerados
+  enum ePhase {
+	// Fases de un cambio de area
+	PHASE_PREPARE = 0, // Fin de combate, sonidos y recogida de precargas
+	PHASE_SAVE,        // Guardado y liberacion del area abandonada
+	PHASE_FILE,        // Apertura, validacion y cabecera del fichero de area
+	PHASE_CELLS,       // Lectura de celdas y creacion de entidades
+	PHASE_GRIDS,       // Rejillas de acceso, conectividad y cubiertas
+	PHASE_LIGHTING,    // Insercion del jugador e iluminacion
+	PHASE_ISOENGINE,   // Establecimiento del area en el motor isometrico
+	PHASE_SCRIPTS,     // Eventos de creacion de entidades y de entrada en area
+	MAX_PHASES
+  };
+
+public:
+  // Estructuras
+  struct sPhaseInfo {
+	// Datos acumulados en una fase
+	dword udTime;        // Tiempo (microsegundos)
+	dword udBytesRead;   // Bytes leidos
+	dword udNumReads;    // Llamadas de lectura
+	dword udNumAllocs;   // Reservas de memoria
+	dword udAllocSize;   // Bytes reservados
+	dword udNumTextures; // Texturas creadas
+	dword udTextureTime; // Tiempo creando texturas (microsegundos)
+  };
+
+  struct sReport {
+	// Informe de un cambio de area
+	word       uwFromArea;          // Area abandonada
+	word       uwToArea;            // Area cargada
+	dword      udTotalTime;         // Tiempo total (microsegundos)
+	sPhaseInfo Phases[MAX_PHASES];  // Datos por fase
+  };
+
+private:
+  // Vbles de miembro
+  static sReport m_Report;        // Informe en curso o ultimo informe
+  static ePhase  m_Phase;         // Fase en curso
+  static dword   m_udPhaseTime;   // Instante de inicio de la fase en curso
+  static dword   m_udInitTime;    // Instante de inicio del cambio de area
+  static bool    m_bIsActive;     // Perfilado en curso?
+  #ifdef _DEBUG
+	static _CRT_ALLOC_HOOK m_PrevAllocHook; // Gancho de reservas previo
+	static dword           m_udThreadID;    // Hilo perfilado
+  #endif
+
+public:
+  // Control del perfilado
+  static void Begin(const word uwFromArea,
+					const word uwToArea);
+  static void SetPhase(const ePhase& Phase);
+  static void End(void);
+  static inline bool IsActive(void) { return m_bIsActive; }
+  static inline const sReport& GetLastReport(void) { return m_Report; }
+
+public:
+  // Acumulacion de datos en la fase en curso
+  static inline void AddRead(const dword udBytes) {
+	// Se acumula la lectura si procede
+	if (m_bIsActive) {
+	  ++m_Report.Phases[m_Phase].udNumReads;
+	  m_Report.Phases[m_Phase].udBytesRead += udBytes;
+	}
+  }
+  static inline void AddAlloc(const dword udSize) {
+	// Se acumula la reserva si procede
+	if (m_bIsActive) {
+	  ++m_Report.Phases[m_Phase].udNumAllocs;
+	  m_Report.Phases[m_Phase].udAllocSize += udSize;
+	}
+  }
+  static inline void AddTexture(const dword udTime) {
+	// Se acumula la creacion de la textura si procede
+	if (m_bIsActive) {
+	  ++m_Report.Phases[m_Phase].udNumTextures;
+	  m_Report.Phases[m_Phase].udTextureTime += udTime;
+	}
+  }
+
+private:
+  // Metodos de apoyo
+  static void WriteReport(void);
+  #ifdef _DEBUG
+	static int __cdecl AllocHook(int nAllocType, 
+								 void* pvData, 
+								 size_t nSize, 
+								 int nBlockUse, 
+								 long lRequest, 
+								 const unsigned char* szFileName, 
+								 int nLine);
+  #endif
+}; // ~ CAreaLoadProfiler
+
+#endif // ~ #ifdef AREA_LOAD_PROFILE
+
+#endif // ~ #ifdef _CAREALOADPROFILER_H_
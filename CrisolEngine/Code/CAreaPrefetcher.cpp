@@ -0,0 +1,622 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CAreaPrefetcher.cpp
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Consultar CAreaPrefetcher.h para mas detalles.
+///////////////////////////////////////////////////////////////////////////////
+#include "CAreaPrefetcher.h"
+
+#include "SYSEngine.h"
+#include "iCFileSystem.h"
+#include "CrisolBuilder\\CBDefs.h"
+#include "CrisolBuilder\\CAreaFileConverter.h"
+#ifdef _MT
+#include <process.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Inicializa la instancia, creando el hilo de precarga.
+// Parametros:
+// Devuelve:
+// - Si todo ha ido bien true. En caso contrario false.
+// Notas:
+// - Con la CRT multihilo el hilo se lanzara con _beginthreadex, pues 
+//   alojara memoria al convertir los ficheros de area base v1.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaPrefetcher::Init(void)
+{
+  // Se intenta reinicializar?
+  if (IsInitOk()) {
+	return false;
+  }
+
+  // Se crean la seccion critica y los eventos de aviso y fin de lectura
+  InitializeCriticalSection(&m_CSection);
+  m_hWakeEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+  ASSERT(m_hWakeEvent);
+  m_hJobEndEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+  ASSERT(m_hJobEndEvent);
+
+  // Se crea el hilo, con prioridad baja para no interferir con el juego
+  m_lCancel = 0;
+  m_lEndThread = 0;
+  m_udStagedSize = 0;
+  #ifdef _MT
+	unsigned uIDThread;
+	m_hThread = HANDLE(_beginthreadex(NULL, 0, &tAreaPrefetch, this, 0, &uIDThread));
+  #else
+	dword udIDThread;
+	m_hThread = CreateThread(NULL, 0, LPTHREAD_START_ROUTINE(&tAreaPrefetch), this, 0, &udIDThread);
+  #endif
+  if (!m_hThread) {
+	CloseHandle(m_hJobEndEvent);
+	m_hJobEndEvent = NULL;
+	CloseHandle(m_hWakeEvent);
+	m_hWakeEvent = NULL;
+	DeleteCriticalSection(&m_CSection);
+	return false;
+  }
+  SetThreadPriority(m_hThread, THREAD_PRIORITY_BELOW_NORMAL);
+
+  // Todo correcto
+  m_bIsInitOk = true;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Finaliza la instancia, cancelando las peticiones y esperando a que el
+//   hilo de precarga termine.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaPrefetcher::End(void)
+{
+  // Instancia inicializada?
+  if (IsInitOk()) {
+	// Se cancelan las peticiones
+	CancelAll();
+
+	// Se ordena la finalizacion del hilo y se espera por el
+	InterlockedExchange(&m_lEndThread, 1);
+	SetEvent(m_hWakeEvent);
+	WaitForSingleObject(m_hThread, INFINITE);
+	CloseHandle(m_hThread);
+	m_hThread = NULL;
+	CloseHandle(m_hJobEndEvent);
+	m_hJobEndEvent = NULL;
+	CloseHandle(m_hWakeEvent);
+	m_hWakeEvent = NULL;
+	DeleteCriticalSection(&m_CSection);
+
+	// Se baja el flag
+	m_bIsInitOk = false;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Solicita la precarga de un fichero. El buffer de preparacion se alojara
+//   en este momento y la lectura se realizara en el hilo de precarga.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// - pFileSys. Subsistema de ficheros.
+// - bAreaBase. Fichero de area base? En tal caso, si esta en formato v1 se
+//   convertira a v2 en el hilo de precarga.
+// Devuelve:
+// - Si la peticion se ha registrado o ya lo estaba true. Si el fichero no
+//   existe o se supera la memoria maxima de precarga false.
+// Notas:
+// - Si el fichero se halla embebido en un CPAK proyectado en memoria, se
+//   mantendra abierto hasta que se libere la peticion.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaPrefetcher::Request(const std::string& szFileName,
+						 iCFileSystem* const pFileSys,
+						 const bool bAreaBase)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT(!szFileName.empty());
+  ASSERT(pFileSys);
+
+  // Ya se solicito?
+  std::string szFileNameLower(szFileName);
+  SYSEngine::MakeLowercase(szFileNameLower);
+  EnterCriticalSection(&m_CSection);
+  sJob* const pPrevJob = FindJob(szFileNameLower);
+  LeaveCriticalSection(&m_CSection);
+  if (pPrevJob) {
+	return true;
+  }
+
+  // Se halla el fichero en un CPAK proyectado?
+  dword udStoredSize = 0;
+  dword udSize = 0;
+  bool bCompressed = false;
+  const sbyte* psbStored = NULL;
+  FileDefs::FileHandle hFile = pFileSys->Open(szFileName);
+  if (hFile) {
+	psbStored = pFileSys->GetFileStoredData(hFile, udStoredSize, udSize, bCompressed);
+	if (!psbStored) {
+	  // No, se cerrara y se leera de disco
+	  pFileSys->Close(hFile);
+	  hFile = 0;
+	}
+  }
+
+  // Se debe de leer de disco?
+  if (!psbStored) {
+	// Si, se obtiene el tamao del fichero en disco
+	const HANDLE hDiskFile = CreateFile(szFileName.c_str(),
+										GENERIC_READ,
+										FILE_SHARE_READ,
+										NULL,
+										OPEN_EXISTING,
+										FILE_ATTRIBUTE_NORMAL,
+										NULL);
+	if (INVALID_HANDLE_VALUE == hDiskFile) {
+	  return false;
+	}
+	udSize = GetFileSize(hDiskFile, NULL);
+	CloseHandle(hDiskFile);
+  }
+
+  // Se supera la memoria maxima?
+  if (0 == udSize ||
+	  0xFFFFFFFF == udSize ||
+	  m_udStagedSize + udSize > MAX_STAGED_SIZE) {
+	if (hFile) {
+	  pFileSys->Close(hFile);
+	}
+	return false;
+  }
+
+  // Se crea la peticion y se aloja el buffer de preparacion
+  sJob* const pJob = new sJob(szFileName, szFileNameLower, udSize, bAreaBase);
+  ASSERT(pJob);
+  pJob->psbData = new sbyte[udSize];
+  ASSERT(pJob->psbData);
+  pJob->pFileSys = pFileSys;
+  pJob->hFile = hFile;
+  pJob->psbStored = psbStored;
+  pJob->udStoredSize = udStoredSize;
+  pJob->bCompressed = bCompressed;
+  m_udStagedSize += udSize;
+
+  // Se registra y se avisa al hilo
+  EnterCriticalSection(&m_CSection);
+  m_Jobs.push_back(pJob);
+  LeaveCriticalSection(&m_CSection);
+  SetEvent(m_hWakeEvent);
+
+  // Todo correcto
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Entrega el contenido precargado de un fichero al subsistema de ficheros,
+//   que lo mantendra como residente en memoria.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// - pFileSys. Subsistema de ficheros.
+// Devuelve:
+// - Si se ha entregado el contenido true. Si el fichero no se solicito o
+//   no se pudo leer false, debiendose cargar de la forma habitual.
+// Notas:
+// - Si el fichero se esta leyendo se esperara a que termine, pues siempre
+//   sera mas rapido que comenzar de nuevo. Si aun no se comenzo a leer, la
+//   peticion se descartara.
+// - Si el fichero era de area base v1 y se convirtio, se entregara su 
+//   conversion a v2.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaPrefetcher::Commit(const std::string& szFileName,
+						iCFileSystem* const pFileSys)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT(pFileSys);
+
+  // Se localiza la peticion y se extrae de la lista
+  std::string szFileNameLower(szFileName);
+  SYSEngine::MakeLowercase(szFileNameLower);
+  EnterCriticalSection(&m_CSection);
+  sJob* const pJob = FindJob(szFileNameLower);
+  if (pJob) {
+	// Si no ha comenzado a leerse, se marca como fallida
+	InterlockedCompareExchange((void**)(&pJob->lState),
+							   (void*)(JOB_FAILED),
+							   (void*)(JOB_PENDING));
+	m_Jobs.remove(pJob);
+  }
+  LeaveCriticalSection(&m_CSection);
+  if (!pJob) {
+	return false;
+  }
+
+  // Se espera a que termine una posible lectura en curso
+  WaitJobNotLoading(pJob);
+
+  // Se completo la lectura?
+  bool bResult = false;
+  if (JOB_DONE == pJob->lState) {
+	// Si, se entrega al subsistema de ficheros
+	if (pJob->V2Data.empty()) {
+	  bResult = pFileSys->CreateMemFile(pJob->szFileName,
+										pJob->psbData,
+										pJob->udSize);
+	} else {
+	  bResult = pFileSys->CreateMemFile(pJob->szFileName,
+										&pJob->V2Data[0],
+										pJob->V2Data.size());
+	}
+  }
+
+  // Se libera la peticion y retorna
+  ReleaseJob(pJob);
+  return bResult;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Cancela todas las peticiones de precarga, liberando sus buffers.
+// Parametros:
+// Devuelve:
+// Notas:
+// - La lectura en curso se interrumpira en el siguiente bloque.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaPrefetcher::CancelAll(void)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se toman las peticiones, marcando como fallidas las pendientes
+  EnterCriticalSection(&m_CSection);
+  JobList Jobs;
+  Jobs.swap(m_Jobs);
+  JobListIt It(Jobs.begin());
+  for (; It != Jobs.end(); ++It) {
+	InterlockedCompareExchange((void**)(&(*It)->lState),
+							   (void*)(JOB_FAILED),
+							   (void*)(JOB_PENDING));
+  }
+  LeaveCriticalSection(&m_CSection);
+
+  // Se interrumpe la lectura en curso y se liberan las peticiones
+  InterlockedExchange(&m_lCancel, 1);
+  for (It = Jobs.begin(); It != Jobs.end(); ++It) {
+	WaitJobNotLoading(*It);
+	ReleaseJob(*It);
+  }
+  InterlockedExchange(&m_lCancel, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Localiza la peticion asociada a un fichero.
+// Parametros:
+// - szFileNameLower. Nombre del fichero en minusculas.
+// Devuelve:
+// - La peticion o NULL si no existe.
+// Notas:
+// - Se debera de llamar con la seccion critica tomada.
+///////////////////////////////////////////////////////////////////////////////
+CAreaPrefetcher::sJob* const
+CAreaPrefetcher::FindJob(const std::string& szFileNameLower)
+{
+  // Se recorren las peticiones
+  JobListIt It(m_Jobs.begin());
+  for (; It != m_Jobs.end(); ++It) {
+	if ((*It)->szFileNameLower == szFileNameLower) {
+	  return *It;
+	}
+  }
+
+  // No se hallo
+  return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Toma la siguiente peticion pendiente, pasandola a estado de lectura.
+// Parametros:
+// Devuelve:
+// - La peticion o NULL si no hay peticiones pendientes.
+// Notas:
+// - Metodo llamado desde el hilo de precarga.
+///////////////////////////////////////////////////////////////////////////////
+CAreaPrefetcher::sJob* const
+CAreaPrefetcher::GetNextPendingJob(void)
+{
+  // Se busca la primera peticion pendiente
+  sJob* pJob = NULL;
+  EnterCriticalSection(&m_CSection);
+  JobListIt It(m_Jobs.begin());
+  for (; It != m_Jobs.end(); ++It) {
+	if (JOB_PENDING == (*It)->lState) {
+	  pJob = *It;
+	  InterlockedExchange(&pJob->lState, JOB_LOADING);
+	  break;
+	}
+  }
+  LeaveCriticalSection(&m_CSection);
+
+  // Se retorna
+  return pJob;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el contenido de un fichero sobre su buffer de preparacion y, si
+//   es de area base v1, lo convierte a v2.
+// Parametros:
+// - pJob. Peticion en estado de lectura.
+// Devuelve:
+// Notas:
+// - Metodo llamado desde el hilo de precarga.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaPrefetcher::LoadJob(sJob* const pJob)
+{
+  // SOLO si parametros validos
+  ASSERT(pJob);
+  ASSERT((JOB_LOADING == pJob->lState) != 0);
+
+  // Se obtiene el contenido y se convierte si procede
+  const bool bLoaded = pJob->psbStored ? CopyStoredJob(pJob) : ReadDiskJob(pJob);
+  const bool bDone = bLoaded && !m_lCancel && ConvertJob(pJob);
+
+  // Se establece el resultado
+  InterlockedExchange(&pJob->lState, bDone ? JOB_DONE : JOB_FAILED);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee el contenido de un fichero de disco sobre su buffer de preparacion,
+//   por bloques para poder atender a la cancelacion.
+// Parametros:
+// - pJob. Peticion en estado de lectura.
+// Devuelve:
+// - Si se leyo por completo true. En caso contrario false.
+// Notas:
+// - Metodo llamado desde el hilo de precarga. Solo utilizara el API de
+//   Win32 sobre el buffer ya alojado.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaPrefetcher::ReadDiskJob(sJob* const pJob)
+{
+  // SOLO si parametros validos
+  ASSERT(pJob);
+
+  // Se abre el fichero
+  bool bResult = false;
+  const HANDLE hFile = CreateFile(pJob->szFileName.c_str(),
+								  GENERIC_READ,
+								  FILE_SHARE_READ,
+								  NULL,
+								  OPEN_EXISTING,
+								  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+								  NULL);
+  if (hFile != INVALID_HANDLE_VALUE) {
+	// Se comprueba que el tamao no haya cambiado y se lee por bloques
+	if (GetFileSize(hFile, NULL) == pJob->udSize) {
+	  dword udOffset = 0;
+	  while (udOffset < pJob->udSize && !m_lCancel) {
+		dword udToRead = pJob->udSize - udOffset;
+		if (udToRead > READ_BLOCK_SIZE) {
+		  udToRead = READ_BLOCK_SIZE;
+		}
+		DWORD udRead = 0;
+		if (!ReadFile(hFile, pJob->psbData + udOffset, udToRead, &udRead, NULL) ||
+			udRead != udToRead) {
+		  break;
+		}
+		udOffset += udRead;
+	  }
+	  bResult = (udOffset == pJob->udSize);
+	}
+	CloseHandle(hFile);
+  }
+
+  // Se retorna
+  return bResult;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el contenido de un fichero embebido en un CPAK proyectado, 
+//   copiando o descomprimiendo sus datos almacenados sobre el buffer de 
+//   preparacion.
+// Parametros:
+// - pJob. Peticion en estado de lectura.
+// Devuelve:
+// - Si se obtuvo por completo true. En caso contrario false.
+// Notas:
+// - Metodo llamado desde el hilo de precarga. La copia se realizara por
+//   bloques para poder atender a la cancelacion. La descompresion se 
+//   realizara de una vez.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaPrefetcher::CopyStoredJob(sJob* const pJob)
+{
+  // SOLO si parametros validos
+  ASSERT(pJob);
+  ASSERT(pJob->psbStored);
+
+  // Datos comprimidos?
+  if (pJob->bCompressed) {
+	// Si, se descomprimen
+	return pJob->pFileSys->UnpackFileData(pJob->psbStored,
+										  pJob->udStoredSize,
+										  pJob->psbData,
+										  pJob->udSize);
+  }
+
+  // No, se copian por bloques
+  if (pJob->udStoredSize != pJob->udSize) {
+	return false;
+  }
+  dword udOffset = 0;
+  while (udOffset < pJob->udSize && !m_lCancel) {
+	dword udToCopy = pJob->udSize - udOffset;
+	if (udToCopy > READ_BLOCK_SIZE) {
+	  udToCopy = READ_BLOCK_SIZE;
+	}
+	memcpy(pJob->psbData + udOffset, pJob->psbStored + udOffset, udToCopy);
+	udOffset += udToCopy;
+  }
+  return (udOffset == pJob->udSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Convierte a formato v2 el contenido de un fichero de area base que se
+//   halle en formato v1, dejando la conversion en V2Data.
+// Parametros:
+// - pJob. Peticion en estado de lectura, con el contenido ya obtenido.
+// Devuelve:
+// - Si no se requeria conversion o se realizo true. Si fallo false.
+// Notas:
+// - Metodo llamado desde el hilo de precarga. Sin CRT multihilo no se 
+//   convertira y CArea realizara la conversion al cargar el area.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaPrefetcher::ConvertJob(sJob* const pJob)
+{
+  // SOLO si parametros validos
+  ASSERT(pJob);
+
+  // Fichero de area base v1?
+  #ifdef _MT
+	if (pJob->bAreaBase &&
+		pJob->udSize >= 2 &&
+		CBDefs::CBBAreaBaseFile == byte(pJob->psbData[0]) &&
+		CBDefs::HVersion == byte(pJob->psbData[1])) {
+	  // Si, se convierte
+	  CAreaFileConverter Converter;
+	  return Converter.Convert(pJob->psbData, pJob->udSize, pJob->V2Data);
+	}
+  #endif
+
+  // No se requiere conversion
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Libera una peticion y su buffer de preparacion.
+// Parametros:
+// - pJob. Peticion ya extraida de la lista y sin lectura en curso.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaPrefetcher::ReleaseJob(sJob* const pJob)
+{
+  // SOLO si parametros validos
+  ASSERT(pJob);
+  ASSERT((JOB_LOADING != pJob->lState) != 0);
+
+  // Se libera, cerrando en su caso el fichero del CPAK
+  ASSERT((m_udStagedSize >= pJob->udSize) != 0);
+  m_udStagedSize -= pJob->udSize;
+  if (pJob->hFile) {
+	pJob->pFileSys->Close(pJob->hFile);
+  }
+  delete[] pJob->psbData;
+  delete pJob;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Espera a que una peticion no este siendo leida por el hilo.
+// Parametros:
+// - pJob. Peticion.
+// Devuelve:
+// Notas:
+// - El hilo sealara m_hJobEndEvent cada vez que termine una lectura, por
+//   lo que se esperara sobre el evento sin consumir procesador, volviendo a
+//   comprobar el estado tras cada aviso.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaPrefetcher::WaitJobNotLoading(sJob* const pJob)
+{
+  // SOLO si parametros validos
+  ASSERT(pJob);
+
+  // Se espera al fin de la lectura
+  while (JOB_LOADING == pJob->lState) {
+	WaitForSingleObject(m_hJobEndEvent, INFINITE);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Rutina del hilo de precarga. Esperara a ser avisado y atendera las
+//   peticiones pendientes hasta que se ordene su finalizacion.
+// Parametros:
+// - pParams. Instancia CAreaPrefetcher.
+// Devuelve:
+// - Siempre 1.
+// Notas:
+// - Tras cada lectura, completada o no, se sealara el evento de fin de
+//   lectura para despertar a WaitJobNotLoading.
+///////////////////////////////////////////////////////////////////////////////
+unsigned 
+__stdcall tAreaPrefetch(void* pParams)
+{
+  // Inicializaciones
+  ASSERT(pParams);
+  CAreaPrefetcher* const pPrefetcher = (CAreaPrefetcher*)(pParams);
+
+  // Se atienden peticiones hasta la finalizacion
+  while (!pPrefetcher->m_lEndThread) {
+	// Se espera aviso
+	WaitForSingleObject(pPrefetcher->m_hWakeEvent, INFINITE);
+
+	// Se leen todas las peticiones pendientes
+	CAreaPrefetcher::sJob* pJob = pPrefetcher->GetNextPendingJob();
+	while (pJob && !pPrefetcher->m_lEndThread) {
+	  pPrefetcher->LoadJob(pJob);
+	  SetEvent(pPrefetcher->m_hJobEndEvent);
+	  pJob = pPrefetcher->GetNextPendingJob();
+	}
+	if (pJob) {
+	  // Finalizacion con peticion tomada, se marca como fallida
+	  InterlockedExchange(&pJob->lState, CAreaPrefetcher::JOB_FAILED);
+	  SetEvent(pPrefetcher->m_hJobEndEvent);
+	}
+  }
+
+  // Todo correcto
+  return 1;
+}
@@ -0,0 +1,205 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CAreaPrefetcher.h
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Clase:
+// - CAreaPrefetcher
+//
+// Descripcion:
+// - Precarga en segundo plano el contenido de ficheros de area que
+//   previsiblemente se vayan a necesitar en breve. La lectura se realizara
+//   en un hilo independiente sobre buffers de preparacion y, cuando el
+//   fichero sea requerido, se entregara al subsistema de ficheros como
+//   fichero residente en memoria desde el hilo principal.
+// - Los ficheros podran hallarse en disco o embebidos en un CPAK proyectado
+//   en memoria, en cuyo caso el hilo copiara o descomprimira sus datos
+//   almacenados desde la proyeccion.
+// - Los ficheros de area base en formato v1 se convertiran en el hilo al
+//   formato v2, de tal forma que el procesado de sus celdas y entidades en
+//   registros de tamao fijo no se realice en el hilo principal.
+// - La memoria total de los buffers de preparacion estara acotada por
+//   MAX_STAGED_SIZE. Las peticiones que la superen seran ignoradas.
+//
+// Notas:
+// - El hilo de precarga no utilizara el subsistema de ficheros salvo para
+//   descomprimir (UnpackFileData, que no accede a sus datos). Los ficheros
+//   de CPAK se abriran desde el hilo principal al registrar la peticion y
+//   se mantendran abiertos hasta liberarla, para que la proyeccion siga 
+//   siendo valida.
+// - La conversion de formato aloja memoria, por lo que SOLO se realizara
+//   si se enlaza con la CRT multihilo (/MT, /MTd). En otro caso se entregara
+//   el fichero v1 y la conversion la realizara CArea en el hilo principal.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _CAREAPREFETCHER_H_
+#define _CAREAPREFETCHER_H_
+
+// Pragmas <VC6 / Warnings sobre la stl>
+#pragma warning(disable:4786)
+
+// Cabeceras
+#ifndef _WINDOWS_
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+#ifndef _SYSDEFS_H_
+#include "SYSDefs.h"
+#endif
+#ifndef _FILEDEFS_H_
+#include "FileDefs.h"
+#endif
+#ifndef _STRING_H_
+#define _STRING_H_
+#include <string>
+#endif
+#ifndef _LIST_H_
+#define _LIST_H_
+#include <list>
+#endif
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+#include <vector>
+#endif
+
+// Defincion de clases / estructuras / espacios de nombres
+struct iCFileSystem;
+
+// Funcion que ejecuta el hilo de precarga
+static unsigned __stdcall tAreaPrefetch(void* pParams);
+
+// Clase CAreaPrefetcher
+class CAreaPrefetcher
+{
+private:
+  // Clases amigas
+  friend unsigned __stdcall tAreaPrefetch(void* pParams);
+
+private:
+  // Enumerados
+  enum {
+	MAX_STAGED_SIZE = 4 * 1024 * 1024, // Memoria maxima de precarga
+	READ_BLOCK_SIZE = 64 * 1024        // Bloque de lectura del hilo
+  };
+
+  enum eJobState {
+	// Estado de una peticion de precarga
+	JOB_PENDING = 0, // Pendiente de lectura
+	JOB_LOADING,     // Leyendose en el hilo
+	JOB_DONE,        // Lectura completada
+	JOB_FAILED       // Lectura fallida o cancelada
+  };
+
+private:
+  // Estructuras
+  struct sJob {
+	// Peticion de precarga de un fichero
+	std::string          szFileName;      // Nombre del fichero
+	std::string          szFileNameLower; // Nombre del fichero en minusculas
+	sbyte*               psbData;         // Buffer de preparacion
+	dword                udSize;          // Tamao del fichero
+	bool                 bAreaBase;       // Fichero de area base?
+	std::vector<sbyte>   V2Data;          // Conversion a v2 del area base v1
+	volatile long        lState;          // Estado de la peticion
+	// Fichero embebido en CPAK
+	iCFileSystem*        pFileSys;        // Subsistema de ficheros
+	FileDefs::FileHandle hFile;           // Handle que mantiene la proyeccion
+	const sbyte*         psbStored;       // Datos almacenados (o NULL)
+	dword                udStoredSize;    // Tamao de los datos almacenados
+	bool                 bCompressed;     // Datos comprimidos?
+	// Constructor
+	sJob(const std::string& aszFileName,
+		 const std::string& aszFileNameLower,
+		 const dword audSize,
+		 const bool abAreaBase): szFileName(aszFileName),
+								 szFileNameLower(aszFileNameLower),
+								 psbData(NULL),
+								 udSize(audSize),
+								 bAreaBase(abAreaBase),
+								 lState(JOB_PENDING),
+								 pFileSys(NULL),
+								 hFile(0),
+								 psbStored(NULL),
+								 udStoredSize(0),
+								 bCompressed(false) { }
+  };
+
+private:
+  // Tipos
+  typedef std::list<sJob*>  JobList;   // Lista de peticiones
+  typedef JobList::iterator JobListIt; // Iterador a la lista
+
+private:
+  // Vbles de miembro
+  JobList          m_Jobs;         // Peticiones de precarga
+  CRITICAL_SECTION m_CSection;     // Acceso exclusivo a las peticiones
+  HANDLE           m_hThread;      // Hilo de precarga
+  HANDLE           m_hWakeEvent;   // Evento de aviso al hilo
+  HANDLE           m_hJobEndEvent; // Evento de fin de lectura en el hilo
+  volatile long    m_lCancel;      // Cancelar la peticion en curso?
+  volatile long    m_lEndThread;   // Finalizar el hilo?
+  dword            m_udStagedSize; // Memoria alojada en precarga
+  bool             m_bIsInitOk;    // Instancia inicializada?
+
+public:
+  // Constructor / destructor
+  CAreaPrefetcher(void): m_hThread(NULL),
+						 m_hWakeEvent(NULL),
+						 m_hJobEndEvent(NULL),
+						 m_lCancel(0),
+						 m_lEndThread(0),
+						 m_udStagedSize(0),
+						 m_bIsInitOk(false) { }
+  ~CAreaPrefetcher(void) { End(); }
+
+public:
+  // Protocolos de inicializacion / finalizacion
+  bool Init(void);
+  void End(void);
+  inline bool IsInitOk(void) const { return m_bIsInitOk; }
+
+public:
+  // Trabajo con las peticiones de precarga
+  bool Request(const std::string& szFileName,
+			   iCFileSystem* const pFileSys,
+			   const bool bAreaBase = false);
+  bool Commit(const std::string& szFileName,
+			  iCFileSystem* const pFileSys);
+  void CancelAll(void);
+  inline dword GetStagedSize(void) const {
+	ASSERT(IsInitOk());
+	// Retorna la memoria alojada en precarga
+	return m_udStagedSize;
+  }
+
+private:
+  // Metodos de apoyo
+  sJob* const FindJob(const std::string& szFileNameLower);
+  sJob* const GetNextPendingJob(void);
+  void LoadJob(sJob* const pJob);
+  bool ReadDiskJob(sJob* const pJob);
+  bool CopyStoredJob(sJob* const pJob);
+  bool ConvertJob(sJob* const pJob);
+  void ReleaseJob(sJob* const pJob);
+  void WaitJobNotLoading(sJob* const pJob);
+}; // ~ CAreaPrefetcher
+
+#endif // ~ #ifdef _CAREAPREFETCHER_H_
@@ -0,0 +1,581 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CAreaStateWriter.cpp
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Consultar CAreaStateWriter.h para mas detalles.
+///////////////////////////////////////////////////////////////////////////////
+#include "CAreaStateWriter.h"
+
+#include "SYSEngine.h"
+#include "iCFileSystem.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Inicializa la instancia, creando el hilo de escritura.
+// Parametros:
+// Devuelve:
+// - Si todo ha ido bien true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaStateWriter::Init(void)
+{
+  // Se intenta reinicializar?
+  if (IsInitOk()) {
+	return false;
+  }
+
+  // Se crean la seccion critica y el evento de aviso
+  InitializeCriticalSection(&m_CSection);
+  m_hWakeEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+  ASSERT(m_hWakeEvent);
+
+  // Se crea el hilo, con prioridad baja para no interferir con el juego
+  m_lCancel = 0;
+  m_lEndThread = 0;
+  m_udPendingSize = 0;
+  m_bFailed = false;
+  dword udIDThread;
+  m_hThread = CreateThread(NULL, 0, &tAreaStateWrite, this, 0, &udIDThread);
+  if (!m_hThread) {
+	CloseHandle(m_hWakeEvent);
+	m_hWakeEvent = NULL;
+	DeleteCriticalSection(&m_CSection);
+	return false;
+  }
+  SetThreadPriority(m_hThread, THREAD_PRIORITY_BELOW_NORMAL);
+
+  // Todo correcto
+  m_bIsInitOk = true;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Finaliza la instancia, cancelando las peticiones y esperando a que el
+//   hilo de escritura termine.
+// Parametros:
+// Devuelve:
+// Notas:
+// - Al finalizar, los ficheros temporales se descartaran, luego no sera
+//   necesario completar las escrituras pendientes.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaStateWriter::End(void)
+{
+  // Instancia inicializada?
+  if (IsInitOk()) {
+	// Se cancelan las peticiones
+	CancelAll();
+
+	// Se ordena la finalizacion del hilo y se espera por el
+	InterlockedExchange(&m_lEndThread, 1);
+	SetEvent(m_hWakeEvent);
+	WaitForSingleObject(m_hThread, INFINITE);
+	CloseHandle(m_hThread);
+	m_hThread = NULL;
+	CloseHandle(m_hWakeEvent);
+	m_hWakeEvent = NULL;
+	DeleteCriticalSection(&m_CSection);
+
+	// Se baja el flag
+	m_bIsInitOk = false;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Solicita la escritura de un fichero. Se tomara una copia del contenido,
+//   de tal forma que el original podra descartarse al retornar.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// - psbData. Contenido a escribir.
+// - udSize. Tamao del contenido.
+// Devuelve:
+// - Si la peticion se ha registrado true. Si alguna escritura previa fallo
+//   false, no registrandose la peticion.
+// Notas:
+// - Si ya existia una peticion sobre el fichero, sera sustituida.
+// - Si se supera la memoria maxima, se esperara a que se completen las
+//   escrituras en curso antes de registrar la peticion.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaStateWriter::Request(const std::string& szFileName,
+						  const sbyte* const psbData,
+						  const dword udSize)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT(!szFileName.empty());
+  ASSERT(psbData);
+  ASSERT(udSize);
+
+  // Se descarta una posible peticion previa sobre el fichero, pues su
+  // contenido habra quedado obsoleto
+  std::string szFileNameLower(szFileName);
+  SYSEngine::MakeLowercase(szFileNameLower);
+  EnterCriticalSection(&m_CSection);
+  sJob* const pPrevJob = FindJob(szFileNameLower);
+  if (pPrevJob) {
+	InterlockedCompareExchange((void**)(&pPrevJob->lState),
+							   (void*)(JOB_FAILED),
+							   (void*)(JOB_PENDING));
+	m_Jobs.remove(pPrevJob);
+  }
+  LeaveCriticalSection(&m_CSection);
+  if (pPrevJob) {
+	WaitJobNotWriting(pPrevJob);
+	ReleaseJob(pPrevJob);
+  }
+
+  // Se liberan las peticiones completadas y, si se supera la memoria
+  // maxima, se espera a que se completen las restantes
+  ReleaseFinishedJobs();
+  if (m_udPendingSize + udSize > MAX_PENDING_SIZE) {
+	WaitAll();
+  }
+
+  // Fallo alguna escritura previa?
+  if (m_bFailed) {
+	return false;
+  }
+
+  // Se crea la peticion con la copia del contenido
+  sJob* const pJob = new sJob(szFileName, szFileNameLower, udSize);
+  ASSERT(pJob);
+  pJob->psbData = new sbyte[udSize];
+  ASSERT(pJob->psbData);
+  memcpy(pJob->psbData, psbData, udSize);
+  m_udPendingSize += udSize;
+
+  // Se registra y se avisa al hilo
+  EnterCriticalSection(&m_CSection);
+  m_Jobs.push_back(pJob);
+  LeaveCriticalSection(&m_CSection);
+  SetEvent(m_hWakeEvent);
+
+  // Todo correcto
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Entrega al subsistema de ficheros la copia de un fichero cuya escritura
+//   se hubiera solicitado, para que su lectura no dependa del estado de la
+//   escritura.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// - pFileSys. Subsistema de ficheros.
+// Devuelve:
+// - Si se ha entregado el contenido true. Si no habia peticion sobre el
+//   fichero false, debiendose leer de disco de la forma habitual.
+// Notas:
+// - La copia siempre sera la version mas reciente del fichero, por lo que
+//   se entregara aun cuando la escritura ya se hubiera completado. Si esta
+//   se halla en curso, se esperara a que termine para no dejar el fichero
+//   auxiliar a medias.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaStateWriter::Commit(const std::string& szFileName,
+						 iCFileSystem* const pFileSys)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT(pFileSys);
+
+  // Se localiza la peticion y se extrae de la lista
+  std::string szFileNameLower(szFileName);
+  SYSEngine::MakeLowercase(szFileNameLower);
+  EnterCriticalSection(&m_CSection);
+  sJob* const pJob = FindJob(szFileNameLower);
+  if (pJob) {
+	// Si no ha comenzado a escribirse, ya no sera necesario
+	InterlockedCompareExchange((void**)(&pJob->lState),
+							   (void*)(JOB_FAILED),
+							   (void*)(JOB_PENDING));
+	m_Jobs.remove(pJob);
+  }
+  LeaveCriticalSection(&m_CSection);
+  if (!pJob) {
+	return false;
+  }
+
+  // Se espera a que termine una posible escritura en curso
+  WaitJobNotWriting(pJob);
+
+  // Se entrega la copia al subsistema de ficheros
+  const bool bResult = pFileSys->CreateMemFile(pJob->szFileName,
+											   pJob->psbData,
+											   pJob->udSize);
+
+  // Se libera la peticion y retorna
+  ReleaseJob(pJob);
+  return bResult;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Espera a que se completen todas las escrituras solicitadas, liberando
+//   las peticiones.
+// Parametros:
+// Devuelve:
+// - Si todas las escrituras realizadas hasta el momento se completaron true.
+//   En caso contrario false.
+// Notas:
+// - Se utilizara antes de acceder directamente a los ficheros de disco,
+//   como al guardar una partida.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaStateWriter::WaitAll(void)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se toman las peticiones y se espera a que el hilo las complete
+  EnterCriticalSection(&m_CSection);
+  JobList Jobs(m_Jobs);
+  LeaveCriticalSection(&m_CSection);
+  SetEvent(m_hWakeEvent);
+  JobListIt It(Jobs.begin());
+  for (; It != Jobs.end(); ++It) {
+	while (JOB_PENDING == (*It)->lState ||
+		   JOB_WRITING == (*It)->lState) {
+	  Sleep(1);
+	}
+  }
+
+  // Se liberan y retorna
+  ReleaseFinishedJobs();
+  return !m_bFailed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Cancela todas las peticiones de escritura, liberando sus copias.
+// Parametros:
+// Devuelve:
+// Notas:
+// - La escritura en curso se interrumpira en el siguiente bloque, borrandose
+//   el fichero auxiliar. El fichero destino conservara su version anterior.
+// - Se utilizara al descartar los ficheros temporales de la sesion.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaStateWriter::CancelAll(void)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se toman las peticiones, marcando como fallidas las pendientes
+  EnterCriticalSection(&m_CSection);
+  JobList Jobs;
+  Jobs.swap(m_Jobs);
+  JobListIt It(Jobs.begin());
+  for (; It != Jobs.end(); ++It) {
+	InterlockedCompareExchange((void**)(&(*It)->lState),
+							   (void*)(JOB_FAILED),
+							   (void*)(JOB_PENDING));
+  }
+  LeaveCriticalSection(&m_CSection);
+
+  // Se interrumpe la escritura en curso y se liberan las peticiones
+  InterlockedExchange(&m_lCancel, 1);
+  for (It = Jobs.begin(); It != Jobs.end(); ++It) {
+	WaitJobNotWriting(*It);
+	ReleaseJob(*It);
+  }
+  InterlockedExchange(&m_lCancel, 0);
+
+  // Los fallos por cancelacion no se consideraran
+  m_bFailed = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprueba si existe una peticion de escritura sobre un fichero.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// Devuelve:
+// - Si existe peticion true. En caso contrario false.
+// Notas:
+// - Mientras exista peticion, el fichero de disco podra no estar actualizado.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaStateWriter::IsPending(const std::string& szFileName)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se localiza
+  std::string szFileNameLower(szFileName);
+  SYSEngine::MakeLowercase(szFileNameLower);
+  EnterCriticalSection(&m_CSection);
+  const bool bResult = (FindJob(szFileNameLower) != NULL);
+  LeaveCriticalSection(&m_CSection);
+  return bResult;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Localiza la peticion asociada a un fichero.
+// Parametros:
+// - szFileNameLower. Nombre del fichero en minusculas.
+// Devuelve:
+// - La peticion o NULL si no existe.
+// Notas:
+// - Se debera de llamar con la seccion critica tomada.
+///////////////////////////////////////////////////////////////////////////////
+CAreaStateWriter::sJob* const
+CAreaStateWriter::FindJob(const std::string& szFileNameLower)
+{
+  // Se recorren las peticiones
+  JobListIt It(m_Jobs.begin());
+  for (; It != m_Jobs.end(); ++It) {
+	if ((*It)->szFileNameLower == szFileNameLower) {
+	  return *It;
+	}
+  }
+
+  // No se hallo
+  return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Toma la siguiente peticion pendiente, pasandola a estado de escritura.
+// Parametros:
+// Devuelve:
+// - La peticion o NULL si no hay peticiones pendientes.
+// Notas:
+// - Metodo llamado desde el hilo de escritura.
+///////////////////////////////////////////////////////////////////////////////
+CAreaStateWriter::sJob* const
+CAreaStateWriter::GetNextPendingJob(void)
+{
+  // Se busca la primera peticion pendiente
+  sJob* pJob = NULL;
+  EnterCriticalSection(&m_CSection);
+  JobListIt It(m_Jobs.begin());
+  for (; It != m_Jobs.end(); ++It) {
+	if (JOB_PENDING == (*It)->lState) {
+	  pJob = *It;
+	  InterlockedExchange(&pJob->lState, JOB_WRITING);
+	  break;
+	}
+  }
+  LeaveCriticalSection(&m_CSection);
+
+  // Se retorna
+  return pJob;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Escribe la copia de un fichero sobre su fichero auxiliar y, una vez
+//   completada y llevada a disco, sustituye con el al fichero destino.
+// Parametros:
+// - pJob. Peticion en estado de escritura.
+// Devuelve:
+// Notas:
+// - Metodo llamado desde el hilo de escritura. Solo utilizara el API de
+//   Win32 sobre la copia ya alojada.
+// - En caso de cancelacion o fallo, se borrara el fichero auxiliar y el
+//   fichero destino conservara su version anterior.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaStateWriter::WriteJob(sJob* const pJob)
+{
+  // SOLO si parametros validos
+  ASSERT(pJob);
+  ASSERT((JOB_WRITING == pJob->lState) != 0);
+
+  // Se crea el fichero auxiliar
+  long lResult = JOB_FAILED;
+  const HANDLE hFile = CreateFile(pJob->szNewFileName.c_str(),
+								  GENERIC_WRITE,
+								  0,
+								  NULL,
+								  CREATE_ALWAYS,
+								  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+								  NULL);
+  if (hFile != INVALID_HANDLE_VALUE) {
+	// Se escribe por bloques
+	dword udOffset = 0;
+	while (udOffset < pJob->udSize && !m_lCancel) {
+	  dword udToWrite = pJob->udSize - udOffset;
+	  if (udToWrite > WRITE_BLOCK_SIZE) {
+		udToWrite = WRITE_BLOCK_SIZE;
+	  }
+	  DWORD udWritten = 0;
+	  if (!WriteFile(hFile, pJob->psbData + udOffset, udToWrite, &udWritten, NULL) ||
+		  udWritten != udToWrite) {
+		break;
+	  }
+	  udOffset += udWritten;
+	}
+
+	// Se lleva a disco y se cierra
+	const bool bWriteOk = (udOffset == pJob->udSize && FlushFileBuffers(hFile));
+	CloseHandle(hFile);
+
+	// Escritura completa?
+	if (bWriteOk && !m_lCancel) {
+	  // Se sustituye el fichero destino
+	  // Nota: Los sistemas sin MoveFileEx (Win9x) borraran antes el destino
+	  if (MoveFileEx(pJob->szNewFileName.c_str(),
+					 pJob->szFileName.c_str(),
+					 MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+		lResult = JOB_DONE;
+	  } else {
+		DeleteFile(pJob->szFileName.c_str());
+		if (MoveFile(pJob->szNewFileName.c_str(), pJob->szFileName.c_str())) {
+		  lResult = JOB_DONE;
+		}
+	  }
+	}
+
+	// Problemas?
+	if (lResult != JOB_DONE) {
+	  DeleteFile(pJob->szNewFileName.c_str());
+	}
+  }
+
+  // Se establece el resultado
+  InterlockedExchange(&pJob->lState, lResult);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Libera las peticiones cuya escritura haya terminado, anotando si alguna
+//   no pudo completarse.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaStateWriter::ReleaseFinishedJobs(void)
+{
+  // Se extraen las peticiones terminadas
+  EnterCriticalSection(&m_CSection);
+  JobList Jobs;
+  JobListIt It(m_Jobs.begin());
+  while (It != m_Jobs.end()) {
+	if (JOB_DONE == (*It)->lState ||
+		JOB_FAILED == (*It)->lState) {
+	  Jobs.push_back(*It);
+	  It = m_Jobs.erase(It);
+	} else {
+	  ++It;
+	}
+  }
+  LeaveCriticalSection(&m_CSection);
+
+  // Se liberan
+  for (It = Jobs.begin(); It != Jobs.end(); ++It) {
+	if (JOB_FAILED == (*It)->lState) {
+	  m_bFailed = true;
+	}
+	ReleaseJob(*It);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Libera una peticion y su copia del contenido.
+// Parametros:
+// - pJob. Peticion ya extraida de la lista y sin escritura en curso.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaStateWriter::ReleaseJob(sJob* const pJob)
+{
+  // SOLO si parametros validos
+  ASSERT(pJob);
+  ASSERT((JOB_WRITING != pJob->lState) != 0);
+
+  // Se libera
+  ASSERT((m_udPendingSize >= pJob->udSize) != 0);
+  m_udPendingSize -= pJob->udSize;
+  delete[] pJob->psbData;
+  delete pJob;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Espera a que una peticion no este siendo escrita por el hilo.
+// Parametros:
+// - pJob. Peticion.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaStateWriter::WaitJobNotWriting(sJob* const pJob)
+{
+  // SOLO si parametros validos
+  ASSERT(pJob);
+
+  // Se espera cediendo el procesador
+  while (JOB_WRITING == pJob->lState) {
+	Sleep(1);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Rutina del hilo de escritura. Esperara a ser avisado y atendera las
+//   peticiones pendientes hasta que se ordene su finalizacion.
+// Parametros:
+// - lpParams. Instancia CAreaStateWriter.
+// Devuelve:
+// - Siempre 1.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+DWORD
+WINAPI tAreaStateWrite(LPVOID lpParams)
+{
+  // Inicializaciones
+  ASSERT(lpParams);
+  CAreaStateWriter* const pWriter = (CAreaStateWriter*)(lpParams);
+
+  // Se atienden peticiones hasta la finalizacion
+  while (!pWriter->m_lEndThread) {
+	// Se espera aviso
+	WaitForSingleObject(pWriter->m_hWakeEvent, INFINITE);
+
+	// Se escriben todas las peticiones pendientes
+	CAreaStateWriter::sJob* pJob = pWriter->GetNextPendingJob();
+	while (pJob && !pWriter->m_lEndThread) {
+	  pWriter->WriteJob(pJob);
+	  pJob = pWriter->GetNextPendingJob();
+	}
+	if (pJob) {
+	  // Finalizacion con peticion tomada, se marca como fallida
+	  InterlockedExchange(&pJob->lState, CAreaStateWriter::JOB_FAILED);
+	}
+  }
+
+  // Todo correcto
+  return 1;
+}
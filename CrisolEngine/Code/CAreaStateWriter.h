@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CAreaStateWriter.h
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Clase:
+// - CAreaStateWriter
+//
+// Descripcion:
+// - Vuelca a disco en segundo plano el estado de las areas abandonadas. Cada
+//   peticion tomara una copia del contenido del fichero temporal del area
+//   y un hilo independiente lo escribira sobre un fichero auxiliar que,
+//   una vez completo, sustituira al fichero temporal mediante un renombrado.
+//   De esta forma, un fallo durante la escritura nunca dejara un fichero
+//   temporal a medio escribir.
+// - Mientras una peticion no se haya completado, su copia sera la version
+//   valida del estado del area, debiendose recoger con Commit si se vuelve
+//   a necesitar el area.
+//
+// Notas:
+// - El hilo de escritura solo utilizara el API de Win32 sobre buffers ya
+//   alojados, al igual que el de CAreaPrefetcher.
+// - La memoria de las peticiones pendientes estara acotada por
+//   MAX_PENDING_SIZE. Al superarla se esperara a que se completen las
+//   peticiones en curso.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _CAREASTATEWRITER_H_
+#define _CAREASTATEWRITER_H_
+
+// Pragmas <VC6 / Warnings sobre la stl>
+#pragma warning(disable:4786)
+
+// Cabeceras
+#ifndef _WINDOWS_
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+#ifndef _SYSDEFS_H_
+#include "SYSDefs.h"
+#endif
+#ifndef _STRING_H_
+#define _STRING_H_
+#include <string>
+#endif
+#ifndef _LIST_H_
+#define _LIST_H_
+#include <list>
+#endif
+
+// Defincion de clases / estructuras / espacios de nombres
+struct iCFileSystem;
+
+// Funcion que ejecuta el hilo de escritura
+static DWORD WINAPI tAreaStateWrite(LPVOID lpParams);
+
+// Clase CAreaStateWriter
+class CAreaStateWriter
+{
+private:
+  // Clases amigas
+  friend DWORD WINAPI tAreaStateWrite(LPVOID lpParams);
+
+private:
+  // Enumerados
+  enum {
+	MAX_PENDING_SIZE = 4 * 1024 * 1024, // Memoria maxima pendiente de volcar
+	WRITE_BLOCK_SIZE = 64 * 1024        // Bloque de escritura del hilo
+  };
+
+  enum eJobState {
+	// Estado de una peticion de escritura
+	JOB_PENDING = 0, // Pendiente de escritura
+	JOB_WRITING,     // Escribiendose en el hilo
+	JOB_DONE,        // Escritura completada
+	JOB_FAILED       // Escritura fallida o cancelada
+  };
+
+private:
+  // Estructuras
+  struct sJob {
+	// Peticion de escritura de un fichero
+	std::string   szFileName;      // Nombre del fichero
+	std::string   szFileNameLower; // Nombre del fichero en minusculas
+	std::string   szNewFileName;   // Nombre del fichero auxiliar
+	sbyte*        psbData;         // Copia del contenido
+	dword         udSize;          // Tamao del contenido
+	volatile long lState;          // Estado de la peticion
+	// Constructor
+	sJob(const std::string& aszFileName,
+		 const std::string& aszFileNameLower,
+		 const dword audSize): szFileName(aszFileName),
+							   szFileNameLower(aszFileNameLower),
+							   szNewFileName(aszFileName + ".new"),
+							   psbData(NULL),
+							   udSize(audSize),
+							   lState(JOB_PENDING) { }
+  };
+
+private:
+  // Tipos
+  typedef std::list<sJob*>  JobList;   // Lista de peticiones
+  typedef JobList::iterator JobListIt; // Iterador a la lista
+
+private:
+  // Vbles de miembro
+  JobList          m_Jobs;          // Peticiones de escritura
+  CRITICAL_SECTION m_CSection;      // Acceso exclusivo a las peticiones
+  HANDLE           m_hThread;       // Hilo de escritura
+  HANDLE           m_hWakeEvent;    // Evento de aviso al hilo
+  volatile long    m_lCancel;       // Cancelar la peticion en curso?
+  volatile long    m_lEndThread;    // Finalizar el hilo?
+  dword            m_udPendingSize; // Memoria alojada en peticiones
+  bool             m_bFailed;       // Fallo alguna escritura?
+  bool             m_bIsInitOk;     // Instancia inicializada?
+
+public:
+  // Constructor / destructor
+  CAreaStateWriter(void): m_hThread(NULL),
+						  m_hWakeEvent(NULL),
+						  m_lCancel(0),
+						  m_lEndThread(0),
+						  m_udPendingSize(0),
+						  m_bFailed(false),
+						  m_bIsInitOk(false) { }
+  ~CAreaStateWriter(void) { End(); }
+
+public:
+  // Protocolos de inicializacion / finalizacion
+  bool Init(void);
+  void End(void);
+  inline bool IsInitOk(void) const { return m_bIsInitOk; }
+
+public:
+  // Trabajo con las peticiones de escritura
+  bool Request(const std::string& szFileName,
+			   const sbyte* const psbData,
+			   const dword udSize);
+  bool Commit(const std::string& szFileName,
+			  iCFileSystem* const pFileSys);
+  bool WaitAll(void);
+  void CancelAll(void);
+  bool IsPending(const std::string& szFileName);
+
+private:
+  // Metodos de apoyo
+  sJob* const FindJob(const std::string& szFileNameLower);
+  sJob* const GetNextPendingJob(void);
+  void WriteJob(sJob* const pJob);
+  void ReleaseFinishedJobs(void);
+  void ReleaseJob(sJob* const pJob);
+  void WaitJobNotWriting(sJob* const pJob);
+}; // ~ CAreaStateWriter
+
+#endif // ~ #ifdef _CAREASTATEWRITER_H_
@@ -27,7 +27,11 @@
 #include "CCPAKFile.h"
 
 #include "CMemoryPool.h"
+#include "CLZCodec.h"
 #include <io.h>
+#ifdef _MT
+#include <process.h>
+#endif
 
 // Declaracion de estructuras forward
 struct CCPAKFile::sNFile { 
@@ -35,7 +39,22 @@ struct CCPAKFile::sNFile {
   byte      ubFileNameSize; // Longitud del nombre del fichero
   dword     udFileSize;     // Tamao del fichero
   dword     udFileOffset;   // Offset en donde en contrar el fichero
+  dword     udStoredSize;   // Tamao ocupado en el CPAK (comprimido o no)
+  byte      ubCodec;        // Metodo de almacenamiento
   FileState State;          // Contiene el estado del fichero	
+  // Integridad
+  dword     udCRC;          // CRC32 del contenido sin comprimir
+  bool      bCRC;           // Se conoce el CRC? (CPAKs anteriores a 1.2)
+  bool      bVerified;      // Contenido ya comprobado?
+  // Tabla hash
+  dword              udHash;        // Hash del nombre en minusculas
+  sNFile*            pNextInBucket; // Sig. fichero en la misma entrada
+  CPAKFileIndexMapIt It;            // Iterador al fichero en el indice
+  dword              udIndexPos;    // Posicion en el indice (al guardar)
+  // Constructor
+  sNFile(void): udCRC(0),
+				bCRC(false),
+				bVerified(false) { }
   // Pool de memoria
   static CMemoryPool MPool;
   static void* operator new(const size_t size) { return MPool.AllocMem(size); }
@@ -45,6 +64,35 @@ struct CCPAKFile::sNFile {
 // Inicializacion del manejador de memoria
 CMemoryPool CCPAKFile::sNFile::MPool(16, sizeof(CCPAKFile::sNFile), true);
 
+struct CCPAKFile::sBatchJob {
+  // Trabajo sobre un fichero en una operacion por lotes
+  std::string   szFileName; // Nombre del fichero
+  const sNFile* pFile;      // Fichero en el CPAK (solo al extraer)
+  BlockBuffer   Data;       // Contenido sin comprimir
+  BlockBuffer   Packed;     // Contenido comprimido (o vacio)
+  dword         udCRC;      // CRC32 del contenido
+  bool          bOk;        // Trabajo realizado con exito?
+  // Constructor
+  sBatchJob(const std::string& szName,
+			const sNFile* const pNFile): szFileName(szName),
+										 pFile(pNFile),
+										 udCRC(0),
+										 bOk(false) { }
+};
+
+struct CCPAKFile::sBatch {
+  // Tanda de trabajos de una operacion por lotes
+  CCPAKFile*             pCPAKFile; // Instancia que lanza la tanda
+  std::vector<sBatchJob> Jobs;      // Trabajos
+  bool                   bExtract;  // Extraccion? (o aadido)
+  volatile long          lNextJob;  // Siguiente trabajo a tomar
+  // Constructor
+  sBatch(CCPAKFile* const pCPAK,
+		 const bool bIsExtract): pCPAKFile(pCPAK),
+								 bExtract(bIsExtract),
+								 lNextJob(0) { }
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Abre el fichero szFileName y rellena las estructuras de datos internas
@@ -53,6 +101,7 @@ CMemoryPool CCPAKFile::sNFile::MPool(16, sizeof(CCPAKFile::sNFile), true);
 //   Tambien realiza la apertura y preparacion del fichero temporal para poder
 //   tenerlo listo en el momento de realizar cualquier tipo de modificacion,
 //   a traves de m_FileTemp.
+// - En caso de que el fichero tenga contenido, se proyectara en memoria.
 // Parametros:
 // - szFileName: Nombre del fichero.
 // - bOverWrite: Si vale true, el fichero CPAK se sobreescribira si existe y en
@@ -120,6 +169,13 @@ CCPAKFile::Open(const std::string& szFileName,
 	ReleaseFileIndex();
     return false;
   }
+
+  // Hay contenido?
+  if (udFileSize > 0) {
+	// Si, se proyecta en memoria
+	// Nota: en caso de no poder proyectarse, se leera desde m_File
+	MapFile();
+  }
   
   // Se actualizan resto de vbles de miembro y retorna
   m_bFileModify = false;  
@@ -150,11 +206,13 @@ CCPAKFile::Close(void)
       UpdateChanges();
     } else if (0 == m_CPAKHeader.udNumFiles) { 
 	  // No, y ademas no contiene elementos luego se guarda la cabecera solo.
+	  UnmapFile();
       m_File.seekp(0);
       m_File.write((sbyte *)(&m_CPAKHeader), sizeof(m_CPAKHeader));          
     }
 
     // Se cierra fichero CPAK y el temporal se elimina
+	UnmapFile();
     m_File.close();
     m_FileTemp.close();
     remove(m_szFileNameTemp.c_str());
@@ -216,6 +274,11 @@ CCPAKFile::InitHeader(const bool bFromDisk)
   }
 
   // Se inicializara la tabla de ficheros CPAK
+  // Nota: Si hay tabla hash, los nombres ya estaran en minusculas
+  const bool bHashIndex = (m_CPAKHeader.udFlags & CCPAKFile::HEADER_HASHINDEX) ? true : false;
+  std::vector<sNFile*> Files;
+  Files.reserve(m_CPAKHeader.udNumFiles);
+  bool bIndexOk = true;
   m_File.clear();
   m_File.seekp(m_CPAKHeader.udOffsetIndex);  
   sbyte szFileName[256];
@@ -231,14 +294,44 @@ CCPAKFile::InitHeader(const bool bFromDisk)
     m_File.read(szFileName, pFile->ubFileNameSize);
     m_File.read((sbyte *)(&pFile->udFileSize),  sizeof(pFile->udFileSize));
     m_File.read((sbyte *)(&pFile->udFileOffset), sizeof(pFile->udFileOffset)); 
+
+	// A partir de la version 1.1 se leera el metodo de almacenamiento
+	if (m_CPAKHeader.ubVersionLo >= 1) {
+	  m_File.read((sbyte *)(&pFile->ubCodec), sizeof(pFile->ubCodec));
+	  m_File.read((sbyte *)(&pFile->udStoredSize), sizeof(pFile->udStoredSize));
+	} else {
+	  pFile->ubCodec = CCPAKFile::CODEC_NONE;
+	  pFile->udStoredSize = pFile->udFileSize;
+	}
+
+	// A partir de la version 1.2 se leera el CRC del contenido
+	if (m_CPAKHeader.ubVersionLo >= 2) {
+	  m_File.read((sbyte *)(&pFile->udCRC), sizeof(pFile->udCRC));
+	  pFile->bCRC = true;
+	}
     
 	// Se establece estado
     pFile->State = CCPAKFile::FILE_OK;
 
 	// Se registra
 	std::string szFileNameLowercase(szFileName);
-	std::transform(szFileNameLowercase.begin(), szFileNameLowercase.end(), szFileNameLowercase.begin(), tolower);
-	m_FileIndex.insert(CPAKFileIndexMapValType(szFileNameLowercase, pFile));
+	if (!bHashIndex) {
+	  std::transform(szFileNameLowercase.begin(), szFileNameLowercase.end(), szFileNameLowercase.begin(), tolower);
+	}
+	const std::pair<CPAKFileIndexMapIt, bool> Result(m_FileIndex.insert(CPAKFileIndexMapValType(szFileNameLowercase, pFile)));
+	if (Result.second) {
+	  pFile->It = Result.first;
+	  Files.push_back(pFile);
+	} else {
+	  // Nombre repetido, la tabla hash guardada no sera utilizable
+	  delete pFile;
+	  bIndexOk = false;
+	}
+  }
+
+  // Se toma la tabla hash guardada o, si no la hubiera, se construye
+  if (!bHashIndex || !bIndexOk || !ReadHashIndex(Files)) {
+	BuildHashIndex();
   }
   
   // Todo correcto
@@ -260,6 +353,10 @@ CCPAKFile::ReleaseFileIndex(void)
   for (; CPAKIt != m_FileIndex.end(); CPAKIt = m_FileIndex.erase(CPAKIt)) {
 	delete CPAKIt->second;
   }
+
+  // Y la tabla hash y el bloque comprimido leido
+  m_HashBuckets.clear();
+  m_pCachedFile = NULL;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -320,280 +417,1156 @@ CCPAKFile::ChangeExtension(const std::string& szFileName,
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Se encargara de hacer efectivos los posibles cambios que se hayan efectuado
-//   en el fichero CPAK.
+// - Localiza el fichero szFileName en el indice a traves de la tabla hash,
+//   sin distinguir mayusculas de minusculas.
 // Parametros:
+// - szFileName: Nombre del fichero.
 // Devuelve:
-// - Si se han realizado los cambios true. En caso de que no se hayan realizado
-//   bien porque no habia nada que modificar (m_bFileModify a false) o bien
-//   porque hubo un error, se devolvera false.
+// - Iterador al fichero en el indice o m_FileIndex.end() si no se hallo.
 // Notas:
+// - No se realizara reserva de memoria alguna.
 ///////////////////////////////////////////////////////////////////////////////
-bool 
-CCPAKFile::UpdateChanges(void)
+CCPAKFile::CPAKFileIndexMapIt 
+CCPAKFile::GetCPAKFileIt(const std::string& szFileName)
 {
   // SOLO si hay fichero abierto
   ASSERT(IsOpen());
 
-  // NO existe ninguna modificacion?
-  if (!m_bFileModify) { 
-	return false; 
+  // No hay ficheros?
+  if (m_HashBuckets.empty()) {
+	return m_FileIndex.end();
   }
 
-  // Se recorre mediante iteradores el indice de ficheros para:
-  // * Encontrar el tamao maximo del buffer
-  // * Borrar aquellos ficheros con flag FILE_REMOVED
-  dword udSizeBuffer = 0;
-  CPAKFileIndexMapIt CPAKFileIt(m_FileIndex.begin());
-  while (CPAKFileIt != m_FileIndex.end()) {
-	// El fichero actual TIENE que borrarse?
-	if (CCPAKFile::FILE_REMOVED == CPAKFileIt->second->State) {
-	  // Si, se elimina y se pasa a sig. iteracion
-	  delete CPAKFileIt->second;
-	  CPAKFileIt = m_FileIndex.erase(CPAKFileIt);
-	} else {
-	  // No, el tamao es mayor que valor actual de buffer?
-	  if (CPAKFileIt->second->udFileSize > udSizeBuffer) {
-		// Si, se toma
-		udSizeBuffer = CPAKFileIt->second->udFileSize;
+  // Se recorre la entrada de la tabla asociada al hash del nombre
+  const dword udHash = GetNameHash(szFileName);
+  const sNFile* pFile = m_HashBuckets[udHash & (m_HashBuckets.size() - 1)];
+  for (; pFile; pFile = pFile->pNextInBucket) {
+	// Mismo hash y mismo tamao?
+	const std::string& szName = pFile->It->first;
+	if (pFile->udHash == udHash && 
+		szName.size() == szFileName.size()) {
+	  // Si, se comparan los caracteres en minusculas
+	  word uwIt = 0;
+	  while (uwIt < szName.size() && 
+			 szName[uwIt] == FoldChar(szFileName[uwIt])) {
+		++uwIt;
+	  }
+	  if (uwIt == szName.size()) {
+		return pFile->It;
 	  }
-	  ++CPAKFileIt;
 	}
   }
 
-  // Flags base para la nueva apartura de los ficheros
-  const sword swBaseFlags = std::ios_base::in | std::ios_base::out | 
-							std::ios_base::binary;	
+  // No se hallo
+  return m_FileIndex.end();
+}
 
-  // No quedan ficheros?
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Construye la tabla hash sobre todos los ficheros del indice.
+// Parametros:
+// Devuelve:
+// Notas:
+// - El numero de entradas sera potencia de 2 y, al menos, el doble que el
+//   numero de ficheros.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CCPAKFile::BuildHashIndex(void)
+{
+  // Se calcula el numero de entradas
+  m_HashBuckets.clear();
   if (m_FileIndex.empty()) {
-	// No quedan, luego se inicializan estructuras y archivos
-	// Se truncan ficheros temporales y actuales
-	m_File.close();
-	m_File.clear();
-	m_File.open(m_szFileName.c_str(), swBaseFlags | std::ios_base::trunc);
-	ASSERT(m_File.good());
-	m_FileTemp.close();	
-	m_FileTemp.clear();
-	m_FileTemp.open(m_szFileNameTemp.c_str(), swBaseFlags | std::ios_base::trunc);
-	ASSERT(m_FileTemp.good());
-
-    // Se actualiza la cabecera y se guarda en disco
-    m_CPAKHeader.udNumFiles = 0;
-    m_CPAKHeader.udOffsetIndex = 0;
-	m_File.clear();
-	m_File.seekp(0, std::ios_base::beg);
-    m_File.write((sbyte *)(&m_CPAKHeader), sizeof(m_CPAKHeader));
-  } else {
-	// Si hay ficheros contenidos, se procede a una actualizacion a nivel
-	// de disco (FILE_MODIFY)	
-	// Se abre el fichero CPAK actualizado	
-	std::string szFileNameTemp(ChangeExtension(m_szFileName, "act"));
-	std::fstream NewFile(szFileNameTemp.c_str(), 
-						 swBaseFlags | std::ios_base::trunc);
-	ASSERT(NewFile.good());
-	
-	// Se prepara buffer temporal para lectura de informacion  
-	byte* pubBuffer = new byte [udSizeBuffer];
-	ASSERT(pubBuffer);  
-	
-	// Se procede a guardar los archivos en NewFile, dejando espacio para 
-	// la cabecera, que se guardara en ultimo lugar
-	NewFile.seekp(sizeof(m_CPAKHeader));
-	CPAKFileIndexMapIt CPAKFileIt(m_FileIndex.begin());
-	for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
-	  // Se evalua estado del fichero actual	
-	  switch(CPAKFileIt->second->State) {
-		case CCPAKFile::FILE_OK: {
-		  // Hay que guardar el fichero tal cual 
-		  // Se lee desde el CPAK
-		  m_File.clear();
-		  m_File.seekg(CPAKFileIt->second->udFileOffset);
-		  m_File.read((sbyte *)(pubBuffer), CPAKFileIt->second->udFileSize);
-		} break;
-
-		case CCPAKFile::FILE_MODIFY: {
-		  // Es un fichero modificado 
-		  // Se lee desde el temporal y se deja en estado "Ok"
-		  m_FileTemp.clear();
-		  m_FileTemp.seekg(CPAKFileIt->second->udFileOffset);
-		  m_FileTemp.read((sbyte *)(pubBuffer), CPAKFileIt->second->udFileSize);      
-		  CPAKFileIt->second->State = CCPAKFile::FILE_OK;
-		} break;
-	  }; // ~ switch
-
-	  // Se actualiza los datos del fichero y se guarda la informacion
-	  CPAKFileIt->second->udFileOffset = NewFile.tellp();    
-	  NewFile.write((sbyte *)(pubBuffer), CPAKFileIt->second->udFileSize);
-	}
-
-	// Se libera el buffer y se cierran y borran los ficheros originales
-	delete[udSizeBuffer] pubBuffer;
-	pubBuffer = NULL;
-	m_File.close();
-	remove(m_szFileName.c_str());
-	m_FileTemp.close();
-	remove(m_szFileNameTemp.c_str());	    
-	
-	// Se completa los datos de la cabecera con el offset para la tabla
-	// de indices y el numero de elementos y se guarda la cabecera  
-	m_CPAKHeader.udOffsetIndex = NewFile.tellp();
-	m_CPAKHeader.udNumFiles = m_FileIndex.size();
-	NewFile.clear();
-	NewFile.seekp(0, std::ios_base::beg);  
-	NewFile.write((sbyte *)(&m_CPAKHeader), sizeof(m_CPAKHeader));
-	
-	// Se procede a almacenar la informacion sobre el indice de ficheros, que
-	// ira siempre al final del todo
-	NewFile.clear();
-	NewFile.seekp(0, std::ios_base::end);  
-	CPAKFileIt = m_FileIndex.begin();
-	for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
-	  // Se guardara: longitud nombre del fichero, nombre fichero, tamao del mismo y
-	  // offset en donde localizarlo.
-	  NewFile.clear();
-	  NewFile.write((sbyte *)(&CPAKFileIt->second->ubFileNameSize), 
-					sizeof(CPAKFileIt->second->ubFileNameSize));
-	  NewFile.write(CPAKFileIt->first.c_str(), 
-					CPAKFileIt->second->ubFileNameSize);
-	  NewFile.write((sbyte *)(&CPAKFileIt->second->udFileSize), 
-					sizeof(CPAKFileIt->second->udFileSize));        
-	  NewFile.write((sbyte *)(&CPAKFileIt->second->udFileOffset), 
-					sizeof(CPAKFileIt->second->udFileOffset));
-	}
-	
-	// Se procede a cerrar NewFile y renombrarlo al nombre del fichero original    
-	NewFile.close();
-	szFileNameTemp = ChangeExtension(m_szFileName.c_str(), "act");
-	rename(szFileNameTemp.c_str(), m_szFileName.c_str());
-	
-	// Se vuelve a abrir el fichero CPAK y el temporal para trabajar
-	m_File.open(m_szFileName.c_str(), swBaseFlags);
-	m_FileTemp.open(m_szFileNameTemp.c_str(), swBaseFlags | std::ios_base::trunc);
+	return;
   }
+  dword udNumBuckets = 16;
+  while (udNumBuckets < 2 * m_FileIndex.size()) {
+	udNumBuckets <<= 1;
+  }
+  m_HashBuckets.resize(udNumBuckets, NULL);
 
-  // Se establece a off el flag de modificaciones y se sale
-  m_bFileModify = false;  
-  return true;  
+  // Se insertan todos los ficheros
+  CPAKFileIndexMapIt CPAKFileIt(m_FileIndex.begin());
+  for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
+	sNFile* const pFile = CPAKFileIt->second;
+	pFile->udHash = GetNameHash(CPAKFileIt->first);
+	pFile->It = CPAKFileIt;
+	pFile->pNextInBucket = m_HashBuckets[pFile->udHash & (udNumBuckets - 1)];
+	m_HashBuckets[pFile->udHash & (udNumBuckets - 1)] = pFile;
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Realiza la lectura del contenido asociado a un fichero. La lectura se
-//   realiza en base al numero de bytes que se quieran leer. El buffer debera 
-//   de haber sido reservado desde el exterior.
+// - Inserta un nuevo fichero del indice en la tabla hash. Si la tabla se
+//   quedara pequea, se reconstruira.
 // Parametros:
-// - szFileName: Nombre del fichero.
-// - psbBuffer: Puntero al buffer de memoria.
-// - udBufferSize: Tamao del buffer.
-// - udInitOffset. Posicion inicial de lectura. Por defecto valdra 0 indicando
-//   que se quiere leer desde el principio.
+// - pFile: Fichero ya insertado en m_FileIndex.
 // Devuelve:
-// - El numbero de bytes leidos. Si se devuelve 0 es que ha existido algun
-//   problema o no se ha hallado el fichero.
 // Notas:
-// - En caso de que el tamao del fichero sea inferior a udBufferSize, se
-//   leeran solos los bytes asociados al tamao del fichero.
-// - En caso de que la posicion inicial este fuera del rango del tamao
-//   del fichero, no se leera nada y se devolvera 0.
 ///////////////////////////////////////////////////////////////////////////////
-dword 
-CCPAKFile::Read(const std::string& szFileName, 
-				sbyte* psbBuffer, 
-				const dword udBufferSize,
-				const dword udInitOffset)
+void 
+CCPAKFile::InsertInHashIndex(sNFile* const pFile)
 {
-  // SOLO si hay fichero abierto
-  ASSERT(IsOpen());
-  // SOLO si parametros correctos
-  ASSERT(psbBuffer);
-  ASSERT(!szFileName.empty());
-  ASSERT(udBufferSize);
-
-  // Se localiza nodo
-  const CPAKFileIndexMapIt CPAKFileIt(GetCPAKFileIt(szFileName));
+  // SOLO si parametros validos
+  ASSERT(pFile);
 
-  // Se encontro el fichero?
-  if (CPAKFileIt != m_FileIndex.end()) {
-	// Si, se acota la posicion de lectura en caso de que se quiera leer mas
-	// de lo que realmente hay desde la posicion de inicio de lectura
-	ASSERT((CPAKFileIt->second->udFileSize > udInitOffset) != 0);
-	const dword udValidZoneToRead = CPAKFileIt->second->udFileSize - udInitOffset;
-	dword udDataRead = udBufferSize;	
-	if (udDataRead > udValidZoneToRead) {
-	  udDataRead = udValidZoneToRead;
-	}
+  // Hay que reconstruir la tabla?
+  if (m_FileIndex.size() > m_HashBuckets.size() / 2) {
+	BuildHashIndex();
+	return;
+  }
 
-	// Se lee y se retorna la cantidad de bytes leidos
-	m_File.clear();
-	m_File.seekp(CPAKFileIt->second->udFileOffset + udInitOffset, std::ios::beg);  
-	m_File.read(psbBuffer, udDataRead);
-	return m_File.fail() ? 0 : udDataRead;
-  } else {
-	// No, leidos 0 bytes
-	return 0;
-  }  
+  // Se inserta
+  pFile->udHash = GetNameHash(pFile->It->first);
+  const dword udBucket = pFile->udHash & (m_HashBuckets.size() - 1);
+  pFile->pNextInBucket = m_HashBuckets[udBucket];
+  m_HashBuckets[udBucket] = pFile;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Metodo preparado para leer una linea a partir de un offset dado. Se
-//   considerara linea a la secuencia que termine en un retorno de carro '\r'
-//   seguido del caracter de nueva linea '\n'. Como se leera HASTA el caracter
-//   '\r' el de nueva linea no sera incluido, pero el numero real de caracteres
-//   leidos incluira a estos dos ultimos.
-// - En caso de que se lea la ultima linea, no existira caracter de retorno
-//   de carro ni de nueva linea, y la longitud sera unicamente la del numero de
-//   caracteres que tenga el string.
+// - Lee la tabla hash guardada tras el indice de ficheros. La lectura se
+//   realizara desde la posicion actual de m_File.
+// - El formato sera: numero de entradas, pares hash / sig. fichero en la
+//   entrada por cada fichero (en el orden del indice) y, finalmente, primer
+//   fichero de cada entrada. Las posiciones se guardaran sumando 1, para que
+//   0 indique la ausencia de fichero.
 // Parametros:
-// - hFile: Identificador del archivo desde donde leer.
-// - udInitOffset. Offset en donde comenzar a leer la informacion.
-// - szDest. String donde depositar la informacion leida.
+// - Files: Ficheros en el orden en que se hallaban en el indice.
 // Devuelve:
-// - El offset que se ha movido para leer
+// - Si la tabla es valida y se ha podido tomar true. En caso contrario false.
 // Notas:
+// - Se comprobara que cada fichero se halle una sola vez, y en la entrada
+//   que le corresponda, para no confiar en una tabla corrupta.
 ///////////////////////////////////////////////////////////////////////////////
-dword
-CCPAKFile::ReadLine(const std::string& szFileName, 
-				    const dword udInitOffset,
-				    std::string& szDest)
+bool 
+CCPAKFile::ReadHashIndex(const std::vector<sNFile*>& Files)
 {
-  // SOLO si hay fichero abierto
-  ASSERT(IsOpen());
-  // SOLO si parametros validos
-  ASSERT(!szFileName.empty());
+  // Se lee el numero de entradas y se comprueba que sea valido
+  const dword udNumFiles = Files.size();
+  dword udNumBuckets = 0;
+  m_File.clear();
+  m_File.read((sbyte *)(&udNumBuckets), sizeof(udNumBuckets));
+  if (m_File.fail() ||
+	  udNumBuckets < udNumFiles || 
+	  0 != (udNumBuckets & (udNumBuckets - 1))) {
+	return false;
+  }
 
-  // Se localiza nodo
-  const CPAKFileIndexMapIt CPAKFileIt(GetCPAKFileIt(szFileName));
+  // Se leen los hash y los encadenamientos de cada fichero
+  std::vector<dword> Nexts(udNumFiles);
+  dword udIt = 0;
+  for (; udIt < udNumFiles; ++udIt) {
+	m_File.read((sbyte *)(&Files[udIt]->udHash), sizeof(dword));
+	m_File.read((sbyte *)(&Nexts[udIt]), sizeof(dword));
+  }
 
-  // Fichero valido?
-  if (CPAKFileIt != m_FileIndex.end()) {
-	// Si, se coloca cursor de lectura
-	m_File.clear();
-	m_File.seekg(CPAKFileIt->second->udFileOffset + udInitOffset,
-				 std::ios_base::beg);  
+  // Se leen las entradas y se enlazan los ficheros
+  m_HashBuckets.resize(udNumBuckets, NULL);
+  std::vector<bool> Linked(udNumFiles, false);
+  dword udNumLinked = 0;
+  for (udIt = 0; udIt < udNumBuckets; ++udIt) {
+	dword udFile = 0;
+	m_File.read((sbyte *)(&udFile), sizeof(dword));
+	sNFile** ppLink = &m_HashBuckets[udIt];
+	while (udFile) {
+	  // Fichero no valido, ya enlazado o en otra entrada?
+	  if (udFile > udNumFiles || 
+		  Linked[udFile - 1] ||
+		  udIt != (Files[udFile - 1]->udHash & (udNumBuckets - 1))) {
+		m_HashBuckets.clear();
+		return false;
+	  }
+	  Linked[udFile - 1] = true;
+	  ++udNumLinked;
+	  *ppLink = Files[udFile - 1];
+	  ppLink = &(*ppLink)->pNextInBucket;
+	  udFile = Nexts[udFile - 1];
+	}
+	*ppLink = NULL;
+  }
 
-	// Se leera una nueva linea, como antes de llegar a la nueva linea podra
-	// haberse incluido el retorno de carro, este sera eliminado del string
-	std::getline(m_File, szDest);
-	if (!szDest.empty() && 
-		'\r' == szDest[szDest.size() - 1]) {
-	  szDest.resize(szDest.size() - 1);
-	}	  
-	
-	// Se retorna el offset avanzado por el archivo
-	return (word(m_File.tellg()) - (CPAKFileIt->second->udFileOffset + udInitOffset));
-	//return (0 != m_File.eof()) ? szDest.size() + 2 : szDest.size();
-  } else {
-	// No, se leyeron 0 bytes
-	return 0;
+  // Problemas de lectura o ficheros sin enlazar?
+  if (m_File.fail() || udNumLinked != udNumFiles) {
+	m_HashBuckets.clear();
+	return false;
   }
+
+  // Todo correcto
+  return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Este metodo sobreescribe los datos de un fichero que se encuentre 
-//   almacenado en el archivo CPAK. Como no se puede sobreescribir directamente,
+// - Guarda la tabla hash en File, en la posicion actual de escritura. 
+//   Consultar ReadHashIndex para conocer el formato.
+// Parametros:
+// - File: Fichero donde guardar.
+// Devuelve:
+// Notas:
+// - Las posiciones de los ficheros en el indice (udIndexPos) deberan de
+//   estar establecidas.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CCPAKFile::WriteHashIndex(std::fstream& File)
+{
+  // Numero de entradas
+  const dword udNumBuckets = m_HashBuckets.size();
+  File.clear();
+  File.write((sbyte *)(&udNumBuckets), sizeof(udNumBuckets));
+
+  // Hash y encadenamiento de cada fichero, en el orden del indice
+  CPAKFileIndexMapIt CPAKFileIt(m_FileIndex.begin());
+  for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
+	const sNFile* const pFile = CPAKFileIt->second;
+	const dword udNext = pFile->pNextInBucket ? pFile->pNextInBucket->udIndexPos + 1 : 0;
+	File.write((sbyte *)(&pFile->udHash), sizeof(dword));
+	File.write((sbyte *)(&udNext), sizeof(dword));
+  }
+
+  // Primer fichero de cada entrada
+  HashBucketVector::iterator BucketIt(m_HashBuckets.begin());
+  for (; BucketIt != m_HashBuckets.end(); ++BucketIt) {
+	const dword udFirst = *BucketIt ? (*BucketIt)->udIndexPos + 1 : 0;
+	File.write((sbyte *)(&udFirst), sizeof(dword));
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Calcula el hash (FNV-1a) del nombre de fichero en minusculas.
+// Parametros:
+// - szFileName: Nombre del fichero.
+// Devuelve:
+// - El hash calculado.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+dword 
+CCPAKFile::GetNameHash(const std::string& szFileName)
+{
+  // Se calcula y retorna
+  dword udHash = 2166136261;
+  std::string::const_iterator It(szFileName.begin());
+  for (; It != szFileName.end(); ++It) {
+	udHash ^= byte(FoldChar(*It));
+	udHash *= 16777619;
+  }
+  return udHash;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprime los datos de un fichero en bloques independientes, precedidos
+//   de una tabla con el offset final de cada bloque (relativo al comienzo
+//   de los bloques).
+// Parametros:
+// - psbData, udSize: Datos del fichero y su tamao.
+// - Packed: Buffer donde depositar los datos comprimidos.
+// Devuelve:
+// - Si compensa la compresion true. En caso contrario false, quedando
+//   Packed vacio.
+// Notas:
+// - Los bloques que no se reduzcan se guardaran sin comprimir, lo que se
+//   reconocera por tener su tamao original.
+// - Solo se comprimira si se ahorra, al menos, la dieciseisava parte.
+// - No se accedera a ningun miembro, por lo que se podra llamar desde 
+//   varios hilos a la vez. El resultado solo dependera de los datos.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::PackContent(const sbyte* const psbData,
+					   const dword udSize,
+					   BlockBuffer& Packed)
+{
+  // SOLO si parametros validos
+  ASSERT(psbData);
+
+  // Fichero demasiado pequeo?
+  Packed.clear();
+  if (udSize < CCPAKFile::COMPRESS_MIN_SIZE) {
+	return false;
+  }
+
+  // Se reserva espacio para la tabla de bloques y se comprime bloque a bloque
+  const dword udNumBlocks = (udSize + CCPAKFile::COMPRESS_BLOCK_SIZE - 1) / CCPAKFile::COMPRESS_BLOCK_SIZE;
+  const dword udTableSize = udNumBlocks * sizeof(dword);
+  Packed.reserve(udTableSize + udSize);
+  Packed.resize(udTableSize);
+  BlockBuffer Block(CCPAKFile::COMPRESS_BLOCK_SIZE);
+  dword udBlock = 0;
+  for (; udBlock < udNumBlocks; ++udBlock) {
+	const byte* const pubSrc = (const byte*)(psbData) + udBlock * CCPAKFile::COMPRESS_BLOCK_SIZE;
+	dword udBlockSize = udSize - udBlock * CCPAKFile::COMPRESS_BLOCK_SIZE;
+	if (udBlockSize > CCPAKFile::COMPRESS_BLOCK_SIZE) {
+	  udBlockSize = CCPAKFile::COMPRESS_BLOCK_SIZE;
+	}
+	const dword udPackedSize = CLZCodec::Compress(pubSrc, udBlockSize, &Block[0], udBlockSize - 1);
+	if (udPackedSize) {
+	  Packed.insert(Packed.end(), Block.begin(), Block.begin() + udPackedSize);
+	} else {
+	  Packed.insert(Packed.end(), pubSrc, pubSrc + udBlockSize);
+	}
+	const dword udBlockEnd = Packed.size() - udTableSize;
+	memcpy(&Packed[udBlock * sizeof(dword)], &udBlockEnd, sizeof(dword));
+  }
+
+  // No compensa la compresion?
+  if (Packed.size() + udSize / 16 > udSize) {
+	Packed.clear();
+	return false;
+  }
+
+  // Si compensa
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Guarda los datos de un fichero al final del fichero temporal, 
+//   comprimidos si se recibe su version comprimida.
+// Parametros:
+// - psbData, udSize: Datos del fichero y su tamao.
+// - Packed: Datos comprimidos con PackContent o vacio si no se comprimen.
+// - udOffset: Offset en el temporal en donde se ha guardado.
+// - udStoredSize: Tamao finalmente guardado.
+// - ubCodec: Metodo de almacenamiento empleado.
+// Devuelve:
+// - Si se ha podido guardar true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::WriteToTemp(const sbyte* const psbData,
+					   const dword udSize,
+					   const BlockBuffer& Packed,
+					   dword& udOffset,
+					   dword& udStoredSize,
+					   byte& ubCodec)
+{
+  // SOLO si parametros validos
+  ASSERT(psbData);
+  ASSERT(udSize);
+
+  // Se situa al final del temporal
+  m_FileTemp.clear();
+  m_FileTemp.seekp(0, std::ios_base::end);
+  udOffset = dword(m_FileTemp.tellp());
+
+  // Se guardan los datos, comprimidos o no
+  if (Packed.empty()) {
+	m_FileTemp.write(psbData, udSize);
+	ubCodec = CCPAKFile::CODEC_NONE;
+	udStoredSize = udSize;
+  } else {
+	m_FileTemp.write((const sbyte*)(&Packed[0]), Packed.size());
+	ubCodec = CCPAKFile::CODEC_LZ;
+	udStoredSize = Packed.size();
+  }
+
+  // Se retorna
+  return m_FileTemp.good();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee datos, tal y como estan almacenados, de un fichero. Se leera del
+//   temporal, de la proyeccion en memoria o del fichero CPAK segun proceda.
+// Parametros:
+// - pFile: Fichero.
+// - udOffset: Offset relativo al comienzo de los datos almacenados.
+// - pDest, udSize: Destino y cantidad a leer.
+// Devuelve:
+// - Si se ha podido leer true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::ReadStored(const sNFile* const pFile,
+					  const dword udOffset,
+					  void* const pDest,
+					  const dword udSize)
+{
+  // SOLO si parametros validos
+  ASSERT(pFile);
+  ASSERT(pDest);
+
+  // Fuera de los datos almacenados?
+  if (udOffset > pFile->udStoredSize ||
+	  udSize > pFile->udStoredSize - udOffset) {
+	return false;
+  }
+
+  // Fichero modificado?
+  if (CCPAKFile::FILE_MODIFY == pFile->State) {
+	// Si, se lee del temporal
+	m_FileTemp.clear();
+	m_FileTemp.seekg(pFile->udFileOffset + udOffset, std::ios_base::beg);
+	m_FileTemp.read((sbyte *)(pDest), udSize);
+	return !m_FileTemp.fail();
+  }
+
+  // Se halla en la proyeccion?
+  if (IsMappedFile(pFile)) {
+	// Si, se copia
+	memcpy(pDest, m_psbMapView + pFile->udFileOffset + udOffset, udSize);
+	return true;
+  }
+
+  // Se lee del fichero CPAK
+  m_File.clear();
+  m_File.seekg(pFile->udFileOffset + udOffset, std::ios_base::beg);
+  m_File.read((sbyte *)(pDest), udSize);
+  return !m_File.fail();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Deja en m_BlockCache el bloque udBlock, descomprimido, del fichero pFile.
+// Parametros:
+// - pFile: Fichero comprimido.
+// - udBlock: Bloque a obtener.
+// Devuelve:
+// - Si se ha podido obtener true. Si el bloque no es valido false.
+// Notas:
+// - Si el bloque ya era el ultimo leido, no se hara nada.
+// - Cuando el CPAK este proyectado, se descomprimira desde la vista.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::LoadCompressedBlock(const sNFile* const pFile,
+							   const dword udBlock)
+{
+  // SOLO si parametros validos
+  ASSERT(pFile);
+  ASSERT((CCPAKFile::CODEC_LZ == pFile->ubCodec) != 0);
+
+  // Es el ultimo bloque leido?
+  if (pFile == m_pCachedFile && udBlock == m_udCachedBlock) {
+	return true;
+  }
+
+  // Se obtienen los limites del bloque en la tabla de bloques
+  const dword udNumBlocks = (pFile->udFileSize + CCPAKFile::COMPRESS_BLOCK_SIZE - 1) / CCPAKFile::COMPRESS_BLOCK_SIZE;
+  ASSERT((udBlock < udNumBlocks) != 0);
+  const dword udTableSize = udNumBlocks * sizeof(dword);
+  dword udBlockBegin = 0;
+  dword udBlockEnd = 0;
+  if ((udBlock > 0 && 
+	   !ReadStored(pFile, (udBlock - 1) * sizeof(dword), &udBlockBegin, sizeof(dword))) ||
+	  !ReadStored(pFile, udBlock * sizeof(dword), &udBlockEnd, sizeof(dword))) {
+	return false;
+  }
+
+  // Se comprueba que el bloque sea valido
+  dword udBlockSize = pFile->udFileSize - udBlock * CCPAKFile::COMPRESS_BLOCK_SIZE;
+  if (udBlockSize > CCPAKFile::COMPRESS_BLOCK_SIZE) {
+	udBlockSize = CCPAKFile::COMPRESS_BLOCK_SIZE;
+  }
+  if (udTableSize > pFile->udStoredSize ||
+	  udBlockEnd < udBlockBegin ||
+	  udBlockEnd - udBlockBegin > udBlockSize ||
+	  udBlockEnd > pFile->udStoredSize - udTableSize) {
+	return false;
+  }
+
+  // Se obtiene el bloque comprimido
+  const dword udPackedSize = udBlockEnd - udBlockBegin;
+  const byte* pubPacked = NULL;
+  if (IsMappedFile(pFile)) {
+	pubPacked = (const byte*)(m_psbMapView + pFile->udFileOffset + udTableSize + udBlockBegin);
+  } else {
+	m_PackedBlock.resize(CCPAKFile::COMPRESS_BLOCK_SIZE);
+	if (!ReadStored(pFile, udTableSize + udBlockBegin, &m_PackedBlock[0], udPackedSize)) {
+	  return false;
+	}
+	pubPacked = &m_PackedBlock[0];
+  }
+
+  // Se descomprime o, si no se redujo, se copia
+  m_BlockCache.resize(CCPAKFile::COMPRESS_BLOCK_SIZE);
+  m_pCachedFile = NULL;
+  if (udPackedSize == udBlockSize) {
+	memcpy(&m_BlockCache[0], pubPacked, udBlockSize);
+  } else if (!CLZCodec::Decompress(pubPacked, udPackedSize, &m_BlockCache[0], udBlockSize)) {
+	return false;
+  }
+
+  // Se guarda el bloque leido y se retorna
+  m_pCachedFile = pFile;
+  m_udCachedBlock = udBlock;
+  m_udCachedBlockSize = udBlockSize;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee datos de un fichero comprimido, descomprimiendo unicamente los 
+//   bloques que contengan la zona a leer.
+// Parametros:
+// - pFile: Fichero comprimido.
+// - psbBuffer, udSize: Destino y cantidad a leer.
+// - udInitOffset: Posicion inicial de lectura.
+// Devuelve:
+// - El numero de bytes leidos. Si hubo algun problema 0.
+// Notas:
+// - La zona a leer debera de estar dentro del fichero.
+///////////////////////////////////////////////////////////////////////////////
+dword 
+CCPAKFile::ReadCompressed(const sNFile* const pFile,
+						  sbyte* const psbBuffer,
+						  const dword udSize,
+						  const dword udInitOffset)
+{
+  // SOLO si parametros validos
+  ASSERT(pFile);
+  ASSERT(psbBuffer);
+  ASSERT((udInitOffset + udSize <= pFile->udFileSize) != 0);
+
+  // Se copia bloque a bloque
+  dword udRead = 0;
+  while (udRead < udSize) {
+	const dword udPos = udInitOffset + udRead;
+	if (!LoadCompressedBlock(pFile, udPos / CCPAKFile::COMPRESS_BLOCK_SIZE)) {
+	  return 0;
+	}
+	const dword udPosInBlock = udPos % CCPAKFile::COMPRESS_BLOCK_SIZE;
+	dword udToCopy = m_udCachedBlockSize - udPosInBlock;
+	if (udToCopy > udSize - udRead) {
+	  udToCopy = udSize - udRead;
+	}
+	memcpy(psbBuffer + udRead, &m_BlockCache[udPosInBlock], udToCopy);
+	udRead += udToCopy;
+  }
+
+  // Se retorna
+  return udRead;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Determina, a partir de su extension, si un fichero se debe de intentar
+//   comprimir al aadirlo.
+// Parametros:
+// - szFileName: Nombre del fichero.
+// Devuelve:
+// - Si se debe de intentar comprimir true. En caso contrario false.
+// Notas:
+// - Los sonidos se guardaran sin comprimir, pues se leen por zonas de 
+//   forma continua y apenas se reducen. Tampoco se comprimiran formatos
+//   ya comprimidos.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::IsCompressibleFile(const std::string& szFileName)
+{
+  // Extensiones que no se comprimiran
+  static const sbyte* const szStoredExts[] = {
+	"wav", "mp3", "ogg", "avi", "mpg", "jpg", "png", "zip", NULL
+  };
+
+  // Se localiza la extension
+  const std::string::size_type ExtPos = szFileName.find_last_of('.');
+  if (std::string::npos == ExtPos) {
+	return true;
+  }
+  const sbyte* const szExt = szFileName.c_str() + ExtPos + 1;
+
+  // Se compara con las extensiones que no se comprimiran
+  word uwIt = 0;
+  for (; szStoredExts[uwIt]; ++uwIt) {
+	if (0 == strcmpi(szExt, szStoredExts[uwIt])) {
+	  return false;
+	}
+  }
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Se encargara de hacer efectivos los posibles cambios que se hayan efectuado
+//   en el fichero CPAK.
+// - Los datos de los ficheros modificados se aadiran al final del CPAK, 
+//   seguidos del nuevo indice, sin tocar el resto de datos, de tal forma que
+//   el coste dependera unicamente de lo modificado.
+// Parametros:
+// Devuelve:
+// - Si se han realizado los cambios true. En caso de que no se hayan realizado
+//   bien porque no habia nada que modificar (m_bFileModify a false) o bien
+//   porque hubo un error, se devolvera false.
+// Notas:
+// - Los datos de los ficheros eliminados o sobreescritos y los indices 
+//   anteriores quedaran como espacio muerto (GetDeadSpace) hasta que se
+//   llame a Compact.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::UpdateChanges(void)
+{
+  // SOLO si hay fichero abierto
+  ASSERT(IsOpen());
+
+  // NO existe ninguna modificacion?
+  if (!m_bFileModify) { 
+	return false; 
+  }
+
+  // Se aaden los cambios
+  return ApplyChanges(false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Reescribe por completo el fichero CPAK, haciendo efectivos los posibles
+//   cambios y eliminando el espacio muerto.
+// Parametros:
+// Devuelve:
+// - Si se ha podido compactar true. En caso contrario false.
+// Notas:
+// - El coste sera proporcional al tamao de todo el CPAK, por lo que solo
+//   convendra llamarlo cuando el espacio muerto sea importante.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::Compact(void)
+{
+  // SOLO si hay fichero abierto
+  ASSERT(IsOpen());
+
+  // Se reescribe el CPAK
+  return ApplyChanges(true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Hace efectivos los cambios en el fichero CPAK, aadiendolos al final o
+//   reescribiendo el fichero por completo.
+// Parametros:
+// - bCompact: Si vale true se reescribira el fichero completo.
+// Devuelve:
+// - Si se han realizado los cambios true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::ApplyChanges(const bool bCompact)
+{
+  // SOLO si hay fichero abierto
+  ASSERT(IsOpen());
+
+  // Se halla el CRC de los ficheros procedentes de CPAKs anteriores a la
+  // version 1.2, antes de abandonar la proyeccion
+  BlockBuffer Content;
+  CPAKFileIndexMapIt CPAKFileIt(m_FileIndex.begin());
+  for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
+	sNFile* const pFile = CPAKFileIt->second;
+	if (!pFile->bCRC &&
+		CCPAKFile::FILE_REMOVED != pFile->State &&
+		ReadContent(pFile, Content)) {
+	  pFile->udCRC = GetContentCRC((const sbyte*)(&Content[0]), pFile->udFileSize);
+	  pFile->bCRC = true;
+	}
+  }
+  Content.clear();
+
+  // Se abandona la proyeccion, pues el fichero CPAK sera reescrito, y el
+  // bloque comprimido leido, pues cambiaran los offsets
+  UnmapFile();
+  m_pCachedFile = NULL;
+
+  // Se recorre mediante iteradores el indice de ficheros para:
+  // * Encontrar el tamao maximo del buffer
+  // * Borrar aquellos ficheros con flag FILE_REMOVED
+  dword udSizeBuffer = 0;
+  CPAKFileIt = m_FileIndex.begin();
+  while (CPAKFileIt != m_FileIndex.end()) {
+	// El fichero actual TIENE que borrarse?
+	if (CCPAKFile::FILE_REMOVED == CPAKFileIt->second->State) {
+	  // Si, se elimina y se pasa a sig. iteracion
+	  delete CPAKFileIt->second;
+	  CPAKFileIt = m_FileIndex.erase(CPAKFileIt);
+	  m_HashBuckets.clear();
+	} else {
+	  // No, el tamao almacenado es mayor que valor actual de buffer?
+	  if (CPAKFileIt->second->udStoredSize > udSizeBuffer) {
+		// Si, se toma
+		udSizeBuffer = CPAKFileIt->second->udStoredSize;
+	  }
+	  ++CPAKFileIt;
+	}
+  }
+
+  // Flags base para la nueva apartura de los ficheros
+  const sword swBaseFlags = std::ios_base::in | std::ios_base::out | 
+							std::ios_base::binary;	
+
+  // No quedan ficheros?
+  if (m_FileIndex.empty()) {
+	// No quedan, luego se inicializan estructuras y archivos
+	// Se truncan ficheros temporales y actuales
+	m_File.close();
+	m_File.clear();
+	m_File.open(m_szFileName.c_str(), swBaseFlags | std::ios_base::trunc);
+	ASSERT(m_File.good());
+	m_FileTemp.close();	
+	m_FileTemp.clear();
+	m_FileTemp.open(m_szFileNameTemp.c_str(), swBaseFlags | std::ios_base::trunc);
+	ASSERT(m_FileTemp.good());
+
+    // Se actualiza la cabecera y se guarda en disco
+    m_CPAKHeader.udNumFiles = 0;
+    m_CPAKHeader.udOffsetIndex = 0;
+	m_CPAKHeader.udFlags &= ~CCPAKFile::HEADER_HASHINDEX;
+	m_CPAKHeader.ubVersionHi = CCPAKFile::VERSIONHI;
+	m_CPAKHeader.ubVersionLo = CCPAKFile::VERSIONLO;
+	m_File.clear();
+	m_File.seekp(0, std::ios_base::beg);
+    m_File.write((sbyte *)(&m_CPAKHeader), sizeof(m_CPAKHeader));
+  } else if (!bCompact) {
+	// Se aadiran los datos de los ficheros modificados al final del CPAK
+	// Nota: Hasta guardar la cabecera, el CPAK seguira siendo valido con el
+	// indice anterior
+	m_File.clear();
+	m_File.seekp(0, std::ios_base::end);
+	if (dword(m_File.tellp()) < sizeof(m_CPAKHeader)) {
+	  // CPAK nuevo, se reserva espacio para la cabecera
+	  m_File.seekp(0, std::ios_base::beg);
+	  m_File.write((sbyte *)(&m_CPAKHeader), sizeof(m_CPAKHeader));
+	}
+
+	// Se copian desde el temporal los datos de los ficheros modificados, 
+	// guardando una sola vez los datos compartidos
+	std::map<dword, dword> TempOffsets;
+	std::vector<sbyte> Buffer(CCPAKFile::COMPRESS_BLOCK_SIZE);
+	CPAKFileIt = m_FileIndex.begin();
+	for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
+	  // Fichero NO modificado?
+	  sNFile* const pFile = CPAKFileIt->second;
+	  if (CCPAKFile::FILE_MODIFY != pFile->State) {
+		continue;
+	  }
+
+	  // Datos NO guardados ya con otro nombre?
+	  const std::map<dword, dword>::iterator OffsetIt(TempOffsets.find(pFile->udFileOffset));
+	  if (OffsetIt == TempOffsets.end()) {
+		// No, se copian por partes
+		const dword udNewOffset = m_File.tellp();
+		dword udCopied = 0;
+		while (udCopied < pFile->udStoredSize) {
+		  dword udToCopy = pFile->udStoredSize - udCopied;
+		  if (udToCopy > Buffer.size()) {
+			udToCopy = Buffer.size();
+		  }
+		  m_FileTemp.clear();
+		  m_FileTemp.seekg(pFile->udFileOffset + udCopied);
+		  m_FileTemp.read(&Buffer[0], udToCopy);
+		  m_File.write(&Buffer[0], udToCopy);
+		  udCopied += udToCopy;
+		}
+		TempOffsets.insert(std::map<dword, dword>::value_type(pFile->udFileOffset, udNewOffset));
+		pFile->udFileOffset = udNewOffset;
+	  } else {
+		// Si, se comparten
+		pFile->udFileOffset = OffsetIt->second;
+	  }
+	  pFile->State = CCPAKFile::FILE_OK;
+	}
+
+	// Tras los datos se guarda el nuevo indice y, por ultimo, la cabecera
+	m_CPAKHeader.udOffsetIndex = m_File.tellp();
+	WriteFileIndex(m_File);
+	m_File.flush();
+	m_CPAKHeader.udNumFiles = m_FileIndex.size();
+	m_CPAKHeader.udFlags |= CCPAKFile::HEADER_HASHINDEX;
+	m_CPAKHeader.ubVersionHi = CCPAKFile::VERSIONHI;
+	m_CPAKHeader.ubVersionLo = CCPAKFile::VERSIONLO;
+	m_File.clear();
+	m_File.seekp(0, std::ios_base::beg);  
+	m_File.write((sbyte *)(&m_CPAKHeader), sizeof(m_CPAKHeader));
+	m_File.flush();
+	ASSERT(m_File.good());
+
+	// Se vacia el temporal y se vuelve a proyectar en memoria
+	m_FileTemp.close();	
+	m_FileTemp.clear();
+	m_FileTemp.open(m_szFileNameTemp.c_str(), swBaseFlags | std::ios_base::trunc);
+	ASSERT(m_FileTemp.good());
+	MapFile();
+  } else {
+	// Se reescribira el CPAK completo, en un nuevo fichero
+
+	// Se abre el fichero CPAK actualizado	
+	std::string szFileNameTemp(ChangeExtension(m_szFileName, "act"));
+	std::fstream NewFile(szFileNameTemp.c_str(), 
+						 swBaseFlags | std::ios_base::trunc);
+	ASSERT(NewFile.good());
+	
+	// Se prepara buffer temporal para lectura de informacion  
+	byte* pubBuffer = new byte [udSizeBuffer];
+	ASSERT(pubBuffer);  
+	
+	// Nuevos offsets de los datos ya guardados, segun su offset en el CPAK
+	// y en el temporal, para guardar una sola vez los datos compartidos
+	std::map<dword, dword> CPAKOffsets;
+	std::map<dword, dword> TempOffsets;
+
+	// Se procede a guardar los archivos en NewFile, dejando espacio para 
+	// la cabecera, que se guardara en ultimo lugar
+	NewFile.seekp(sizeof(m_CPAKHeader));
+	CPAKFileIt = m_FileIndex.begin();
+	for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
+	  // Los datos del fichero ya se guardaron con otro nombre?
+	  std::map<dword, dword>& Offsets = (CCPAKFile::FILE_OK == CPAKFileIt->second->State) ? CPAKOffsets : TempOffsets;
+	  const std::map<dword, dword>::iterator OffsetIt(Offsets.find(CPAKFileIt->second->udFileOffset));
+	  if (OffsetIt != Offsets.end()) {
+		// Si, se comparten
+		CPAKFileIt->second->udFileOffset = OffsetIt->second;
+		CPAKFileIt->second->State = CCPAKFile::FILE_OK;
+		continue;
+	  }
+	  const dword udOldOffset = CPAKFileIt->second->udFileOffset;
+
+	  // Se evalua estado del fichero actual	
+	  switch(CPAKFileIt->second->State) {
+		case CCPAKFile::FILE_OK: {
+		  // Hay que guardar el fichero tal cual 
+		  // Se lee desde el CPAK
+		  m_File.clear();
+		  m_File.seekg(CPAKFileIt->second->udFileOffset);
+		  m_File.read((sbyte *)(pubBuffer), CPAKFileIt->second->udStoredSize);
+		} break;
+
+		case CCPAKFile::FILE_MODIFY: {
+		  // Es un fichero modificado 
+		  // Se lee desde el temporal y se deja en estado "Ok"
+		  m_FileTemp.clear();
+		  m_FileTemp.seekg(CPAKFileIt->second->udFileOffset);
+		  m_FileTemp.read((sbyte *)(pubBuffer), CPAKFileIt->second->udStoredSize);      
+		  CPAKFileIt->second->State = CCPAKFile::FILE_OK;
+		} break;
+	  }; // ~ switch
+
+	  // Se actualiza los datos del fichero y se guarda la informacion
+	  CPAKFileIt->second->udFileOffset = NewFile.tellp();    
+	  NewFile.write((sbyte *)(pubBuffer), CPAKFileIt->second->udStoredSize);
+	  Offsets.insert(std::map<dword, dword>::value_type(udOldOffset, CPAKFileIt->second->udFileOffset));
+	}
+
+	// Se libera el buffer y se cierran y borran los ficheros originales
+	delete[udSizeBuffer] pubBuffer;
+	pubBuffer = NULL;
+	m_File.close();
+	remove(m_szFileName.c_str());
+	m_FileTemp.close();
+	remove(m_szFileNameTemp.c_str());	    
+	
+	// Se completa los datos de la cabecera con el offset para la tabla
+	// de indices y el numero de elementos y se guarda la cabecera  
+	m_CPAKHeader.udOffsetIndex = NewFile.tellp();
+	m_CPAKHeader.udNumFiles = m_FileIndex.size();
+	m_CPAKHeader.udFlags |= CCPAKFile::HEADER_HASHINDEX;
+	m_CPAKHeader.ubVersionHi = CCPAKFile::VERSIONHI;
+	m_CPAKHeader.ubVersionLo = CCPAKFile::VERSIONLO;
+	NewFile.clear();
+	NewFile.seekp(0, std::ios_base::beg);  
+	NewFile.write((sbyte *)(&m_CPAKHeader), sizeof(m_CPAKHeader));
+	
+	// Se procede a almacenar la informacion sobre el indice de ficheros, que
+	// ira siempre al final del todo
+	NewFile.clear();
+	NewFile.seekp(0, std::ios_base::end);  
+	WriteFileIndex(NewFile);
+	
+	// Se procede a cerrar NewFile y renombrarlo al nombre del fichero original    
+	NewFile.close();
+	szFileNameTemp = ChangeExtension(m_szFileName.c_str(), "act");
+	rename(szFileNameTemp.c_str(), m_szFileName.c_str());
+	
+	// Se vuelve a abrir el fichero CPAK y el temporal para trabajar
+	m_File.open(m_szFileName.c_str(), swBaseFlags);
+	m_FileTemp.open(m_szFileNameTemp.c_str(), swBaseFlags | std::ios_base::trunc);
+
+	// Y se vuelve a proyectar en memoria
+	MapFile();
+  }
+
+  // Se establece a off el flag de modificaciones y se sale
+  m_bFileModify = false;  
+  return true;  
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Guarda en File, en la posicion actual de escritura, el indice de 
+//   ficheros seguido de la tabla hash sobre el mismo.
+// Parametros:
+// - File: Fichero donde guardar.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CCPAKFile::WriteFileIndex(std::fstream& File)
+{
+  // Se guarda cada fichero
+  CPAKFileIndexMapIt CPAKFileIt(m_FileIndex.begin());
+  dword udIndexPos = 0;
+  for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt, ++udIndexPos) {
+	// Se guardara: longitud nombre del fichero, nombre fichero, tamao del mismo,
+	// offset en donde localizarlo, metodo de almacenamiento, tamao almacenado
+	// y CRC del contenido.
+	CPAKFileIt->second->udIndexPos = udIndexPos;
+	File.clear();
+	File.write((sbyte *)(&CPAKFileIt->second->ubFileNameSize), 
+			   sizeof(CPAKFileIt->second->ubFileNameSize));
+	File.write(CPAKFileIt->first.c_str(), 
+			   CPAKFileIt->second->ubFileNameSize);
+	File.write((sbyte *)(&CPAKFileIt->second->udFileSize), 
+			   sizeof(CPAKFileIt->second->udFileSize));        
+	File.write((sbyte *)(&CPAKFileIt->second->udFileOffset), 
+			   sizeof(CPAKFileIt->second->udFileOffset));
+	File.write((sbyte *)(&CPAKFileIt->second->ubCodec), 
+			   sizeof(CPAKFileIt->second->ubCodec));
+	File.write((sbyte *)(&CPAKFileIt->second->udStoredSize), 
+			   sizeof(CPAKFileIt->second->udStoredSize));
+	File.write((sbyte *)(&CPAKFileIt->second->udCRC), 
+			   sizeof(CPAKFileIt->second->udCRC));
+  }
+
+  // Tras el indice, se guarda la tabla hash sobre el mismo
+  if (m_HashBuckets.empty()) {
+	BuildHashIndex();
+  }
+  WriteHashIndex(File);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Calcula el espacio muerto del CPAK, esto es, el ocupado por datos e
+//   indices que ya no se utilizan.
+// Parametros:
+// Devuelve:
+// - El numero de bytes muertos.
+// Notas:
+// - Los cambios pendientes de UpdateChanges no se tendran en cuenta.
+///////////////////////////////////////////////////////////////////////////////
+dword 
+CCPAKFile::GetDeadSpace(void)
+{
+  // SOLO si hay fichero abierto
+  ASSERT(IsOpen());
+
+  // CPAK sin indice?
+  if (m_CPAKHeader.udOffsetIndex < sizeof(m_CPAKHeader)) {
+	return 0;
+  }
+
+  // Se descuenta, de la zona previa al indice, los datos en uso, contando
+  // una sola vez los datos compartidos
+  std::map<dword, dword> Offsets;
+  dword udLiveSize = sizeof(m_CPAKHeader);
+  CPAKFileIndexMapIt CPAKFileIt(m_FileIndex.begin());
+  for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
+	const sNFile* const pFile = CPAKFileIt->second;
+	if (CCPAKFile::FILE_MODIFY != pFile->State &&
+		Offsets.insert(std::map<dword, dword>::value_type(pFile->udFileOffset, 0)).second) {
+	  udLiveSize += pFile->udStoredSize;
+	}
+  }
+  return (m_CPAKHeader.udOffsetIndex > udLiveSize) ? m_CPAKHeader.udOffsetIndex - udLiveSize : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Realiza la lectura del contenido asociado a un fichero. La lectura se
+//   realiza en base al numero de bytes que se quieran leer. El buffer debera 
+//   de haber sido reservado desde el exterior.
+// Parametros:
+// - szFileName: Nombre del fichero.
+// - psbBuffer: Puntero al buffer de memoria.
+// - udBufferSize: Tamao del buffer.
+// - udInitOffset. Posicion inicial de lectura. Por defecto valdra 0 indicando
+//   que se quiere leer desde el principio.
+// Devuelve:
+// - El numbero de bytes leidos. Si se devuelve 0 es que ha existido algun
+//   problema o no se ha hallado el fichero.
+// Notas:
+// - En caso de que el tamao del fichero sea inferior a udBufferSize, se
+//   leeran solos los bytes asociados al tamao del fichero.
+// - En caso de que la posicion inicial este fuera del rango del tamao
+//   del fichero, no se leera nada y se devolvera 0.
+// - Si el fichero CPAK esta proyectado en memoria, la lectura sera una
+//   copia directa desde la vista.
+// - Si el fichero esta comprimido, solo se descomprimiran los bloques que
+//   contengan la zona a leer.
+///////////////////////////////////////////////////////////////////////////////
+dword 
+CCPAKFile::Read(const std::string& szFileName, 
+				sbyte* psbBuffer, 
+				const dword udBufferSize,
+				const dword udInitOffset)
+{
+  // SOLO si hay fichero abierto
+  ASSERT(IsOpen());
+  // SOLO si parametros correctos
+  ASSERT(psbBuffer);
+  ASSERT(!szFileName.empty());
+  ASSERT(udBufferSize);
+
+  // Se localiza nodo
+  const CPAKFileIndexMapIt CPAKFileIt(GetCPAKFileIt(szFileName));
+
+  // Se encontro el fichero?
+  if (CPAKFileIt != m_FileIndex.end()) {
+	// Si, se debe de comprobar su contenido y no es valido?
+	if (m_bVerifyOnRead && !CheckOnFirstRead(CPAKFileIt->second)) {
+	  return 0;
+	}
+
+	// Se acota la posicion de lectura en caso de que se quiera leer mas
+	// de lo que realmente hay desde la posicion de inicio de lectura
+	ASSERT((CPAKFileIt->second->udFileSize > udInitOffset) != 0);
+	const dword udValidZoneToRead = CPAKFileIt->second->udFileSize - udInitOffset;
+	dword udDataRead = udBufferSize;	
+	if (udDataRead > udValidZoneToRead) {
+	  udDataRead = udValidZoneToRead;
+	}
+
+	// Fichero comprimido?
+	if (CCPAKFile::CODEC_LZ == CPAKFileIt->second->ubCodec) {
+	  return ReadCompressed(CPAKFileIt->second, psbBuffer, udDataRead, udInitOffset);
+	}
+
+	// Se puede leer desde la proyeccion en memoria?
+	if (IsMappedFile(CPAKFileIt->second)) {
+	  // Si, se copia directamente
+	  memcpy(psbBuffer, 
+			 m_psbMapView + CPAKFileIt->second->udFileOffset + udInitOffset,
+			 udDataRead);
+	  return udDataRead;
+	}
+
+	// Se lee y se retorna la cantidad de bytes leidos
+	m_File.clear();
+	m_File.seekp(CPAKFileIt->second->udFileOffset + udInitOffset, std::ios::beg);  
+	m_File.read(psbBuffer, udDataRead);
+	return m_File.fail() ? 0 : udDataRead;
+  } else {
+	// No, leidos 0 bytes
+	return 0;
+  }  
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Metodo preparado para leer una linea a partir de un offset dado. Se
+//   considerara linea a la secuencia que termine en un retorno de carro '\r'
+//   seguido del caracter de nueva linea '\n'. Como se leera HASTA el caracter
+//   '\r' el de nueva linea no sera incluido, pero el numero real de caracteres
+//   leidos incluira a estos dos ultimos.
+// - En caso de que se lea la ultima linea, no existira caracter de retorno
+//   de carro ni de nueva linea, y la longitud sera unicamente la del numero de
+//   caracteres que tenga el string.
+// Parametros:
+// - hFile: Identificador del archivo desde donde leer.
+// - udInitOffset. Offset en donde comenzar a leer la informacion.
+// - szDest. String donde depositar la informacion leida.
+// Devuelve:
+// - El offset que se ha movido para leer
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+dword
+CCPAKFile::ReadLine(const std::string& szFileName, 
+				    const dword udInitOffset,
+				    std::string& szDest)
+{
+  // SOLO si hay fichero abierto
+  ASSERT(IsOpen());
+  // SOLO si parametros validos
+  ASSERT(!szFileName.empty());
+
+  // Se localiza nodo
+  const CPAKFileIndexMapIt CPAKFileIt(GetCPAKFileIt(szFileName));
+
+  // Fichero valido?
+  if (CPAKFileIt != m_FileIndex.end()) {
+	// Si, se debe de comprobar su contenido y no es valido?
+	if (m_bVerifyOnRead && !CheckOnFirstRead(CPAKFileIt->second)) {
+	  szDest.erase();
+	  return 0;
+	}
+
+	// Fichero comprimido?
+	if (CCPAKFile::CODEC_LZ == CPAKFileIt->second->ubCodec) {
+	  // Si, se recorren los bloques hasta hallar el fin de linea
+	  const sNFile* const pFile = CPAKFileIt->second;
+	  dword udPos = udInitOffset;
+	  szDest.erase();
+	  while (udPos < pFile->udFileSize) {
+		if (!LoadCompressedBlock(pFile, udPos / CCPAKFile::COMPRESS_BLOCK_SIZE)) {
+		  break;
+		}
+		const sbyte* const psbBlock = (const sbyte*)(&m_BlockCache[0]);
+		const sbyte* const psbBegin = psbBlock + udPos % CCPAKFile::COMPRESS_BLOCK_SIZE;
+		const sbyte* const psbEnd = psbBlock + m_udCachedBlockSize;
+		const sbyte* const psbNewLine = std::find(psbBegin, psbEnd, '\n');
+		szDest.append(psbBegin, psbNewLine - psbBegin);
+		udPos += psbNewLine - psbBegin;
+		if (psbNewLine != psbEnd) {
+		  // Se salta el caracter de nueva linea
+		  ++udPos;
+		  break;
+		}
+	  }
+
+	  // Se elimina el posible retorno de carro y se retorna
+	  if (!szDest.empty() && 
+		  '\r' == szDest[szDest.size() - 1]) {
+		szDest.resize(szDest.size() - 1);
+	  }	  
+	  return (udPos - udInitOffset);
+	}
+
+	// No, se puede leer desde la proyeccion en memoria?
+	if (IsMappedFile(CPAKFileIt->second)) {
+	  // Si, se localiza el fin de linea sin salir de los limites del fichero
+	  const sbyte* const psbData = m_psbMapView + CPAKFileIt->second->udFileOffset;
+	  const dword udFileSize = CPAKFileIt->second->udFileSize;
+	  dword udPos = udInitOffset;
+	  while (udPos < udFileSize && '\n' != psbData[udPos]) {
+		++udPos;
+	  }
+
+	  // Se toma la linea, eliminando el posible retorno de carro
+	  szDest.assign(psbData + udInitOffset, udPos - udInitOffset);
+	  if (!szDest.empty() && 
+		  '\r' == szDest[szDest.size() - 1]) {
+		szDest.resize(szDest.size() - 1);
+	  }	  
+
+	  // Se salta el caracter de nueva linea y se retorna el offset avanzado
+	  if (udPos < udFileSize) {
+		++udPos;
+	  }
+	  return (udPos - udInitOffset);
+	}
+
+	// No, se coloca cursor de lectura
+	m_File.clear();
+	m_File.seekg(CPAKFileIt->second->udFileOffset + udInitOffset,
+				 std::ios_base::beg);  
+
+	// Se leera una nueva linea, como antes de llegar a la nueva linea podra
+	// haberse incluido el retorno de carro, este sera eliminado del string
+	std::getline(m_File, szDest);
+	if (!szDest.empty() && 
+		'\r' == szDest[szDest.size() - 1]) {
+	  szDest.resize(szDest.size() - 1);
+	}	  
+	
+	// Se retorna el offset avanzado por el archivo
+	return (word(m_File.tellg()) - (CPAKFileIt->second->udFileOffset + udInitOffset));
+	//return (0 != m_File.eof()) ? szDest.size() + 2 : szDest.size();
+  } else {
+	// No, se leyeron 0 bytes
+	return 0;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Este metodo sobreescribe los datos de un fichero que se encuentre 
+//   almacenado en el archivo CPAK. Como no se puede sobreescribir directamente,
 //   se utilizara un fichero temporal en donde depositar los datos. Una llamada
 //   a UpdateChanges se encargara de hacer efectivos dichos cambios. En el 
 //   momento que un fichero es modificado no se podra trabajar con el hasta una
@@ -627,18 +1600,33 @@ CCPAKFile::Write(const std::string& szFileName,
   // El fichero existe y NO esta pendiente de ser borrado?
   if (CPAKFileIt != m_FileIndex.end() &&
 	  CCPAKFile::FILE_REMOVED == CPAKFileIt->second->State) {
-	// Se procede a guardar la nueva informacion en el fichero temporal  
-	m_FileTemp.clear();
-	m_FileTemp.seekp(0, std::ios_base::end);
-	const dword udFTempOffset = m_FileTemp.tellp();
-	m_FileTemp.write(psbBuffer, udBufferSize);
+	// Se procede a guardar la nueva informacion en el fichero temporal,
+	// comprimiendola si procede
+	BlockBuffer Packed;
+	if (IsCompressibleFile(szFileName)) {
+	  PackContent(psbBuffer, udBufferSize, Packed);
+	}
+	dword udFTempOffset;
+	dword udStoredSize;
+	byte ubCodec;
+	m_pCachedFile = NULL;
 
 	// Todo correcto?
-	if (m_FileTemp.good()) {
+	if (WriteToTemp(psbBuffer, 
+					udBufferSize, 
+					Packed, 
+					udFTempOffset, 
+					udStoredSize, 
+					ubCodec)) {
 	  // Si, se cambia atributos y el flag de modificacion y se retorna
 	  CPAKFileIt->second->State = FILE_MODIFY;
 	  CPAKFileIt->second->udFileOffset = udFTempOffset;
 	  CPAKFileIt->second->udFileSize = udBufferSize;  
+	  CPAKFileIt->second->udStoredSize = udStoredSize;
+	  CPAKFileIt->second->ubCodec = ubCodec;
+	  CPAKFileIt->second->udCRC = GetContentCRC(psbBuffer, udBufferSize);
+	  CPAKFileIt->second->bCRC = true;
+	  CPAKFileIt->second->bVerified = false;
 	  m_bFileModify = true;
 	  return true;
 	} else {
@@ -707,6 +1695,8 @@ CCPAKFile::Remove(const std::string& szFileName)
 //   operacion si este se encuentra en estado de eliminacion: FILE_REMOVED.
 //   En cualquier otro caso no se permitira la operacion, por tanto, no se
 //   permitira mediante esta operacion sobreescribir ficheros.
+// - Si el contenido del fichero ya se halla en el CPAK bajo otro nombre, no
+//   se volvera a guardar y ambos nombres compartiran los mismos datos.
 ///////////////////////////////////////////////////////////////////////////////
 bool 
 CCPAKFile::Add(const std::string& szFileName, 
@@ -729,39 +1719,127 @@ CCPAKFile::Add(const std::string& szFileName,
 	}	
   }
 
-  // No se encontro, luego se abre fichero para lectura  
-  std::fstream NewFile(szFileName.c_str(), 
-					   std::ios_base::in | std::ios_base::binary);
-  if (!NewFile.good()) { 
+  // Se lee el fichero de disco
+  // Nota: En caso de que el fichero tenga tamao 0, se abandonara
+  BlockBuffer Data;
+  if (!ReadDiskFile(szFileName, Data)) {
+	return false;
+  }
+
+  // Se comprime, si procede, y se aade su contenido
+  BlockBuffer Packed;
+  if (IsCompressibleFile(szFileName)) {
+	PackContent((const sbyte*)(&Data[0]), Data.size(), Packed);
+  }
+  if (!AddContent(szFileName, 
+				  CPAKFileIt,
+				  Data, 
+				  GetContentCRC((const sbyte*)(&Data[0]), Data.size()), 
+				  Packed)) {
+	return false;
+  }
+
+  // Hay que eliminar el fichero aadido?
+  if (bRemoveFromDisk) { 
+	// Se elimina szFileName
+    remove(szFileName.c_str());
+  }  
+    
+  // Todo correcto
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee por completo un fichero de disco.
+// Parametros:
+// - szFileName: Nombre del fichero.
+// - Data: Buffer donde depositar el contenido.
+// Devuelve:
+// - Si se ha podido leer y no esta vacio true. En caso contrario false.
+// Notas:
+// - Se podra llamar desde varios hilos a la vez.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::ReadDiskFile(const std::string& szFileName,
+						BlockBuffer& Data)
+{
+  // Se abre el fichero para lectura  
+  Data.clear();
+  std::fstream File(szFileName.c_str(), 
+					std::ios_base::in | std::ios_base::binary);
+  if (!File.good()) { 
 	return false; 
   }
 
-  // Se obtiene el tamao del buffer para leer el fichero
-  // Nota: En caso de que el fichero tenga tamao 0, se abandonara
-  NewFile.seekg(0, std::ios_base::end);
-  const dword udSizeBuffer = NewFile.tellg();
-  if (0 == udSizeBuffer) {
+  // Se obtiene su tamao
+  File.seekg(0, std::ios_base::end);
+  const dword udSize = File.tellg();
+  if (0 == udSize) {
 	return false;
   }
 
-  // Se prepara espacio necesario para realizar la lectura de datos y se cierra
-  byte* pubBuffer = new byte[udSizeBuffer];
-  ASSERT(pubBuffer);
-  NewFile.clear();
-  NewFile.seekg(0, std::ios_base::beg);
-  NewFile.read((sbyte *)(pubBuffer), udSizeBuffer);  
-  NewFile.close();
-  
-  // Se procede a escribir en el temporal, siempre por el final
-  m_FileTemp.clear();
-  m_FileTemp.seekp(0, std::ios_base::end);
-  const dword udFTempOffset = dword(m_FileTemp.tellp());  
-  m_FileTemp.write((sbyte *)(pubBuffer), udSizeBuffer); 
-  ASSERT(m_FileTemp.fail());  
+  // Se lee
+  Data.resize(udSize);
+  File.clear();
+  File.seekg(0, std::ios_base::beg);
+  File.read((sbyte *)(&Data[0]), udSize);  
+  return !File.fail();
+}
 
-  // Se libera buffer
-  delete[udSizeBuffer] pubBuffer;
-  pubBuffer = NULL;
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Aade al CPAK el contenido de un fichero ya leido de disco. Si el 
+//   contenido ya se halla en el CPAK bajo otro nombre, se compartiran los
+//   datos almacenados.
+// Parametros:
+// - szFileName: Nombre del fichero.
+// - CPAKFileIt: Iterador al fichero en el indice o m_FileIndex.end() si
+//   no estaba registrado.
+// - Data: Contenido del fichero.
+// - udCRC: CRC del contenido.
+// - Packed: Contenido comprimido con PackContent o vacio si no se comprime.
+// Devuelve:
+// - Si se ha podido aadir true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::AddContent(const std::string& szFileName,
+					  const CPAKFileIndexMapIt& CPAKFileIt,
+					  const BlockBuffer& Data,
+					  const dword udCRC,
+					  const BlockBuffer& Packed)
+{
+  // SOLO si parametros validos
+  ASSERT(!Data.empty());
+
+  // Se busca si el contenido ya esta almacenado con otro nombre
+  const sbyte* const psbData = (const sbyte*)(&Data[0]);
+  const sNFile* const pSameFile = FindSameContent(psbData, Data.size(), udCRC);
+
+  // Contenido ya almacenado?
+  dword udFTempOffset;
+  dword udStoredSize;
+  byte ubCodec;
+  FileState State = CCPAKFile::FILE_MODIFY;
+  if (pSameFile) {
+	// Si, se compartiran sus datos
+	udFTempOffset = pSameFile->udFileOffset;
+	udStoredSize = pSameFile->udStoredSize;
+	ubCodec = pSameFile->ubCodec;
+	State = pSameFile->State;
+  } else {
+	// No, se procede a escribir en el temporal
+	m_pCachedFile = NULL;
+	if (!WriteToTemp(psbData, 
+					 Data.size(), 
+					 Packed,
+					 udFTempOffset, 
+					 udStoredSize, 
+					 ubCodec)) {
+	  return false;
+	}
+  }
 
   // Se toma el nodo asociado al fichero
   // Estaba registrado el fichero?
@@ -776,21 +1854,23 @@ CCPAKFile::Add(const std::string& szFileName,
 	ASSERT(pFileNode);	
 	std::string szFileNameLowercase(szFileName);
 	std::transform(szFileNameLowercase.begin(), szFileNameLowercase.end(), szFileNameLowercase.begin(), tolower);
-	m_FileIndex.insert(CPAKFileIndexMapValType(szFileNameLowercase, pFileNode));
+	pFileNode->It = m_FileIndex.insert(CPAKFileIndexMapValType(szFileNameLowercase, pFileNode)).first;
+	InsertInHashIndex(pFileNode);
   }
 
   // Se procede a actualizar atributos del fichero
-  pFileNode->State = FILE_MODIFY;
+  // Nota: Si se comparten datos, el offset se referira al CPAK o al 
+  // temporal segun el estado del fichero con el que se compartan
+  pFileNode->State = State;
   pFileNode->ubFileNameSize = szFileName.size() + 1; // donde +1 = '\0'
   pFileNode->udFileOffset = udFTempOffset;
-  pFileNode->udFileSize = udSizeBuffer;
+  pFileNode->udFileSize = Data.size();
+  pFileNode->udStoredSize = udStoredSize;
+  pFileNode->ubCodec = ubCodec;
+  pFileNode->udCRC = udCRC;
+  pFileNode->bCRC = true;
+  pFileNode->bVerified = (NULL != pSameFile);
 
-  // Hay que eliminar el fichero aadido?
-  if (bRemoveFromDisk) { 
-	// Se elimina szFileName
-    remove(szFileName.c_str());
-  }  
-    
   // Se activa flag de modificacion y se retorna  
   m_bFileModify = true;
   return true;
@@ -838,27 +1918,15 @@ CCPAKFile::Extract(const std::string& szFileName,
 	return false;
   }
 
-  // Se busca el directorio de donde cuelga el archivo y en caso de no
-  // ser la raiz, sera creado para guardar ahi el archivo.
-  word uwDirItBeg = 0;
-  word uwDirItEnd = 0;
-  std::string szPath;
-  for (; uwDirItEnd < CPAKFileIt->first.size(); ++uwDirItEnd) {
-	if (CPAKFileIt->first[uwDirItEnd] == '\\') {	  
-	  szPath += szFileName.substr(uwDirItBeg, uwDirItEnd - uwDirItBeg) + '\\';
-	  CreateDirectory(szPath.c_str(), NULL);
-	  uwDirItBeg = uwDirItEnd + 1;
-	}
-  }
+  // Se crea, si procede, el directorio de donde cuelga el archivo
+  CreateFileDirectory(szFileName);
 
   // Se crea el buffer donde alojar la informacion
   sbyte* pubBuffer = new sbyte[CPAKFileIt->second->udFileSize];
   ASSERT(pubBuffer);
 
-  // Se del fichero la informacion
-  m_File.clear();
-  m_File.seekp(CPAKFileIt->second->udFileOffset, std::ios::beg);  
-  m_File.read((sbyte *)(pubBuffer), CPAKFileIt->second->udFileSize);
+  // Se lee del fichero la informacion, descomprimiendola si procede
+  Read(szFileName, pubBuffer, CPAKFileIt->second->udFileSize);
   
   // Se crea el nuevo fichero y se vuelca la informacion leida
   std::fstream FileCreated(szFileName.c_str(), 
@@ -878,22 +1946,415 @@ CCPAKFile::Extract(const std::string& szFileName,
   return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Crea los directorios de donde cuelga un archivo, en caso de que no 
+//   cuelgue de la raiz.
+// Parametros:
+// - szFileName: Nombre del archivo.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CCPAKFile::CreateFileDirectory(const std::string& szFileName)
+{
+  // Se crea cada directorio del camino
+  word uwDirItBeg = 0;
+  word uwDirItEnd = 0;
+  std::string szPath;
+  for (; uwDirItEnd < szFileName.size(); ++uwDirItEnd) {
+	if (szFileName[uwDirItEnd] == '\\') {	  
+	  szPath += szFileName.substr(uwDirItBeg, uwDirItEnd - uwDirItBeg) + '\\';
+	  CreateDirectory(szPath.c_str(), NULL);
+	  uwDirItBeg = uwDirItEnd + 1;
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Aade una lista de ficheros de disco. La lectura, el calculo del CRC y
+//   la compresion de los ficheros se repartira entre ubNumThreads hilos, 
+//   mientras que su incorporacion al CPAK se realizara en el orden de la
+//   lista.
+// Parametros:
+// - Files: Ficheros a aadir.
+// - ubNumThreads: Numero de hilos a utilizar. Por defecto 1.
+// Devuelve:
+// - El numero de ficheros aadidos.
+// Notas:
+// - El resultado sera identico con independencia del numero de hilos.
+// - Los ficheros se procesaran por tandas, para no tener en memoria mas de
+//   BATCH_JOBS_PER_THREAD ficheros por hilo.
+///////////////////////////////////////////////////////////////////////////////
+dword 
+CCPAKFile::AddFiles(const std::list<std::string>& Files,
+					const byte ubNumThreads)
+{
+  // SOLO si CPAK abierto
+  ASSERT(IsOpen());
+
+  // Se procesan los ficheros por tandas
+  const dword udBatchSize = (ubNumThreads ? ubNumThreads : 1) * CCPAKFile::BATCH_JOBS_PER_THREAD;
+  dword udFilesInserted = 0;
+  std::list<std::string>::const_iterator FileIt(Files.begin());
+  while (FileIt != Files.end()) {
+	// Se prepara la tanda
+	sBatch Batch(this, false);
+	Batch.Jobs.reserve(udBatchSize);
+	for (; FileIt != Files.end() && Batch.Jobs.size() < udBatchSize; ++FileIt) {
+	  Batch.Jobs.push_back(sBatchJob(*FileIt, NULL));
+	}
+
+	// Se leen y comprimen en paralelo
+	RunBatch(Batch, ubNumThreads);
+
+	// Y se aaden en orden
+	std::vector<sBatchJob>::iterator JobIt(Batch.Jobs.begin());
+	for (; JobIt != Batch.Jobs.end(); ++JobIt) {
+	  // Fichero leido?
+	  if (JobIt->bOk) {
+		// Si, NO esta en estado de eliminacion y se puede aadir?
+		const CPAKFileIndexMapIt CPAKFileIt(GetCPAKFileIt(JobIt->szFileName));
+		if ((CPAKFileIt == m_FileIndex.end() || 
+			 CCPAKFile::FILE_REMOVED != CPAKFileIt->second->State) &&
+			AddContent(JobIt->szFileName, 
+					   CPAKFileIt, 
+					   JobIt->Data, 
+					   JobIt->udCRC, 
+					   JobIt->Packed)) {
+		  ++udFilesInserted;
+		}
+	  }
+	}
+  }
+
+  // Se retorna el numero de ficheros aadidos
+  return udFilesInserted;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Extrae una lista de ficheros a disco, repartiendo la descompresion y la
+//   escritura entre ubNumThreads hilos.
+// Parametros:
+// - Files: Ficheros a extraer.
+// - ubNumThreads: Numero de hilos a utilizar. Por defecto 1.
+// Devuelve:
+// - El numero de ficheros extraidos.
+// Notas:
+// - Los hilos solo podran trabajar sobre la proyeccion en memoria, por lo
+//   que si el CPAK no esta proyectado se extraera desde este hilo.
+///////////////////////////////////////////////////////////////////////////////
+dword 
+CCPAKFile::ExtractFiles(const std::list<std::string>& Files,
+						const byte ubNumThreads)
+{
+  // SOLO si CPAK abierto
+  ASSERT(IsOpen());
+
+  // Se procesan los ficheros por tandas
+  const dword udBatchSize = (ubNumThreads ? ubNumThreads : 1) * CCPAKFile::BATCH_JOBS_PER_THREAD;
+  dword udFilesExtracted = 0;
+  std::list<std::string>::const_iterator FileIt(Files.begin());
+  while (FileIt != Files.end()) {
+	// Se prepara la tanda con los ficheros que esten en la proyeccion, 
+	// extrayendo el resto directamente
+	sBatch Batch(this, true);
+	Batch.Jobs.reserve(udBatchSize);
+	for (; FileIt != Files.end() && Batch.Jobs.size() < udBatchSize; ++FileIt) {
+	  const CPAKFileIndexMapIt CPAKFileIt(GetCPAKFileIt(*FileIt));
+	  if (ubNumThreads > 1 &&
+		  CPAKFileIt != m_FileIndex.end() && 
+		  IsMappedFile(CPAKFileIt->second)) {
+		CreateFileDirectory(*FileIt);
+		Batch.Jobs.push_back(sBatchJob(*FileIt, CPAKFileIt->second));
+	  } else if (Extract(*FileIt)) {
+		++udFilesExtracted;
+	  }
+	}
+
+	// Se extraen en paralelo y se cuentan
+	RunBatch(Batch, ubNumThreads);
+	std::vector<sBatchJob>::iterator JobIt(Batch.Jobs.begin());
+	for (; JobIt != Batch.Jobs.end(); ++JobIt) {
+	  if (JobIt->bOk) {
+		++udFilesExtracted;
+	  }
+	}
+  }
+
+  // Se retorna el numero de ficheros extraidos
+  return udFilesExtracted;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Realiza los trabajos de una tanda, repartiendolos entre ubNumThreads
+//   hilos. El hilo que llama sera uno de ellos.
+// Parametros:
+// - Batch: Tanda de trabajos.
+// - ubNumThreads: Numero de hilos.
+// Devuelve:
+// Notas:
+// - Se retornara cuando todos los trabajos se hayan completado.
+// - Los trabajos reservan memoria y usan streams, por lo que los hilos
+//   adicionales SOLO se lanzaran si se enlaza con la CRT multihilo (/MT,
+//   /MTd) y siempre a traves de _beginthreadex. Con la CRT de un solo hilo
+//   todos los trabajos se realizaran desde el hilo que llama.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CCPAKFile::RunBatch(sBatch& Batch,
+					const byte ubNumThreads)
+{
+  // Se acota el numero de hilos
+  dword udNumThreads = ubNumThreads;
+  if (udNumThreads > CCPAKFile::BATCH_MAX_THREADS) {
+	udNumThreads = CCPAKFile::BATCH_MAX_THREADS;
+  }
+  if (udNumThreads > Batch.Jobs.size()) {
+	udNumThreads = Batch.Jobs.size();
+  }
+
+  // Se construye la tabla CRC antes de lanzar los hilos
+  GetCRCTable();
+
+  // Se lanzan los hilos adicionales
+  std::vector<HANDLE> Threads;
+  #ifdef _MT
+  dword udIt = 1;
+  for (; udIt < udNumThreads; ++udIt) {
+	unsigned uIDThread;
+	const HANDLE hThread = HANDLE(_beginthreadex(NULL, 0, &tCPAKBatchWork, &Batch, 0, &uIDThread));
+	if (hThread) {
+	  Threads.push_back(hThread);
+	}
+  }
+  #endif
+
+  // Se trabaja desde este hilo y se espera al resto
+  tCPAKBatchWork(&Batch);
+  std::vector<HANDLE>::iterator ThreadIt(Threads.begin());
+  for (; ThreadIt != Threads.end(); ++ThreadIt) {
+	WaitForSingleObject(*ThreadIt, INFINITE);
+	CloseHandle(*ThreadIt);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee un fichero de disco, calcula su CRC y lo comprime si procede.
+// Parametros:
+// - Job: Trabajo a realizar.
+// Devuelve:
+// Notas:
+// - Se llamara desde los hilos de trabajo, por lo que no se accedera a 
+//   ningun miembro.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CCPAKFile::PrepareAddJob(sBatchJob& Job)
+{
+  // Se lee el fichero
+  Job.bOk = false;
+  if (!ReadDiskFile(Job.szFileName, Job.Data)) {
+	return;
+  }
+
+  // Se calcula su CRC y se comprime
+  const sbyte* const psbData = (const sbyte*)(&Job.Data[0]);
+  Job.udCRC = GetContentCRC(psbData, Job.Data.size());
+  if (IsCompressibleFile(Job.szFileName)) {
+	PackContent(psbData, Job.Data.size(), Job.Packed);
+  }
+  Job.bOk = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Extrae a disco un fichero, desde la proyeccion en memoria.
+// Parametros:
+// - Job: Trabajo a realizar.
+// Devuelve:
+// Notas:
+// - Se llamara desde los hilos de trabajo, por lo que solo se accedera a
+//   la proyeccion, que no se modificara mientras duren los trabajos.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CCPAKFile::ExtractJob(sBatchJob& Job) const
+{
+  // SOLO si parametros validos
+  ASSERT(Job.pFile);
+
+  // Se toma el contenido, descomprimiendolo si procede
+  Job.bOk = false;
+  const sNFile* const pFile = Job.pFile;
+  const sbyte* psbContent = m_psbMapView + pFile->udFileOffset;
+  if (CCPAKFile::CODEC_LZ == pFile->ubCodec) {
+	Job.Data.resize(pFile->udFileSize);
+	if (!UnpackContent((const byte*)(psbContent), 
+					   pFile->udStoredSize, 
+					   &Job.Data[0], 
+					   pFile->udFileSize)) {
+	  return;
+	}
+	psbContent = (const sbyte*)(&Job.Data[0]);
+  }
+
+  // Contenido alterado?
+  if (pFile->bCRC && 
+	  pFile->udFileSize &&
+	  pFile->udCRC != GetContentCRC(psbContent, pFile->udFileSize)) {
+	return;
+  }
+
+  // Se crea el nuevo fichero y se vuelca
+  std::fstream FileCreated(Job.szFileName.c_str(), 
+						   std::ios_base::out | std::ios_base::trunc | 
+						   std::ios_base::binary);
+  FileCreated.write(psbContent, pFile->udFileSize);
+  Job.bOk = FileCreated.good();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Descomprime por completo los datos almacenados de un fichero 
+//   comprimido.
+// Parametros:
+// - pubStored, udStoredSize: Datos almacenados y su tamao.
+// - pubDest, udSize: Destino y tamao del fichero sin comprimir.
+// Devuelve:
+// - Si los datos son validos y se han descomprimido true. En caso 
+//   contrario false.
+// Notas:
+// - Se podra llamar desde varios hilos a la vez.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::UnpackContent(const byte* const pubStored,
+						 const dword udStoredSize,
+						 byte* const pubDest,
+						 const dword udSize)
+{
+  // SOLO si parametros validos
+  ASSERT(pubStored);
+  ASSERT(pubDest);
+
+  // Tabla de bloques fuera de los datos?
+  const dword udNumBlocks = (udSize + CCPAKFile::COMPRESS_BLOCK_SIZE - 1) / CCPAKFile::COMPRESS_BLOCK_SIZE;
+  const dword udTableSize = udNumBlocks * sizeof(dword);
+  if (udTableSize > udStoredSize) {
+	return false;
+  }
+
+  // Se descomprime cada bloque
+  dword udBlockBegin = 0;
+  dword udBlock = 0;
+  for (; udBlock < udNumBlocks; ++udBlock) {
+	// Se obtiene el bloque y se comprueba que sea valido
+	dword udBlockEnd;
+	memcpy(&udBlockEnd, pubStored + udBlock * sizeof(dword), sizeof(dword));
+	dword udBlockSize = udSize - udBlock * CCPAKFile::COMPRESS_BLOCK_SIZE;
+	if (udBlockSize > CCPAKFile::COMPRESS_BLOCK_SIZE) {
+	  udBlockSize = CCPAKFile::COMPRESS_BLOCK_SIZE;
+	}
+	if (udBlockEnd < udBlockBegin ||
+		udBlockEnd - udBlockBegin > udBlockSize ||
+		udBlockEnd > udStoredSize - udTableSize) {
+	  return false;
+	}
+
+	// Se descomprime o, si no se redujo, se copia
+	const byte* const pubPacked = pubStored + udTableSize + udBlockBegin;
+	byte* const pubBlockDest = pubDest + udBlock * CCPAKFile::COMPRESS_BLOCK_SIZE;
+	const dword udPackedSize = udBlockEnd - udBlockBegin;
+	if (udPackedSize == udBlockSize) {
+	  memcpy(pubBlockDest, pubPacked, udBlockSize);
+	} else if (!CLZCodec::Decompress(pubPacked, udPackedSize, pubBlockDest, udBlockSize)) {
+	  return false;
+	}
+	udBlockBegin = udBlockEnd;
+  }
+
+  // Todo correcto
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el numero de procesadores del sistema, para usarlo como numero
+//   de hilos en las operaciones por lotes.
+// Parametros:
+// Devuelve:
+// - El numero de procesadores, acotado a BATCH_MAX_THREADS.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+byte 
+CCPAKFile::GetNumProcessors(void)
+{
+  // Se obtiene y acota
+  SYSTEM_INFO SystemInfo;
+  GetSystemInfo(&SystemInfo);
+  if (SystemInfo.dwNumberOfProcessors < 1) {
+	return 1;
+  } else if (SystemInfo.dwNumberOfProcessors > CCPAKFile::BATCH_MAX_THREADS) {
+	return CCPAKFile::BATCH_MAX_THREADS;
+  }
+  return byte(SystemInfo.dwNumberOfProcessors);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Funcion de los hilos de trabajo de las operaciones por lotes. Tomara 
+//   trabajos de la tanda hasta que no quede ninguno.
+// Parametros:
+// - pParams: Tanda de trabajos (sBatch).
+// Devuelve:
+// Notas:
+// - Se lanzara con _beginthreadex, ver RunBatch.
+///////////////////////////////////////////////////////////////////////////////
+unsigned
+__stdcall tCPAKBatchWork(void* pParams)
+{
+  // Inicializaciones
+  ASSERT(pParams);
+  CCPAKFile::sBatch* const pBatch = (CCPAKFile::sBatch*)(pParams);
+
+  // Se toman trabajos hasta agotarlos
+  for (;;) {
+	const long lJob = InterlockedExchangeAdd((LPLONG)(&pBatch->lNextJob), 1);
+	if (lJob >= long(pBatch->Jobs.size())) {
+	  break;
+	}
+	if (pBatch->bExtract) {
+	  pBatch->pCPAKFile->ExtractJob(pBatch->Jobs[lJob]);
+	} else {
+	  CCPAKFile::PrepareAddJob(pBatch->Jobs[lJob]);
+	}
+  }
+
+  // Todo correcto
+  return 1;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Aade ficheros en virtud de su extension, aadiendose todos los ficheros
 //   que se encuentren con dicha extension. 
-// - Este metodo se limitara a naventar entre los ficheros, dejando la 
-//   verdadera responsabilidad al metodo Add.
+// - Este metodo se limitara a navegar entre los ficheros, dejando la 
+//   verdadera responsabilidad al metodo AddFiles.
 // Parametros:
 // - szDirectory. Directorio.
 // - szExtension. Extension.
+// - ubNumThreads: Numero de hilos a utilizar. Por defecto 1.
 // Devuelve:
 // - El numero de ficheros aadidos.
 // Notas:
+// - Los ficheros se aadiran ordenados por nombre, para que el resultado
+//   no dependa del orden en que los devuelva el sistema.
 ///////////////////////////////////////////////////////////////////////////////
 dword 
 CCPAKFile::AddFilesByExtension(const std::string& szDirectory,
-							   const std::string& szExtension)
+							   const std::string& szExtension,
+							   const byte ubNumThreads)
 {
   // SOLO si CPAK abierto
   ASSERT(IsOpen());
@@ -910,19 +2371,19 @@ CCPAKFile::AddFilesByExtension(const std::string& szDirectory,
   dword udFilesInserted = 0;
   const long hFile = _findfirst(szFiles.c_str(), &FileInfo);
   if (-1L != hFile) {
-	// Si se localizo el fichero, se procede a registrar y a iniciar
-	// el resgistro del resto de ficheros.
-	// Nota: se aadiran sin borrarse de disco	
+	// Si se localizo el fichero, se procede a tomar el resto de ficheros
+	// Nota: el nombre del fichero debera de tener como prefijo el directorio
+	std::list<std::string> Files;
 	do {
-	  // Se aade fichero y se incrementa contador si procede
-	  // Nota: el nombre del fichero debera de tener como prefijo el directorio
-	  if (Add(szDirectory + FileInfo.name, false)) {
-		++udFilesInserted;
-	  }
+	  Files.push_back(szDirectory + FileInfo.name);
 	} while((0 == _findnext(hFile, &FileInfo)));
 
 	// Se cierra estructura
 	_findclose(hFile);
+
+	// Se aaden, sin borrarse de disco
+	Files.sort();
+	udFilesInserted = AddFiles(Files, ubNumThreads);
   }
 
   // Se retorna el numero de ficheros aadido
@@ -932,27 +2393,38 @@ CCPAKFile::AddFilesByExtension(const std::string& szDirectory,
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Extrae todos los ficheros que se encuentren embebidos en el CPAK. Para
-//   ello, bastara con hacer un recorrido y llamar al metodo Extract.
+//   ello, bastara con hacer un recorrido y llamar al metodo Extract o, si 
+//   no hay que eliminarlos, al metodo ExtractFiles.
 // - Una vez que se hayan borrado todos, se llamara a UpdateChanges.
 // Parametros:
 // - bRemoveFromCPAK. Se desea eliminar a los archivos del CPAK?
+// - ubNumThreads: Numero de hilos a utilizar. Por defecto 1.
 // Devuelve:
 // - La cantidad de ficheros extraidos
 // Notas:
 ///////////////////////////////////////////////////////////////////////////////
 dword
-CCPAKFile::ExtractAll(const bool bRemoveFromCPAK)
+CCPAKFile::ExtractAll(const bool bRemoveFromCPAK,
+					  const byte ubNumThreads)
 {
   // SOLO si hay fichero abierto
   ASSERT(IsOpen());
 
-  // Se procede a recorrer el indice de ficheros extrayendolos
+  // Hay que eliminar los ficheros?
   dword udFilesExtracted = 0;
-  CPAKFileIndexMapIt CPAKFileIt(m_FileIndex.begin());
-  for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
-	if (Extract(CPAKFileIt->first, bRemoveFromCPAK)) {
-	  ++udFilesExtracted;
+  if (bRemoveFromCPAK) {
+	// Si, se procede a recorrer el indice de ficheros extrayendolos
+	CPAKFileIndexMapIt CPAKFileIt(m_FileIndex.begin());
+	for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
+	  if (Extract(CPAKFileIt->first, bRemoveFromCPAK)) {
+		++udFilesExtracted;
+	  }
 	}
+  } else {
+	// No, se extraen por lotes
+	std::list<std::string> Files;
+	GetFileList(Files);
+	udFilesExtracted = ExtractFiles(Files, ubNumThreads);
   }
 
   // Actualiza cambios y retorna la cantidad de ficheros extraidos
@@ -1032,6 +2504,243 @@ CCPAKFile::GetFileSize(const std::string& szFileName)
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el contenido de un fichero embebido en el CPAK sin realizar
+//   copia alguna, directamente desde la proyeccion en memoria.
+// Parametros:
+// - szFileName: Nombre del fichero.
+// - udSize: Referencia en donde depositar el tamao del fichero.
+// Devuelve:
+// - Puntero al contenido del fichero o NULL si no se hallo el fichero, no
+//   esta en estado OK, esta comprimido o el CPAK no esta proyectado en 
+//   memoria. En ese caso, el contenido se debera de obtener con Read.
+// Notas:
+// - El puntero sera valido mientras no se cierre el CPAK ni se llame a 
+//   UpdateChanges.
+///////////////////////////////////////////////////////////////////////////////
+const sbyte* const
+CCPAKFile::GetFileData(const std::string& szFileName,
+					   dword& udSize)
+{
+  // SOLO si hay fichero abierto
+  ASSERT(IsOpen());
+  // SOLO si parametros validos
+  ASSERT(!szFileName.empty());
+
+  // Se localiza nodo
+  const CPAKFileIndexMapIt CPAKFileIt(GetCPAKFileIt(szFileName));
+
+  // Se encontro fichero, sin comprimir, Y se halla en la proyeccion?
+  if (CPAKFileIt != m_FileIndex.end() &&
+	  CCPAKFile::CODEC_NONE == CPAKFileIt->second->ubCodec &&
+	  IsMappedFile(CPAKFileIt->second) &&
+	  (!m_bVerifyOnRead || CheckOnFirstRead(CPAKFileIt->second))) {
+	// Si, se retorna la vista sobre el contenido
+	udSize = CPAKFileIt->second->udFileSize;
+	return (m_psbMapView + CPAKFileIt->second->udFileOffset);
+  } else {
+	// No
+	udSize = 0;
+	return NULL;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene los datos almacenados de un fichero embebido en el CPAK, esten
+//   o no comprimidos, directamente desde la proyeccion en memoria.
+// Parametros:
+// - szFileName: Nombre del fichero.
+// - udStoredSize: Referencia en donde depositar el tamao almacenado.
+// - udSize: Referencia en donde depositar el tamao del fichero.
+// - bCompressed: Referencia en donde depositar si esta comprimido.
+// Devuelve:
+// - Puntero a los datos almacenados o NULL si no se hallo el fichero, no
+//   esta en estado OK o el CPAK no esta proyectado en memoria.
+// Notas:
+// - Los datos comprimidos se podran obtener con UnpackContent, incluso
+//   desde otro hilo, pues la vista no se modificara mientras no se cierre
+//   el CPAK ni se llame a UpdateChanges.
+///////////////////////////////////////////////////////////////////////////////
+const sbyte* const
+CCPAKFile::GetStoredData(const std::string& szFileName,
+						 dword& udStoredSize,
+						 dword& udSize,
+						 bool& bCompressed)
+{
+  // SOLO si hay fichero abierto
+  ASSERT(IsOpen());
+  // SOLO si parametros validos
+  ASSERT(!szFileName.empty());
+
+  // Se localiza nodo
+  const CPAKFileIndexMapIt CPAKFileIt(GetCPAKFileIt(szFileName));
+
+  // Se encontro fichero Y se halla en la proyeccion?
+  if (CPAKFileIt != m_FileIndex.end() &&
+	  IsMappedFile(CPAKFileIt->second) &&
+	  (!m_bVerifyOnRead || CheckOnFirstRead(CPAKFileIt->second))) {
+	// Si, se retorna la vista sobre los datos almacenados
+	udStoredSize = CPAKFileIt->second->udStoredSize;
+	udSize = CPAKFileIt->second->udFileSize;
+	bCompressed = (CCPAKFile::CODEC_LZ == CPAKFileIt->second->ubCodec);
+	return (m_psbMapView + CPAKFileIt->second->udFileOffset);
+  } else {
+	// No
+	udStoredSize = 0;
+	udSize = 0;
+	bCompressed = false;
+	return NULL;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Proyecta en memoria, para lectura, el contenido del fichero CPAK.
+// Parametros:
+// Devuelve:
+// - Si se ha podido proyectar true. En caso contrario false.
+// Notas:
+// - Un fallo en la proyeccion no sera un error; las lecturas se realizaran
+//   en tal caso a traves de m_File.
+// - El fichero se abre compartido para que m_File pueda seguir trabajando.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::MapFile(void)
+{
+  // SOLO si el fichero CPAK esta abierto
+  ASSERT(m_File.is_open());
+
+  // Ya estaba proyectado?
+  if (IsMapped()) {
+	return true;
+  }
+
+  // Se abre el fichero para la proyeccion
+  m_hMapFile = CreateFile(m_szFileName.c_str(),
+						  GENERIC_READ,
+						  FILE_SHARE_READ | FILE_SHARE_WRITE,
+						  NULL,
+						  OPEN_EXISTING,
+						  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+						  NULL);
+  if (INVALID_HANDLE_VALUE == m_hMapFile) {
+	m_hMapFile = NULL;
+	return false;
+  }
+
+  // Se obtiene el tamao; un fichero vacio no se puede proyectar
+  m_udMapSize = ::GetFileSize(m_hMapFile, NULL);
+  if (0 == m_udMapSize || 0xFFFFFFFF == m_udMapSize) {
+	UnmapFile();
+	return false;
+  }
+
+  // Se crea la proyeccion y se obtiene la vista sobre todo el fichero
+  m_hMapping = CreateFileMapping(m_hMapFile, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (NULL == m_hMapping) {
+	UnmapFile();
+	return false;
+  }
+  m_psbMapView = (const sbyte*)(MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0));
+  if (NULL == m_psbMapView) {
+	UnmapFile();
+	return false;
+  }
+
+  // Todo correcto
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Libera la proyeccion en memoria del fichero CPAK, si la hubiera.
+// Parametros:
+// Devuelve:
+// Notas:
+// - A partir de este momento, las lecturas se realizaran desde m_File.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CCPAKFile::UnmapFile(void)
+{
+  // Se libera la vista, la proyeccion y el fichero
+  if (m_psbMapView) {
+	UnmapViewOfFile((LPCVOID)(m_psbMapView));
+	m_psbMapView = NULL;
+  }
+  if (m_hMapping) {
+	CloseHandle(m_hMapping);
+	m_hMapping = NULL;
+  }
+  if (m_hMapFile) {
+	CloseHandle(m_hMapFile);
+	m_hMapFile = NULL;
+  }
+  m_udMapSize = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprueba si el contenido del fichero pFile se puede obtener desde la
+//   proyeccion en memoria.
+// Parametros:
+// - pFile: Nodo del fichero.
+// Devuelve:
+// - Si se puede obtener true. En caso contrario false.
+// Notas:
+// - Los ficheros modificados se hallaran en m_FileTemp y no seran validos.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::IsMappedFile(const sNFile* const pFile) const
+{
+  // SOLO si parametros validos
+  ASSERT(pFile);
+
+  // Se comprueba proyeccion, estado y limites del fichero almacenado
+  return (IsMapped() &&
+		  CCPAKFile::FILE_OK == pFile->State &&
+		  pFile->udFileOffset <= m_udMapSize &&
+		  pFile->udStoredSize <= m_udMapSize - pFile->udFileOffset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el tamao que ocupa en el CPAK un fichero y si esta comprimido.
+// Parametros:
+// - szFileName: Nombre del fichero.
+// - udStoredSize: Tamao almacenado.
+// - bCompressed: Esta comprimido?
+// Devuelve:
+// - Si el fichero existe y esta en estado OK true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::GetFileStorage(const std::string& szFileName,
+						  dword& udStoredSize,
+						  bool& bCompressed)
+{
+  // SOLO si hay fichero abierto
+  ASSERT(IsOpen());
+  // SOLO si parametros validos
+  ASSERT(!szFileName.empty());
+
+  // Se localiza nodo
+  const CPAKFileIndexMapIt CPAKFileIt(GetCPAKFileIt(szFileName));
+
+  // Se encontro fichero Y esta en estado Ok?
+  if (CPAKFileIt != m_FileIndex.end() &&
+	  FILE_OK == CPAKFileIt->second->State) {
+	// Si, se retorna la informacion
+	udStoredSize = CPAKFileIt->second->udStoredSize;
+	bCompressed = (CCPAKFile::CODEC_LZ == CPAKFileIt->second->ubCodec);
+	return true;
+  } else {
+	// No
+	return false;
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Devuelve true si el fichero pasado existe y ademas esta en estado OK.
@@ -1088,3 +2797,250 @@ CCPAKFile::GetFileList(std::list<std::string>& StrList)
 	}
   }
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el espacio ahorrado por los ficheros que comparten los datos
+//   almacenados con otros ficheros del CPAK.
+// Parametros:
+// - udNumSharedFiles: Numero de ficheros que no han necesitado almacenar
+//   sus datos.
+// Devuelve:
+// - El numero de bytes ahorrados.
+// Notas:
+// - Solo se tendran en cuenta los ficheros en estado OK.
+///////////////////////////////////////////////////////////////////////////////
+dword 
+CCPAKFile::GetSharedStorage(dword& udNumSharedFiles)
+{
+  // SOLO si intancia inicializada
+  ASSERT(IsOpen());
+
+  // Se cuentan los ficheros cuyo offset ya se haya visitado
+  std::map<dword, dword> Offsets;
+  dword udSharedSize = 0;
+  udNumSharedFiles = 0;
+  CPAKFileIndexMapIt CPAKFileIt(m_FileIndex.begin());
+  for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
+	const sNFile* const pFile = CPAKFileIt->second;
+	if (CCPAKFile::FILE_OK == pFile->State &&
+		!Offsets.insert(std::map<dword, dword>::value_type(pFile->udFileOffset, 0)).second) {
+	  ++udNumSharedFiles;
+	  udSharedSize += pFile->udStoredSize;
+	}
+  }
+
+  // Se retorna
+  return udSharedSize;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprueba que el contenido de un fichero se corresponda con el CRC
+//   guardado para el.
+// Parametros:
+// - szFileName: Nombre del fichero.
+// Devuelve:
+// - Si el contenido es correcto true. Si no lo es, no se ha podido leer o
+//   no se hallo el fichero, false.
+// Notas:
+// - Los ficheros procedentes de CPAKs anteriores a la version 1.2 no tendran
+//   CRC, por lo que solo se comprobara que puedan leerse completamente.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::VerifyFile(const std::string& szFileName)
+{
+  // SOLO si hay fichero abierto
+  ASSERT(IsOpen());
+  // SOLO si parametros validos
+  ASSERT(!szFileName.empty());
+
+  // Se localiza nodo
+  const CPAKFileIndexMapIt CPAKFileIt(GetCPAKFileIt(szFileName));
+  if (CPAKFileIt == m_FileIndex.end() ||
+	  CCPAKFile::FILE_REMOVED == CPAKFileIt->second->State) {
+	return false;
+  }
+
+  // Se lee el contenido y se comprueba
+  sNFile* const pFile = CPAKFileIt->second;
+  BlockBuffer Content;
+  if (!ReadContent(pFile, Content)) {
+	return false;
+  }
+  if (pFile->bCRC &&
+	  pFile->udCRC != GetContentCRC((const sbyte*)(&Content[0]), pFile->udFileSize)) {
+	return false;
+  }
+
+  // Todo correcto
+  pFile->bVerified = true;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee, descomprimiendo si procede, el contenido completo de un fichero.
+// Parametros:
+// - pFile: Fichero.
+// - Content: Buffer donde depositar el contenido.
+// Devuelve:
+// - Si se ha podido leer true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::ReadContent(const sNFile* const pFile,
+					   BlockBuffer& Content)
+{
+  // SOLO si parametros validos
+  ASSERT(pFile);
+
+  // Se prepara el buffer
+  Content.resize(pFile->udFileSize);
+  if (0 == pFile->udFileSize) {
+	return false;
+  }
+
+  // Se lee
+  if (CCPAKFile::CODEC_LZ == pFile->ubCodec) {
+	return (pFile->udFileSize == ReadCompressed(pFile, 
+												(sbyte *)(&Content[0]), 
+												pFile->udFileSize, 
+												0));
+  } else {
+	return ReadStored(pFile, 0, &Content[0], pFile->udFileSize);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprueba el contenido de un fichero si es la primera vez que se lee.
+// Parametros:
+// - pFile: Fichero.
+// Devuelve:
+// - Si el contenido es correcto o ya se comprobo true. En caso contrario 
+//   false.
+// Notas:
+// - Solo se llamara si se halla activo m_bVerifyOnRead. El motor lo 
+//   activara en las versiones de depuracion.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKFile::CheckOnFirstRead(sNFile* const pFile)
+{
+  // SOLO si parametros validos
+  ASSERT(pFile);
+
+  // Ya comprobado o sin CRC?
+  if (pFile->bVerified || !pFile->bCRC) {
+	return true;
+  }
+
+  // Se comprueba
+  BlockBuffer Content;
+  if (!ReadContent(pFile, Content) ||
+	  pFile->udCRC != GetContentCRC((const sbyte*)(&Content[0]), pFile->udFileSize)) {
+	// Contenido no valido
+	ASSERT_MSG(false, "Fichero del CPAK corrupto");
+	return false;
+  }
+  pFile->bVerified = true;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Localiza un fichero, no eliminado, con el mismo contenido que el 
+//   recibido.
+// Parametros:
+// - psbData, udSize: Contenido a buscar.
+// - udCRC: CRC del contenido.
+// Devuelve:
+// - El fichero hallado o NULL si no hay ninguno.
+// Notas:
+// - Solo se compararan byte a byte los ficheros con mismo tamao y CRC.
+///////////////////////////////////////////////////////////////////////////////
+CCPAKFile::sNFile* 
+CCPAKFile::FindSameContent(const sbyte* const psbData,
+						   const dword udSize,
+						   const dword udCRC)
+{
+  // SOLO si parametros validos
+  ASSERT(psbData);
+
+  // Se recorren los ficheros
+  BlockBuffer Content;
+  CPAKFileIndexMapIt CPAKFileIt(m_FileIndex.begin());
+  for (; CPAKFileIt != m_FileIndex.end(); ++CPAKFileIt) {
+	sNFile* const pFile = CPAKFileIt->second;
+	if (CCPAKFile::FILE_REMOVED != pFile->State &&
+		pFile->bCRC &&
+		pFile->udCRC == udCRC &&
+		pFile->udFileSize == udSize &&
+		ReadContent(pFile, Content) &&
+		0 == memcmp(&Content[0], psbData, udSize)) {
+	  return pFile;
+	}
+  }
+
+  // No se hallo
+  return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Calcula el CRC32 (polinomio 0xEDB88320) de un contenido.
+// Parametros:
+// - psbData, udSize: Contenido.
+// Devuelve:
+// - El CRC calculado.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+dword 
+CCPAKFile::GetContentCRC(const sbyte* const psbData,
+						 const dword udSize)
+{
+  // SOLO si parametros validos
+  ASSERT(psbData);
+
+  // Se calcula
+  const dword* const udCRCTable = GetCRCTable();
+  dword udCRC = 0xFFFFFFFF;
+  dword udIt = 0;
+  for (; udIt < udSize; ++udIt) {
+	udCRC = udCRCTable[(udCRC ^ byte(psbData[udIt])) & 0xFF] ^ (udCRC >> 8);
+  }
+  return (udCRC ^ 0xFFFFFFFF);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene la tabla para el calculo del CRC32.
+// Parametros:
+// Devuelve:
+// - La tabla.
+// Notas:
+// - La tabla se construira en la primera llamada. Antes de lanzar hilos que 
+//   calculen CRCs se debera de llamar a este metodo desde el hilo principal.
+///////////////////////////////////////////////////////////////////////////////
+const dword* 
+CCPAKFile::GetCRCTable(void)
+{
+  // Hay que construir la tabla?
+  static dword udCRCTable[256];
+  static bool bTableBuilt = false;
+  if (!bTableBuilt) {
+	dword udIt = 0;
+	for (; udIt < 256; ++udIt) {
+	  dword udValue = udIt;
+	  byte ubBit = 0;
+	  for (; ubBit < 8; ++ubBit) {
+		udValue = (udValue & 1) ? (0xEDB88320 ^ (udValue >> 1)) : (udValue >> 1);
+	  }
+	  udCRCTable[udIt] = udValue;
+	}
+	bTableBuilt = true;
+  }
+
+  // Se retorna
+  return udCRCTable;
+}
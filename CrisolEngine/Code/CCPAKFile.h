@@ -33,6 +33,32 @@
 //   se pasa dicho fichero a traves de un path, se insertara el path como
 //   elemento que forme parte del nombre del fichero y en consecuencia, habra
 //   que indicar el nombre del path para obtener el fichero.
+// - Al abrirse, el fichero CPAK se proyectara en memoria para lectura, de
+//   tal forma que las lecturas de ficheros no modificados seran simples 
+//   copias y se podra acceder a su contenido sin copiarlo (GetFileData).
+//   Si la proyeccion no fuera posible, se leera a traves de m_File.
+// - Los nombres se guardaran en minusculas y, tras el indice de ficheros, se
+//   almacenara una tabla hash sobre los mismos (flag HEADER_HASHINDEX) que
+//   se usara directamente al abrir. Con los ficheros CPAK que no la tengan,
+//   la tabla se construira en la apertura. Las busquedas de ficheros no
+//   realizaran reserva de memoria alguna.
+// - A partir de la version 1.1, los ficheros se podran almacenar comprimidos
+//   (CLZCodec) en bloques independientes de COMPRESS_BLOCK_SIZE bytes, de tal
+//   forma que una lectura solo descomprimira los bloques que toque. Que un
+//   fichero se comprima o no dependera de su extension (IsCompressibleFile)
+//   y de que la compresion compense.
+// - A partir de la version 1.2, cada fichero guardara el CRC32 de su
+//   contenido sin comprimir, lo que permitira comprobar la integridad del
+//   CPAK (VerifyFile). Al aadir un fichero cuyo contenido ya exista bajo
+//   otro nombre, ambos compartiran los mismos datos almacenados.
+// - UpdateChanges aadira al final del CPAK los datos modificados y un nuevo
+//   indice, por lo que los datos eliminados o sobreescritos quedaran como
+//   espacio muerto. Para recuperarlo, se debera de llamar a Compact, que
+//   reescribira el CPAK completo.
+// - Las operaciones por lotes (AddFiles, ExtractFiles) repartiran la lectura,
+//   el calculo del CRC y la (des)compresion entre varios hilos. Al aadir,
+//   los ficheros se incorporaran al CPAK en el orden de la lista, de tal
+//   forma que el resultado no dependera del numero de hilos.
 //
 // Notas:
 ///////////////////////////////////////////////////////////////////////////////
@@ -43,6 +69,10 @@
 #pragma warning(disable:4786)
 
 // Cabeceras
+#ifndef _WINDOWS_
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
 #ifndef _SYSDEFS_H_
 #include "SYSDefs.h"    
 #endif
@@ -64,6 +94,10 @@
 #define _LIST_H_
 #include <list>
 #endif
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+#include <vector>
+#endif
 #ifndef _ALGORITHM_H_
 #define _ALGORITHM_H_
 #include <algorithm>
@@ -71,9 +105,16 @@
 
 // Defincion de clases / estructuras / espacios de nombres
 
+// Funcion que ejecuta los hilos de las operaciones por lotes
+static unsigned __stdcall tCPAKBatchWork(void* pParams);
+
 // Clase CCPAKFile
 class CCPAKFile
 {  
+private:
+  // Clases amigas
+  friend unsigned __stdcall tCPAKBatchWork(void* pParams);
+
 private:
   // Constantes
   const byte VERSIONHI; // Version alta con la que se trabaja
@@ -87,6 +128,25 @@ private:
     FILE_MODIFY,     // Fichero modificado
     FILE_REMOVED     // Fichero eliminado
   };
+  enum {
+	// Flags de la cabecera
+	HEADER_HASHINDEX = 0x00000001 // Tabla hash tras el indice de ficheros
+  };
+  enum {
+	// Metodo de almacenamiento de los ficheros
+	CODEC_NONE = 0, // Sin comprimir
+	CODEC_LZ        // Comprimido por bloques con CLZCodec
+  };
+  enum {
+	// Compresion
+	COMPRESS_BLOCK_SIZE = 65536, // Tamao de los bloques sin comprimir
+	COMPRESS_MIN_SIZE   = 256    // Tamao minimo para intentar comprimir
+  };
+  enum {
+	// Operaciones por lotes
+	BATCH_MAX_THREADS     = 16, // Numero maximo de hilos
+	BATCH_JOBS_PER_THREAD = 4   // Ficheros por hilo en cada tanda
+  };
 
 // Obliga al compilador a que las estructuras las alinee en bytes
 #pragma pack(push, 1)
@@ -109,6 +169,8 @@ private:
 private:
   // Estructuras forward
   struct sNFile;
+  struct sBatchJob;
+  struct sBatch;
 
 private:
   // Tipos
@@ -116,6 +178,10 @@ private:
   typedef std::map<std::string, sNFile*> CPAKFileIndexMap;
   typedef CPAKFileIndexMap::iterator     CPAKFileIndexMapIt;
   typedef CPAKFileIndexMap::value_type   CPAKFileIndexMapValType;
+  // Tabla hash sobre los ficheros del indice
+  typedef std::vector<sNFile*>           HashBucketVector;
+  // Buffers para el trabajo con bloques comprimidos
+  typedef std::vector<byte>              BlockBuffer;
 
   // Vbles de miembro
 private:
@@ -125,14 +191,36 @@ private:
   std::fstream     m_FileTemp;       // Fichero temporal    
   sCPAKHeader      m_CPAKHeader;     // Cabecera del fichero CPAK
   CPAKFileIndexMap m_FileIndex;      // Tabla con todos los ficheros CPAK
+  HashBucketVector m_HashBuckets;    // Tabla hash sobre m_FileIndex
   bool             m_bFileOpen;      // Fichero abierto correctamente?
   bool             m_bFileModify;    // Hay que llamar a UpdateChanges()?
+  // Proyeccion en memoria del fichero CPAK
+  HANDLE           m_hMapFile;       // Handle al fichero proyectado
+  HANDLE           m_hMapping;       // Handle a la proyeccion
+  const sbyte*     m_psbMapView;     // Vista con el contenido del fichero
+  dword            m_udMapSize;      // Tamao de la vista
+  // Ultimo bloque comprimido leido
+  BlockBuffer      m_BlockCache;         // Bloque descomprimido
+  BlockBuffer      m_PackedBlock;        // Bloque comprimido leido
+  const sNFile*    m_pCachedFile;        // Fichero del bloque (o NULL)
+  dword            m_udCachedBlock;      // Numero del bloque
+  dword            m_udCachedBlockSize;  // Tamao del bloque descomprimido
+  // Comprobacion de integridad
+  bool             m_bVerifyOnRead;      // Comprobar CRC en la 1 lectura?
 
 public:
   // Constructor / Destructor
   CCPAKFile(void): VERSIONHI(1),
-				   VERSIONLO(0),
-				   m_bFileOpen(false) { }
+				   VERSIONLO(2),
+				   m_bFileOpen(false),
+				   m_hMapFile(NULL),
+				   m_hMapping(NULL),
+				   m_psbMapView(NULL),
+				   m_udMapSize(0),
+				   m_pCachedFile(NULL),
+				   m_udCachedBlock(0),
+				   m_udCachedBlockSize(0),
+				   m_bVerifyOnRead(false) { }
   ~CCPAKFile(void) { Close(); }
   
 public:
@@ -160,15 +248,52 @@ public:
   bool Remove(const std::string& szFileName);
   bool Add(const std::string& szFileName, 
 		   const bool bRemoveFromDisk = false);
+private:
+  // Metodos de apoyo
+  static bool ReadDiskFile(const std::string& szFileName,
+						   BlockBuffer& Data);
+  bool AddContent(const std::string& szFileName,
+				  const CPAKFileIndexMapIt& CPAKFileIt,
+				  const BlockBuffer& Data,
+				  const dword udCRC,
+				  const BlockBuffer& Packed);
+public:
   bool Extract(const std::string& szFileName, 
 			   const bool bRemoveFromPak = false);
+  const sbyte* const GetFileData(const std::string& szFileName,
+								 dword& udSize);
+  const sbyte* const GetStoredData(const std::string& szFileName,
+								   dword& udStoredSize,
+								   dword& udSize,
+								   bool& bCompressed);
+  static bool UnpackContent(const byte* const pubStored,
+							const dword udStoredSize,
+							byte* const pubDest,
+							const dword udSize);
   
 public:
   // Operaciones sobre la totalidad de los ficheros
   dword AddFilesByExtension(const std::string& szDirectory,
-							const std::string& szExtension);
-  dword ExtractAll(const bool bRemoveFromCPAK = false);
+							const std::string& szExtension,
+							const byte ubNumThreads = 1);
+  dword ExtractAll(const bool bRemoveFromCPAK = false,
+				   const byte ubNumThreads = 1);
   dword RemoveAll(void);
+
+public:
+  // Operaciones por lotes
+  dword AddFiles(const std::list<std::string>& Files,
+				 const byte ubNumThreads = 1);
+  dword ExtractFiles(const std::list<std::string>& Files,
+					 const byte ubNumThreads = 1);
+  static byte GetNumProcessors(void);
+private:
+  // Metodos de apoyo
+  void RunBatch(sBatch& Batch,
+				const byte ubNumThreads);
+  static void PrepareAddJob(sBatchJob& Job);
+  void ExtractJob(sBatchJob& Job) const;
+  static void CreateFileDirectory(const std::string& szFileName);
   
 public:
   // Operaciones de consulta
@@ -176,6 +301,9 @@ public:
 	return m_bFileOpen; 
   }  
   dword GetFileSize(const std::string& szFileName);
+  bool GetFileStorage(const std::string& szFileName,
+					  dword& udStoredSize,
+					  bool& bCompressed);
   inline std::string GetCPAKFileName(void) const { 
 	ASSERT(IsOpen());
 	// Se retorna el nombre
@@ -183,22 +311,88 @@ public:
   }
   bool IsFilePresent(const std::string& szFileName);
   void GetFileList(std::list<std::string>& StrList);
+  dword GetSharedStorage(dword& udNumSharedFiles);
+
+public:
+  // Comprobacion de integridad
+  bool VerifyFile(const std::string& szFileName);
+  inline void SetVerifyOnRead(const bool bVerify) {
+	// Establece el flag
+	m_bVerifyOnRead = bVerify;
+  }
+private:
+  // Metodos de apoyo
+  bool ReadContent(const sNFile* const pFile,
+				   BlockBuffer& Content);
+  bool CheckOnFirstRead(sNFile* const pFile);
+  sNFile* FindSameContent(const sbyte* const psbData,
+						  const dword udSize,
+						  const dword udCRC);
+  static dword GetContentCRC(const sbyte* const psbData,
+							 const dword udSize);
+  static const dword* GetCRCTable(void);
 
 public:
   // Operaciones de actualizacion
   bool UpdateChanges(void);
+  bool Compact(void);
+  dword GetDeadSpace(void);
+private:
+  // Metodos de apoyo
+  bool ApplyChanges(const bool bCompact);
+  void WriteFileIndex(std::fstream& File);
+
+public:
+  // Proyeccion del fichero CPAK en memoria
+  bool MapFile(void);
+  void UnmapFile(void);
+  inline bool IsMapped(void) const { 
+	return (NULL != m_psbMapView); 
+  }
+private:
+  // Metodos de apoyo
+  bool IsMappedFile(const sNFile* const pFile) const;
   
 private:
   // Metodos de apoyo  
   std::string ChangeExtension(const std::string& szFileName, 
 							  const std::string& szExtension);
-  inline CPAKFileIndexMapIt GetCPAKFileIt(const std::string& szFileName) {
-	ASSERT(IsOpen());
-	// Se retorna iterador al fichero szFileName
-	std::string szFileNameLowercase(szFileName);
-	std::transform(szFileNameLowercase.begin(), szFileNameLowercase.end(), szFileNameLowercase.begin(), tolower);
-	return m_FileIndex.find(szFileNameLowercase);
+  CPAKFileIndexMapIt GetCPAKFileIt(const std::string& szFileName);
+  
+private:
+  // Trabajo con la tabla hash de nombres
+  void BuildHashIndex(void);
+  void InsertInHashIndex(sNFile* const pFile);
+  bool ReadHashIndex(const std::vector<sNFile*>& Files);
+  void WriteHashIndex(std::fstream& File);
+  static dword GetNameHash(const std::string& szFileName);
+  static inline sbyte FoldChar(const sbyte sbChar) {
+	// Retorna el caracter en minusculas, tal y como lo haria tolower
+	return ('A' <= sbChar && 'Z' >= sbChar) ? sbChar + ('a' - 'A') : sbChar;
   }
+
+private:
+  // Trabajo con ficheros comprimidos
+  static bool PackContent(const sbyte* const psbData,
+						  const dword udSize,
+						  BlockBuffer& Packed);
+  bool WriteToTemp(const sbyte* const psbData,
+				   const dword udSize,
+				   const BlockBuffer& Packed,
+				   dword& udOffset,
+				   dword& udStoredSize,
+				   byte& ubCodec);
+  bool ReadStored(const sNFile* const pFile,
+				  const dword udOffset,
+				  void* const pDest,
+				  const dword udSize);
+  bool LoadCompressedBlock(const sNFile* const pFile,
+						   const dword udBlock);
+  dword ReadCompressed(const sNFile* const pFile,
+					   sbyte* const psbBuffer,
+					   const dword udSize,
+					   const dword udInitOffset);
+  static bool IsCompressibleFile(const std::string& szFileName);
   inline bool IsValidFirm(const sbyte* psbFirm) const {
 	// Retorna el flag
 	return ('C' != psbFirm[0] || 'P' != psbFirm[1] || 
@@ -207,8 +401,9 @@ private:
   inline bool IsValidVersion(const byte VersionHi, 
 							 const byte VersionLo) const {
 	// Retorna flag de version valida
-	return (CCPAKFile::VERSIONHI > m_CPAKHeader.ubVersionHi ||
-		    CCPAKFile::VERSIONLO > m_CPAKHeader.ubVersionLo) ? false : true;
+	// Nota: Se aceptaran las versiones bajas anteriores a la actual
+	return (CCPAKFile::VERSIONHI == VersionHi &&
+		    CCPAKFile::VERSIONLO >= VersionLo) ? true : false;
   }  
 };
 
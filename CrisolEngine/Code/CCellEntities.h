@@ -0,0 +1,178 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CCellEntities.h
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Clase:
+// - CCellEntities
+//
+// Descripcion:
+// - Secuencia ordenada de handles a las entidades situadas sobre una celda.
+//   Los primeros INLINE_CAPACITY handles se alojaran dentro de la propia
+//   instancia y solo cuando se supere dicha capacidad se pasara a un array
+//   en memoria dinamica. Como la gran mayoria de celdas tendran muy pocas
+//   entidades, recorrerlas no supondra salir de la memoria de la celda.
+// - La interfaz imitara a la de las listas de la STL en las operaciones que
+//   se usan sobre las celdas, siendo los iteradores simples punteros.
+//
+// Notas:
+// - Las inserciones y borrados invalidaran los iteradores.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _CCELLENTITIES_H_
+#define _CCELLENTITIES_H_
+
+// Cabeceras
+#ifndef _SYSDEFS_H_
+#include "SYSDefs.h"
+#endif
+#ifndef _AREADEFS_H_
+#include "AreaDefs.h"
+#endif
+
+// Clase CCellEntities
+class CCellEntities
+{
+public:
+  // Tipos
+  typedef AreaDefs::EntHandle*       iterator;       // Iterador
+  typedef const AreaDefs::EntHandle* const_iterator; // Iterador constante
+
+private:
+  // Enumerados
+  enum {
+	INLINE_CAPACITY = 4 // Handles alojados en la propia instancia
+  };
+
+private:
+  // Vbles de miembro
+  AreaDefs::EntHandle  m_Inline[INLINE_CAPACITY]; // Handles en la instancia
+  AreaDefs::EntHandle* m_pData;                   // Handles en uso
+  word                 m_uwSize;                  // Num. de handles
+  word                 m_uwCapacity;              // Capacidad de m_pData
+
+public:
+  // Constructores / destructor
+  CCellEntities(void): m_pData(m_Inline),
+					   m_uwSize(0),
+					   m_uwCapacity(INLINE_CAPACITY) { }
+  CCellEntities(const CCellEntities& Entities): m_pData(m_Inline),
+												m_uwSize(0),
+												m_uwCapacity(INLINE_CAPACITY) {
+	*this = Entities;
+  }
+  ~CCellEntities(void) {
+	if (m_pData != m_Inline) {
+	  delete[] m_pData;
+	}
+  }
+
+public:
+  // Operadores
+  CCellEntities& operator=(const CCellEntities& Entities) {
+	if (this != &Entities) {
+	  clear();
+	  Reserve(Entities.m_uwSize);
+	  word uwIt = 0;
+	  for (; uwIt < Entities.m_uwSize; ++uwIt) {
+		m_pData[uwIt] = Entities.m_pData[uwIt];
+	  }
+	  m_uwSize = Entities.m_uwSize;
+	}
+	return *this;
+  }
+  inline AreaDefs::EntHandle operator[](const word uwPos) const {
+	ASSERT((uwPos < m_uwSize) != 0);
+	return m_pData[uwPos];
+  }
+
+public:
+  // Recorrido
+  inline iterator begin(void) { return m_pData; }
+  inline iterator end(void) { return m_pData + m_uwSize; }
+  inline const_iterator begin(void) const { return m_pData; }
+  inline const_iterator end(void) const { return m_pData + m_uwSize; }
+  inline word size(void) const { return m_uwSize; }
+  inline bool empty(void) const { return (0 == m_uwSize); }
+
+public:
+  // Insercion / borrado
+  void insert(iterator It,
+			  const AreaDefs::EntHandle& hEntity) {
+	ASSERT((It >= begin() && It <= end()) != 0);
+	// Se asegura espacio, recolocando el iterador si cambia el array
+	const word uwPos = It - m_pData;
+	Reserve(m_uwSize + 1);
+	// Se desplazan los handles posteriores y se inserta
+	word uwIt = m_uwSize;
+	for (; uwIt > uwPos; --uwIt) {
+	  m_pData[uwIt] = m_pData[uwIt - 1];
+	}
+	m_pData[uwPos] = hEntity;
+	++m_uwSize;
+  }
+  inline void push_back(const AreaDefs::EntHandle& hEntity) {
+	insert(end(), hEntity);
+  }
+  void erase(iterator It) {
+	ASSERT((It >= begin() && It < end()) != 0);
+	// Se desplazan los handles posteriores
+	for (++It; It != end(); ++It) {
+	  *(It - 1) = *It;
+	}
+	--m_uwSize;
+  }
+  void clear(void) {
+	// Se vuelve a los handles de la instancia
+	if (m_pData != m_Inline) {
+	  delete[] m_pData;
+	  m_pData = m_Inline;
+	  m_uwCapacity = INLINE_CAPACITY;
+	}
+	m_uwSize = 0;
+  }
+
+private:
+  // Metodos de apoyo
+  void Reserve(const word uwCapacity) {
+	// Hay que ampliar?
+	if (uwCapacity > m_uwCapacity) {
+	  // Si, se dobla la capacidad y se pasan los handles
+	  word uwNewCapacity = m_uwCapacity * 2;
+	  if (uwNewCapacity < uwCapacity) {
+		uwNewCapacity = uwCapacity;
+	  }
+	  AreaDefs::EntHandle* const pNewData = new AreaDefs::EntHandle[uwNewCapacity];
+	  ASSERT(pNewData);
+	  word uwIt = 0;
+	  for (; uwIt < m_uwSize; ++uwIt) {
+		pNewData[uwIt] = m_pData[uwIt];
+	  }
+	  if (m_pData != m_Inline) {
+		delete[] m_pData;
+	  }
+	  m_pData = pNewData;
+	  m_uwCapacity = uwNewCapacity;
+	}
+  }
+}; // ~ CCellEntities
+
+#endif // ~ #ifdef _CCELLENTITIES_H_
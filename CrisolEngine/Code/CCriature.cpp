@@ -2341,53 +2341,52 @@ CCriature::SetTilePos(const AreaDefs::sTilePos& TilePos)
   // Propaga para establecer el valor de posicion
   Inherited::SetTilePos(TilePos);
 
-  // Obtiene el conjunto de criaturas en el rango
-  // Nota: se quita el handle de la criatura propia del conjunto
+  // Obtiene las criaturas que han entrado y salido del rango
+  // Nota: se quita el handle de la criatura propia de las que entran
   iCWorld* const pWorld = SYSEngine::GetWorld();
   ASSERT(pWorld);
-  CriaturesInRangeSet NewRangeSet;
-  pWorld->FindCriaturesInRangeAt(TilePos, m_Attributes.Range, NewRangeSet);  
-  NewRangeSet.erase(Inherited::GetHandle());
-
-  // Se recorre el nuevo conjunto obtenido y para todas aquellas criaturas que
-  // no esten en el antiguo, instalaremos esta como observer y notificaremos
-  // su visibilidad.
+  CriaturesInRangeSet EnteredSet;
+  CriaturesInRangeSet LeftSet;
+  pWorld->FindCriaturesRangeDelta(TilePos, 
+								  m_Attributes.Range, 
+								  m_CriaturesInRange,
+								  EnteredSet,
+								  LeftSet);  
+  EnteredSet.erase(Inherited::GetHandle());
+
+  // Se recorren las criaturas que han entrado en el rango, instalando esta
+  // como observer y notificando su visibilidad.
   iCVirtualMachine* const pVMachine = SYSEngine::GetVirtualMachine();
   ASSERT(pVMachine);
-  CriaturesInRangeSetIt It(NewRangeSet.begin());
-  for (; It != NewRangeSet.end(); ++It) {
-	// NO esta en el antiguo?
-	if (m_CriaturesInRange.find(*It) == m_CriaturesInRange.end()) {
-	  // Instala como observer, notifica y continua
-	  // Nota: Solo se notificara si NO SE ESTA cargando una partida guardada	
-	  CCriature* const pCriature = pWorld->GetCriature(*It);
-	  ASSERT(pCriature);
-	  ASSERT((*It != Inherited::GetHandle()) != 0);
-	  pCriature->AddObserver(this);		
-	  if (!pWorld->IsLoadingASavedGame()) {
-	    pVMachine->OnCriatureInRange(this, 
-									 Inherited::GetScriptEvent(RulesDefs::SE_ONCRIATUREINRANGE),
-									 Inherited::GetHandle(),
-									 *It);
-	  }
-	} else {
-	  // En caso de estar en el antiguo, se extrera de este para que al
-	  // final solo queden aquellas criaturas que ya no estan en el rango
-	  m_CriaturesInRange.erase(*It);
+  CriaturesInRangeSetIt It(EnteredSet.begin());
+  for (; It != EnteredSet.end(); ++It) {
+	// Instala como observer, notifica y continua
+	// Nota: Solo se notificara si NO SE ESTA cargando una partida guardada	
+	CCriature* const pCriature = pWorld->GetCriature(*It);
+	ASSERT(pCriature);
+	ASSERT((*It != Inherited::GetHandle()) != 0);
+	m_CriaturesInRange.insert(*It);
+	pCriature->AddObserver(this);		
+	if (!pWorld->IsLoadingASavedGame()) {
+	  pVMachine->OnCriatureInRange(this, 
+								   Inherited::GetScriptEvent(RulesDefs::SE_ONCRIATUREINRANGE),
+								   Inherited::GetHandle(),
+								   *It);
 	}
   }
   
-  // Ahora se recorrera el conjunto antiguo, que estara lleno de criaturas
-  // que dejaron de estar en el rango al moverse esta criatura. 
-  It = m_CriaturesInRange.begin();
-  for (; It != m_CriaturesInRange.end(); It = m_CriaturesInRange.erase(It)) {
-	// Criatura valida?
+  // Ahora se recorreran las criaturas que dejaron de estar en el rango al 
+  // moverse esta criatura. 
+  It = LeftSet.begin();
+  for (; It != LeftSet.end(); ++It) {
+	// Se extrae del conjunto y, si la criatura es valida, se desinstala esta
+	// como observer y se notifica
+	// Nota: es seguro que durante la carga de una partida guardada
+	// NO existan handles en el conjunto (de ahi que no se haga comprobacion
+	// acerca de si se esta, o no, cargando un area)
+	m_CriaturesInRange.erase(*It);
 	CCriature* const pCriature = pWorld->GetCriature(*It);	
 	if (pCriature) {
-	  // Si, se desinstala esta como observer y se notifica
-	  // Nota: es seguro que durante la carga de una partida guardada
-	  // NO existan handles en el conjunto (de ahi que no se haga comprobacion
-	  // acerca de si se esta, o no, cargando un area)
 	  ASSERT((*It != Inherited::GetHandle()) != 0);
 	  pCriature->RemoveObserver(this);
 	  pVMachine->OnCriatureOutOfRange(this, 
@@ -2397,21 +2396,18 @@ CCriature::SetTilePos(const AreaDefs::sTilePos& TilePos)
 	}
   }
   
-  // Se establece el nuevo conjunto como el oficial
-  m_CriaturesInRange = NewRangeSet;
-
   // Ahora se hallaran criaturas que contengan en su rango a la actual
   // Nota: El conjunto devuelto contendra SOLO a aquellas criaturas que 
   // no contuvieran anteriormente a esta criatura. Tampoco contendra
   // el handle de esta misma criatura.
-  NewRangeSet.clear();
+  CriaturesInRangeSet ContainingSet;
   pWorld->FindCriaturesContainingCriatureInRange(Inherited::GetHandle(), 
-												 NewRangeSet);  
+												 ContainingSet);  
 
   // Ahora se recorrera el conjunto y para cada criatura recibida, se
   // asociara esta en su conjunto ademas de instalarse como observador de la misma
-  It = NewRangeSet.begin();
-  for (; It != NewRangeSet.end(); ++It) {
+  It = ContainingSet.begin();
+  for (; It != ContainingSet.end(); ++It) {
 	// Se toma criatura
 	CCriature* const pCriature = pWorld->GetCriature(*It);	
 	ASSERT(pCriature);
@@ -0,0 +1,426 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CCriatureGrid.cpp
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Consultar CCriatureGrid.h para mas detalles.
+///////////////////////////////////////////////////////////////////////////////
+#include "CCriatureGrid.h"
+
+#ifdef CRIATUREGRID_BENCHMARK
+#include "SYSEngine.h"
+#include "iCLogger.h"
+#include "iCTimer.h"
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Inicializa la rejilla para un area de uwWidth x uwHeight tiles.
+// Parametros:
+// - uwWidth, uwHeight. Dimensiones del area en tiles.
+// Devuelve:
+// - Si todo ha ido bien true. En caso contrario false.
+// Notas:
+// - Si la instancia ya estaba inicializada, se finalizara antes.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CCriatureGrid::Init(const word uwWidth,
+					const word uwHeight)
+{
+  // SOLO si parametros validos
+  ASSERT(uwWidth);
+  ASSERT(uwHeight);
+
+  // Se intenta reinicializar?
+  if (IsInitOk()) {
+	End();
+  }
+
+  // Se crean las cubetas, redondeando las dimensiones por exceso
+  m_uwBucketsWidth = (uwWidth + BUCKET_SIZE - 1) >> BUCKET_SHIFT;
+  m_uwBucketsHeight = (uwHeight + BUCKET_SIZE - 1) >> BUCKET_SHIFT;
+  m_Buckets.resize(m_uwBucketsWidth * m_uwBucketsHeight);
+  m_uwNumCriatures = 0;
+  m_MaxRange = 0;
+
+  // Todo correcto
+  m_bIsInitOk = true;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Finaliza la instancia, liberando las cubetas.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CCriatureGrid::End(void)
+{
+  // Instancia inicializada?
+  if (IsInitOk()) {
+	// Se liberan cubetas
+	m_Buckets.clear();
+	m_uwBucketsWidth = m_uwBucketsHeight = 0;
+	m_uwNumCriatures = 0;
+	m_MaxRange = 0;
+	m_bIsInitOk = false;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Registra una criatura en la cubeta asociada a su posicion.
+// Parametros:
+// - hCriature. Handle a la criatura.
+// - TilePos. Posicion de la criatura.
+// - Range. Rango de la criatura.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CCriatureGrid::Insert(const AreaDefs::EntHandle& hCriature,
+					  const AreaDefs::sTilePos& TilePos,
+					  const RulesDefs::CriatureRange& Range)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT(hCriature);
+
+  // Se inserta y se actualiza el rango maximo
+  m_Buckets[GetBucketIdx(TilePos)].push_back(sCriatureInfo(hCriature, TilePos, Range));
+  ++m_uwNumCriatures;
+  if (Range > m_MaxRange) {
+	m_MaxRange = Range;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Quita a una criatura de la cubeta asociada a su posicion.
+// Parametros:
+// - hCriature. Handle a la criatura.
+// - TilePos. Posicion con la que la criatura fue registrada.
+// Devuelve:
+// Notas:
+// - El rango maximo no se reducira, pues los rangos no cambian durante el
+//   juego y bastara con que sea una cota superior.
+///////////////////////////////////////////////////////////////////////////////
+void
+CCriatureGrid::Remove(const AreaDefs::EntHandle& hCriature,
+					  const AreaDefs::sTilePos& TilePos)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT(hCriature);
+
+  // Se localiza en la cubeta y se sustituye por la ultima criatura
+  CriaturesVector& Bucket = m_Buckets[GetBucketIdx(TilePos)];
+  CriaturesVector::iterator It(Bucket.begin());
+  for (; It != Bucket.end(); ++It) {
+	if (It->hCriature == hCriature) {
+	  *It = Bucket.back();
+	  Bucket.pop_back();
+	  --m_uwNumCriatures;
+	  return;
+	}
+  }
+
+  // No deberia de llegar aqui
+  ASSERT(false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Inserta en InRangeSet las criaturas que se hallan dentro del rango Range
+//   centrado en Pos.
+// Parametros:
+// - Pos. Centro del rango.
+// - Range. Rango.
+// - InRangeSet. Conjunto donde depositar los handles.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CCriatureGrid::FindInRange(const AreaDefs::sTilePos& Pos,
+						   const RulesDefs::CriatureRange& Range,
+						   CriaturesSet& InRangeSet) const
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se hallan las cubetas que solapan con el rango
+  sword swXInitBucket, swYInitBucket, swXEndBucket, swYEndBucket;
+  ClipBuckets(Pos.XTile - Range, Pos.YTile - Range,
+			  Pos.XTile + Range - 1, Pos.YTile + Range - 1,
+			  swXInitBucket, swYInitBucket, swXEndBucket, swYEndBucket);
+
+  // Se recorren las cubetas
+  sword swYBucket = swYInitBucket;
+  for (; swYBucket <= swYEndBucket; ++swYBucket) {
+	sword swXBucket = swXInitBucket;
+	for (; swXBucket <= swXEndBucket; ++swXBucket) {
+	  const CriaturesVector& Bucket = m_Buckets[(swYBucket * m_uwBucketsWidth) + swXBucket];
+	  CriaturesVector::const_iterator It(Bucket.begin());
+	  for (; It != Bucket.end(); ++It) {
+		if (IsInRange(It->TilePos, Pos, Range)) {
+		  InRangeSet.insert(It->hCriature);
+		}
+	  }
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Inserta en ContainingSet las criaturas que contienen a la posicion Pos
+//   dentro de su rango.
+// Parametros:
+// - Pos. Posicion.
+// - ContainingSet. Conjunto donde depositar los handles.
+// Devuelve:
+// Notas:
+// - Si hubiera una criatura sobre Pos, tambien sera insertada.
+///////////////////////////////////////////////////////////////////////////////
+void
+CCriatureGrid::FindContaining(const AreaDefs::sTilePos& Pos,
+							  CriaturesSet& ContainingSet) const
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se hallan las cubetas en donde podria haber criaturas que contengan a
+  // la posicion, tomando como radio el mayor rango registrado
+  // Nota: Una criatura en C contiene a Pos si Pos - Range < C <= Pos + Range
+  sword swXInitBucket, swYInitBucket, swXEndBucket, swYEndBucket;
+  ClipBuckets(Pos.XTile - m_MaxRange + 1, Pos.YTile - m_MaxRange + 1,
+			  Pos.XTile + m_MaxRange, Pos.YTile + m_MaxRange,
+			  swXInitBucket, swYInitBucket, swXEndBucket, swYEndBucket);
+
+  // Se recorren las cubetas
+  sword swYBucket = swYInitBucket;
+  for (; swYBucket <= swYEndBucket; ++swYBucket) {
+	sword swXBucket = swXInitBucket;
+	for (; swXBucket <= swXEndBucket; ++swXBucket) {
+	  const CriaturesVector& Bucket = m_Buckets[(swYBucket * m_uwBucketsWidth) + swXBucket];
+	  CriaturesVector::const_iterator It(Bucket.begin());
+	  for (; It != Bucket.end(); ++It) {
+		if (IsInRange(Pos, It->TilePos, It->Range)) {
+		  ContainingSet.insert(It->hCriature);
+		}
+	  }
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Compara el conjunto de criaturas que estaban en rango, InRangeSet, con
+//   las criaturas que se hallan ahora en el rango Range centrado en Pos,
+//   obteniendo las que han entrado y las que han salido.
+// Parametros:
+// - Pos. Centro del rango.
+// - Range. Rango.
+// - InRangeSet. Criaturas que estaban en rango.
+// - EnteredSet. Criaturas que estan en rango y no estaban en InRangeSet.
+// - LeftSet. Criaturas de InRangeSet que ya no estan en rango.
+// Devuelve:
+// Notas:
+// - El conjunto actual quedara como InRangeSet + EnteredSet - LeftSet.
+///////////////////////////////////////////////////////////////////////////////
+void
+CCriatureGrid::FindRangeDelta(const AreaDefs::sTilePos& Pos,
+							  const RulesDefs::CriatureRange& Range,
+							  const CriaturesSet& InRangeSet,
+							  CriaturesSet& EnteredSet,
+							  CriaturesSet& LeftSet) const
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se obtienen las criaturas en rango y se separan las nuevas
+  CriaturesSet NowInRangeSet;
+  FindInRange(Pos, Range, NowInRangeSet);
+  CriaturesSet::const_iterator It(NowInRangeSet.begin());
+  for (; It != NowInRangeSet.end(); ++It) {
+	if (InRangeSet.find(*It) == InRangeSet.end()) {
+	  EnteredSet.insert(*It);
+	}
+  }
+
+  // Se hallan las que dejaron de estar en rango
+  It = InRangeSet.begin();
+  for (; It != InRangeSet.end(); ++It) {
+	if (NowInRangeSet.find(*It) == NowInRangeSet.end()) {
+	  LeftSet.insert(*It);
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Halla el rectangulo de cubetas que solapa con un rectangulo de tiles,
+//   recortandolo a los limites de la rejilla.
+// Parametros:
+// - swXMin, swYMin, swXMax, swYMax. Rectangulo de tiles (extremos incluidos).
+// - swXInitBucket, swYInitBucket, swXEndBucket, swYEndBucket. Rectangulo de
+//   cubetas (extremos incluidos). Si no hubiera solape, el inicio quedara
+//   por encima del final.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CCriatureGrid::ClipBuckets(const sword swXMin, const sword swYMin,
+						   const sword swXMax, const sword swYMax,
+						   sword& swXInitBucket, sword& swYInitBucket,
+						   sword& swXEndBucket, sword& swYEndBucket) const
+{
+  // Se hallan y recortan los limites
+  swXInitBucket = (swXMin < 0) ? 0 : GetBucketCoord(swXMin);
+  swYInitBucket = (swYMin < 0) ? 0 : GetBucketCoord(swYMin);
+  swXEndBucket = (swXMax < 0) ? -1 : GetBucketCoord(swXMax);
+  swYEndBucket = (swYMax < 0) ? -1 : GetBucketCoord(swYMax);
+  if (swXEndBucket >= m_uwBucketsWidth) {
+	swXEndBucket = m_uwBucketsWidth - 1;
+  }
+  if (swYEndBucket >= m_uwBucketsHeight) {
+	swYEndBucket = m_uwBucketsHeight - 1;
+  }
+}
+
+#ifdef CRIATUREGRID_BENCHMARK
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Banco de pruebas de la rejilla. Situa uwNumCriatures criaturas ficticias
+//   en posiciones y con rangos elegidos de forma determinista a partir de
+//   udSeed y, durante udNumSteps pasos, mueve cada una a un tile adyacente y
+//   realiza las consultas que se harian al notificar su movimiento. Las
+//   consultas se resuelven tanto con la rejilla como recorriendo todas las
+//   criaturas, volcando al log el tiempo medio por paso de cada metodo.
+// Parametros:
+// - uwWidth, uwHeight. Dimensiones del area simulada.
+// - uwNumCriatures. Numero de criaturas.
+// - udNumSteps. Numero de pasos.
+// - udSeed. Semilla.
+// Devuelve:
+// Notas:
+// - Solo disponible al compilar con CRIATUREGRID_BENCHMARK.
+// - Se comprobara que ambos metodos obtienen los mismos resultados.
+///////////////////////////////////////////////////////////////////////////////
+void
+CCriatureGrid::RunBenchmark(const word uwWidth,
+							const word uwHeight,
+							const word uwNumCriatures,
+							const dword udNumSteps,
+							const dword udSeed)
+{
+  // SOLO si parametros validos
+  ASSERT(uwWidth);
+  ASSERT(uwHeight);
+  ASSERT(uwNumCriatures);
+
+  // Se situan las criaturas
+  CCriatureGrid Grid;
+  Grid.Init(uwWidth, uwHeight);
+  std::vector<sCriatureInfo> Criatures;
+  Criatures.reserve(uwNumCriatures);
+  dword udSeedValue = udSeed;
+  word uwIt = 0;
+  for (; uwIt < uwNumCriatures; ++uwIt) {
+	udSeedValue = udSeedValue * 1664525 + 1013904223;
+	const AreaDefs::sTilePos TilePos((udSeedValue >> 8) % uwWidth, (udSeedValue >> 20) % uwHeight);
+	udSeedValue = udSeedValue * 1664525 + 1013904223;
+	const RulesDefs::CriatureRange Range = 4 + ((udSeedValue >> 8) % 8);
+	Criatures.push_back(sCriatureInfo(uwIt + 1, TilePos, Range));
+	Grid.Insert(uwIt + 1, TilePos, Range);
+  }
+
+  // Se mueven las criaturas
+  iCTimer* const pTimer = SYSEngine::GetTimer();
+  ASSERT(pTimer);
+  sqword sqGridTime = 0;
+  sqword sqLinearTime = 0;
+  dword udChecksum = 0;
+  dword udMismatches = 0;
+  dword udStep = 0;
+  for (; udStep < udNumSteps; ++udStep) {
+	for (uwIt = 0; uwIt < uwNumCriatures; ++uwIt) {
+	  // Se elige el nuevo tile
+	  sCriatureInfo& Criature = Criatures[uwIt];
+	  udSeedValue = udSeedValue * 1664525 + 1013904223;
+	  AreaDefs::sTilePos NewPos(Criature.TilePos);
+	  NewPos.XTile += sword((udSeedValue >> 8) % 3) - 1;
+	  NewPos.YTile += sword((udSeedValue >> 12) % 3) - 1;
+	  if (NewPos.XTile < 0 || NewPos.XTile >= uwWidth ||
+		  NewPos.YTile < 0 || NewPos.YTile >= uwHeight) {
+		NewPos = Criature.TilePos;
+	  }
+
+	  // Movimiento y consultas sobre la rejilla
+	  CriaturesSet GridInRange, GridContaining;
+	  sqword sqInitTime = pTimer->GetTime(TimerDefs::TIMER_UNITS_US);
+	  Grid.Remove(Criature.hCriature, Criature.TilePos);
+	  Grid.Insert(Criature.hCriature, NewPos, Criature.Range);
+	  Grid.FindInRange(NewPos, Criature.Range, GridInRange);
+	  Grid.FindContaining(NewPos, GridContaining);
+	  sqGridTime += pTimer->GetTime(TimerDefs::TIMER_UNITS_US) - sqInitTime;
+	  Criature.TilePos = NewPos;
+
+	  // Consultas recorriendo todas las criaturas
+	  CriaturesSet LinearInRange, LinearContaining;
+	  sqInitTime = pTimer->GetTime(TimerDefs::TIMER_UNITS_US);
+	  std::vector<sCriatureInfo>::const_iterator It(Criatures.begin());
+	  for (; It != Criatures.end(); ++It) {
+		if (IsInRange(It->TilePos, NewPos, Criature.Range)) {
+		  LinearInRange.insert(It->hCriature);
+		}
+		if (IsInRange(NewPos, It->TilePos, It->Range)) {
+		  LinearContaining.insert(It->hCriature);
+		}
+	  }
+	  sqLinearTime += pTimer->GetTime(TimerDefs::TIMER_UNITS_US) - sqInitTime;
+
+	  // Se comprueban resultados y se actualiza la suma de control
+	  if (GridInRange != LinearInRange ||
+		  GridContaining != LinearContaining) {
+		++udMismatches;
+	  }
+	  udChecksum = (udChecksum * 31) + GridInRange.size();
+	  udChecksum = (udChecksum * 31) + GridContaining.size();
+	}
+  }
+
+  // Se vuelca la informacion
+  const dword udNumMoves = udNumSteps * uwNumCriatures;
+  SYSEngine::GetLogger()->Write("CCriatureGrid::RunBenchmark> Area %ux%u, %u criaturas, %u pasos (semilla %u).\n",
+								uwWidth, uwHeight, uwNumCriatures, udNumSteps, udSeed);
+  SYSEngine::GetLogger()->Write("                           | Rejilla: %u us por paso (%u us por 1000 movimientos).\n",
+								dword(sqGridTime / udNumSteps), dword((sqGridTime * 1000) / udNumMoves));
+  SYSEngine::GetLogger()->Write("                           | Recorrido lineal: %u us por paso (%u us por 1000 movimientos).\n",
+								dword(sqLinearTime / udNumSteps), dword((sqLinearTime * 1000) / udNumMoves));
+  SYSEngine::GetLogger()->Write("                           | Discrepancias: %u, suma de control: 0x%08X.\n",
+								udMismatches, udChecksum);
+}
+#endif
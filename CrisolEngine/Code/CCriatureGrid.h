@@ -0,0 +1,190 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CCriatureGrid.h
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Clase:
+// - CCriatureGrid
+//
+// Descripcion:
+// - Rejilla espacial uniforme con las criaturas (y el jugador) situadas en
+//   el area. El area se dividira en cubetas cuadradas de BUCKET_SIZE tiles
+//   de lado y cada cubeta mantendra las criaturas que se hallen sobre sus
+//   tiles junto a su posicion y rango.
+// - Las consultas de rango solo recorreran las cubetas que solapen con el
+//   rango pedido, de tal forma que su coste dependera del numero de
+//   criaturas cercanas y no del total de criaturas del area.
+//
+// Notas:
+// - El rango de una criatura situada en Pos abarcara las posiciones desde
+//   Pos - Range, incluida, hasta Pos + Range, excluida, tanto en X como en Y.
+// - Para localizar las criaturas que contienen una posicion en su rango se
+//   tomara como radio de busqueda el mayor rango registrado en la rejilla.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _CCRIATUREGRID_H_
+#define _CCRIATUREGRID_H_
+
+// Pragmas <VC6 / Warnings sobre la stl>
+#pragma warning(disable:4786)
+
+// Cabeceras
+#ifndef _SYSDEFS_H_
+#include "SYSDefs.h"
+#endif
+#ifndef _AREADEFS_H_
+#include "AreaDefs.h"
+#endif
+#ifndef _RULESDEFS_H_
+#include "RulesDefs.h"
+#endif
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+#include <vector>
+#endif
+#ifndef _SET_H_
+#define _SET_H_
+#include <set>
+#endif
+
+// Clase CCriatureGrid
+class CCriatureGrid
+{
+private:
+  // Enumerados
+  enum {
+	BUCKET_SHIFT = 3,                 // Desplazamiento tile -> cubeta
+	BUCKET_SIZE  = 1 << BUCKET_SHIFT  // Tiles por lado de cubeta
+  };
+
+private:
+  // Estructuras
+  struct sCriatureInfo {
+	// Criatura registrada en una cubeta
+	AreaDefs::EntHandle      hCriature; // Handle a la criatura
+	AreaDefs::sTilePos       TilePos;   // Posicion de la criatura
+	RulesDefs::CriatureRange Range;     // Rango de la criatura
+	// Constructor
+	sCriatureInfo(const AreaDefs::EntHandle& ahCriature,
+				  const AreaDefs::sTilePos& aTilePos,
+				  const RulesDefs::CriatureRange& aRange): hCriature(ahCriature),
+														   TilePos(aTilePos),
+														   Range(aRange) { }
+  };
+
+private:
+  // Tipos
+  typedef std::vector<sCriatureInfo> CriaturesVector; // Criaturas de una cubeta
+  typedef std::vector<CriaturesVector> BucketsVector; // Cubetas
+
+public:
+  // Tipos
+  typedef std::set<AreaDefs::EntHandle> CriaturesSet; // Conjunto de criaturas
+
+private:
+  // Vbles de miembro
+  BucketsVector            m_Buckets;        // Cubetas
+  word                     m_uwBucketsWidth; // Cubetas a lo ancho
+  word                     m_uwBucketsHeight;// Cubetas a lo alto
+  word                     m_uwNumCriatures; // Criaturas registradas
+  RulesDefs::CriatureRange m_MaxRange;       // Mayor rango registrado
+  bool                     m_bIsInitOk;      // Instancia inicializada?
+
+public:
+  // Constructor / destructor
+  CCriatureGrid(void): m_uwBucketsWidth(0),
+					   m_uwBucketsHeight(0),
+					   m_uwNumCriatures(0),
+					   m_MaxRange(0),
+					   m_bIsInitOk(false) { }
+  ~CCriatureGrid(void) { End(); }
+
+public:
+  // Protocolos de inicializacion / finalizacion
+  bool Init(const word uwWidth,
+			const word uwHeight);
+  void End(void);
+  inline bool IsInitOk(void) const { return m_bIsInitOk; }
+
+public:
+  // Insercion / extraccion de criaturas
+  void Insert(const AreaDefs::EntHandle& hCriature,
+			  const AreaDefs::sTilePos& TilePos,
+			  const RulesDefs::CriatureRange& Range);
+  void Remove(const AreaDefs::EntHandle& hCriature,
+			  const AreaDefs::sTilePos& TilePos);
+  inline word GetNumCriatures(void) const {
+	ASSERT(IsInitOk());
+	// Retorna el numero de criaturas registradas
+	return m_uwNumCriatures;
+  }
+
+public:
+  // Consultas de rango
+  void FindInRange(const AreaDefs::sTilePos& Pos,
+				   const RulesDefs::CriatureRange& Range,
+				   CriaturesSet& InRangeSet) const;
+  void FindContaining(const AreaDefs::sTilePos& Pos,
+					  CriaturesSet& ContainingSet) const;
+  void FindRangeDelta(const AreaDefs::sTilePos& Pos,
+					  const RulesDefs::CriatureRange& Range,
+					  const CriaturesSet& InRangeSet,
+					  CriaturesSet& EnteredSet,
+					  CriaturesSet& LeftSet) const;
+
+  #ifdef CRIATUREGRID_BENCHMARK
+  public:
+	// Banco de pruebas de la rejilla
+	static void RunBenchmark(const word uwWidth,
+							 const word uwHeight,
+							 const word uwNumCriatures,
+							 const dword udNumSteps,
+							 const dword udSeed);
+  #endif
+
+private:
+  // Metodos de apoyo
+  inline sword GetBucketCoord(const sword swTileCoord) const {
+	// Retorna la coordenada de cubeta asociada a una coordenada de tile
+	return swTileCoord >> BUCKET_SHIFT;
+  }
+  inline dword GetBucketIdx(const AreaDefs::sTilePos& TilePos) const {
+	// Retorna el indice de la cubeta asociada a una posicion
+	ASSERT((GetBucketCoord(TilePos.XTile) < m_uwBucketsWidth) != 0);
+	ASSERT((GetBucketCoord(TilePos.YTile) < m_uwBucketsHeight) != 0);
+	return (GetBucketCoord(TilePos.YTile) * m_uwBucketsWidth) + GetBucketCoord(TilePos.XTile);
+  }
+  static inline bool IsInRange(const AreaDefs::sTilePos& TilePos,
+							   const AreaDefs::sTilePos& RangePos,
+							   const RulesDefs::CriatureRange& Range) {
+	// Comprueba si TilePos esta dentro del rango Range centrado en RangePos
+	return (TilePos.XTile >= RangePos.XTile - Range &&
+			TilePos.XTile < RangePos.XTile + Range &&
+			TilePos.YTile >= RangePos.YTile - Range &&
+			TilePos.YTile < RangePos.YTile + Range);
+  }
+  void ClipBuckets(const sword swXMin, const sword swYMin,
+				   const sword swXMax, const sword swYMax,
+				   sword& swXInitBucket, sword& swYInitBucket,
+				   sword& swXEndBucket, sword& swYEndBucket) const;
+}; // ~ CCriatureGrid
+
+#endif // ~ #ifdef _CCRIATUREGRID_H_
@@ -0,0 +1,223 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CEntityTable.h
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Clase:
+// - CEntityTable
+//
+// Descripcion:
+// - Tabla de entidades de un mismo tipo indexada por handle. Cada handle
+//   codificara, ademas del tipo de entidad en sus 4 bits superiores, el
+//   indice del slot que ocupa la entidad, de tal forma que la localizacion
+//   de una entidad sera inmediata.
+// - Los nodos vivos se mantendran, ademas, en un array compacto de tal forma
+//   que el recorrido de todas las entidades de un tipo sera lineal. Al
+//   extraer un nodo, su lugar en el array compacto lo ocupara el ultimo.
+// - Los slots libres se reutilizaran en orden FIFO, alargando el tiempo que
+//   tarda en repetirse un mismo handle.
+// - El handle es un word y no quedan bits libres para una generacion, por lo
+//   que un handle a una entidad ya destruida SOLO se rechazara mientras su
+//   slot no haya sido reutilizado.
+//
+// Notas:
+// - La tabla NO sera propietaria de los nodos, el usuario sera el encargado
+//   de liberarlos tras extraerlos.
+// - La obtencion de un handle, Alloc, y la insercion del nodo asociado,
+//   Insert, seran dos pasos separados pues las entidades necesitan conocer
+//   su handle antes de poder ser insertadas.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _CENTITYTABLE_H_
+#define _CENTITYTABLE_H_
+
+// Pragmas <VC6 / Warnings sobre la stl>
+#pragma warning(disable:4786)
+
+// Cabeceras
+#ifndef _SYSDEFS_H_
+#include "SYSDefs.h"
+#endif
+#ifndef _AREADEFS_H_
+#include "AreaDefs.h"
+#endif
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+#include <vector>
+#endif
+
+// Clase CEntityTable
+template<class Node>
+class CEntityTable
+{
+private:
+  // Enumerados
+  enum {
+	NO_SLOT = 0xFFFF // Indice de slot nulo
+  };
+
+private:
+  // Estructuras
+  struct sSlot {
+	// Slot de la tabla
+	Node* pNode;      // Nodo alojado (NULL si libre o solo reservado)
+	word  uwDensePos; // Posicion del nodo en el array compacto
+	word  uwNextFree; // Sig. slot en la lista de libres
+	bool  bInUse;     // Slot reservado?
+	// Constructor
+	sSlot(void): pNode(NULL),
+				 uwDensePos(0),
+				 uwNextFree(NO_SLOT),
+				 bInUse(false) { }
+  };
+
+private:
+  // Tipos
+  typedef std::vector<sSlot>               SlotsVector;   // Slots
+  typedef std::vector<Node*>               NodesVector;   // Nodos compactos
+  typedef std::vector<AreaDefs::EntHandle> HandlesVector; // Handles compactos
+
+private:
+  // Vbles de miembro
+  SlotsVector         m_Slots;       // Slots de la tabla
+  NodesVector         m_Nodes;       // Nodos vivos en disposicion compacta
+  HandlesVector       m_Handles;     // Handles asociados a m_Nodes
+  AreaDefs::EntHandle m_TypeBits;    // Bits de tipo de los handles
+  word                m_uwFirstFree; // Primer slot libre
+  word                m_uwLastFree;  // Ultimo slot libre
+
+public:
+  // Constructor / destructor
+  CEntityTable(const byte ubEntityType): m_TypeBits(ubEntityType << AreaDefs::ENTHANDLE_TYPE_SHIFT),
+										 m_uwFirstFree(NO_SLOT),
+										 m_uwLastFree(NO_SLOT) { }
+  ~CEntityTable(void) { }
+
+public:
+  // Reserva de handles e insercion / extraccion de nodos
+  AreaDefs::EntHandle Alloc(void) {
+	// Se toma el slot libre mas antiguo o, si no hay, se crea uno nuevo
+	word uwIdx;
+	if (m_uwFirstFree != NO_SLOT) {
+	  uwIdx = m_uwFirstFree;
+	  m_uwFirstFree = m_Slots[uwIdx].uwNextFree;
+	  if (NO_SLOT == m_uwFirstFree) {
+		m_uwLastFree = NO_SLOT;
+	  }
+	} else {
+	  // Se alcanzo el maximo?
+	  if (m_Slots.size() >= AreaDefs::MAX_ENTITIES_BY_TYPE) {
+		return 0;
+	  }
+	  uwIdx = m_Slots.size();
+	  m_Slots.push_back(sSlot());
+	}
+
+	// Se reserva y retorna handle
+	sSlot& Slot = m_Slots[uwIdx];
+	ASSERT(!Slot.bInUse);
+	Slot.bInUse = true;
+	Slot.pNode = NULL;
+	Slot.uwNextFree = NO_SLOT;
+	return MakeHandle(uwIdx);
+  }
+  void Insert(const AreaDefs::EntHandle& hEntity, Node* const pNode) {
+	ASSERT(pNode);
+	ASSERT(IsReserved(hEntity));
+	// Se vincula el nodo al slot y se aade al array compacto
+	sSlot& Slot = m_Slots[GetSlotIdx(hEntity)];
+	ASSERT(!Slot.pNode);
+	Slot.pNode = pNode;
+	Slot.uwDensePos = m_Nodes.size();
+	m_Nodes.push_back(pNode);
+	m_Handles.push_back(hEntity);
+  }
+  Node* const Remove(const AreaDefs::EntHandle& hEntity) {
+	ASSERT(IsReserved(hEntity));
+	// Se desvincula el nodo del array compacto, llevando el ultimo a su lugar
+	const word uwIdx = GetSlotIdx(hEntity);
+	sSlot& Slot = m_Slots[uwIdx];
+	Node* const pNode = Slot.pNode;
+	if (pNode) {
+	  const word uwLastPos = m_Nodes.size() - 1;
+	  if (Slot.uwDensePos != uwLastPos) {
+		m_Nodes[Slot.uwDensePos] = m_Nodes[uwLastPos];
+		m_Handles[Slot.uwDensePos] = m_Handles[uwLastPos];
+		m_Slots[GetSlotIdx(m_Handles[uwLastPos])].uwDensePos = Slot.uwDensePos;
+	  }
+	  m_Nodes.pop_back();
+	  m_Handles.pop_back();
+	}
+
+	// Se libera el slot
+	Slot.pNode = NULL;
+	Slot.bInUse = false;
+	Slot.uwNextFree = NO_SLOT;
+	if (NO_SLOT == m_uwLastFree) {
+	  m_uwFirstFree = uwIdx;
+	} else {
+	  m_Slots[m_uwLastFree].uwNextFree = uwIdx;
+	}
+	m_uwLastFree = uwIdx;
+
+	// Retorna el nodo extraido
+	return pNode;
+  }
+
+public:
+  // Localizacion
+  inline Node* const Find(const AreaDefs::EntHandle& hEntity) const {
+	// Retorna el nodo SOLO si el handle sigue vivo
+	return IsReserved(hEntity) ? m_Slots[GetSlotIdx(hEntity)].pNode : NULL;
+  }
+
+public:
+  // Recorrido lineal
+  inline word GetSize(void) const {
+	return m_Nodes.size();
+  }
+  inline Node* const GetAt(const word uwPos) const {
+	ASSERT((uwPos < m_Nodes.size()) != 0);
+	return m_Nodes[uwPos];
+  }
+  inline AreaDefs::EntHandle GetHandleAt(const word uwPos) const {
+	ASSERT((uwPos < m_Handles.size()) != 0);
+	return m_Handles[uwPos];
+  }
+
+private:
+  // Metodos de apoyo
+  inline AreaDefs::EntHandle MakeHandle(const word uwIdx) const {
+	return (m_TypeBits | uwIdx);
+  }
+  inline word GetSlotIdx(const AreaDefs::EntHandle& hEntity) const {
+	return (hEntity & AreaDefs::ENTHANDLE_INDEX_MASK);
+  }
+  inline bool IsReserved(const AreaDefs::EntHandle& hEntity) const {
+	// Comprueba tipo e indice
+	const word uwIdx = GetSlotIdx(hEntity);
+	return ((hEntity & AreaDefs::ENTHANDLE_TYPE_MASK) == m_TypeBits &&
+			uwIdx < m_Slots.size() &&
+			m_Slots[uwIdx].bInUse);
+  }
+}; // ~ CEntityTable
+
+#endif // ~ #ifdef _CENTITYTABLE_H_
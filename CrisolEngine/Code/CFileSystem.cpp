@@ -28,9 +28,11 @@
 
 #include "SYSEngine.h"   
 #include "iCLogger.h"    
-#include "iCMathUtil.h"
+#include "CAreaLoadProfiler.h"
 #include <fstream>
 #include <algorithm>
+#include <vector>
+#include <string.h>
 #include <io.h>
 
 // Inicializacion de la unica instancia singlenton
@@ -42,7 +44,8 @@ struct CFileSystem::sFileNode {
   enum eFILE_TYPE { 
     // Tipo de fichero
     CPAK_FILE = 1, 
-    DISK_FILE      
+    DISK_FILE,
+	MEM_FILE
   };
 
   // Datos
@@ -52,18 +55,52 @@ struct CFileSystem::sFileNode {
   union {
 	sCPAKFile*    pCPAKFile; // Puntero a CPAK con el fichero en cuestion
 	std::fstream* pDiskFile; // Puntero a objeto fstream al fichero en cuestion
+	sMemFile*     pMemFile;  // Puntero al fichero residente en memoria
   };
+  // Ficheros de disco
+  dword              udDiskFileSize;    // Tamao del fichero
+  std::vector<sbyte> ReadAhead;         // Bloque leido por anticipado
+  dword              udReadAheadOffset; // Offset del bloque en el fichero
+  dword              udReadAheadSize;   // Bytes validos en el bloque
+  // Tabla de handles y tabla hash por nombre
+  FileDefs::FileHandle hFile;         // Handle asociado al fichero
+  dword                udNameHash;    // Hash del nombre
+  sFileNode*           pNextInBucket; // Sig. fichero en la misma entrada
   // Constructor por defecto
   sFileNode(const std::string& aszFileName,
 			sCPAKFile* const apCPAKFile): szFileName(aszFileName),
 										  FileType(CPAK_FILE), 
 										  pCPAKFile(apCPAKFile),
-										  uwInstances(1) { }
+										  uwInstances(1),
+										  udDiskFileSize(0),
+										  udReadAheadOffset(0),
+										  udReadAheadSize(0),
+										  hFile(0),
+										  udNameHash(0),
+										  pNextInBucket(NULL) { }
   sFileNode(const std::string& aszFileName,
-		    std::fstream* const apDiskFile): szFileName(aszFileName),
-										     FileType(DISK_FILE), 
-										     pDiskFile(apDiskFile),
-											 uwInstances(1) { }
+		    std::fstream* const apDiskFile,
+			const dword audDiskFileSize): szFileName(aszFileName),
+										  FileType(DISK_FILE), 
+										  pDiskFile(apDiskFile),
+										  uwInstances(1),
+										  udDiskFileSize(audDiskFileSize),
+										  udReadAheadOffset(0),
+										  udReadAheadSize(0),
+										  hFile(0),
+										  udNameHash(0),
+										  pNextInBucket(NULL) { }
+  sFileNode(const std::string& aszFileName,
+		    sMemFile* const apMemFile): szFileName(aszFileName),
+										FileType(MEM_FILE), 
+										pMemFile(apMemFile),
+										uwInstances(1),
+										udDiskFileSize(0),
+										udReadAheadOffset(0),
+										udReadAheadSize(0),
+										hFile(0),
+										udNameHash(0),
+										pNextInBucket(NULL) { }
   // Pool de memoria
   static CMemoryPool MPool;
   static void* operator new(const size_t size) { return MPool.AllocMem(size); }
@@ -81,6 +118,18 @@ struct CFileSystem::sCPAKFile {
   static void operator delete(void* pItem)  { MPool.FreeMem(pItem); } 
 };
   
+struct CFileSystem::sMemFile {
+  // Datos asociados a un fichero residente en memoria
+  std::string        szFileName;  // Nombre del fichero en disco
+  std::vector<sbyte> Data;        // Contenido del fichero
+  word               uwOpenNodes; // Nodos abiertos sobre el fichero
+  bool               bExist;      // Existe el fichero?
+  // Constructor
+  sMemFile(const std::string& aszFileName): szFileName(aszFileName),
+											uwOpenNodes(0),
+											bExist(false) { }
+};
+
 // Inicializacion del manejador de memoria
 CMemoryPool CFileSystem::sFileNode::MPool(16,
                                           sizeof(CFileSystem::sFileNode), 
@@ -107,9 +156,8 @@ CFileSystem::Init(void)
      SYSEngine::GetLogger()->Write("CFileSystem::Init> Inicializando subsistema de ficheros.\n");        
   #endif
 
-  // Se toman instancias a otros subsistemas
-  m_pMathUtil = SYSEngine::GetMathUtil();
-  ASSERT(m_pMathUtil);
+  // Se prepara la tabla hash por nombre
+  m_NameBuckets.assign(CFileSystem::NAME_HASH_BUCKETS, NULL);
 
   // Se inicializan resto de vbles de miembro
   m_udNumFilesOpen = 0;
@@ -143,6 +191,7 @@ CFileSystem::End(void)
 	// Se cierran, quitan y liberan archivos
     CloseAll();   
     QuitAllCPAKFiles();
+	ReleaseAllMemFiles();
     
     // Se baja el flag de inicializacion
     #ifdef ENGINE_TRACE  
@@ -171,11 +220,14 @@ CFileSystem::CloseAll(void)
   const dword udFilesClosed = m_udNumFilesOpen; 
 
   // Se itera procede a cerrar ficheros y eliminar nodos    
-  while (!m_FileIndex.empty()) {
-	// Se obtiene identificador al primer nodo y se cierra fichero
-	const FileDefs::FileHandle hFile = m_FileIndex.begin()->first;
-	ASSERT(hFile);
-	Close(hFile);
+  HandleSlotVector::iterator SlotIt(m_HandleSlots.begin());
+  for (; SlotIt != m_HandleSlots.end(); ++SlotIt) {
+	// Se cierra el fichero tantas veces como instancias tenga
+	while (SlotIt->pFileNode) {
+	  const FileDefs::FileHandle hFile = SlotIt->pFileNode->hFile;
+	  ASSERT(hFile);
+	  Close(hFile);
+	}
   }
 
   // Se devuelve el num. de ficheros cerrados.  
@@ -229,6 +281,11 @@ CFileSystem::AddCPAKFile(const std::string& szFileName)
 	return false;
   }
 
+  // En depuracion, se comprobara el CRC de cada fichero en su primera lectura
+  #ifdef _DEBUG
+	pCPAKFile->File.SetVerifyOnRead(true);
+  #endif
+
   // Se inserta en la lista y se retorna
   m_CPAKFiles.push_back(pCPAKFile);
   return true;
@@ -285,28 +342,47 @@ CFileSystem::Open(const std::string& szFileName,
   ASSERT(!szFileName.empty());
   
   // Se busca por nombre
-  const CFileNameSearch<FileDefs::FileHandle, sFileNode*> Predicate(szFileName);
-  const FileIndexMapIt It(std::find_if(m_FileIndex.begin(),
-									   m_FileIndex.end(),
-									   Predicate));
+  const dword udNameHash = GetNameHash(szFileName);
+  sFileNode* const pOpenFile = FindOpenFile(szFileName, udNameHash);
 
   // Fichero ya registrado?
-  if (It != m_FileIndex.end()) { 
+  if (pOpenFile) { 
 	// Se pretendia crear?
     if (bCreate) { 
 	  // No se dejara
 	  return 0;
     } else { 
 	  // Incrementa contador de referencias y retorna            
-      ++It->second->uwInstances;      
-      return It->first;
+      ++pOpenFile->uwInstances;      
+      return pOpenFile->hFile;
     }
   }
 
+  // NO quedan handles libres?
+  if (m_FreeSlots.empty() && 
+	  m_HandleSlots.size() >= CFileSystem::HANDLE_MAX_SLOTS) {
+	ASSERT_MSG(false, "CFileSystem::Open> No quedan handles libres");
+	return 0;
+  }
+
   // No se encontro, por lo que se abrira 
-  // Se desea abrir sobreescribiendo?
+  // Reside el fichero en memoria?
   sFileNode* pFileNode = NULL;
-  if (bCreate) {
+  sMemFile* const pMemFile = FindMemFile(szFileName);
+  if (pMemFile) {
+	// Si, se vacia si se desea sobreescribir y se crea nodo
+	// Nota: Si no se desea crear, el fichero ya habra de existir
+	if (bCreate) {
+	  pMemFile->Data.clear();
+	  pMemFile->bExist = true;
+	} else if (!pMemFile->bExist) {
+	  return 0;
+	}
+	pFileNode = new sFileNode(szFileName, pMemFile);
+	ASSERT(pFileNode);
+	++pMemFile->uwOpenNodes;
+  } else if (bCreate) {
+	// No, se desea abrir sobreescribiendo?
     // Se abre el nuevo fichero sobreescribiendolo si ya existia
 	std::fstream* pDiskFile = new std::fstream;
     ASSERT(pDiskFile);	
@@ -321,8 +397,8 @@ CFileSystem::Open(const std::string& szFileName,
 	  return 0;
     }
     
-    // Se crea nodo
-    pFileNode = new sFileNode(szFileName, pDiskFile);
+    // Se crea nodo, con el fichero vacio
+    pFileNode = new sFileNode(szFileName, pDiskFile, 0);
     ASSERT(pFileNode);
   } else {
 	// Se abre sin sobreescribir, luego el fichero ha de existir.
@@ -347,16 +423,19 @@ CFileSystem::Open(const std::string& szFileName,
 		ASSERT(pFileNode);
 	  }
     } else {	  
-	  // Se abrio en disco	  
-	  pFileNode = new sFileNode(szFileName, pDiskFile);
+	  // Se abrio en disco, se toma su tamao y se crea nodo
+	  pDiskFile->seekg(0, std::ios_base::end);
+	  const dword udFileSize = pDiskFile->tellg();
+	  pDiskFile->seekg(0, std::ios_base::beg);
+	  pFileNode = new sFileNode(szFileName, pDiskFile, udFileSize);
 	  ASSERT(pFileNode);
 	}
   }   
 
-  // Se inserta en map
-  const FileDefs::FileHandle hNewFile = CreateNewID();
+  // Se inserta en la tabla de handles y en la tabla hash
+  pFileNode->udNameHash = udNameHash;
+  const FileDefs::FileHandle hNewFile = InsertFileNode(pFileNode);
   ASSERT(hNewFile);
-  m_FileIndex.insert(FileIndexMapValType(hNewFile, pFileNode));
 
   // Se incrementa el num. fichero abiertos
   m_udNumFilesOpen++;
@@ -401,46 +480,49 @@ dword CFileSystem::Read(const FileDefs::FileHandle& hFile,
   dword udDataRead = 0; // Cantidad de informacion leida
   
   // Se obtiene nodo al fichero
-  const FileIndexMapIt It(m_FileIndex.find(hFile));
-  ASSERT((It != m_FileIndex.end()) != 0);
+  sFileNode* const pFileNode = GetFileNode(hFile);
+  ASSERT(pFileNode);
 
   // Se comprueba el tipo de fichero y dependiendo del mismo,
   // se realiza la lectura
-  switch (It->second->FileType) {
+  switch (pFileNode->FileType) {
 	case CFileSystem::sFileNode::DISK_FILE: {
 	  // Fichero fstream
-      // Se ajusta correctamente la cantidad de tamaos a leer
-      ASSERT(It->second->pDiskFile);
-	  It->second->pDiskFile->clear();
-      It->second->pDiskFile->seekg(0, std::ios_base::end);
-      udDataRead = udBuffSize;
-      const dword udFileSize = It->second->pDiskFile->tellg();
-      
-	  // Se intenta leer mas informacion que la que realmente hay?
-	  ASSERT((udInitOffset < udFileSize) != 0);
-      if (udDataRead > udFileSize - udInitOffset) { 
-        // Hay que acotar la cantidad posible a leer
-        udDataRead = udFileSize - udInitOffset;
-      }
-      
-	  // Se procede a leer la informacion      
-	  It->second->pDiskFile->clear();
-      It->second->pDiskFile->seekg(udInitOffset, std::ios_base::beg);
-      It->second->pDiskFile->read(psbBuffer, udDataRead);
+	  // La cantidad a leer se acotara al tamao del fichero
+      ASSERT(pFileNode->pDiskFile);
+	  udDataRead = ReadDiskFile(pFileNode, psbBuffer, udBuffSize, udInitOffset);
 	} break;
 					
     case CFileSystem::sFileNode::CPAK_FILE: {
 	  // Fichero CPAK
       // La cantidad de datos leidos sera ajustada automaticamente 
       // por el fichero CPAK
-      ASSERT(It->second->pCPAKFile);
-	  udDataRead = It->second->pCPAKFile->File.Read(It->second->szFileName,
+      ASSERT(pFileNode->pCPAKFile);
+	  udDataRead = pFileNode->pCPAKFile->File.Read(pFileNode->szFileName,
 													psbBuffer,
 													udBuffSize,
 													udInitOffset);	  
 	} break;
+
+	case CFileSystem::sFileNode::MEM_FILE: {
+	  // Fichero residente en memoria
+	  // Se ajusta la cantidad a leer al tamao del fichero y se copia
+	  ASSERT(pFileNode->pMemFile);
+	  const std::vector<sbyte>& Data = pFileNode->pMemFile->Data;
+	  ASSERT((udInitOffset < Data.size()) != 0);
+	  udDataRead = udBuffSize;
+	  if (udDataRead > Data.size() - udInitOffset) {
+		udDataRead = Data.size() - udInitOffset;
+	  }
+	  memcpy(psbBuffer, &Data[udInitOffset], udDataRead);
+	} break;
   }
 
+  #ifdef AREA_LOAD_PROFILE
+	// Se registra la lectura en el perfilador de carga de areas
+	CAreaLoadProfiler::AddRead(udDataRead);
+  #endif
+
   // Se devuelve la cantidad de bytes leidos
   return udDataRead;
 }
@@ -474,44 +556,51 @@ CFileSystem::ReadLine(const FileDefs::FileHandle& hFile,
   ASSERT(hFile);
 
   // Se obtiene nodo al fichero
-  const FileIndexMapIt It(m_FileIndex.find(hFile));
-  ASSERT((It != m_FileIndex.end()) != 0);
+  sFileNode* const pFileNode = GetFileNode(hFile);
+  ASSERT(pFileNode);
 
   // Se comprueba el tipo de fichero y dependiendo del mismo,
   // se realiza la lectura
-  switch (It->second->FileType) {
+  switch (pFileNode->FileType) {
 	case CFileSystem::sFileNode::DISK_FILE: {
 	  // Fichero fstream
-	  // Se coloca el offset
-	  ASSERT(It->second->pDiskFile);
-	  #ifdef _SYSASSERT
-		//It->second->pDiskFile->clear();
-		//It->second->pDiskFile->seekg(0, std::ios_base::end);
-		ASSERT((udInitOffset <= It->second->pDiskFile->tellg()) != 0);
-	  #endif	  
-	  It->second->pDiskFile->clear();
-	  It->second->pDiskFile->seekg(udInitOffset, std::ios_base::beg);	  
-
-	  // Se leera una nueva linea, como antes de llegar a la nueva linea podra
-	  // haberse incluido el retorno de carro, este sera eliminado del string
-	  std::getline(*It->second->pDiskFile, szDest);	
-	  if (!szDest.empty() && 
-		  '\r' == szDest[szDest.size() - 1]) {
-		szDest.resize(szDest.size() - 1);
-	  }	  
-
-	  // Se retorna el offset avanzado por el archivo
-	  return (word(It->second->pDiskFile->tellg()) - udInitOffset);
+	  // Se lee la linea desde el bloque de lectura anticipada
+	  ASSERT(pFileNode->pDiskFile);
+	  ASSERT((udInitOffset <= pFileNode->udDiskFileSize) != 0);
+	  return ReadDiskLine(pFileNode, udInitOffset, szDest);
 	} break;
 					
     case CFileSystem::sFileNode::CPAK_FILE: {
 	  // Fichero CPAK
-      ASSERT(It->second->pCPAKFile);
-	  ASSERT((udInitOffset <= It->second->pCPAKFile->File.GetFileSize(It->second->szFileName)) != 0);
-      return It->second->pCPAKFile->File.ReadLine(It->second->szFileName,		
+      ASSERT(pFileNode->pCPAKFile);
+	  ASSERT((udInitOffset <= pFileNode->pCPAKFile->File.GetFileSize(pFileNode->szFileName)) != 0);
+      return pFileNode->pCPAKFile->File.ReadLine(pFileNode->szFileName,		
 										          udInitOffset,
 										          szDest);
 	} break;
+
+	case CFileSystem::sFileNode::MEM_FILE: {
+	  // Fichero residente en memoria
+	  // Se toman caracteres hasta la nueva linea, que se saltara
+	  ASSERT(pFileNode->pMemFile);
+	  const std::vector<sbyte>& Data = pFileNode->pMemFile->Data;
+	  ASSERT((udInitOffset <= Data.size()) != 0);
+	  dword udPos = udInitOffset;
+	  szDest = "";
+	  for (; udPos < Data.size() && Data[udPos] != '\n'; ++udPos) {
+		szDest += Data[udPos];
+	  }
+	  if (udPos < Data.size()) {
+		++udPos;
+	  }
+	  if (!szDest.empty() && 
+		  '\r' == szDest[szDest.size() - 1]) {
+		szDest.resize(szDest.size() - 1);
+	  }	  
+
+	  // Se retorna el offset avanzado por el archivo
+	  return udPos - udInitOffset;
+	} break;
   }
   
   // No se ha leido nada
@@ -624,14 +713,33 @@ CFileSystem::Write(const FileDefs::FileHandle& hFile,
   ASSERT(psbBuffer);
 
   // Se obtiene nodo al fichero
-  const FileIndexMapIt It(m_FileIndex.find(hFile));
-  ASSERT((It != m_FileIndex.end()) != 0);
-  ASSERT((CFileSystem::sFileNode::CPAK_FILE != It->second->FileType) != 0);
+  sFileNode* const pFileNode = GetFileNode(hFile);
+  ASSERT(pFileNode);
+  ASSERT((CFileSystem::sFileNode::CPAK_FILE != pFileNode->FileType) != 0);
   
-  // Se procede a realizar la escritura, preparando antes el fichero
-  ASSERT(It->second->pDiskFile);
-  It->second->pDiskFile->seekp(udOffset, std::ios_base::beg);    
-  It->second->pDiskFile->write(psbBuffer, udBuffSize);
+  // Se procede a realizar la escritura segun el tipo de fichero
+  if (CFileSystem::sFileNode::MEM_FILE == pFileNode->FileType) {
+	// Fichero residente en memoria, se amplia si procede y se copia
+	ASSERT(pFileNode->pMemFile);
+	std::vector<sbyte>& Data = pFileNode->pMemFile->Data;
+	if (Data.size() < udOffset + udBuffSize) {
+	  Data.resize(udOffset + udBuffSize);
+	}
+	if (udBuffSize) {
+	  memcpy(&Data[udOffset], psbBuffer, udBuffSize);
+	}
+  } else {
+	// Fichero en disco, preparando antes el fichero
+	ASSERT(pFileNode->pDiskFile);
+	pFileNode->pDiskFile->seekp(udOffset, std::ios_base::beg);    
+	pFileNode->pDiskFile->write(psbBuffer, udBuffSize);
+
+	// Se actualiza el tamao y se descarta el bloque leido por anticipado
+	if (pFileNode->udDiskFileSize < udOffset + udBuffSize) {
+	  pFileNode->udDiskFileSize = udOffset + udBuffSize;
+	}
+	pFileNode->udReadAheadSize = 0;
+  }
 
   // Retorna
   return udBuffSize;
@@ -655,34 +763,41 @@ void CFileSystem::Close(const FileDefs::FileHandle& hFile)
   ASSERT(IsInitOk());
   // SOLO si parametros validos
   ASSERT(hFile);
-  ASSERT((m_FileIndex.find(hFile) != m_FileIndex.end()) != 0);
 
   // Se obtiene nodo al fichero
-  const FileIndexMapIt It(m_FileIndex.find(hFile));
-  ASSERT((It != m_FileIndex.end()) != 0);
+  sFileNode* const pFileNode = GetFileNode(hFile);
+  ASSERT(pFileNode);
  
   // Se decrementa el num. de instancias y se evalua el resultado
-  --It->second->uwInstances;
-  if (!It->second->uwInstances) { 
-    switch (It->second->FileType) {
+  --pFileNode->uwInstances;
+  if (!pFileNode->uwInstances) { 
+    switch (pFileNode->FileType) {
 	  case CFileSystem::sFileNode::DISK_FILE: {
 		// Fichero fstream    
-		It->second->pDiskFile->clear();
-		It->second->pDiskFile->close();
-		delete It->second->pDiskFile;
+		pFileNode->pDiskFile->clear();
+		pFileNode->pDiskFile->close();
+		delete pFileNode->pDiskFile;
 	  } break; 
   
 	  case CFileSystem::sFileNode::CPAK_FILE: { 
 		// Fichero en CPAK
 		// En este caso, realmente no habra que realizar ningun tipo de
 		// cierre sobre el fichero, pues estara embebido en el CPAK.
-		It->second->pCPAKFile = NULL;
+		pFileNode->pCPAKFile = NULL;
+	  } break;
+
+	  case CFileSystem::sFileNode::MEM_FILE: { 
+		// Fichero residente en memoria
+		// El contenido se conservara hasta volcarse o descartarse
+		ASSERT(pFileNode->pMemFile->uwOpenNodes);
+		--pFileNode->pMemFile->uwOpenNodes;
+		pFileNode->pMemFile = NULL;
 	  } break;
 	}; // ~ switch
 
-	// Finalmente se libera instancia y nodo
-	delete It->second;
-	m_FileIndex.erase(It);
+	// Finalmente se quita de las tablas y se libera el nodo
+	RemoveFileNode(hFile);
+	delete pFileNode;
   };  
 
   // Antes de salir se decrementa el contador de fich. abiertos
@@ -709,31 +824,332 @@ dword CFileSystem::GetFileSize(const FileDefs::FileHandle& hFile)
   ASSERT(hFile);
 
   // Se obtiene nodo al fichero
-  const FileIndexMapIt It(m_FileIndex.find(hFile));
-  ASSERT((It != m_FileIndex.end()) != 0);
+  sFileNode* const pFileNode = GetFileNode(hFile);
+  ASSERT(pFileNode);
 
   // Se obtiene el tamao del fichero, atentiendo antes al tipo
   // de fichero sobre el que se desee hacer la operacion.
-  switch (It->second->FileType) {
+  switch (pFileNode->FileType) {
 	case CFileSystem::sFileNode::DISK_FILE: {
-	  // Fichero fstream    
-	  ASSERT(It->second->pDiskFile);
-	  It->second->pDiskFile->clear();
-	  It->second->pDiskFile->seekg(0, std::ios_base::end);
-	  return (dword)(It->second->pDiskFile->tellg());
+	  // Fichero fstream, se retorna el tamao guardado
+	  ASSERT(pFileNode->pDiskFile);
+	  return pFileNode->udDiskFileSize;
 	} break; 
   
 	case CFileSystem::sFileNode::CPAK_FILE: { 
 	  // Fichero en CPAK
-	  ASSERT(It->second->pCPAKFile);
-	  return It->second->pCPAKFile->File.GetFileSize(It->second->szFileName);
+	  ASSERT(pFileNode->pCPAKFile);
+	  return pFileNode->pCPAKFile->File.GetFileSize(pFileNode->szFileName);
+	} break;
+
+	case CFileSystem::sFileNode::MEM_FILE: { 
+	  // Fichero residente en memoria
+	  ASSERT(pFileNode->pMemFile);
+	  return pFileNode->pMemFile->Data.size();
 	} break;
   };
 
   // Hubo algun problema
   return 0;
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el contenido del fichero asociado al identificador pasado sin
+//   realizar copia alguna. Estara disponible para los ficheros embebidos en
+//   un CPAK proyectado en memoria y para los ficheros residentes en memoria.
+// Parametros:
+// - hFile: Identificador del fichero.
+// - udSize: Referencia en donde depositar el tamao del contenido.
+// Devuelve:
+// - Puntero al contenido del fichero. En caso de que no se pueda acceder
+//   sin copia se devolvera NULL, debiendose de usar Read.
+// Notas:
+// - El puntero solo sera valido mientras el fichero permanezca abierto y,
+//   en el caso de ficheros residentes en memoria, no se escriba en ellos.
+///////////////////////////////////////////////////////////////////////////////
+const sbyte* const 
+CFileSystem::GetFileData(const FileDefs::FileHandle& hFile,
+						 dword& udSize)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT(hFile);
+
+  // Se obtiene nodo al fichero
+  sFileNode* const pFileNode = GetFileNode(hFile);
+  ASSERT(pFileNode);
+
+  // Se obtiene el contenido atendiendo al tipo de fichero
+  const sbyte* psbData = NULL;
+  udSize = 0;
+  switch (pFileNode->FileType) {
+	case CFileSystem::sFileNode::CPAK_FILE: { 
+	  // Fichero en CPAK
+	  ASSERT(pFileNode->pCPAKFile);
+	  psbData = pFileNode->pCPAKFile->File.GetFileData(pFileNode->szFileName,
+														udSize);
+	} break;
+
+	case CFileSystem::sFileNode::MEM_FILE: { 
+	  // Fichero residente en memoria
+	  ASSERT(pFileNode->pMemFile);
+	  if (!pFileNode->pMemFile->Data.empty()) {
+		udSize = pFileNode->pMemFile->Data.size();
+		psbData = &pFileNode->pMemFile->Data[0];
+	  }
+	} break;
+  }; // ~ switch
+
+  #ifdef AREA_LOAD_PROFILE
+	// Se registra el acceso como lectura en el perfilador de carga de areas
+	if (psbData) {
+	  CAreaLoadProfiler::AddRead(udSize);
+	}
+  #endif
+
+  // Se retorna
+  return psbData;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene, sin realizar copia alguna, los datos tal y como se hallan
+//   almacenados en un CPAK proyectado en memoria, esten o no comprimidos.
+// Parametros:
+// - hFile: Identificador del fichero.
+// - udStoredSize: Referencia en donde depositar el tamao almacenado.
+// - udSize: Referencia en donde depositar el tamao del contenido.
+// - bCompressed: Referencia en donde depositar si esta comprimido.
+// Devuelve:
+// - Puntero a los datos almacenados. Si el fichero no se halla en un CPAK
+//   proyectado se devolvera NULL.
+// Notas:
+// - El puntero solo sera valido mientras el fichero permanezca abierto. 
+//   Los datos comprimidos se obtendran con UnpackFileData.
+///////////////////////////////////////////////////////////////////////////////
+const sbyte* const 
+CFileSystem::GetFileStoredData(const FileDefs::FileHandle& hFile,
+							   dword& udStoredSize,
+							   dword& udSize,
+							   bool& bCompressed)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT(hFile);
+
+  // Se obtiene nodo al fichero
+  sFileNode* const pFileNode = GetFileNode(hFile);
+  ASSERT(pFileNode);
+
+  // Fichero en CPAK?
+  if (CFileSystem::sFileNode::CPAK_FILE == pFileNode->FileType) {
+	// Si, se obtienen los datos almacenados
+	ASSERT(pFileNode->pCPAKFile);
+	return pFileNode->pCPAKFile->File.GetStoredData(pFileNode->szFileName,
+													udStoredSize,
+													udSize,
+													bCompressed);
+  }
+
+  // No
+  udStoredSize = 0;
+  udSize = 0;
+  bCompressed = false;
+  return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Descomprime los datos almacenados obtenidos con GetFileStoredData.
+// Parametros:
+// - psbStored, udStoredSize: Datos almacenados y su tamao.
+// - psbDest, udSize: Destino y tamao del contenido.
+// Devuelve:
+// - Si los datos son validos y se han descomprimido true. En caso 
+//   contrario false.
+// Notas:
+// - No accede a ningun dato del subsistema, luego se podra llamar desde
+//   cualquier hilo.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CFileSystem::UnpackFileData(const sbyte* const psbStored,
+							const dword udStoredSize,
+							sbyte* const psbDest,
+							const dword udSize) const
+{
+  // SOLO si parametros validos
+  ASSERT(psbStored);
+  ASSERT(psbDest);
+
+  // Se descomprime
+  return CCPAKFile::UnpackContent((const byte*)(psbStored), 
+								  udStoredSize, 
+								  (byte*)(psbDest), 
+								  udSize);
+}
   
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee de un fichero de disco. Las lecturas de menor tamao que el bloque
+//   de lectura anticipada se serviran desde este, rellenandolo si procede.
+//   El resto se leeran directamente del fichero.
+// Parametros:
+// - pFileNode: Nodo del fichero.
+// - psbBuffer, udSize: Buffer destino y cantidad a leer.
+// - udOffset: Offset en donde comenzar a leer.
+// Devuelve:
+// - La cantidad de informacion leida.
+// Notas:
+// - La cantidad a leer se acotara al tamao del fichero. Si la lectura se
+//   quedara corta, se retornara lo realmente leido.
+///////////////////////////////////////////////////////////////////////////////
+dword 
+CFileSystem::ReadDiskFile(sFileNode* const pFileNode,
+						  sbyte* const psbBuffer,
+						  const dword udSize,
+						  const dword udOffset)
+{
+  // SOLO si parametros validos
+  ASSERT(pFileNode);
+  ASSERT(pFileNode->pDiskFile);
+  ASSERT(psbBuffer);
+
+  // Se intenta leer mas informacion que la que realmente hay?
+  ASSERT((udOffset < pFileNode->udDiskFileSize) != 0);
+  dword udDataRead = udSize;
+  if (udDataRead > pFileNode->udDiskFileSize - udOffset) { 
+	// Hay que acotar la cantidad posible a leer
+	udDataRead = pFileNode->udDiskFileSize - udOffset;
+  }
+
+  // Lectura mayor que el bloque de lectura anticipada?
+  if (udDataRead >= CFileSystem::READ_AHEAD_SIZE) {
+	// Si, se lee directamente, retornando lo realmente leido
+	pFileNode->pDiskFile->clear();
+	pFileNode->pDiskFile->seekg(udOffset, std::ios_base::beg);
+	pFileNode->pDiskFile->read(psbBuffer, udDataRead);
+	return pFileNode->pDiskFile->gcount();
+  }
+
+  // No, NO esta lo pedido en el bloque leido?
+  if (udOffset < pFileNode->udReadAheadOffset ||
+	  udOffset + udDataRead > pFileNode->udReadAheadOffset + pFileNode->udReadAheadSize) {
+	// Se lee el bloque a partir del offset, acotando por si no se leyera
+	// completamente
+	FillReadAhead(pFileNode, udOffset);
+	if (udDataRead > pFileNode->udReadAheadSize) {
+	  udDataRead = pFileNode->udReadAheadSize;
+	}
+  }
+
+  // Se copia desde el bloque
+  if (udDataRead) {
+	memcpy(psbBuffer, 
+		   &pFileNode->ReadAhead[udOffset - pFileNode->udReadAheadOffset],
+		   udDataRead);
+  }
+  return udDataRead;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee una linea de un fichero de disco desde el bloque de lectura
+//   anticipada, rellenandolo tantas veces como sea necesario.
+// Parametros:
+// - pFileNode: Nodo del fichero.
+// - udInitOffset. Offset en donde comenzar a leer la linea.
+// - szDest. String donde depositar la linea, sin retorno de carro.
+// Devuelve:
+// - El offset que se ha movido para leer, incluyendo la nueva linea.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+dword 
+CFileSystem::ReadDiskLine(sFileNode* const pFileNode,
+						  const dword udInitOffset,
+						  std::string& szDest)
+{
+  // SOLO si parametros validos
+  ASSERT(pFileNode);
+  ASSERT(pFileNode->pDiskFile);
+
+  // Se toman caracteres hasta la nueva linea, que se saltara
+  szDest = "";
+  dword udPos = udInitOffset;
+  while (udPos < pFileNode->udDiskFileSize) {
+	// Hay que rellenar el bloque?
+	if (udPos < pFileNode->udReadAheadOffset ||
+		udPos >= pFileNode->udReadAheadOffset + pFileNode->udReadAheadSize) {
+	  FillReadAhead(pFileNode, udPos);
+	  if (0 == pFileNode->udReadAheadSize) {
+		// No se pudo leer
+		break;
+	  }
+	}
+
+	// Se busca la nueva linea en lo que resta de bloque
+	const sbyte* const psbBegin = &pFileNode->ReadAhead[udPos - pFileNode->udReadAheadOffset];
+	const dword udLeft = pFileNode->udReadAheadOffset + pFileNode->udReadAheadSize - udPos;
+	const sbyte* const psbNewLine = (const sbyte*)(memchr(psbBegin, '\n', udLeft));
+	if (psbNewLine) {
+	  // Se toma la linea y se salta la nueva linea
+	  szDest.append(psbBegin, psbNewLine - psbBegin);
+	  udPos += (psbNewLine - psbBegin) + 1;
+	  break;
+	}
+	szDest.append(psbBegin, udLeft);
+	udPos += udLeft;
+  }
+
+  // Se elimina el posible retorno de carro
+  if (!szDest.empty() && 
+	  '\r' == szDest[szDest.size() - 1]) {
+	szDest.resize(szDest.size() - 1);
+  }	  
+
+  // Se retorna el offset avanzado por el archivo
+  return udPos - udInitOffset;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Rellena el bloque de lectura anticipada de un fichero de disco a partir
+//   del offset indicado.
+// Parametros:
+// - pFileNode: Nodo del fichero.
+// - udOffset: Offset en donde comenzar a leer.
+// Devuelve:
+// Notas:
+// - El bloque se alojara en la primera llamada.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CFileSystem::FillReadAhead(sFileNode* const pFileNode,
+						   const dword udOffset)
+{
+  // SOLO si parametros validos
+  ASSERT(pFileNode);
+  ASSERT(pFileNode->pDiskFile);
+  ASSERT((udOffset < pFileNode->udDiskFileSize) != 0);
+
+  // Se acota la cantidad a leer al tamao del fichero
+  dword udSize = pFileNode->udDiskFileSize - udOffset;
+  if (udSize > CFileSystem::READ_AHEAD_SIZE) {
+	udSize = CFileSystem::READ_AHEAD_SIZE;
+  }
+
+  // Se lee
+  if (pFileNode->ReadAhead.empty()) {
+	pFileNode->ReadAhead.resize(CFileSystem::READ_AHEAD_SIZE);
+  }
+  pFileNode->pDiskFile->clear();
+  pFileNode->pDiskFile->seekg(udOffset, std::ios_base::beg);
+  pFileNode->pDiskFile->read(&pFileNode->ReadAhead[0], udSize);
+  pFileNode->udReadAheadOffset = udOffset;
+  pFileNode->udReadAheadSize = pFileNode->pDiskFile->gcount();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Busca entre los ficheros CPAK y abre el archivo especificado, devolviendo
@@ -767,30 +1183,413 @@ CFileSystem::OpenInCPAKFile(const std::string& szFileName)
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Genera un nuevo identificador con la condicion de que no sea 0 y que
-//   tampoco se encuentre ya registrado en el arbol
+// - Hace residente en memoria el fichero szFileName. Si el fichero existe
+//   en disco, su contenido se cargara en memoria y, en caso contrario, se
+//   partira de un fichero vacio. A partir de ese momento, las aperturas del
+//   fichero trabajaran sobre la memoria sin acceder a disco.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// Devuelve:
+// - Si el fichero se ha hecho residente true. Si ya lo era false.
+// Notas:
+// - El fichero no debera de estar abierto desde disco en ese momento.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CFileSystem::CreateMemFile(const std::string& szFileName)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT(!szFileName.empty());
+
+  // Ya era residente?
+  std::string szFileNameLowercase(szFileName);
+  SYSEngine::MakeLowercase(szFileNameLowercase);
+  if (m_MemFiles.find(szFileNameLowercase) != m_MemFiles.end()) {
+	return false;
+  }
+
+  // Se crea el fichero y se carga el posible contenido en disco
+  sMemFile* const pMemFile = new sMemFile(szFileName);
+  ASSERT(pMemFile);
+  std::fstream DiskFile;
+  DiskFile.open(szFileName.c_str(), std::ios_base::in | std::ios_base::binary);
+  if (!DiskFile.fail()) {
+	pMemFile->bExist = true;
+	DiskFile.seekg(0, std::ios_base::end);
+	const dword udFileSize = DiskFile.tellg();
+	if (udFileSize) {
+	  pMemFile->Data.resize(udFileSize);
+	  DiskFile.seekg(0, std::ios_base::beg);
+	  DiskFile.read(&pMemFile->Data[0], udFileSize);
+	}
+	DiskFile.close();
+  }
+
+  // Se registra y retorna
+  m_MemFiles.insert(MemFileMapValType(szFileNameLowercase, pMemFile));
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Hace residente en memoria el fichero szFileName tomando como contenido
+//   el buffer recibido, sin acceder a disco.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// - psbData. Contenido del fichero.
+// - udSize. Tamao del contenido.
+// Devuelve:
+// - Si el fichero se ha hecho residente true. Si ya lo era false.
+// Notas:
+// - El contenido se copiara, pudiendose liberar el buffer a la vuelta.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CFileSystem::CreateMemFile(const std::string& szFileName,
+						   const sbyte* const psbData,
+						   const dword udSize)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT(!szFileName.empty());
+  ASSERT((psbData || !udSize) != 0);
+
+  // Ya era residente?
+  std::string szFileNameLowercase(szFileName);
+  SYSEngine::MakeLowercase(szFileNameLowercase);
+  if (m_MemFiles.find(szFileNameLowercase) != m_MemFiles.end()) {
+	return false;
+  }
+
+  // Se crea el fichero con el contenido recibido
+  sMemFile* const pMemFile = new sMemFile(szFileName);
+  ASSERT(pMemFile);
+  pMemFile->bExist = true;
+  pMemFile->Data.assign(psbData, psbData + udSize);
+
+  // Se registra y retorna
+  m_MemFiles.insert(MemFileMapValType(szFileNameLowercase, pMemFile));
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Vuelca a disco el contenido de un fichero residente en memoria y lo
+//   descarta de memoria.
 // Parametros:
+// - szFileName. Nombre del fichero.
 // Devuelve:
-// - El nuevo identificador creado
+// - Si se ha podido volcar true. En caso contrario false, permaneciendo el
+//   fichero en memoria.
+// Notas:
+// - El fichero no podra estar abierto.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CFileSystem::FlushMemFile(const std::string& szFileName)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se localiza el fichero
+  sMemFile* const pMemFile = FindMemFile(szFileName);
+  ASSERT(pMemFile);
+  ASSERT(!pMemFile->uwOpenNodes);
+
+  // NO existe el fichero?
+  if (!pMemFile->bExist) {
+	// No hay nada que volcar, se descarta
+	ReleaseMemFile(szFileName);
+	return true;
+  }
+
+  // Se vuelca a disco
+  std::fstream DiskFile;
+  DiskFile.open(pMemFile->szFileName.c_str(), 
+				std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  if (DiskFile.fail()) {
+	// Problemas
+	return false;
+  }
+  if (!pMemFile->Data.empty()) {
+	DiskFile.write(&pMemFile->Data[0], pMemFile->Data.size());
+  }
+  DiskFile.close();
+
+  // Se descarta de memoria
+  ReleaseMemFile(szFileName);
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Descarta de memoria un fichero residente sin volcar su contenido.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// Devuelve:
+// Notas:
+// - El fichero no podra estar abierto.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CFileSystem::ReleaseMemFile(const std::string& szFileName)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se localiza y, si procede, se libera
+  std::string szFileNameLowercase(szFileName);
+  SYSEngine::MakeLowercase(szFileNameLowercase);
+  const MemFileMapIt It(m_MemFiles.find(szFileNameLowercase));
+  if (It != m_MemFiles.end()) {
+	ASSERT(!It->second->uwOpenNodes);
+	delete It->second;
+	m_MemFiles.erase(It);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprueba si un fichero es residente en memoria.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// Devuelve:
+// - Si es residente true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CFileSystem::IsMemFile(const std::string& szFileName)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se localiza
+  return (FindMemFile(szFileName) != NULL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene la memoria ocupada por el contenido de un fichero residente.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// Devuelve:
+// - El tamao del fichero o 0 si no es residente.
 // Notas:
-// - Para crear el identificador se utilizara un generador de numeros aleatorios
 ///////////////////////////////////////////////////////////////////////////////
 dword 
-CFileSystem::CreateNewID(void)
+CFileSystem::GetMemFileSize(const std::string& szFileName)
 {
-  // SOLO si la instancia esta correctamente inicializada
+  // SOLO si instancia inicializada
   ASSERT(IsInitOk());
 
-  // Se obtiene un ID
-  m_pMathUtil->GenSeed();
-  FileDefs::FileHandle hFile = 0;
-  do {     
-    hFile = m_pMathUtil->GetRandValue(1, 0x7FFF);
-  } while (!(m_FileIndex.find(hFile) == m_FileIndex.end()));
+  // Se localiza y retorna
+  sMemFile* const pMemFile = FindMemFile(szFileName);
+  return pMemFile ? pMemFile->Data.size() : 0;
+}
 
-  // Se retorna el identificador
-  ASSERT(hFile);
-  return hFile;
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el contenido de un fichero residente.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// Devuelve:
+// - El contenido del fichero o NULL si no es residente, no existe o esta
+//   vacio.
+// Notas:
+// - El puntero solo sera valido mientras el fichero no se modifique ni
+//   se descarte de memoria.
+///////////////////////////////////////////////////////////////////////////////
+const sbyte* const 
+CFileSystem::GetMemFileData(const std::string& szFileName)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se localiza y retorna
+  sMemFile* const pMemFile = FindMemFile(szFileName);
+  if (!pMemFile || !pMemFile->bExist || pMemFile->Data.empty()) {
+	return NULL;
+  }
+  return &pMemFile->Data[0];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Localiza un fichero residente en memoria a partir de su nombre, sin
+//   distinguir mayusculas de minusculas.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// Devuelve:
+// - El fichero residente o NULL si no lo es.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+CFileSystem::sMemFile* const 
+CFileSystem::FindMemFile(const std::string& szFileName)
+{
+  // Hay ficheros residentes?
+  if (m_MemFiles.empty()) {
+	return NULL;
+  }
+
+  // Se localiza
+  std::string szFileNameLowercase(szFileName);
+  SYSEngine::MakeLowercase(szFileNameLowercase);
+  const MemFileMapIt It(m_MemFiles.find(szFileNameLowercase));
+  return (It != m_MemFiles.end()) ? It->second : NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Descarta todos los ficheros residentes en memoria.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CFileSystem::ReleaseAllMemFiles(void)
+{
+  // Se liberan
+  MemFileMapIt It(m_MemFiles.begin());
+  for (; It != m_MemFiles.end(); ++It) {
+	delete It->second;
+  }
+  m_MemFiles.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Inserta un nodo en la tabla de handles, reutilizando una posicion libre
+//   si la hubiera, y en la tabla hash por nombre.
+// Parametros:
+// - pFileNode: Nodo a insertar.
+// Devuelve:
+// - El handle asociado al nodo.
+// Notas:
+// - Debera de quedar al menos una posicion libre o por crear.
+///////////////////////////////////////////////////////////////////////////////
+FileDefs::FileHandle 
+CFileSystem::InsertFileNode(sFileNode* const pFileNode)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT(pFileNode);
+
+  // Se toma una posicion libre o se crea una nueva
+  word uwSlot;
+  if (!m_FreeSlots.empty()) {
+	uwSlot = m_FreeSlots.back();
+	m_FreeSlots.pop_back();
+  } else {
+	ASSERT((m_HandleSlots.size() < CFileSystem::HANDLE_MAX_SLOTS) != 0);
+	uwSlot = m_HandleSlots.size();
+	sHandleSlot NewSlot;
+	NewSlot.pFileNode = NULL;
+	NewSlot.ubGeneration = 1;
+	m_HandleSlots.push_back(NewSlot);
+  }
+
+  // Se asocia el nodo y se forma el handle
+  sHandleSlot& Slot = m_HandleSlots[uwSlot];
+  ASSERT(!Slot.pFileNode);
+  Slot.pFileNode = pFileNode;
+  pFileNode->hFile = (Slot.ubGeneration << CFileSystem::HANDLE_SLOT_BITS) | uwSlot;
+  ASSERT((pFileNode->hFile <= MAX_IDHANDLE_VALUE) != 0);
+
+  // Se inserta al comienzo de su entrada en la tabla hash
+  sFileNode*& pBucket = m_NameBuckets[pFileNode->udNameHash & (CFileSystem::NAME_HASH_BUCKETS - 1)];
+  pFileNode->pNextInBucket = pBucket;
+  pBucket = pFileNode;
+
+  // Se retorna el handle
+  return pFileNode->hFile;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Quita de la tabla de handles y de la tabla hash por nombre el nodo
+//   asociado a un handle. La posicion quedara libre con una nueva 
+//   generacion, invalidando el handle.
+// Parametros:
+// - hFile: Handle del fichero.
+// Devuelve:
+// Notas:
+// - El nodo no se liberara.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CFileSystem::RemoveFileNode(const FileDefs::FileHandle& hFile)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se obtiene el nodo
+  sFileNode* const pFileNode = GetFileNode(hFile);
+  ASSERT(pFileNode);
+
+  // Se quita de su entrada en la tabla hash
+  sFileNode** ppNode = &m_NameBuckets[pFileNode->udNameHash & (CFileSystem::NAME_HASH_BUCKETS - 1)];
+  while (*ppNode != pFileNode) {
+	ASSERT(*ppNode);
+	ppNode = &(*ppNode)->pNextInBucket;
+  }
+  *ppNode = pFileNode->pNextInBucket;
+  pFileNode->pNextInBucket = NULL;
+
+  // Se libera la posicion, pasando a la siguiente generacion
+  const word uwSlot = hFile & (CFileSystem::HANDLE_MAX_SLOTS - 1);
+  sHandleSlot& Slot = m_HandleSlots[uwSlot];
+  Slot.pFileNode = NULL;
+  Slot.ubGeneration = (Slot.ubGeneration < CFileSystem::HANDLE_MAX_GEN) ? Slot.ubGeneration + 1 : 1;
+  m_FreeSlots.push_back(uwSlot);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Localiza, a traves de la tabla hash, un fichero abierto por su nombre.
+// Parametros:
+// - szFileName: Nombre del fichero.
+// - udHash: Hash del nombre.
+// Devuelve:
+// - El nodo del fichero o NULL si no esta abierto.
+// Notas:
+// - La comparacion de nombres distinguira mayusculas y minusculas.
+///////////////////////////////////////////////////////////////////////////////
+CFileSystem::sFileNode* const 
+CFileSystem::FindOpenFile(const std::string& szFileName,
+						  const dword udHash)
+{
+  // Se recorre la entrada en la tabla hash
+  sFileNode* pFileNode = m_NameBuckets[udHash & (CFileSystem::NAME_HASH_BUCKETS - 1)];
+  for (; pFileNode; pFileNode = pFileNode->pNextInBucket) {
+	if (pFileNode->udNameHash == udHash &&
+		0 == strcmp(szFileName.c_str(), pFileNode->szFileName.c_str())) {
+	  return pFileNode;
+	}
+  }
+
+  // No se encontro
+  return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Calcula el hash (FNV-1a) de un nombre de fichero.
+// Parametros:
+// - szFileName: Nombre del fichero.
+// Devuelve:
+// - El hash calculado.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+dword 
+CFileSystem::GetNameHash(const std::string& szFileName)
+{
+  // Se calcula y retorna
+  dword udHash = 2166136261;
+  std::string::const_iterator It(szFileName.begin());
+  for (; It != szFileName.end(); ++It) {
+	udHash ^= byte(*It);
+	udHash *= 16777619;
+  }
+  return udHash;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -37,6 +37,19 @@
 //   fichero mediante Open, primero se comprobara si dicho fichero existe 
 //   individualmente en disco. En caso de que no exista en disco, se pasara
 //   a buscarlo en los ficheros CPAK. 
+// - Los ficheros residentes en memoria tendran prioridad sobre los de disco
+//   y los CPAK. Se crearan de forma explicita y se comportaran como ficheros
+//   de disco normales hasta que se vuelquen a disco o se descarten.
+// - De los ficheros de disco se guardara el tamao al abrirlos y se leera
+//   por anticipado en bloques de READ_AHEAD_SIZE bytes, de tal forma que las
+//   lecturas pequeas y consecutivas (ReadLine, ReadStringFromBinary, etc.)
+//   se sirvan desde memoria. Las escrituras invalidaran el bloque leido.
+// - Los handles a ficheros abiertos estaran formados por la posicion del
+//   nodo en una tabla (m_HandleSlots) y por una generacion, que cambiara
+//   cada vez que se reutilice la posicion, de tal forma que un handle ya
+//   cerrado no se confunda con uno nuevo. Los ficheros abiertos tambien se
+//   hallaran en una tabla hash por nombre (m_NameBuckets), para localizar
+//   en tiempo constante los que se vuelvan a abrir.
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef _CFILESYSTEM_H_
 #define _CFILESYSTEM_H_
@@ -63,9 +76,12 @@
 #define _MAP_H_
 #include <map>
 #endif     
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+#include <vector>
+#endif
 
 // Defincion de clases / estructuras / espacios de nombres
-struct iCMathUtil;
 
 // Clase CFileSystem
 class CFileSystem: public iCFileSystem
@@ -74,57 +90,65 @@ private:
   // Constantes
   const word MAX_IDHANDLE_VALUE; // Valor maximo de un identificador
 
+private:
+  // Enumerados
+  enum {
+	READ_AHEAD_SIZE = 4096 // Tamao del bloque de lectura anticipada
+  };
+  enum {
+	// Tabla de handles
+	HANDLE_SLOT_BITS  = 10,                    // Bits para la posicion
+	HANDLE_MAX_SLOTS  = 1 << HANDLE_SLOT_BITS, // Ficheros abiertos a la vez
+	HANDLE_MAX_GEN    = 0x7FFF >> HANDLE_SLOT_BITS, // Generacion maxima
+	NAME_HASH_BUCKETS = 256                    // Entradas de la tabla hash
+  };
+
 private:
   // Estructuras forward
   struct sCPAKFile;
+  struct sMemFile;
 
 private:
   // Tipos
   // Lista de CPAKs instalados en sistema
   typedef std::list<sCPAKFile*> CPAKList;  
   typedef CPAKList::iterator    CPAKListIt;
+  // Map con los ficheros residentes en memoria (nombre en minusculas)
+  typedef std::map<std::string, sMemFile*> MemFileMap;
+  typedef MemFileMap::iterator             MemFileMapIt;
+  typedef MemFileMap::value_type           MemFileMapValType;
   
 private:  
   // Estructuras forward
   struct sFileNode;
   
 private:
-  // Tipos
-  // Map para trabajar con los handles asociados a los ficheros
-  typedef std::map<FileDefs::FileHandle, sFileNode*> FileIndexMap;
-  typedef FileIndexMap::iterator                     FileIndexMapIt;
-  typedef FileIndexMap::value_type                   FileIndexMapValType;
+  // Estructuras
+  struct sHandleSlot {
+	// Posicion en la tabla de handles
+	sFileNode* pFileNode;    // Nodo del fichero abierto (o NULL si libre)
+	byte       ubGeneration; // Generacion actual de la posicion
+  };
 
 private:
-  // Predicado para la busqueda de ficheros por el nombre (valor)  
-  template<class First, class Second>
-  class CFileNameSearch {
-  private:
-	// Vbles de miembro
-	std::string m_szFileName; // Nombre del fichero a localizar
-
-  public:
-	// Constructor
-	CFileNameSearch(const std::string& szFileName): m_szFileName(szFileName) { }
-
-  public:
-	// Predicado de busqueda
-	bool operator() (std::pair<const First, Second>& Node) {
-	  return (0 == strcmp(m_szFileName.c_str(), Node.second->szFileName.c_str()));
-	}  
-  }; // ~ MapValueSearch
+  // Tipos
+  // Tabla de handles a los ficheros abiertos y posiciones libres
+  typedef std::vector<sHandleSlot> HandleSlotVector;
+  typedef std::vector<word>        FreeSlotVector;
+  // Tabla hash por nombre de los ficheros abiertos
+  typedef std::vector<sFileNode*>  NameBucketVector;
 
  
 private:
   // Instancia Singlenton
   static CFileSystem* m_pFileSystem; // Unica instancia a la clase
   
-  // Instancias a otros subsistemas
-  iCMathUtil* m_pMathUtil; // Utilidades matematicas
-
   // Estructuras con archivos
-  FileIndexMap     m_FileIndex; // Map con los handles a ficheros abiertos
-  CPAKList         m_CPAKFiles; // Ficheros CPAK Instalados
+  HandleSlotVector m_HandleSlots; // Tabla con los ficheros abiertos
+  FreeSlotVector   m_FreeSlots;   // Posiciones libres en m_HandleSlots
+  NameBucketVector m_NameBuckets; // Tabla hash sobre los ficheros abiertos
+  CPAKList         m_CPAKFiles;   // Ficheros CPAK Instalados
+  MemFileMap       m_MemFiles;    // Ficheros residentes en memoria
 
   // Resto de vbles de miembro      
   dword m_udNumFilesOpen; // Numero de ficheros abiertos
@@ -133,7 +157,6 @@ private:
 protected:
   // Constructor / Destructor
   CFileSystem(void): MAX_IDHANDLE_VALUE(0x7FFF),
-					 m_pMathUtil(NULL),
 					 m_bInitOk(false) { }
 public:
   ~CFileSystem(void) { 
@@ -209,12 +232,63 @@ public:
 public:
   // iCFileSystem / Trabajo con ficheros
   dword GetFileSize(const FileDefs::FileHandle& hFile);
+  const sbyte* const GetFileData(const FileDefs::FileHandle& hFile,
+								 dword& udSize);
+  const sbyte* const GetFileStoredData(const FileDefs::FileHandle& hFile,
+									   dword& udStoredSize,
+									   dword& udSize,
+									   bool& bCompressed);
+  bool UnpackFileData(const sbyte* const psbStored,
+					  const dword udStoredSize,
+					  sbyte* const psbDest,
+					  const dword udSize) const;
   void GetFileNamesFromPath(const std::string& szPath,
 						    std::list<std::string>& DestList);
 
+public:
+  // iCFileSystem / Trabajo con ficheros residentes en memoria
+  bool CreateMemFile(const std::string& szFileName);
+  bool CreateMemFile(const std::string& szFileName,
+					 const sbyte* const psbData,
+					 const dword udSize);
+  bool FlushMemFile(const std::string& szFileName);
+  void ReleaseMemFile(const std::string& szFileName);
+  bool IsMemFile(const std::string& szFileName);
+  dword GetMemFileSize(const std::string& szFileName);
+  const sbyte* const GetMemFileData(const std::string& szFileName);
 private:
-  // Metodos de apoyo  
-  dword CreateNewID(void);
+  // Metodos de apoyo
+  sMemFile* const FindMemFile(const std::string& szFileName);
+  void ReleaseAllMemFiles(void);
+
+private:
+  // Trabajo con ficheros de disco
+  dword ReadDiskFile(sFileNode* const pFileNode,
+					 sbyte* const psbBuffer,
+					 const dword udSize,
+					 const dword udOffset);
+  dword ReadDiskLine(sFileNode* const pFileNode,
+					 const dword udInitOffset,
+					 std::string& szDest);
+  void FillReadAhead(sFileNode* const pFileNode,
+					 const dword udOffset);
+
+private:
+  // Trabajo con la tabla de handles y la tabla hash por nombre
+  FileDefs::FileHandle InsertFileNode(sFileNode* const pFileNode);
+  void RemoveFileNode(const FileDefs::FileHandle& hFile);
+  sFileNode* const FindOpenFile(const std::string& szFileName,
+								const dword udHash);
+  static dword GetNameHash(const std::string& szFileName);
+  inline sFileNode* const GetFileNode(const FileDefs::FileHandle& hFile) {
+	// Se obtiene la posicion y se comprueba que la generacion coincida
+	const word uwSlot = hFile & (CFileSystem::HANDLE_MAX_SLOTS - 1);
+	if (uwSlot < m_HandleSlots.size() &&
+		m_HandleSlots[uwSlot].ubGeneration == (hFile >> CFileSystem::HANDLE_SLOT_BITS)) {
+	  return m_HandleSlots[uwSlot].pFileNode;
+	}
+	return NULL;
+  }
 };
 
 #endif // ~ CFileSystem
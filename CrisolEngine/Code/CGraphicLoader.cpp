@@ -108,6 +108,8 @@ void
 CGraphicLoader::End(void)
 {
   if (IsInitOk()) {
+	// Se libera la vista sobre la imagen actual, si la hubiera
+	ReleaseImgData();
     if (m_pImgFile) { 
       // Se procede a liberar el buffer
 	  delete[m_udImgFileSize] m_pImgFile;
@@ -128,6 +130,9 @@ CGraphicLoader::End(void)
 // - Abre el fichero szFileName, lee el contenido del mismo en m_pImgFile y 
 //   luego lo cierra. En caso de que el tamao del buffer sea insuficiente,
 //   se liberara y se reservara el espacio necesario.
+// - Si el contenido se puede obtener sin copia (fichero en un CPAK 
+//   proyectado en memoria), no se leera y el fichero quedara abierto en
+//   m_hImgFile mientras la imagen sea la actual.
 // Parametros:
 // - aszFileName: Referencia al nombre del fichero
 // - m_pImgFile: Contendra el fichero y se podra ajustar.
@@ -135,10 +140,14 @@ CGraphicLoader::End(void)
 //   ajustado.
 // Devuelve:
 // Notas:
+// - En ambos casos, m_psbImgData apuntara al contenido de la imagen.
 ///////////////////////////////////////////////////////////////////////////////
 void 
 CGraphicLoader::ReadImage(const std::string& aszFileName)
 {
+  // Se libera la vista sobre la imagen anterior, si la hubiera
+  ReleaseImgData();
+
   // Se abre el fichero y se procede a cargar la informacion en el buffer    
   iCFileSystem* const pFileSys = SYSEngine::GetFileSystem();
   ASSERT(pFileSys);
@@ -147,6 +156,15 @@ CGraphicLoader::ReadImage(const std::string& aszFileName)
 	SYSEngine::FatalError("No se ha podido encontrar la imagen %s.\n", aszFileName.c_str());
   }
 
+  // Se puede acceder al contenido sin copiarlo?
+  dword udDataSize = 0;
+  m_psbImgData = pFileSys->GetFileData(hFile, udDataSize);
+  if (m_psbImgData) {
+	// Si, se mantiene el fichero abierto y se retorna
+	m_hImgFile = hFile;
+	return;
+  }
+
   // Hay suficiente espacio en el buffer de lectura?
   const dword udFileSize = pFileSys->GetFileSize(hFile);  
   ASSERT(udFileSize);
@@ -163,6 +181,29 @@ CGraphicLoader::ReadImage(const std::string& aszFileName)
   // Se lee del fichero y despues se cierra
   pFileSys->Read(hFile, m_pImgFile, udFileSize);
   pFileSys->Close(hFile);  
+  m_psbImgData = m_pImgFile;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Deja de referenciar el contenido de la imagen actual, cerrando el 
+//   fichero en caso de que se mantuviera abierto para conservar la vista.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CGraphicLoader::ReleaseImgData(void)
+{
+  // Se mantenia fichero abierto?
+  if (m_hImgFile) {
+	// Si, se cierra
+	iCFileSystem* const pFileSys = SYSEngine::GetFileSystem();
+	ASSERT(pFileSys);
+	pFileSys->Close(m_hImgFile);
+	m_hImgFile = 0;
+  }
+  m_psbImgData = NULL;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -177,12 +218,12 @@ CGraphicLoader::ReadImage(const std::string& aszFileName)
 bool 
 CGraphicLoader::CheckTGAFile(void)
 {
-  // SOLO si existe buffer donde haber leido
-  ASSERT(m_pImgFile);
+  // SOLO si existe contenido leido
+  ASSERT(m_psbImgData);
 
   // Lee cabecera
   TGAHeader Header;
-  memcpy(&Header, m_pImgFile, sizeof(TGAHeader));  
+  memcpy(&Header, m_psbImgData, sizeof(TGAHeader));  
   
   // Se comprueba que el TGA no este comprimido ni tenga color map
   if (0 != Header.ColorMap || 
@@ -248,7 +289,7 @@ CGraphicLoader::TGALoader(const std::string& szFileName)
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Vuelca la porcion prSrcRect de informacion grafica situada en m_pImgFile, 
+// - Vuelca la porcion prSrcRect de informacion grafica situada en m_psbImgData, 
 //   sobre la zona prDestRect de la textura pTexture.
 // Parametros:
 // - pTexture: Direccion de la textura en donde volcar la informacion.
@@ -340,7 +381,7 @@ CGraphicLoader::Draw(DXDDSurfaceTexture* const pTexture,
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Vuelca la porcion prSrcRect de informacion grafica del fichero TGA leido
-//   en m_pImgFile sobre la zona prDestRect de la textura pTexture. Este
+//   en m_psbImgData sobre la zona prDestRect de la textura pTexture. Este
 //   metodo sera llamado desde Draw.
 // Parametros:
 // - pTexture: Direccion de la textura en donde volcar la informacion.
@@ -376,7 +417,7 @@ CGraphicLoader::TGADraw(DXDDSurfaceTexture* const pTexture,
   // SOLO si se ha cargado antes imagen
   ASSERT(IsImageLoaded());
   // SOLO si el buffer con los datos del TGA es valido
-  ASSERT(m_pImgFile);
+  ASSERT(m_psbImgData);
   
   // Vbles
   dword   udBpp;    // Bits por posicion
@@ -421,13 +462,13 @@ CGraphicLoader::TGADraw(DXDDSurfaceTexture* const pTexture,
                  m_ActImgInfo.uwWidth* udBpp + udXSrc * udBpp;      
       
       // Se calculan los componentes RGB
-      ubR = m_pImgFile[udOffset + 2];
-      ubG = m_pImgFile[udOffset + 1];
-      ubB = m_pImgFile[udOffset];
+      ubR = m_psbImgData[udOffset + 2];
+      ubG = m_psbImgData[udOffset + 1];
+      ubB = m_psbImgData[udOffset];
       
       // Se calcula el valor alpha
       if (4 == udBpp) { 
-		ubAlpha = m_pImgFile[udOffset + 3]; 
+		ubAlpha = m_psbImgData[udOffset + 3]; 
 	  } else { 
 		ubAlpha = 0xFF; 
 	  }      
@@ -53,6 +53,9 @@
 #ifndef _GRAPHDEFS_H_
 #include "GraphDefs.h"
 #endif
+#ifndef _FILEDEFS_H_
+#include "FileDefs.h"
+#endif
 
 // Defincion de clases / estructuras / espacios de nombres
 
@@ -82,15 +85,19 @@ private:
   static CGraphicLoader* m_pGraphicLoader; // Unica instancia a la clase
   
   // Resto de vbles de miembro
-  sbyte*    m_pImgFile;      // Buffer donde leer los ficheros
-  dword     m_udImgFileSize; // Tamao del buffer
+  sbyte*               m_pImgFile;      // Buffer donde leer los ficheros
+  dword                m_udImgFileSize; // Tamao del buffer
+  const sbyte*         m_psbImgData;    // Contenido de la imagen actual
+  FileDefs::FileHandle m_hImgFile;      // Handle que mantiene m_psbImgData
   ImageInfo m_ActImgInfo;    // Informacion sobre la imagen actualmente cargada  
   bool      m_bIsInitOk;     // Clase inicializada correctamente?
     
 protected:
   // Constructor / Destructor
   CGraphicLoader(void): m_bIsInitOk(false),
-                        m_pImgFile(NULL) { }
+                        m_pImgFile(NULL),
+						m_psbImgData(NULL),
+						m_hImgFile(0) { }
 public:
   ~CGraphicLoader(void) { 
 	End(); 
@@ -146,6 +153,7 @@ public:
 	ASSERT(IsInitOk());
 	// Descarga imagen
 	m_ActImgInfo.bImgLoaded = false; 
+	ReleaseImgData();
   }
   bool Draw(DXDDSurfaceTexture* const pTexture,
 			const sRect* prSrcRect = NULL,
@@ -155,6 +163,7 @@ private:
   // Metodos de apoyo
   bool CheckTGAFile(void);
   void ReadImage(const std::string& szFileName);
+  void ReleaseImgData(void);
   bool TGADraw(DXDDSurfaceTexture* const pTexture, 
                const sRect& arSrcRect, const sRect& arDestRect);
 };
@@ -31,6 +31,7 @@
 #include "DXWrapper\\DXDDSurfaceTexture.h"
 #include "iCGraphicSystem.h"
 #include "iCLogger.h"
+#include "iCTimer.h"
 #include "iCCommandManager.h"
 #include "iCGameDataBase.h"
 #include "CCBTEngineParser.h"
@@ -39,12 +40,6 @@
 #include <algorithm>
 #include <math.h>
 
-// Inicializacion del subsistema de memoria
-CMemoryPool 
-CIsoEngine::CPathFinder::sNodeSearch::MPool(256,
-											sizeof(CIsoEngine::CPathFinder::sNodeSearch), 
-											true);
-
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Inicializa el motor isometrico. Principalmente, se encarga de crear las
@@ -428,14 +423,16 @@ CIsoEngine::SetArea(CArea* const pArea)
 	  m_CameraInfo.MovIsoCmd.End();
 	  
 	  // Se asocia area nula al buscador de caminos
-	  m_PathFinder.SetArea(NULL);		
+	  m_PathFinder.SetMap(NULL);		
+	  m_PathFinderArea.SetArea(NULL);
 	}
   } else {
 	// Se vincula un nuevo area
 	m_IsoMap.pArea = pArea;  
 
 	// Se inicializa localizador de caminos
-	m_PathFinder.SetArea(pArea);
+	m_PathFinderArea.SetArea(pArea);
+	m_PathFinder.SetMap(&m_PathFinderArea);
 	ASSERT(m_PathFinder.IsInitOk());
   
 	// Se levanta flag de dibujado
@@ -614,7 +611,13 @@ CIsoEngine::Draw(void)
   if (IsAreaSet() &&
 	  IsDrawFlagActive() &&
 	  IsCameraAttached()) { 
-	// Si, se procede a dibujar suelo y elementos sobre el mismo
+	// Si, se actualizan los bloques de celdas residentes segun la zona visible
+	m_IsoMap.pArea->UpdateCellChunks(AreaDefs::sTilePos(m_IsoMap.rTileViewArea.swLeft, 
+														m_IsoMap.rTileViewArea.swTop),
+									 AreaDefs::sTilePos(m_IsoMap.rTileViewArea.swRight, 
+														m_IsoMap.rTileViewArea.swBottom));
+
+	// Se procede a dibujar suelo y elementos sobre el mismo
 	DrawArea(CDrawAreaFloor());	
 	DrawArea(CDrawAreaOnFloor());	
   }  
@@ -2298,632 +2301,50 @@ CIsoEngine::IsAdjacentTo(const AreaDefs::sTilePos& TileSrc,
 {
   // SOLO si instancia inicializada
   ASSERT(IsInitOk());
+  ASSERT(IsAreaSet());
 
-  // Se hallan los tiles adjacentes a TileDest comprobandose si alguno
-  // es igual a TileSrc
-  AreaDefs::sTilePos AdjacentTilePos;
-  byte ubDirIt = IsoDefs::NORTH_INDEX;
-  for (; ubDirIt != IsoDefs::NO_DIRECTION_INDEX; ++ubDirIt) {
-	// Se halla la posicion adjacente al TileDest en la dir. que toque
-	if (m_IsoMap.pArea->GetAdjacentTilePos(TileDest, 
-										   IsoDefs::eDirectionIndex(ubDirIt), 
-										   AdjacentTilePos)) {
-	  // Dir. adjacente valida, es igual a TileSrc?
-	  if (TileSrc == AdjacentTilePos) {
-		// Si, se retorna
-		return true;
-	  }
-	}
-  }
-
-  // No, no se cumple que la posicion sea adjacente
-  return false;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Inicializa la instancia.
-// Parametros:
-// Devuelve:
-// - Si todo ha ido correctamente true. En caso contrario false.
-// Notas:
-// - NO se permitira reinicializar
-// - La tabla m_MaskFlagToCheck sirve para saber que direccion en el tile
-//   adyacente en el que nos encontrabamos, demos de chequear para saber si
-//   podemos pasar. Siempre se cumplira que la direccion a chequear sera la
-//   simetrica de la que hemos usado para entrar en dicho tile.
-///////////////////////////////////////////////////////////////////////////////
-bool 
-CIsoEngine::CPathFinder::Init(void) 
-{
-  // Se pretende reinicializar?
-  if (IsInitOk()) {
-	return false;
-  }
-
-  // Se inicializa el recycle node pool
-  if (!m_RecycleNodePool.Init()) { 
-	return false; 
-  }
-
-  // Se establecen la informacion por direccion a visitar
-  byte ubIt = 0;
-  for (; ubIt < IsoDefs::MAX_DIRECTIONS; ++ubIt) {
-	// Se establece direccion
-	m_DirsToVisit[ubIt] = IsoDefs::eDirectionIndex(ubIt);		
-  }
-
-  // Se establecen los flags asociados a las direcciones de visita
-  // pero con respecto a la mascara de acceso en el tile a visitar
-  // Se cumplira que siempre seran las simetricas
-  m_MaskFlagToCheck[IsoDefs::NORTH_INDEX] = IsoDefs::SOUTH_FLAG;
-  m_MaskFlagToCheck[IsoDefs::NORTHEAST_INDEX] = IsoDefs::SOUTHWEST_FLAG;
-  m_MaskFlagToCheck[IsoDefs::EAST_INDEX] = IsoDefs::WEST_FLAG;
-  m_MaskFlagToCheck[IsoDefs::SOUTHEAST_INDEX] = IsoDefs::NORTHWEST_FLAG;
-  m_MaskFlagToCheck[IsoDefs::SOUTH_INDEX] = IsoDefs::NORTH_FLAG;
-  m_MaskFlagToCheck[IsoDefs::SOUTHWEST_INDEX] = IsoDefs::NORTHEAST_FLAG;
-  m_MaskFlagToCheck[IsoDefs::WEST_INDEX] = IsoDefs::EAST_FLAG;
-  m_MaskFlagToCheck[IsoDefs::NORTHWEST_INDEX] = IsoDefs::SOUTHEAST_FLAG;
-
-  // Se establece area nula
-  m_pActArea = NULL;
-
-  // Todo correcto
-  m_bIsInitOk = true;
-  return true;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Finaliza instancia.
-// Parametros:
-// Devuelve:
-// Notas:
-///////////////////////////////////////////////////////////////////////////////
-void 
-CIsoEngine::CPathFinder::End(void)
-{
-  // Finaliza si procede
-  if (IsInitOk()) {
-	m_RecycleNodePool.End();
-	m_pActArea = NULL;
-	m_bIsInitOk = false;
-  }
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Apoyandose en FindPath ordena la creacion de un camino de busqueda y 
-//   retorna unicamente la longitud del mismo si es que existe. En caso de no
-//   hallar camino de busqueda entre dos nodos retornara un valor negativo.
-// Parametros:
-// - TileSrc. Posicion del tile origen.
-// - TileDest. Posicion del tile destino.
-// Devuelve:
-// - La longitud del camino de busqueda si existe. Si no existiera, un valor
-//   de -1. Esto tambien se aplicara si los tiles no son validos en cuanto a
-//   que no pertenezcan al mapa.
-// Notas:
-///////////////////////////////////////////////////////////////////////////////
-sword 
-CIsoEngine::CPathFinder::CalculePathLenght(const AreaDefs::sTilePos& TileSrc,
-										   const AreaDefs::sTilePos& TileDest)
-{
-  // SOLO si instancia inicializada
-  ASSERT(IsInitOk());
-  ASSERT(IsAreaAttached());
-
-  // Posiciones validas?
-
-  // SOLO si parametros correctos
-  ASSERT(m_pActArea->IsCellValid(TileSrc));
-  ASSERT(m_pActArea->IsCellValid(TileDest));
-
-  // Los tiles pertenecen a posiciones validas?
-  ASSERT(IsAreaAttached());
-  if (m_pActArea->IsCellValid(TileSrc) &&
-	  m_pActArea->IsCellValid(TileDest)) {
-	// Obtiene camino
-	const CPath* pPath = FindPath(TileSrc, TileDest);
-
-	// Camino valido?
-	if (pPath) {
-	  // Se retorna la longitud y se destruye
-	  const word uwSize = pPath->GetSize();	  
-	  delete pPath;
-	  return uwSize;
-	}  
-  }
-
-  // El camino no es valido / los tiles no son validos
-  return -1;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Dada una posicion inicio y una posicion final, localiza, si es posible,
-//   el camino de busqueda. El camino de busqueda se devolvera en una clase
-//   CPath. En caso de que no hubiera camino posible, se devolveria NULL.
-// - El metodo tambien sera capaz de hallar un camino de minima distancia.
-//   Un camino de minima distancia sera aquel que ira desde TileSrc a un
-//   tile que podra ser o no igual a TileDest pero que tendra que cumplir que
-//   la distancia desde el hasta TileDest sea menor o igual que la minima
-//   distancia. Para indicar que se desea hallar un camino de minima distancia,
-//   el parametro uwDistanceMin debera de ser mayor que 0. Por defecto valdra
-//   cero.
-// Parametros:
-// - TileSrc. Posicion del tile origen.
-// - TileDest. Posicion del tile destino.
-// - uwDistanceMin. Distancia minima, solo usable en caso de querer hallar un
-//   camino de minima distancia. Por defecto 0.
-// - bGhostMode. Flag para indicar si se quiere hallar el camino de acceso
-//   SIN tener en cuenta obstaculos.
-// Devuelve:
-// - Direccion a la clase CPath
-// Notas:
-// - Este metodo actua como una "Factory" de clases CPath, siendo 
-//   responsabilidad del exterior eliminarla.
-///////////////////////////////////////////////////////////////////////////////
-CPath* const 
-CIsoEngine::CPathFinder::FindPath(const AreaDefs::sTilePos& TileSrc,
-								  const AreaDefs::sTilePos& TileDest,
-								  const word uwDistanceMin,
-								  const bool bGhostMode)
-{
-  // SOLO si instancia inicializada
-  ASSERT(IsInitOk());
-  ASSERT(IsAreaAttached());
-  // SOLO si parametros correctos
-  ASSERT(m_pActArea->IsCellValid(TileSrc));
-  ASSERT(m_pActArea->IsCellValid(TileDest));
-
-  // Se resetea el RecycleNodePool (de una posible llamada anterior)
-  m_RecycleNodePool.ResetPool();
-
-  // Se inicializa el nodo de comienzo y se inserta en la Open
-  sNodeSearch* pNode = m_RecycleNodePool.GetNewNode();
-  ASSERT(pNode);
-  pNode->pParentState = NULL;
-  pNode->TilePos = TileSrc;
-  pNode->fCostToThis = 0.0f;
-  pNode->fCostToDest = GetHeuristicValue(TileSrc, TileDest);
-  OpenPush(pNode);
-  
-  // Se procede a localizar el camino hasta que se halle solucion o no
-  while (m_Open.size()) {
-	// Se obtiene nodo de la Open (seguro que tiene el menor coste global)
-	OpenPop(pNode);
-	ASSERT(pNode);
-
-	// Se ha hallado el objetivo?
-	bool bGoalOk = false; 
-	if (uwDistanceMin > 0) {
-	  // Si se deseaba hallar un camino de minima distancia
-	  // Se ha alcanzado la distancia minima?
-	  if (CalculeAbsoluteDistance(pNode->TilePos, TileDest) <= uwDistanceMin) {
-		bGoalOk = true;
-	  }
-	} else if (TileDest == pNode->TilePos) {
-	  // Si se deseaba hallar un camino normal
-	  bGoalOk = true;
-	}
-
-	// Hemos alcanzado el nodo destino?
-	if (bGoalOk) {
-	  // Se alcanzo el destino y se construye hacia atras el camino
-	  CPath* pPath = new CPath;
-	  ASSERT(pPath);
-	  pPath->Init(TileSrc);
-	  ASSERT(pPath->IsInitOk());
-	  _CreatePath(pNode, pPath);
-	  
-	  // Se liberan listas
-	  CleanMainNodeIndex();
-	  CleanOpen();	  
-
-	  // Se retorna camino generado
-	  return pPath;
-	}
-
-	// Vbles
-	AreaDefs::sTilePos       NewTilePos;     // Pos. del nuevo tile a visitar
-	float                    fNewCostToThis; // Coste del nuevo tile a visitar
-	IsoDefs::eDirectionIndex DirToSrc;       // Direccion a nodo origen actual
-	sNodeSearch*             pNewNode;       // Puntero a nuevo nodo
-
-	// Se obtiene la direccion hasta el tile origen actual
-	if (pNode->pParentState) {
-	  DirToSrc =  m_pActArea->CalculeDirection(pNode->pParentState->TilePos, 
-										       pNode->TilePos);
-	} else {
-	  DirToSrc = IsoDefs::NO_DIRECTION_INDEX;
-	}
-
-	// Para cada posible direccion se comprueba si es visitable	
-	byte ubIt = 0;
-	for (; ubIt < IsoDefs::MAX_DIRECTIONS; ++ubIt) {
-	  // Existe tile adyacente en la direccion que procede?
-	  if (m_pActArea->GetAdjacentTilePos(pNode->TilePos, 
-										 m_DirsToVisit[ubIt], 
-										 NewTilePos)) {
-		// Se puede acceder a dicho tile adyacente?
-		// Nota: Se podra acceder si la mascara de acceso lo permite y ademas
-		// si los tiles adyacentes a la posicion destino permiten el franqueo en
-		// al menos un paso (esto ultimo solo en determinadas direcciones).
-		// EN CASO de estar activo el modo fantasma, flag bGhostMode, no se
-		// tendra en cuenta los posibles obstaculos
-		if (bGhostMode ||
-		   (!(m_pActArea->GetMaskTileAccess(NewTilePos) & m_MaskFlagToCheck[ubIt]) &&
-			AccessValidInAdjacentsOfTileDest(pNode->TilePos, IsoDefs::eDirectionIndex(ubIt)))) {
-		  // Se calcula el coste a dicho tile
-		  // El coste premiara aquellas direcciones consecutivas iguales,
-		  // penalizando las que sean en diagonal
-		  if (DirToSrc != m_DirsToVisit[ubIt]) {
-			fNewCostToThis = pNode->fCostToThis + 2.0f;
-		  } else {
-			fNewCostToThis = pNode->fCostToThis + 1.0f;
-		  }
-		  
-		  // El nodo a dicha posicion ya ese encuentra registrado?
-		  const AreaDefs::TileIndex NewTilePosIdx = m_pActArea->GetTileIdx(NewTilePos);
-		  MainNodeIndexIt It(m_MainNodeIndex.find(NewTilePosIdx));
-		  if (It != m_MainNodeIndex.end()) {
-			// Se toma y se comprueba si es PEOR esta nueva version del nodo
-			pNewNode = It->second;			
-			if (pNewNode->fCostToThis <= fNewCostToThis) {
-			  continue;
-			}
-		  } else {
-			// Se toma un nuevo nodo y se registra en el MainNodeIndex
-			pNewNode = m_RecycleNodePool.GetNewNode();
-			ASSERT(pNewNode);
-			m_MainNodeIndex.insert(MainNodeIndexValType(NewTilePosIdx, pNewNode));
-			pNewNode->NodeAlloc = sNodeSearch::NO_ALLOC;
-		  }
-
-		  // Se almacena la nueva informacion o la informacion mejorada
-		  pNewNode->pParentState = pNode;
-		  pNewNode->TilePos = NewTilePos;
-		  pNewNode->fCostToThis = fNewCostToThis;
-		  pNewNode->fCostToDest = fNewCostToThis + 
-								  GetHeuristicValue(NewTilePos, TileDest);
-
-		  // Se asienta el nuevo nodo
-		  if (sNodeSearch::OPEN == pNewNode->NodeAlloc) {
-			// Se actualiza posicion segun la nueva prioridad
-			OpenUpdateNodePriority(pNewNode);
-		  } else {
-			// Si no estaba asentado o si estaba en CLOSED se inserta en Open
-			OpenPush(pNewNode);
-		  }
-		}
-	  }	  
-	} // ~ for
-
-	// Una vez examinado el nodo sacado de la Open, se inserta en la Closed
-	pNode->NodeAlloc = sNodeSearch::CLOSED;
-  } // ~ while
-
-  // No se logro encontrar el camino
-  // Se liberan listas y se retorna
-  CleanMainNodeIndex();
-  CleanOpen();	  
-  return NULL;
+  // Se traslada la comprobacion al area vinculada al localizador de caminos
+  return m_PathFinderArea.IsAdjacentTo(TileSrc, TileDest);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
-// - Comprueba, para una determinada direccion, si es posible el acceso a los
-//   tiles adyacentes a la misma. Teniendo en cuenta que los tiles adyacentes
-//   se referiran a la direccion anterior y posterior de la recibida. 
-//   Este calculo sera necesario para evitar situaciones en las que, por ejemplo,
-//   dos paredes esten en posicion suroeste y sureste, mostrandose visualmente
-//   adyacentes, pero que logicamente puedan franquerase via sur.
-// - Dependiendo de la direccion del tile destino, se debera de comprobar una
-//   set de direcciones distintas.
-// - SOLO se comprobara para las direcciones NORTE / ESTE / SUR / OESTE ya que
-//   en el resto de los casos, no sera aplicacable.
-// - No se considerara la existencia de criaturas.
+// - Comprueba si el tile de posicion TileSrc es adjacente a TileDest en el
+//   area vinculada.
 // Parametros:
-// - TileSrc. Posicion del tile desde donde parte el reconocimiento.
-// - TileDestDir. Direccion del tile destino.
+// - TileSrc, TileDest. Tile de posicion origen y destino.
 // Devuelve:
-// - Si el acceso es valido true, en caso contrario false.
+// - Si es adjacente true. En caso contrario false.
 // Notas:
 ///////////////////////////////////////////////////////////////////////////////
 bool 
-CIsoEngine::CPathFinder::AccessValidInAdjacentsOfTileDest(const AreaDefs::sTilePos& TileSrc,
-											              const IsoDefs::eDirectionIndex& TileDestDir)
+CIsoEngine::CPathFinderArea::IsAdjacentTo(const AreaDefs::sTilePos& TileSrc,
+										  const AreaDefs::sTilePos& TileDest)
 {
-  // SOLO si instancia inicializada
-  ASSERT(IsInitOk());
-  ASSERT(IsAreaAttached());
-  // SOLO si parametros correctos
-  ASSERT(m_pActArea->IsCellValid(TileSrc));
-  ASSERT((TileDestDir != IsoDefs::NO_DIRECTION_INDEX) != 0);
-
-  // Se determinan las direcciones a chequear
-  IsoDefs::eDirectionIndex AdjacentDirs[2];
-  switch (TileDestDir) {
-	case IsoDefs::NORTH_INDEX: {
-	  AdjacentDirs[0] = IsoDefs::NORTHWEST_INDEX;
-	  AdjacentDirs[1] = IsoDefs::NORTHEAST_INDEX;	  
-	} break;
+  // SOLO si hay area vinculada
+  ASSERT(m_pArea);
 
-	case IsoDefs::NORTHEAST_INDEX: {
-	  //AdjacentDirs[0] = IsoDefs::NORTH_INDEX;
-	  //AdjacentDirs[1] = IsoDefs::EAST_INDEX;	  
-	  return true;
-	} break;
-
-	case IsoDefs::EAST_INDEX: {
-	  AdjacentDirs[0] = IsoDefs::NORTHEAST_INDEX;
-	  AdjacentDirs[1] = IsoDefs::SOUTHEAST_INDEX;	  
-	} break;
-
-	case IsoDefs::SOUTHEAST_INDEX: {
-	  //AdjacentDirs[0] = IsoDefs::EAST_INDEX;
-	  //AdjacentDirs[1] = IsoDefs::SOUTH_INDEX;	  
-	  return true;
-	} break;
-
-	case IsoDefs::SOUTH_INDEX: {
-	  AdjacentDirs[0] = IsoDefs::SOUTHEAST_INDEX;
-	  AdjacentDirs[1] = IsoDefs::SOUTHWEST_INDEX;	  
-	} break;
-
-	case IsoDefs::SOUTHWEST_INDEX: {
-	  //AdjacentDirs[0] = IsoDefs::SOUTH_INDEX;
-	  //AdjacentDirs[1] = IsoDefs::WEST_INDEX;	  
-	  return true;
-	} break;
-
-	case IsoDefs::WEST_INDEX: {
-	  AdjacentDirs[0] = IsoDefs::SOUTHWEST_INDEX;
-	  AdjacentDirs[1] = IsoDefs::NORTHWEST_INDEX;	  
-	} break;
-
-	case IsoDefs::NORTHWEST_INDEX: {
-	  //AdjacentDirs[0] = IsoDefs::NORTH_INDEX;
-	  //AdjacentDirs[1] = IsoDefs::WEST_INDEX;	  
-	  return true;
-	} break;
-  }; // ~ switch
-
-  // Se comprueba para cada una de las direcciones halladas si pueden
-  // ser accedidas desde la posicion origen. En el primer caso en el que 
-  // esto sea posible, se retornara.
-  // Nota: Se considerara que no podra accederse cuando no exista tile adyacente.
-  // Nota: No incluiremos en el chequeo la comprobacion de criaturas	  	
-  const dword udNoEntToCheck = RulesDefs::PLAYER | RulesDefs::CRIATURE;
-  byte ubIt = 0;
-  for (; ubIt < 2; ++ubIt) {
-	// Existe tile adyacente en la direccion que procede?
-	AreaDefs::sTilePos NewTilePos;
-	ASSERT((AdjacentDirs[ubIt] != IsoDefs::NO_DIRECTION_INDEX) != 0);
-	if (m_pActArea->GetAdjacentTilePos(TileSrc, AdjacentDirs[ubIt], NewTilePos)) {
-	  // La mascara de acceso permite acceder al tile anterior?
-	  if (!(m_pActArea->GetMaskTileAccess(NewTilePos, udNoEntToCheck) & m_MaskFlagToCheck[AdjacentDirs[ubIt]])) {
-		// Si, retorna
+  // Se hallan los tiles adjacentes a TileDest comprobandose si alguno
+  // es igual a TileSrc
+  AreaDefs::sTilePos AdjacentTilePos;
+  byte ubDirIt = IsoDefs::NORTH_INDEX;
+  for (; ubDirIt != IsoDefs::NO_DIRECTION_INDEX; ++ubDirIt) {
+	// Se halla la posicion adjacente al TileDest en la dir. que toque
+	if (m_pArea->GetAdjacentTilePos(TileDest, 
+									IsoDefs::eDirectionIndex(ubDirIt), 
+									AdjacentTilePos)) {
+	  // Dir. adjacente valida, es igual a TileSrc?
+	  if (TileSrc == AdjacentTilePos) {
+		// Si, se retorna
 		return true;
 	  }
 	}
   }
 
-  // No hay posibilidad de acceso
+  // No, no se cumple que la posicion sea adjacente
   return false;
 }
 
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Construye el camino CPath a partir de la sucesion de nodos que lo forman
-//   y que sabemos que son validos. El nodo recibido, pNodeSearch, sera el 
-//   ultimo nodo de tal forma que navegando por los nodos padres se llegara al
-//   nodo inicio y a partir de ahi se debera de construir el camino.
-// - El metodo sera recursivo y no se querra incluir en el camino de busqueda
-//   el nodo padre.
-// Parametros:
-// - pNodeSearch. La llamada del exterior pasara siempre el ultimo nodo de
-//   busqueda.
-// - pPath. Instancia CPath donde se iran asociando los nodos que formen el
-//   camino
-// Devuelve:
-// Notas:
-// - Nunca se debera de llamar a este metodo con el nodo inicial de busqueda.
-//   El camino debera de estar formando por al menos dos nodos, el incial y
-//   y el nodo destino.
-///////////////////////////////////////////////////////////////////////////////
-void 
-CIsoEngine::CPathFinder::_CreatePath(sNodeSearch* const pNodeSearch,
-									 CPath*& pPath)
-{
-  // SOLO si parametros validos
-  ASSERT(pNodeSearch);
-  ASSERT(pPath);
-  ASSERT(pPath->IsInitOk());
-
-  // NO estamos en el primer nodo del camino, excluido el nodo inicial?
-  if (pNodeSearch->pParentState->pParentState) {	
-	_CreatePath(pNodeSearch->pParentState, pPath);
-  }
-
-  // Procedemos a insertar nodo en el camino
-  const IsoDefs::eDirectionIndex DirToWalk = m_pActArea->CalculeDirection(pNodeSearch->pParentState->TilePos,
-																		  pNodeSearch->TilePos);
-  pPath->AddPosition(pNodeSearch->TilePos, DirToWalk);
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Procede a liberar la MainNodeIndex.
-// Parametros:
-// Devuelve:
-// Notas:
-// - Los nodos no seran eliminados de memoria, al utilizar un CRecycleNodePool
-///////////////////////////////////////////////////////////////////////////////
-void
-CIsoEngine::CPathFinder::CleanMainNodeIndex(void)
-{
-  // SOLO si instancia inicializada
-  ASSERT(IsInitOk());
-
-  // Se procede a eliminar elementos
-  MainNodeIndexIt It = m_MainNodeIndex.begin();
-  while (It != m_MainNodeIndex.end()) {
-	It = m_MainNodeIndex.erase(It);
-  }
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Extrae un nodo de la Open
-// Parametros:
-// - pNodeSearch, nodo a devolver
-// Devuelve:
-// - Un nodo de la open pero por parametro (debido a problemas de ambito para
-//   devolverlo por funcion)
-// Notas:
-// - El metodo pop_heap lo que hace es pone el nodo que estaba al comienzo al
-//   final, posicion N, y despues ordenar los nodos entre la posicion 1 y N-1
-//   para que cumplan la propiedad de monticulo, usando el predicado CHeapComp.
-//   Una vez hecho esto, el nodo en la posicion N sabemos que no nos interesa
-//   y lo quitamos.
-///////////////////////////////////////////////////////////////////////////////
-void
-CIsoEngine::CPathFinder::OpenPop(sNodeSearch*& pNodeSearch)
-{
-  // SOLO si instancia inicializada
-  ASSERT(IsInitOk());
- 
-  // Extrae elemento
-  ASSERT(m_Open.size());
-  pNodeSearch = m_Open.front();
-  ASSERT(pNodeSearch);
- 
-  // Reconstruye monticulo
-  CHeapComp HeapComp;
-  std::pop_heap(m_Open.begin(), m_Open.end(), HeapComp);
-  m_Open.pop_back();
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Inserta un nodo en la Open.
-// Parametros:
-// - pNode. Nodo a insertar.
-// Devuelve:
-// Notas:
-///////////////////////////////////////////////////////////////////////////////
-void 
-CIsoEngine::CPathFinder::OpenPush(sNodeSearch* const pNode)
-{
-  // SOLO si instancia inicializada
-  ASSERT(IsInitOk());
-  // SOLO si parametros validos
-  ASSERT(pNode);
-  
-  // Se inserta el nodo al final y se reordena el monticulo
-  pNode->NodeAlloc = sNodeSearch::OPEN;
-  m_Open.push_back(pNode);
-  CHeapComp HeapComp;
-  std::push_heap(m_Open.begin(), m_Open.end(), HeapComp);
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Despues de haber actualizado la prioridad de un nodo, se debera de
-//   llamar a este metodo para que se localice la posicion del nodo en el
-//   Heap y se reordene segun su cambio de prioridad
-// Parametros:
-// - pNodeUpdated. Nodo actualizo
-// Devuelve:
-// Notas:
-///////////////////////////////////////////////////////////////////////////////
-void 
-CIsoEngine::CPathFinder::OpenUpdateNodePriority(sNodeSearch* const pNodeUpdated)
-{
-  // SOLO si instancia inicializada
-  ASSERT(IsInitOk());
-  // SOLO si parametros validos
-  ASSERT(pNodeUpdated);
-  ASSERT((pNodeUpdated->NodeAlloc == sNodeSearch::OPEN) != 0);
-
-  // Se procede a localizar el nodo en el heap
-  HeapIt It = std::find(m_Open.begin(), m_Open.end(), pNodeUpdated);
-  ASSERT((It != m_Open.end()) != 0);
-  
-  // Se reordean elementos en el heap
-  CHeapComp HeapComp;
-  std::push_heap(m_Open.begin(), ++It, HeapComp);
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Libera la lista en Open.
-// Parametros:
-// Devuelve:
-// Notas:
-// - Los nodos no seran eliminados de memoria, al utilizar un CRecycleNodePool
-///////////////////////////////////////////////////////////////////////////////
-void
-CIsoEngine::CPathFinder::CleanOpen(void)
-{
-  // SOLO si instancia inicializada
-  ASSERT(IsInitOk());
-  
-  // Se procede a eliminar nodos
-  HeapIt It = m_Open.begin();
-  while (It != m_Open.end()) {	
-	It = m_Open.erase(It);
-  }
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Descripcion:
-// - Calcula la distancia entre las dos posiciones de tile usando pitagoras
-// Parametros:
-// - TileSrc, TileDest. Posiciones inicial y destino
-// Devuelve:
-// - Valor de la distancia entre ambos tiles, teniendo en cuenta que se usara
-//   como referencia unitaria la posicion de los mismos en un sistema de
-//   coordenadas. En caso de que alguna posicion no sea valida, se 
-//   retornara -1.
-// Notas:
-///////////////////////////////////////////////////////////////////////////////
-sword 
-CIsoEngine::CPathFinder::CalculeAbsoluteDistance(const AreaDefs::sTilePos& TileSrc,
-												 const AreaDefs::sTilePos& TileDest)
-{
-  // SOLO si instancia inicializada  
-  ASSERT(IsInitOk());
-
-  // Los tiles pertenecen a posiciones validas?
-  ASSERT(IsAreaAttached());
-  if (m_pActArea->IsCellValid(TileSrc) &&
-	  m_pActArea->IsCellValid(TileDest)) {	
-	// Calcula la distancia entre coordenadas
-	const sword swXValue = TileSrc.XTile - TileDest.XTile;
-	const sword swYValue = TileSrc.YTile - TileDest.YTile;
-
-	// Aplica pitagoras
-	dword udResult = sqrt((swXValue * swXValue) + (swYValue * swYValue));
-
-	// Para corregir las variaciones isometricas, si el resultado es 1 y no
-	// son tiles adyacentes, se incrementara el resultado
-	if (udResult < 2) {
-	  if (!SYSEngine::GetWorld()->IsAdjacentTo(TileSrc, TileDest)) {
-		udResult++;
-	  }
-	}
-
-	// Retorna
-	return udResult;
-  }
-
-  // Posiciones no validas
-  return -1;
-}
-
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Recibe la notificacion de una criatura. El motor isometrico sera observer
@@ -24,7 +24,7 @@
 //
 // Clases:
 // - CIsoEngine
-//    * CPathFinder
+//    * CPathFinderArea
 //    * CDrawArea
 //       * CDrawAreaFloor
 //       * CDrawAreaOnFloor
@@ -35,9 +35,8 @@
 // - El motor isometrico sera un componente de CWorld y trabajara con objetos
 //   de tipos CArea, que contendran toda la informacion relativa al contenido que
 //   el motor sera capaz de coordinar para el dibujado.
-// - Dentro del motor isometrico se implementara la clase CPathFinder que sera
-//   la que se encargue de implementar el sistema de busqueda utilizando el
-//   algoritmo A*.
+// - El motor isometrico mantendra el localizador de caminos, CPathFinder,
+//   vinculandole el area activa a traves de la clase CPathFinderArea.
 //
 // Notas:
 // * CIsoEngine
@@ -45,20 +44,13 @@
 //   array que represente el area, la fila y columna 0 estaran reseradas para
 //   las celdas marco. Cuando se quiera acceder a una posicion de un area,
 //   siempre se exijira trabajar con posiciones entre 1 y 255.
-// * CPathFinder
-// - La Closed list no existira como tal, en lugar de ello, se usara un map
-//   general que contendra punteros a nodos. Dichos nodos tendran dos flags
-//   indicando en que lista se hallan. Cuando un nodo este en la Open, es seguro
-//   que se pueda encontrar en el monticulo que la representa y cuando este
-//   en la Closed es seguro que se podra encontrar unicamente en el map
-//   general. El map general acelerara el proceso de busqueda.
-// - Como apoyo en la eficiencia, se usara un CRecycleNodePool que evitara
-//   el estar haciendo sucesivas llamadas New y aprovechara nodos previamente
-//   creados.
 // - Se tomara al motor isometrico como observer de CWorld para conocer 
 //   cuando es destruida una entidad y comprobar si dicha entidad posee
 //   la camara asociada. Si esto ocurriera asi, se debera de asociar la
 //   camara al jugador.
+// * CPathFinderArea
+// - Implementara la interfaz iCPathFinderMap sobre un area, trasladando cada
+//   consulta del localizador de caminos a la misma.
 // * CDrawArea
 // - Se implementara una jerarquia de clases muy sencillas para sobrecargar
 //   su operador (). Al sobrecargarlo, se incluira en el mismo el metodo
@@ -125,8 +117,8 @@
 #ifndef _CPLAYER_H_
 #include "CPlayer.h"
 #endif
-#ifndef _CRECYCLENODEPOOL_CPP_
-#include "CRecycleNodePool.cpp"
+#ifndef _CPATHFINDER_H_
+#include "CPathFinder.h"
 #endif
 #ifndef _DEQUE_H_
 #include <deque>
@@ -163,147 +155,61 @@ class CIsoEngine: public iCCriatureObserver,
 				  public iCWorldObserver
 {
 private:
-  // Clase para la busqueda de caminos
-  class CPathFinder 
+  // Clase para vincular el area al localizador de caminos
+  class CPathFinderArea: public iCPathFinderMap
   {
   private:
-	// Estructuras
-	struct sNodeSearch {
-	  // Nodo de busqueda
-	  // Enumerados
-	  enum eNodeAlloc {
-		// Posibles lugares de alojamiento para un nodo
-		OPEN, CLOSED, NO_ALLOC
-	  };
-	  // Datos
-	  sNodeSearch*       pParentState; // Estado padre
-	  AreaDefs::sTilePos TilePos;      // Posicion del tile al que hace ref.
-	  float              fCostToThis;  // Coste para llegar a este nodo
-	  float              fCostToDest;  // fCostToThis + Heuristic
-	  eNodeAlloc         NodeAlloc;    // Lugar de alojamiento del nodo
-	  // Constructor
-	  sNodeSearch(void): pParentState(NULL),
-						 fCostToThis(0.0f),
-						 fCostToDest(0.0f),
-						 NodeAlloc(sNodeSearch::NO_ALLOC) { }
-	  // Pool de memoria
-	  static CMemoryPool MPool;
-	  static void* operator new(const size_t size) { return MPool.AllocMem(size); }
-	  static void operator delete(void* pItem) { MPool.FreeMem(pItem); } 
-	};
-
-  private:
-	// Tipos
-	// Define el map para la relacion posicion - nodo estado
-	typedef std::map<AreaDefs::TileIndex, sNodeSearch*> MainNodeIndex;
-	typedef MainNodeIndex::iterator                     MainNodeIndexIt;
-	typedef MainNodeIndex::value_type                   MainNodeIndexValType;
-	// Define un monticulo a partir de un vector para representar la Open
-	typedef std::vector<sNodeSearch*> Heap;
-	typedef Heap::iterator            HeapIt;	
-
-  private:
-	// Predicado para el trabajo con el monticulo de la Open
-	// a la hora de comparar nodos entre si
-	class CHeapComp 
-	{
-	public:
-	  bool operator()(sNodeSearch* const pFirst, 
-					  sNodeSearch* const pSecond) const {
-		return (pFirst->fCostToDest > pSecond->fCostToDest);
-	  }
-	}; // ~ CHeapComp 
-
-  private:
-	// Alojamiento de los nodos	
-	CRecycleNodePool<sNodeSearch> 
-	               m_RecycleNodePool; // Banco de nodos
-	Heap           m_Open;            // Monticulo con los nodos en la Open
-	MainNodeIndex  m_MainNodeIndex;   // Map principal (ver notas)
-
-	// Area actual
-	CArea* m_pActArea; // Area actual
-
-	// Datos precalculados	
-	// Direc. a visitar
-	IsoDefs::eDirectionIndex m_DirsToVisit[IsoDefs::MAX_DIRECTIONS]; 
-	// Flags asociados a las direcciones a visitar que hay que chequear en los adj.
-	IsoDefs::eDirectionFlag  m_MaskFlagToCheck[IsoDefs::MAX_DIRECTIONS];
-
-	// Resto de vbles
-	bool m_bIsInitOk; // Instancia inicializada?
-
-  public:
-	// Constructor / destructor
-	CPathFinder(void): m_bIsInitOk(false),
-				       m_pActArea(NULL) { }
-	~CPathFinder(void) { End(); }
+	// Vbles de miembro
+	CArea* m_pArea; // Area vinculada
 
   public:
-	// Protocolo de inicio y fin de instancia
-	bool Init(void);
-	void End(void);
-	inline bool IsInitOk(void) const { return m_bIsInitOk; }
+	// Constructor
+	CPathFinderArea(void): m_pArea(NULL) { }
 
   public:
 	// Trabajo con el establecimiento del area
 	inline void SetArea(CArea* const pArea) {
-	  ASSERT(IsInitOk());
 	  // Asocia / desasocia area
-	  m_pActArea = pArea;
-	}
-	inline bool IsAreaAttached(void) const {
-	  ASSERT(IsInitOk());
-	  // Retorna flag
-	  return (m_pActArea != NULL);
+	  m_pArea = pArea;
 	}
 
   public:
-	// Trabajo para la obtencion del camino de busqueda o info derivada
-	CPath* const FindPath(const AreaDefs::sTilePos& TileSrc,
-						  const AreaDefs::sTilePos& TileDest,
-						  const word uwDistanceMin = 0,
-						  const bool bGhostMode = false);	
-	sword CalculePathLenght(const AreaDefs::sTilePos& TileSrc,
-						    const AreaDefs::sTilePos& TileDest);	
-	sword CalculeAbsoluteDistance(const AreaDefs::sTilePos& TileSrc,
-								  const AreaDefs::sTilePos& TileDest);
-  private:
-	// Metodos de a apoyo
-	bool AccessValidInAdjacentsOfTileDest(const AreaDefs::sTilePos& TileSrc,
-										  const IsoDefs::eDirectionIndex& TileDestDir);
-
-  private:
-	// Generacion del camino de busqueda una vez encontrado
-	void _CreatePath(sNodeSearch* const pNodeSearch,
-					 CPath*& pPath);
-  
-  private:
-	// Metodos de trabajo con el MainNodeIndex	
-	void CleanMainNodeIndex(void);
-	
-  private:
-	// Metodos para el trabajo con la Open
-	void OpenPop(sNodeSearch*& pNodeSearch);
-	void OpenPush(sNodeSearch* const pNode);
-	void OpenUpdateNodePriority(sNodeSearch* const pNodeUpdated);
-	void CleanOpen(void);
+	// iCPathFinderMap / Manipulacion de posicion en tiles
+	bool IsCellValid(const AreaDefs::sTilePos& TilePos) {
+	  ASSERT(m_pArea);
+	  return m_pArea->IsCellValid(TilePos);
+	}
+	AreaDefs::TileIndex GetTileIdx(const AreaDefs::sTilePos& TilePos) {
+	  ASSERT(m_pArea);
+	  return m_pArea->GetTileIdx(TilePos);
+	}
+	bool GetAdjacentTilePos(const AreaDefs::sTilePos& TilePosSrc,
+							const IsoDefs::eDirectionIndex& AdjTileDirection,
+							AreaDefs::sTilePos& TilePosDest) {
+	  ASSERT(m_pArea);
+	  return m_pArea->GetAdjacentTilePos(TilePosSrc, AdjTileDirection, TilePosDest);
+	}
+	IsoDefs::eDirectionIndex CalculeDirection(const AreaDefs::sTilePos& TilePosSrc,
+											  const AreaDefs::sTilePos& TilePosDest) {
+	  ASSERT(m_pArea);
+	  return m_pArea->CalculeDirection(TilePosSrc, TilePosDest);
+	}
+	bool IsAdjacentTo(const AreaDefs::sTilePos& TileSrc,
+					  const AreaDefs::sTilePos& TileDest);
 
-  private:
-	// Obtencion del valor heuristico
-	inline float GetHeuristicValue(const AreaDefs::sTilePos& TileSrc, 						 
-								   const AreaDefs::sTilePos& TileDest) {	  
-	  ASSERT(IsInitOk());  
-	  // Calcula el valor heuristico y lo devuelve
-	  const word uwXDist = TileSrc.XTile > TileDest.XTile ? 
-						   TileSrc.XTile - TileDest.XTile : 
-						   TileDest.XTile - TileSrc.XTile;
-	  const word uwYDist = TileSrc.YTile > TileDest.YTile ? 
-						   TileSrc.YTile - TileDest.YTile : 
-						   TileDest.YTile - TileSrc.YTile;
-	  return (uwXDist > uwYDist) ? uwXDist : uwYDist;
-	}  
-  }; // ~ CPathFinder
+  public:
+	// iCPathFinderMap / Trabajo con la mascara de acceso y la conectividad
+	AreaDefs::MaskTileAccess GetMaskTileAccess(const AreaDefs::sTilePos& TilePos,
+											   const dword udNoEntitiesToCheck = RulesDefs::NO_ENTITY) {
+	  ASSERT(m_pArea);
+	  return m_pArea->GetMaskTileAccess(TilePos, udNoEntitiesToCheck);
+	}
+	bool AreTilesConnected(const AreaDefs::sTilePos& TileSrc,
+						   const AreaDefs::sTilePos& TileDest) {
+	  ASSERT(m_pArea);
+	  return m_pArea->AreTilesConnected(TileSrc, TileDest);
+	}
+  }; // ~ CPathFinderArea
 
   class CDrawArea {
 	public:
@@ -438,6 +344,7 @@ private:
   // Sistemas de informacion 
   sIsoMap         m_IsoMap;        // Info. sobre el area vinculada  
   CPathFinder     m_PathFinder;    // Localizador de caminos
+  CPathFinderArea m_PathFinderArea; // Area vinculada al localizador de caminos
   sScrollInfo     m_ScrollInfo;    // Info. sobre el trabajo con el scroll  
   sCameraInfo     m_CameraInfo;    // Informacion asociada a la camara 
   sTransparentSys m_TranspSys;     // Subsistema de info para transparencias sobre entidades
@@ -743,6 +650,13 @@ public:
 	// Traslada la responsabilidad al localizador de caminos
 	return m_PathFinder.CalculePathLenght(TileSrc, TileDest);
   }
+  inline sword CalculeBoundedPathLenght(const AreaDefs::sTilePos& TileSrc, 				  
+										const AreaDefs::sTilePos& TileDest,
+										const word uwMaxLenght) {
+	ASSERT(IsInitOk());
+	// Traslada la responsabilidad al localizador de caminos
+	return m_PathFinder.CalculeBoundedPathLenght(TileSrc, TileDest, uwMaxLenght);
+  }
   sword CalculeAdjacentPosInDestination(const AreaDefs::sTilePos& TileSrc, 				  
 									    const AreaDefs::sTilePos& TileDest,
 									    AreaDefs::sTilePos& AdjacentTilePos);
@@ -0,0 +1,280 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CLZCodec.cpp
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Consultar CLZCodec.h para mas detalles.
+///////////////////////////////////////////////////////////////////////////////
+#include "CLZCodec.h"
+
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprime el bloque pubSrc en pubDest.
+// Parametros:
+// - pubSrc, udSrcSize: Bloque a comprimir y su tamao.
+// - pubDest, udDestCapacity: Buffer destino y su capacidad.
+// Devuelve:
+// - El tamao del bloque comprimido. Si no cupiera en pubDest, se devolvera
+//   0 y el bloque se debera de guardar sin comprimir.
+// Notas:
+// - Pasando como capacidad un valor inferior a udSrcSize, se obtendra 0
+//   siempre que la compresion no reduzca el tamao.
+///////////////////////////////////////////////////////////////////////////////
+dword
+CLZCodec::Compress(const byte* const pubSrc,
+				   const dword udSrcSize,
+				   byte* const pubDest,
+				   const dword udDestCapacity)
+{
+  // SOLO si parametros validos
+  ASSERT(pubSrc);
+  ASSERT(pubDest);
+  ASSERT((udSrcSize <= CLZCodec::MAX_BLOCK_SIZE) != 0);
+
+  // Se inicializa la tabla hash con las ultimas posiciones de cada secuencia
+  // de 4 bytes, marcando las entradas como vacias
+  dword HashTable[1 << CLZCodec::HASH_BITS];
+  memset(HashTable, 0xFF, sizeof(HashTable));
+
+  // Se recorre el bloque buscando coincidencias
+  dword udSrcPos = 0;
+  dword udAnchor = 0;
+  dword udDestPos = 0;
+  while (udSrcPos + CLZCodec::MIN_MATCH <= udSrcSize) {
+	// Se localiza la ultima posicion con el mismo hash y se actualiza
+	dword udSequence;
+	memcpy(&udSequence, pubSrc + udSrcPos, sizeof(dword));
+	const dword udHash = dword(udSequence * 2654435761UL) >> (32 - CLZCodec::HASH_BITS);
+	const dword udRef = HashTable[udHash];
+	HashTable[udHash] = udSrcPos;
+
+	// NO hay coincidencia valida?
+	dword udRefSequence = 0;
+	if (0xFFFFFFFF != udRef) {
+	  memcpy(&udRefSequence, pubSrc + udRef, sizeof(dword));
+	}
+	if (0xFFFFFFFF == udRef ||
+		udSrcPos - udRef > CLZCodec::MAX_OFFSET ||
+		udRefSequence != udSequence) {
+	  ++udSrcPos;
+	  continue;
+	}
+
+	// Se extiende la coincidencia
+	dword udMatch = CLZCodec::MIN_MATCH;
+	while (udSrcPos + udMatch < udSrcSize &&
+		   pubSrc[udRef + udMatch] == pubSrc[udSrcPos + udMatch]) {
+	  ++udMatch;
+	}
+
+	// Se escribe el byte de control y los literales pendientes
+	const dword udLiterals = udSrcPos - udAnchor;
+	const dword udMatchCode = udMatch - CLZCodec::MIN_MATCH;
+	if (udDestPos >= udDestCapacity) {
+	  return 0;
+	}
+	pubDest[udDestPos++] = byte(((udLiterals < 15 ? udLiterals : 15) << 4) |
+								(udMatchCode < 15 ? udMatchCode : 15));
+	if (udLiterals >= 15 &&
+		!WriteLength(udLiterals - 15, pubDest, udDestPos, udDestCapacity)) {
+	  return 0;
+	}
+	if (udDestPos + udLiterals > udDestCapacity) {
+	  return 0;
+	}
+	memcpy(pubDest + udDestPos, pubSrc + udAnchor, udLiterals);
+	udDestPos += udLiterals;
+
+	// Se escribe el desplazamiento y el resto del tamao de la coincidencia
+	if (udDestPos + 2 > udDestCapacity) {
+	  return 0;
+	}
+	const word uwOffset = word(udSrcPos - udRef);
+	pubDest[udDestPos++] = byte(uwOffset & 0xFF);
+	pubDest[udDestPos++] = byte(uwOffset >> 8);
+	if (udMatchCode >= 15 &&
+		!WriteLength(udMatchCode - 15, pubDest, udDestPos, udDestCapacity)) {
+	  return 0;
+	}
+
+	// Se avanza tras la coincidencia
+	udSrcPos += udMatch;
+	udAnchor = udSrcPos;
+  }
+
+  // Se escribe la ultima secuencia, solo con literales
+  const dword udLiterals = udSrcSize - udAnchor;
+  if (udDestPos >= udDestCapacity) {
+	return 0;
+  }
+  pubDest[udDestPos++] = byte((udLiterals < 15 ? udLiterals : 15) << 4);
+  if (udLiterals >= 15 &&
+	  !WriteLength(udLiterals - 15, pubDest, udDestPos, udDestCapacity)) {
+	return 0;
+  }
+  if (udDestPos + udLiterals > udDestCapacity) {
+	return 0;
+  }
+  memcpy(pubDest + udDestPos, pubSrc + udAnchor, udLiterals);
+  udDestPos += udLiterals;
+
+  // Se retorna el tamao comprimido
+  return udDestPos;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Descomprime el bloque pubSrc en pubDest.
+// Parametros:
+// - pubSrc, udSrcSize: Bloque comprimido y su tamao.
+// - pubDest, udDestSize: Buffer destino y tamao exacto del bloque original.
+// Devuelve:
+// - Si el bloque se ha descomprimido completamente true. Si el bloque no
+//   fuera valido false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+CLZCodec::Decompress(const byte* const pubSrc,
+					 const dword udSrcSize,
+					 byte* const pubDest,
+					 const dword udDestSize)
+{
+  // SOLO si parametros validos
+  ASSERT(pubSrc);
+  ASSERT(pubDest);
+
+  // Se procesan las secuencias
+  dword udSrcPos = 0;
+  dword udDestPos = 0;
+  while (udSrcPos < udSrcSize) {
+	// Se lee el byte de control y se copian los literales
+	const byte ubToken = pubSrc[udSrcPos++];
+	dword udLiterals = ubToken >> 4;
+	if (15 == udLiterals &&
+		!ReadLength(pubSrc, udSrcPos, udSrcSize, udLiterals)) {
+	  return false;
+	}
+	if (udLiterals > udSrcSize - udSrcPos ||
+		udLiterals > udDestSize - udDestPos) {
+	  return false;
+	}
+	memcpy(pubDest + udDestPos, pubSrc + udSrcPos, udLiterals);
+	udSrcPos += udLiterals;
+	udDestPos += udLiterals;
+
+	// Ultima secuencia?
+	if (udDestPos == udDestSize) {
+	  return (udSrcPos == udSrcSize);
+	}
+
+	// Se lee la coincidencia
+	if (udSrcPos + 2 > udSrcSize) {
+	  return false;
+	}
+	const dword udOffset = pubSrc[udSrcPos] | (dword(pubSrc[udSrcPos + 1]) << 8);
+	udSrcPos += 2;
+	if (0 == udOffset || udOffset > udDestPos) {
+	  return false;
+	}
+	dword udMatch = ubToken & 0x0F;
+	if (15 == udMatch &&
+		!ReadLength(pubSrc, udSrcPos, udSrcSize, udMatch)) {
+	  return false;
+	}
+	udMatch += CLZCodec::MIN_MATCH;
+	if (udMatch > udDestSize - udDestPos) {
+	  return false;
+	}
+
+	// Se copia byte a byte, pues la coincidencia se podra solapar con
+	// el propio destino
+	const byte* pubRef = pubDest + udDestPos - udOffset;
+	byte* pubOut = pubDest + udDestPos;
+	udDestPos += udMatch;
+	for (; udMatch > 0; --udMatch) {
+	  *pubOut++ = *pubRef++;
+	}
+  }
+
+  // Se debera de haber completado el bloque
+  return (udDestPos == udDestSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Escribe los bytes adicionales de una longitud que ha llegado a 15.
+// Parametros:
+// - udLength: Longitud restante a escribir.
+// - pubDest, udDestPos, udDestCapacity: Buffer, posicion y capacidad.
+// Devuelve:
+// - Si se ha podido escribir true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+CLZCodec::WriteLength(dword udLength,
+					  byte* const pubDest,
+					  dword& udDestPos,
+					  const dword udDestCapacity)
+{
+  // Se escriben tantos 255 como sean necesarios y el resto
+  for (;;) {
+	if (udDestPos >= udDestCapacity) {
+	  return false;
+	}
+	if (udLength < 255) {
+	  pubDest[udDestPos++] = byte(udLength);
+	  return true;
+	}
+	pubDest[udDestPos++] = 255;
+	udLength -= 255;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee y suma a udLength los bytes adicionales de una longitud.
+// Parametros:
+// - pubSrc, udSrcPos, udSrcSize: Buffer, posicion y tamao.
+// - udLength: Longitud a completar.
+// Devuelve:
+// - Si se ha podido leer true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+CLZCodec::ReadLength(const byte* const pubSrc,
+					 dword& udSrcPos,
+					 const dword udSrcSize,
+					 dword& udLength)
+{
+  // Se suman bytes mientras valgan 255
+  byte ubValue = 255;
+  while (255 == ubValue) {
+	if (udSrcPos >= udSrcSize) {
+	  return false;
+	}
+	ubValue = pubSrc[udSrcPos++];
+	udLength += ubValue;
+  }
+  return true;
+}
@@ -0,0 +1,93 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CLZCodec.h
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Clase:
+// - CLZCodec
+//
+// Descripcion:
+// - Compresor / descompresor LZ77 orientado a bytes, al estilo de LZ4, para
+//   bloques de hasta 64 KB. Prima la velocidad de descompresion sobre el
+//   ratio obtenido y no necesita memoria adicional para descomprimir.
+// - Cada bloque comprimido sera una sucesion de secuencias formadas por:
+//   * Un byte de control, con el numero de literales en los 4 bits altos y
+//     el tamao de la coincidencia (menos 4) en los 4 bits bajos. Si algun
+//     valor llega a 15, se continuara con bytes adicionales que se sumaran
+//     mientras valgan 255.
+//   * Los literales.
+//   * El desplazamiento hacia atras de la coincidencia (word), salvo en la
+//     ultima secuencia, que solo contendra literales.
+//
+// Notas:
+// - La descompresion validara todos los limites, de tal forma que un bloque
+//   corrupto no provocara accesos fuera de los buffers.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _CLZCODEC_H_
+#define _CLZCODEC_H_
+
+// Cabeceras
+#ifndef _SYSDEFS_H_
+#include "SYSDefs.h"
+#endif
+
+// Clase CLZCodec
+class CLZCodec
+{
+public:
+  // Constantes
+  enum {
+	MAX_BLOCK_SIZE = 65536 // Tamao maximo de un bloque sin comprimir
+  };
+
+private:
+  // Constantes
+  enum {
+	MIN_MATCH  = 4,  // Tamao minimo de una coincidencia
+	HASH_BITS  = 12, // Bits para la tabla hash del compresor
+	MAX_OFFSET = 65535 // Desplazamiento maximo de una coincidencia
+  };
+
+public:
+  // Compresion / descompresion
+  static dword Compress(const byte* const pubSrc,
+						const dword udSrcSize,
+						byte* const pubDest,
+						const dword udDestCapacity);
+  static bool Decompress(const byte* const pubSrc,
+						 const dword udSrcSize,
+						 byte* const pubDest,
+						 const dword udDestSize);
+
+private:
+  // Metodos de apoyo
+  static bool WriteLength(dword udLength,
+						  byte* const pubDest,
+						  dword& udDestPos,
+						  const dword udDestCapacity);
+  static bool ReadLength(const byte* const pubSrc,
+						 dword& udSrcPos,
+						 const dword udSrcSize,
+						 dword& udLength);
+};
+
+#endif // ~ CLZCodec
@@ -93,13 +93,13 @@ CMemoryPool::ReleasePool(void)
 
   // Se libera el pool de memoria  
   if (m_pubMemoryPool) { 
-	delete m_pubMemoryPool; 
+	::operator delete(m_pubMemoryPool); 
 	m_pubMemoryPool = NULL;
   }
 
   // Se libera la pila  
   if (m_pFreeBlocksStack) { 
-	delete[m_uwNumBlocks] m_pFreeBlocksStack; 
+	delete[] m_pFreeBlocksStack; 
 	m_pFreeBlocksStack = NULL;
   }
 }
@@ -115,15 +115,21 @@ CMemoryPool::ReleasePool(void)
 // Devuelve:
 // - Puntero a un bloque de memoria.
 // Notas:
+// - Los contadores de bloques pedidos y reservas en el heap se llevaran en
+//   el pool raiz, que sera el que reciba las peticiones del exterior.
 ///////////////////////////////////////////////////////////////////////////////
 void* 
 CMemoryPool::AllocMem(const size_t& nItemSize)
 {
+  // Se cuenta la peticion (solo tendra sentido en el pool raiz)
+  ++m_udNumAllocs;
+
   // En caso de que el tamao del item por el que se pida memoria no coincida
   // con el tamao de m_nItemSize, se dejara la responsabilidad de crear memoria
   // al operador new global. Esto puede ocurrir cuando se intente crear memoria
   // de una clase derivada de otra que mantiene el CMemoryPool.
   if (nItemSize != m_nItemSize) {  
+	++m_udNumHeapAllocs;
 	return ::operator new(nItemSize); 
   }
 
@@ -159,6 +165,14 @@ CMemoryPool::AllocMem(const size_t& nItemSize)
       m_pNextPool = new CMemoryPool(this);
 	  ASSERT(m_pNextPool);
       if (m_pNextPool) {        
+		// Se anotan en el pool raiz las reservas de la instancia, el bloque
+		// de memoria y la pila
+		CMemoryPool* pRootPool = this;
+		while (pRootPool->m_pPrevPool) {
+		  pRootPool = pRootPool->m_pPrevPool;
+		}
+		pRootPool->m_udNumHeapAllocs += 3;
+
         return m_pNextPool->AllocMem(nItemSize); 
       }
     }
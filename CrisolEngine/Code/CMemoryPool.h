@@ -57,6 +57,10 @@
 //      m_MemoryManager.FreeMem(pItem) 
 //   }
 //
+// - El pool raiz llevara la cuenta de los bloques que se le pidan y de las
+//   reservas que, por ello, haya tenido que realizar en el heap (bloques de
+//   tamao distinto y expansiones), de tal forma que la clase anfitriona
+//   pueda conocer el coste en memoria de sus operaciones.
 // - Quedaria por implementar una mejora en el tratamiento de los bloques
 //   usados y libres.
 ///////////////////////////////////////////////////////////////////////////////
@@ -83,6 +87,8 @@ private:
   word         m_uwNumBlocks;        // Numero de bloques de memoria reservados
   size_t       m_nItemSize;          // Tamao de un bloque de memoria
   bool         m_bExpandPool;        // Flag de pool con capacidad de expansion
+  dword        m_udNumAllocs;        // Bloques pedidos al pool
+  dword        m_udNumHeapAllocs;    // Reservas realizadas en el heap
   
   // Constructor / Destructor
 public: 
@@ -93,7 +99,9 @@ public:
                                                m_bExpandPool(bExpandPool),
                                                m_uwStackTop(0),
                                                m_pNextPool(NULL),
-                                               m_pPrevPool(NULL) { 
+                                               m_pPrevPool(NULL),
+                                               m_udNumAllocs(0),
+                                               m_udNumHeapAllocs(0) { 
 	// Se prepara el pool de memoria
     PreparePool(); 
   }
@@ -103,7 +111,9 @@ protected:
                                              m_uwNumBlocks(pPrevPool->m_uwNumBlocks),
                                              m_nItemSize(pPrevPool->m_nItemSize),
                                              m_bExpandPool(true),
-                                             m_uwStackTop(0) {
+                                             m_uwStackTop(0),
+                                             m_udNumAllocs(0),
+                                             m_udNumHeapAllocs(0) {
     // Se prepara el pool de memoria 
     PreparePool(); 
   }
@@ -118,6 +128,11 @@ public:
   void* AllocMem(const size_t& ItemSize);
   void FreeMem(void* pFreeItem);
 
+  // Obtencion de contadores
+public:
+  inline dword GetNumAllocs(void) const { return m_udNumAllocs; }
+  inline dword GetNumHeapAllocs(void) const { return m_udNumHeapAllocs; }
+
   // Metodos de apoyo
 protected:
   void PreparePool(void);
@@ -29,6 +29,11 @@
 #include "..\\CCPAKFile.h"
 #include <iostream>
 #include <sstream>
+#include <fstream>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <time.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
@@ -52,8 +57,9 @@ CCPAKTool::Init(const std::string& szGameDataFileName)
 	End();
   }
 
-  // Se toma el nombre
+  // Se toma el nombre y, por defecto, un hilo por procesador
   m_szGameDataFileName = szGameDataFileName;
+  m_ubNumThreads = CCPAKFile::GetNumProcessors();
 
   // Se retorna
   m_bIsInitOk = true;
@@ -76,6 +82,21 @@ CCPAKTool::End(void)
   }
 }
  
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Establece el numero de hilos a utilizar al aadir y extraer ficheros.
+// Parametros:
+// - ubNumThreads. Numero de hilos. Con 0 se usara un hilo por procesador.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CCPAKTool::SetNumThreads(const byte ubNumThreads)
+{
+  // Se establece
+  m_ubNumThreads = ubNumThreads ? ubNumThreads : CCPAKFile::GetNumProcessors();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Crea el archivo de datos SOLO si este no existe. Al crearlo lo dejara
@@ -115,6 +136,76 @@ CCPAKTool::CreateGameDataFile(void)
   return false;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Crea de nuevo el archivo de datos con los ficheros indicados en un
+//   manifiesto, aadiendolos en el orden en que aparezcan.
+// Parametros:
+// - szManifestFileName. Nombre del manifiesto.
+// Devuelve:
+// - Resultado de la operacion
+// Notas:
+// - El manifiesto tendra un fichero por linea. Las lineas vacias y las que
+//   comiencen por ';' o '#' se ignoraran.
+// - El archivo resultante sera identico para un mismo manifiesto y unos 
+//   mismos ficheros, con independencia del numero de hilos.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKTool::BuildFromManifest(const std::string& szManifestFileName)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se lee el manifiesto
+  WriteMsg("Creando el fichero " + m_szGameDataFileName + " desde " + szManifestFileName);
+  std::ifstream Manifest(szManifestFileName.c_str());
+  if (!Manifest.good()) {
+	WriteMsg("Problemas abriendo el fichero " + szManifestFileName);
+	return false;
+  }
+  std::list<std::string> Files;
+  std::string szLine;
+  while (std::getline(Manifest, szLine)) {
+	// Se eliminan espacios y retornos de carro en los extremos
+	const std::string::size_type Begin = szLine.find_first_not_of(" \t\r");
+	if (std::string::npos == Begin) {
+	  continue;
+	}
+	const std::string::size_type End = szLine.find_last_not_of(" \t\r");
+	szLine = szLine.substr(Begin, End - Begin + 1);
+
+	// NO es comentario?
+	if (';' != szLine[0] && '#' != szLine[0]) {
+	  Files.push_back(szLine);
+	}
+  }
+  Manifest.close();
+
+  // Se crea el CPAK, sobreescribiendolo si existiera, y se aaden
+  CCPAKFile CPAKFile;
+  if (CPAKFile.Open(m_szGameDataFileName, true)) {
+	const clock_t InitTime = clock();
+	const dword udNumFiles = CPAKFile.AddFiles(Files, m_ubNumThreads);
+	CPAKFile.Close();
+	const double dTime = double(clock() - InitTime) / CLOCKS_PER_SEC;
+
+	// Muestra el resultado
+	std::ostringstream StrText;
+	StrText << "Ficheros aadidos: " << udNumFiles << " de " << Files.size();
+	WriteMsg(StrText.str());
+	std::ostringstream TimeText;
+	TimeText << "Tiempo: " << dTime << " s con " << dword(m_ubNumThreads) << " hilo(s)";
+	WriteMsg(TimeText.str());
+
+	// Retorna
+	return (udNumFiles == Files.size());
+  }
+
+  // Problemas creando
+  WriteMsg("Problemas creando el fichero " + m_szGameDataFileName);
+  return false;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Aade un fichero.
@@ -174,7 +265,7 @@ CCPAKTool::AddFiles(const std::string& szDirectory,
   CCPAKFile CPAKFile;
   if (CPAKFile.Open(m_szGameDataFileName)) {
 	// Asocia archivos por extension
-	const dword udNumFiles = CPAKFile.AddFilesByExtension(szDirectory, szExtension);
+	const dword udNumFiles = CPAKFile.AddFilesByExtension(szDirectory, szExtension, m_ubNumThreads);
 	CPAKFile.Close();	
 
 	// Muestra el num. de archivos asociados
@@ -247,7 +338,7 @@ CCPAKTool::ExtractAllFiles(void)
   CCPAKFile CPAKFile;
   if (CPAKFile.Open(m_szGameDataFileName)) {
 	// Intenta extraer todos
-	const dword udNumFiles = CPAKFile.ExtractAll();	
+	const dword udNumFiles = CPAKFile.ExtractAll(false, m_ubNumThreads);	
 	CPAKFile.Close();	
 
 	// Num. de extraidos
@@ -383,6 +474,287 @@ CCPAKTool::ListFiles(const std::string& szListFileName)
   return false;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Mide la velocidad de lectura de todos los ficheros contenidos en el CPAK,
+//   primero a traves del fstream y luego desde la proyeccion en memoria, 
+//   mostrando los MB/s obtenidos en cada caso.
+// Parametros:
+// Devuelve:
+// - Resultado
+// Notas:
+// - Antes de medir se realizara una pasada sin contabilizar, para que ambas
+//   mediciones partan con el fichero en la cache del sistema.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKTool::Benchmark(void)
+{
+  // Abre fichero CPAK
+  WriteMsg("Midiendo la velocidad de lectura");
+  CCPAKFile CPAKFile;
+  if (CPAKFile.Open(m_szGameDataFileName)) {
+	// Obtiene lista y tamao del mayor de los ficheros
+	std::list<std::string> StrList;
+	CPAKFile.GetFileList(StrList);
+	dword udMaxSize = 0;
+	std::list<std::string>::iterator It(StrList.begin());
+	for (; It != StrList.end(); ++It) {
+	  const dword udSize = CPAKFile.GetFileSize(*It);
+	  if (udSize > udMaxSize) {
+		udMaxSize = udSize;
+	  }
+	}
+	if (0 == udMaxSize) {
+	  WriteMsg("No hay ficheros que leer");
+	  return false;
+	}
+	std::vector<sbyte> Buffer(udMaxSize);
+
+	// Se realizan las pasadas sin proyeccion, la primera sin contabilizar,
+	// y por ultima la pasada con proyeccion
+	const bool bMapped = CPAKFile.IsMapped();
+	CPAKFile.UnmapFile();
+	double dTime[2] = { 0.0, 0.0 };
+	dword udTotalRead = 0;
+	byte ubPass = 0;
+	for (; ubPass < 3; ++ubPass) {
+	  if (2 == ubPass && !CPAKFile.MapFile()) {
+		WriteMsg("No se pudo proyectar en memoria el fichero");
+		break;
+	  }
+	  const clock_t InitTime = clock();
+	  udTotalRead = 0;
+	  It = StrList.begin();
+	  for (; It != StrList.end(); ++It) {
+		const dword udSize = CPAKFile.GetFileSize(*It);
+		if (udSize) {
+		  udTotalRead += CPAKFile.Read(*It, &Buffer[0], udSize);
+		}
+	  }
+	  if (ubPass > 0) {
+		dTime[ubPass - 1] = double(clock() - InitTime) / CLOCKS_PER_SEC;
+	  }
+	}
+
+	// Se muestran resultados
+	const double dMBytes = double(udTotalRead) / (1024.0 * 1024.0);
+	std::ostringstream Msg;
+	Msg << "Ledos " << StrList.size() << " ficheros (" << dMBytes << " MB) por pasada";
+	WriteMsg(Msg.str());
+	const std::string szPass[2] = { "fstream", "proyeccin" };
+	for (ubPass = 0; ubPass < 2; ++ubPass) {
+	  std::ostringstream PassMsg;
+	  PassMsg << szPass[ubPass] << ": " << dTime[ubPass] << " s";
+	  if (dTime[ubPass] > 0.0) {
+		PassMsg << ", " << dMBytes / dTime[ubPass] << " MB/s";
+	  }
+	  WriteMsg(PassMsg.str());
+	}
+	if (!bMapped) {
+	  WriteMsg("Nota: El motor no podra proyectar este fichero y usara fstream");
+	}
+
+	// Cierra y retorna
+	CPAKFile.Close();
+	return true;
+  }
+
+  // Problemas abriendo
+  WriteMsg("Problemas abriendo el fichero " + m_szGameDataFileName);
+  return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Muestra, agrupando los ficheros por extension, el espacio ocupado sin
+//   comprimir y almacenado, el ratio obtenido y la velocidad de lectura de
+//   los ficheros, incluida su descompresion.
+// Parametros:
+// Devuelve:
+// - Resultado
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKTool::Statistics(void)
+{
+  // Tipos
+  // Ficheros agrupados por extension
+  typedef std::map<std::string, std::list<std::string> > ExtFilesMap;
+  typedef ExtFilesMap::iterator                          ExtFilesMapIt;
+
+  // Abre fichero CPAK
+  WriteMsg("Obteniendo estadsticas de compresin");
+  CCPAKFile CPAKFile;
+  if (CPAKFile.Open(m_szGameDataFileName)) {
+	// Se agrupan los ficheros por extension y se halla el de mayor tamao
+	std::list<std::string> StrList;
+	CPAKFile.GetFileList(StrList);
+	ExtFilesMap ExtFiles;
+	dword udMaxSize = 0;
+	std::list<std::string>::iterator It(StrList.begin());
+	for (; It != StrList.end(); ++It) {
+	  const std::string::size_type ExtPos = It->find_last_of('.');
+	  std::string szExt((std::string::npos == ExtPos) ? "" : It->substr(ExtPos + 1));
+	  std::transform(szExt.begin(), szExt.end(), szExt.begin(), tolower);
+	  ExtFiles[szExt].push_back(*It);
+	  const dword udSize = CPAKFile.GetFileSize(*It);
+	  if (udSize > udMaxSize) {
+		udMaxSize = udSize;
+	  }
+	}
+	if (0 == udMaxSize) {
+	  WriteMsg("No hay ficheros que leer");
+	  return false;
+	}
+	std::vector<sbyte> Buffer(udMaxSize);
+
+	// Se procesa cada extension
+	ExtFilesMapIt ExtIt(ExtFiles.begin());
+	for (; ExtIt != ExtFiles.end(); ++ExtIt) {
+	  // Se obtienen tamaos y se leen todos sus ficheros
+	  dword udSize = 0;
+	  dword udStoredSize = 0;
+	  dword udNumCompressed = 0;
+	  const clock_t InitTime = clock();
+	  It = ExtIt->second.begin();
+	  for (; It != ExtIt->second.end(); ++It) {
+		dword udFileStoredSize = 0;
+		bool bCompressed = false;
+		const dword udFileSize = CPAKFile.GetFileSize(*It);
+		if (udFileSize && 
+			CPAKFile.GetFileStorage(*It, udFileStoredSize, bCompressed)) {
+		  udSize += CPAKFile.Read(*It, &Buffer[0], udFileSize);
+		  udStoredSize += udFileStoredSize;
+		  if (bCompressed) {
+			++udNumCompressed;
+		  }
+		}
+	  }
+	  const double dTime = double(clock() - InitTime) / CLOCKS_PER_SEC;
+
+	  // Se muestra el resultado
+	  const double dMBytes = double(udSize) / (1024.0 * 1024.0);
+	  std::ostringstream Msg;
+	  Msg << "." << ExtIt->first << ": " << ExtIt->second.size() << " ficheros ("
+		  << udNumCompressed << " comprimidos), " << dMBytes << " MB -> "
+		  << double(udStoredSize) / (1024.0 * 1024.0) << " MB";
+	  if (udSize) {
+		Msg << " (" << 100.0 * double(udStoredSize) / double(udSize) << "%)";
+	  }
+	  if (dTime > 0.0) {
+		Msg << ", lectura " << dMBytes / dTime << " MB/s";
+	  }
+	  WriteMsg(Msg.str());
+	}
+
+	// Se muestra el espacio ahorrado por los contenidos compartidos
+	dword udNumShared = 0;
+	const dword udSharedSize = CPAKFile.GetSharedStorage(udNumShared);
+	std::ostringstream SharedMsg;
+	SharedMsg << "Ficheros con contenido compartido: " << udNumShared << " ("
+			  << double(udSharedSize) / (1024.0 * 1024.0) << " MB ahorrados)";
+	WriteMsg(SharedMsg.str());
+
+	// Y el espacio muerto
+	std::ostringstream DeadMsg;
+	DeadMsg << "Espacio muerto: " 
+			<< double(CPAKFile.GetDeadSpace()) / (1024.0 * 1024.0) << " MB";
+	WriteMsg(DeadMsg.str());
+
+	// Cierra y retorna
+	CPAKFile.Close();
+	return true;
+  }
+
+  // Problemas abriendo
+  WriteMsg("Problemas abriendo el fichero " + m_szGameDataFileName);
+  return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprueba el CRC de todos los ficheros del CPAK, mostrando aquellos
+//   cuyo contenido no sea correcto.
+// Parametros:
+// Devuelve:
+// - Si todos los ficheros son correctos true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKTool::Verify(void)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Abre fichero CPAK
+  WriteMsg("Comprobando la integridad de los ficheros");
+  CCPAKFile CPAKFile;
+  if (CPAKFile.Open(m_szGameDataFileName)) {
+	// Se comprueba cada fichero
+	std::list<std::string> StrList;
+	CPAKFile.GetFileList(StrList);
+	dword udNumErrors = 0;
+	std::list<std::string>::iterator It(StrList.begin());
+	for (; It != StrList.end(); ++It) {
+	  if (!CPAKFile.VerifyFile(*It)) {
+		WriteMsg("Fichero corrupto: " + *It);
+		++udNumErrors;
+	  }
+	}
+	CPAKFile.Close();
+
+	// Muestra el resultado y retorna
+	std::ostringstream StrText;
+	StrText << "Ficheros comprobados: " << StrList.size() 
+			<< ", ficheros corruptos: " << udNumErrors;
+	WriteMsg(StrText.str());
+	return (0 == udNumErrors);
+  }
+
+  // Problemas abriendo
+  WriteMsg("Problemas abriendo el fichero " + m_szGameDataFileName);
+  return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Compacta el fichero CPAK, eliminando el espacio muerto.
+// Parametros:
+// Devuelve:
+// - Resultado de la operacion
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CCPAKTool::Compact(void)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Abre fichero CPAK
+  WriteMsg("Compactando el fichero " + m_szGameDataFileName);
+  CCPAKFile CPAKFile;
+  if (CPAKFile.Open(m_szGameDataFileName)) {
+	// Se compacta
+	const dword udDeadSpace = CPAKFile.GetDeadSpace();
+	const bool bResult = CPAKFile.Compact();
+	CPAKFile.Close();
+	if (bResult) {
+	  std::ostringstream StrText;
+	  StrText << "Recuperados " << double(udDeadSpace) / (1024.0 * 1024.0) << " MB";
+	  WriteMsg(StrText.str());
+	} else {
+	  WriteMsg("No se pudo compactar el fichero");
+	}
+
+	// Retorna
+	return bResult;
+  }
+
+  // Problemas abriendo
+  WriteMsg("Problemas abriendo el fichero " + m_szGameDataFileName);
+  return false;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Escribre mensaje
@@ -57,11 +57,13 @@ private:
   // Vbles de miembro
   std::string m_szGameDataFileName; // Nombre del archivo CPAK a utilizar
   bool		  m_bIsInitOk;         // Instancia inicializada correctamente?
+  byte        m_ubNumThreads;      // Hilos para las operaciones por lotes
 
    
 public:
   // Constructor / Destructor
-  CCPAKTool(void): m_bIsInitOk(false) { }
+  CCPAKTool(void): m_bIsInitOk(false),
+				   m_ubNumThreads(1) { }
   ~CCPAKTool(void) { 
 	End(); 
   }
@@ -72,9 +74,14 @@ public:
   void End(void);
   inline bool IsInitOk(void) const { return m_bIsInitOk; }
 
+public:
+  // Configuracion
+  void SetNumThreads(const byte ubNumThreads);
+
 public:
   // Operacion de creacion
   bool CreateGameDataFile(void);
+  bool BuildFromManifest(const std::string& szManifestFileName);
 
 public:
   // Operacion de aadir
@@ -96,6 +103,19 @@ public:
   // Operacion de listado
   bool ListFiles(const std::string& szListFileName);
 
+public:
+  // Operacion de medicion de lectura
+  bool Benchmark(void);
+  bool Statistics(void);
+
+public:
+  // Operacion de comprobacion
+  bool Verify(void);
+
+public:
+  // Operacion de compactacion
+  bool Compact(void);
+
 private:
   // Metodos de apoyo
   void WriteMsg(const std::string& szMsg);
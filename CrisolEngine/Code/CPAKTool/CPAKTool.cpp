@@ -40,6 +40,7 @@
 #include <iostream>
 #include <list>
 #include <string>
+#include <stdlib.h>
 
 // Tipos
 // Lista para el mantenimiento de los parametros leidos desde la linea de comandos
@@ -49,6 +50,8 @@ typedef CommandLineList::iterator CommandLineListIt;
 // Ejecucion de la peticion pertinente
 bool Execute(CCPAKTool& CPAKTool,
 			 CommandLineList& CmdLineList);
+void ReadOptions(CCPAKTool& CPAKTool,
+				 CommandLineList& CmdLineList);
 void WriteHelp(void);
 void WriteHead(void);
 
@@ -84,6 +87,7 @@ main(int argc,
 	WriteHead();
 	CCPAKTool CPAKTool;
 	CPAKTool.Init("GameData.pak");
+	ReadOptions(CPAKTool, CommandLine);
 	Execute(CPAKTool, CommandLine);
   }
 
@@ -107,6 +111,37 @@ WriteHead(void)
   std::cout << "<V:1.0>\n\n";
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee y retira de la lista de parametros las opciones que no son 
+//   peticiones, como el numero de hilos (-j N).
+// Parametros:
+// - CPAKTool. Tool a configurar.
+// - CmdLineList. Lista de parametros recibidos.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+ReadOptions(CCPAKTool& CPAKTool,
+			CommandLineList& CmdLineList)
+{
+  // Se buscan las opciones
+  CommandLineListIt It(CmdLineList.begin());
+  while (It != CmdLineList.end()) {
+	// Numero de hilos?
+	if (0 == strcmpi(It->c_str(), "-j")) {
+	  It = CmdLineList.erase(It);
+	  if (It != CmdLineList.end()) {
+		const sword swNumThreads = atoi(It->c_str());
+		CPAKTool.SetNumThreads(byte((swNumThreads > 0 && swNumThreads < 256) ? swNumThreads : 0));
+		It = CmdLineList.erase(It);
+	  }
+	} else {
+	  ++It;
+	}
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Ejecuta la peticion que se halle en la lista de peticiones recibidas.
@@ -136,6 +171,18 @@ Execute(CCPAKTool& CPAKTool,
 	  return CPAKTool.CreateGameDataFile();
 	} 
 	
+	// Crear desde un manifiesto?
+	if (0 == strcmpi(szOrder.c_str(), "-M")) {
+	  if (!CmdLineList.empty()) {
+		const std::string szManifest(CmdLineList.front());
+		CmdLineList.pop_front();
+		return CPAKTool.BuildFromManifest(szManifest);
+	  } else {
+		std::cout << "No se indic el manifiesto.\n";
+		return false;
+	  }
+	}
+	
 	// Aadir archivo?
 	if (0 == strcmpi(szOrder.c_str(), "-A")) {	  	  
 	  if (!CmdLineList.empty()) {
@@ -212,6 +259,26 @@ Execute(CCPAKTool& CPAKTool,
 		return false;
 	  }
 	}
+
+	// Medir la velocidad de lectura
+	if (0 == strcmpi(szOrder.c_str(), "-B")) {
+	  return CPAKTool.Benchmark();
+	}
+
+	// Mostrar estadisticas de compresion
+	if (0 == strcmpi(szOrder.c_str(), "-S")) {
+	  return CPAKTool.Statistics();
+	}
+
+	// Comprobar la integridad de los archivos
+	if (0 == strcmpi(szOrder.c_str(), "-V")) {
+	  return CPAKTool.Verify();
+	}
+
+	// Compactar el archivo
+	if (0 == strcmpi(szOrder.c_str(), "-K")) {
+	  return CPAKTool.Compact();
+	}
   }	
 
   // No se puede realizar operacion
@@ -232,6 +299,10 @@ WriteHelp(void)
   // Muestra la ayuda
   std::cout << "Comandos posibles:\n";
   std::cout << "-C                       -> Crea el archivo GameData.pak si no existiera.\n";
+  std::cout << "-M manifiesto            -> Crea de nuevo GameData.pak con los archivos que\n";
+  std::cout << "                            aparecen en el manifiesto, uno por lnea, en ese\n";
+  std::cout << "                            mismo orden. Se ignoran las lneas que comiencen\n";
+  std::cout << "                            por ; o #.\n";
   std::cout << "-A archivo               -> Aade el archivo si no est aadido y existe.\n";
   std::cout << "-Ae directorio extensin -> Aade todos los archivos en el directorio (acabado\n";
   std::cout << "                            siempre en \\, ejemplo: Graphics\\) que tengan la\n";
@@ -244,9 +315,25 @@ WriteHelp(void)
   std::cout << "-Ra                      -> Elimina todos los archivos.\n";
   std::cout << "-L archivo               -> Crea un listado de los archivos aadidos y lo\n";
   std::cout << "                            deposita en el fichero especificado.\n";
+  std::cout << "-B                       -> Mide la velocidad de lectura de todos los archivos\n";
+  std::cout << "                            con y sin proyeccin en memoria.\n";
+  std::cout << "-S                       -> Muestra, por extensin, el ratio de compresin y\n";
+  std::cout << "                            la velocidad de lectura con descompresin.\n";
+  std::cout << "-V                       -> Comprueba el CRC de todos los archivos.\n";
+  std::cout << "-K                       -> Compacta GameData.pak, recuperando el espacio de\n";
+  std::cout << "                            los archivos eliminados o sobreescritos.\n";
+  std::cout << "-j hilos                 -> Opcin que, junto a cualquier comando, indica los\n";
+  std::cout << "                            hilos con los que aadir y extraer. Por defecto\n";
+  std::cout << "                            se usa uno por procesador.\n";
   std::cout << "\n";
   std::cout << "Notas: * Todas las operaciones se realizarn sobre el archivo GameData.pak, por\n";
   std::cout << "         lo que si este archivo no existiera, no se ejecutarn.\n";
   std::cout << "       * Si un fichero ya est aadido y se vuelve a aadir, se contabilizar\n";
   std::cout << "         la operacin pero no se efectuar.\n";
+  std::cout << "       * Los archivos se comprimirn al aadirse si compensa, salvo los sonidos\n";
+  std::cout << "         y los formatos ya comprimidos.\n";
+  std::cout << "       * Los archivos con idntico contenido se guardarn una sola vez.\n";
+  std::cout << "       * El resultado no depende del nmero de hilos utilizado.\n";
+  std::cout << "       * Los cambios se aaden al final de GameData.pak; -S muestra el espacio\n";
+  std::cout << "         que ha quedado sin utilizar.\n";
 }
@@ -0,0 +1,274 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+// 
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//  
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CPathFinder.h
+// Autor: Fernando Rodrguez Martnez 
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Clase:
+// - CPathFinder
+//
+// Descripcion:
+// - Localizador de caminos usando el algoritmo A*. Trabajara sobre un mapa
+//   con la interfaz iCPathFinderMap, de tal forma que no dependa del resto de
+//   subsistemas del motor y pueda usarse desde herramientas externas.
+// - Dentro del motor sera un componente de CIsoEngine, que le vinculara el 
+//   area activa.
+//
+// Notas:
+// - La Closed list no existira como tal, en lugar de ello, se usara un map
+//   general que contendra punteros a nodos. Dichos nodos tendran dos flags
+//   indicando en que lista se hallan. Cuando un nodo este en la Open, es seguro
+//   que se pueda encontrar en el monticulo que la representa y cuando este
+//   en la Closed es seguro que se podra encontrar unicamente en el map
+//   general. El map general acelerara el proceso de busqueda.
+// - Como apoyo en la eficiencia, se usara un CRecycleNodePool que evitara
+//   el estar haciendo sucesivas llamadas New y aprovechara nodos previamente
+//   creados.
+// - Los nodos se alojaran en un CMemoryPool, cuyos contadores se usaran para
+//   conocer las reservas realizadas en cada busqueda.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _CPATHFINDER_H_
+#define _CPATHFINDER_H_
+
+// Pragmas <VC6 / Warnings sobre la stl>
+#pragma warning(disable:4786)
+
+// Cabeceras
+#ifndef _SYSDEFS_H_
+#include "SYSDefs.h"
+#endif
+#ifndef _AREADEFS_H_
+#include "AreaDefs.h"
+#endif
+#ifndef _ISODEFS_H_
+#include "IsoDefs.h"
+#endif
+#ifndef _CMEMORYPOOL_H_
+#include "CMemoryPool.h"
+#endif
+#ifndef _ICPATHFINDERMAP_H_
+#include "iCPathFinderMap.h"
+#endif
+#ifndef _CRECYCLENODEPOOL_CPP_
+#include "CRecycleNodePool.cpp"
+#endif
+#ifndef _MAP_H_
+#define _MAP_H_
+#include <map>
+#endif
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+#include <vector>
+#endif
+
+// Defincion de clases / estructuras / espacios de nombres
+class CPath;
+
+// Clase CPathFinder
+class CPathFinder 
+{
+private:
+  // Estructuras
+  struct sNodeSearch {
+	// Nodo de busqueda
+	// Enumerados
+	enum eNodeAlloc {
+	  // Posibles lugares de alojamiento para un nodo
+	  OPEN, CLOSED, NO_ALLOC
+	};
+	// Datos
+	sNodeSearch*       pParentState; // Estado padre
+	AreaDefs::sTilePos TilePos;      // Posicion del tile al que hace ref.
+	float              fCostToThis;  // Coste para llegar a este nodo
+	float              fCostToDest;  // fCostToThis + Heuristic
+	word               uwSteps;      // Pasos desde el nodo inicial
+	eNodeAlloc         NodeAlloc;    // Lugar de alojamiento del nodo
+	// Constructor
+	sNodeSearch(void): pParentState(NULL),
+					   fCostToThis(0.0f),
+					   fCostToDest(0.0f),
+					   uwSteps(0),
+					   NodeAlloc(sNodeSearch::NO_ALLOC) { }
+	// Pool de memoria
+	static CMemoryPool MPool;
+	static void* operator new(const size_t size) { return MPool.AllocMem(size); }
+	static void operator delete(void* pItem) { MPool.FreeMem(pItem); } 
+  };
+
+public:
+  // Estructuras
+  struct sSearchStats {
+	// Estadisticas asociadas a la ultima busqueda realizada
+	dword udExpandedNodes;  // Nodos sacados de la Open
+	dword udAllocatedNodes; // Nodos tomados del banco de nodos
+	dword udPoolAllocs;     // Nodos pedidos al pool de memoria
+	dword udHeapAllocs;     // Reservas del pool de memoria en el heap
+	bool  bRejected;        // Descartada por conectividad?
+	// Constructor
+	sSearchStats(void): udExpandedNodes(0),
+						udAllocatedNodes(0),
+						udPoolAllocs(0),
+						udHeapAllocs(0),
+						bRejected(false) { }
+  };
+
+private:
+  // Tipos
+  // Define el map para la relacion posicion - nodo estado
+  typedef std::map<AreaDefs::TileIndex, sNodeSearch*> MainNodeIndex;
+  typedef MainNodeIndex::iterator                     MainNodeIndexIt;
+  typedef MainNodeIndex::value_type                   MainNodeIndexValType;
+  // Define un monticulo a partir de un vector para representar la Open
+  typedef std::vector<sNodeSearch*> Heap;
+  typedef Heap::iterator            HeapIt;	
+
+private:
+  // Predicado para el trabajo con el monticulo de la Open
+  // a la hora de comparar nodos entre si
+  class CHeapComp 
+  {
+  public:
+	bool operator()(sNodeSearch* const pFirst, 
+					sNodeSearch* const pSecond) const {
+	  return (pFirst->fCostToDest > pSecond->fCostToDest);
+	}
+  }; // ~ CHeapComp 
+
+private:
+  // Alojamiento de los nodos	
+  CRecycleNodePool<sNodeSearch> 
+				 m_RecycleNodePool; // Banco de nodos
+  Heap           m_Open;            // Monticulo con los nodos en la Open
+  MainNodeIndex  m_MainNodeIndex;   // Map principal (ver notas)
+
+  // Mapa actual
+  iCPathFinderMap* m_pMap; // Mapa actual
+
+  // Estadisticas
+  sSearchStats m_Stats; // Estadisticas de la ultima busqueda
+
+  // Datos precalculados	
+  // Direc. a visitar
+  IsoDefs::eDirectionIndex m_DirsToVisit[IsoDefs::MAX_DIRECTIONS]; 
+  // Flags asociados a las direcciones a visitar que hay que chequear en los adj.
+  IsoDefs::eDirectionFlag  m_MaskFlagToCheck[IsoDefs::MAX_DIRECTIONS];
+
+  // Resto de vbles
+  bool m_bIsInitOk; // Instancia inicializada?
+
+public:
+  // Constructor / destructor
+  CPathFinder(void): m_pMap(NULL),
+					 m_bIsInitOk(false) { }
+  ~CPathFinder(void) { End(); }
+
+public:
+  // Protocolo de inicio y fin de instancia
+  bool Init(void);
+  void End(void);
+  inline bool IsInitOk(void) const { return m_bIsInitOk; }
+
+public:
+  // Trabajo con el establecimiento del mapa
+  inline void SetMap(iCPathFinderMap* const pMap) {
+	ASSERT(IsInitOk());
+	// Asocia / desasocia mapa
+	m_pMap = pMap;
+  }
+  inline bool IsMapAttached(void) const {
+	ASSERT(IsInitOk());
+	// Retorna flag
+	return (m_pMap != NULL);
+  }
+
+public:
+  // Trabajo para la obtencion del camino de busqueda o info derivada
+  CPath* const FindPath(const AreaDefs::sTilePos& TileSrc,
+						const AreaDefs::sTilePos& TileDest,
+						const word uwDistanceMin = 0,
+						const bool bGhostMode = false,
+						const word uwMaxLenght = 0);	
+  sword CalculePathLenght(const AreaDefs::sTilePos& TileSrc,
+						  const AreaDefs::sTilePos& TileDest);	
+  sword CalculeBoundedPathLenght(const AreaDefs::sTilePos& TileSrc,
+								 const AreaDefs::sTilePos& TileDest,
+								 const word uwMaxLenght);
+  sword CalculeAbsoluteDistance(const AreaDefs::sTilePos& TileSrc,
+								const AreaDefs::sTilePos& TileDest);
+  inline const sSearchStats& GetLastSearchStats(void) const {
+	ASSERT(IsInitOk());
+	// Retorna las estadisticas de la ultima busqueda
+	return m_Stats;
+  }
+
+private:
+  // Metodos de a apoyo
+  bool AccessValidInAdjacentsOfTileDest(const AreaDefs::sTilePos& TileSrc,
+										const IsoDefs::eDirectionIndex& TileDestDir);
+  void SetMemoryStats(const dword udInitPoolAllocs,
+					  const dword udInitHeapAllocs);
+
+private:
+  // Generacion del camino de busqueda una vez encontrado
+  void _CreatePath(sNodeSearch* const pNodeSearch,
+				   CPath*& pPath);
+
+private:
+  // Metodos de trabajo con el MainNodeIndex	
+  void CleanMainNodeIndex(void);
+  
+private:
+  // Metodos para el trabajo con la Open
+  void OpenPop(sNodeSearch*& pNodeSearch);
+  void OpenPush(sNodeSearch* const pNode);
+  void OpenUpdateNodePriority(sNodeSearch* const pNodeUpdated);
+  void CleanOpen(void);
+
+private:
+  // Obtencion del valor heuristico
+  inline float GetHeuristicValue(const AreaDefs::sTilePos& TileSrc, 						 
+								 const AreaDefs::sTilePos& TileDest) {	  
+	ASSERT(IsInitOk());  
+	// Calcula el valor heuristico y lo devuelve
+	const word uwXDist = TileSrc.XTile > TileDest.XTile ? 
+						 TileSrc.XTile - TileDest.XTile : 
+						 TileDest.XTile - TileSrc.XTile;
+	const word uwYDist = TileSrc.YTile > TileDest.YTile ? 
+						 TileSrc.YTile - TileDest.YTile : 
+						 TileDest.YTile - TileSrc.YTile;
+	return (uwXDist > uwYDist) ? uwXDist : uwYDist;
+  }  
+  inline word GetMinSteps(const AreaDefs::sTilePos& TileSrc, 						 
+						  const AreaDefs::sTilePos& TileDest) {	  
+	ASSERT(IsInitOk());  
+	// Calcula el minimo numero de pasos posible entre dos tiles
+	// Nota: En cada paso la X variara como mucho en 1 y la Y en 2
+	const word uwXDist = TileSrc.XTile > TileDest.XTile ? 
+						 TileSrc.XTile - TileDest.XTile : 
+						 TileDest.XTile - TileSrc.XTile;
+	const word uwYDist = TileSrc.YTile > TileDest.YTile ? 
+						 (TileSrc.YTile - TileDest.YTile + 1) / 2 : 
+						 (TileDest.YTile - TileSrc.YTile + 1) / 2;
+	return (uwXDist > uwYDist) ? uwXDist : uwYDist;
+  }  
+}; // ~ CPathFinder
+
+#endif // ~ #ifdef _CPATHFINDER_H_
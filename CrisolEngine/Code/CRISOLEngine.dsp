@@ -43,7 +43,7 @@ RSC=rc.exe
 # PROP Ignore_Export_Lib 0
 # PROP Target_Dir ""
 # ADD BASE CPP /nologo /W3 /GX /O2 /D "WIN32" /D "NDEBUG" /D "_WINDOWS" /D "_MBCS" /YX /FD /c
-# ADD CPP /nologo /W3 /GX /O2 /D "_NDEBUG" /D "WIN32" /D "_WINDOWS" /D "_MBCS" /D "_CRISOLENGINE" /D "ENGINE_TRACE" /D "_SYSASSERT" /Fr /YX /FD /c
+# ADD CPP /nologo /MT /W3 /GX /O2 /D "_NDEBUG" /D "WIN32" /D "_WINDOWS" /D "_MBCS" /D "_CRISOLENGINE" /D "ENGINE_TRACE" /D "_SYSASSERT" /Fr /YX /FD /c
 # ADD BASE MTL /nologo /D "NDEBUG" /mktyplib203 /win32
 # ADD MTL /nologo /D "NDEBUG" /mktyplib203 /win32
 # ADD BASE RSC /l 0xc0a /d "NDEBUG"
@@ -53,7 +53,7 @@ BSC32=bscmake.exe
 # ADD BSC32 /nologo
 LINK32=link.exe
 # ADD BASE LINK32 kernel32.lib user32.lib gdi32.lib winspool.lib comdlg32.lib advapi32.lib shell32.lib ole32.lib oleaut32.lib uuid.lib odbc32.lib odbccp32.lib /nologo /subsystem:windows /machine:I386
-# ADD LINK32 winmm.lib dxguid.lib dinput.lib ddraw.lib dsound.lib dx7wrapper.lib kernel32.lib user32.lib gdi32.lib winspool.lib comdlg32.lib advapi32.lib shell32.lib ole32.lib oleaut32.lib uuid.lib odbc32.lib odbccp32.lib /nologo /subsystem:windows /machine:I386
+# ADD LINK32 winmm.lib dxguid.lib dinput.lib ddraw.lib dsound.lib dx7wrapper.lib kernel32.lib user32.lib gdi32.lib winspool.lib comdlg32.lib advapi32.lib shell32.lib ole32.lib oleaut32.lib uuid.lib odbc32.lib odbccp32.lib /nologo /subsystem:windows /machine:I386 /nodefaultlib:"LIBC"
 
 !ELSEIF  "$(CFG)" == "CRISOLEngine - Win32 Debug"
 
@@ -69,7 +69,7 @@ LINK32=link.exe
 # PROP Ignore_Export_Lib 0
 # PROP Target_Dir ""
 # ADD BASE CPP /nologo /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_DEBUG" /D "_WINDOWS" /D "_MBCS" /YX /FD /GZ /c
-# ADD CPP /nologo /W3 /Gm /GX /ZI /D "_DEBUG" /D "WIN32" /D "_WINDOWS" /D "_MBCS" /D "_CRISOLENGINE" /D "_SYSASSERT" /D "ENGINE_TRACE" /YX /FD /GZ /c
+# ADD CPP /nologo /MTd /W3 /Gm /GX /ZI /D "_DEBUG" /D "WIN32" /D "_WINDOWS" /D "_MBCS" /D "_CRISOLENGINE" /D "_SYSASSERT" /D "ENGINE_TRACE" /YX /FD /GZ /c
 # ADD BASE MTL /nologo /D "_DEBUG" /mktyplib203 /win32
 # ADD MTL /nologo /D "_DEBUG" /mktyplib203 /win32
 # ADD BASE RSC /l 0xc0a /d "_DEBUG"
@@ -113,6 +113,18 @@ SOURCE=.\CArea.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\CAreaLoadProfiler.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\CAreaPrefetcher.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\CAreaStateWriter.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\CAudioSystem.cpp
 # End Source File
 # Begin Source File
@@ -165,6 +177,10 @@ SOURCE=.\CCriature.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\CCriatureGrid.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\CCRISOLEngine.cpp
 # End Source File
 # Begin Source File
@@ -401,6 +417,10 @@ SOURCE=.\CLogger.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\CLZCodec.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\CMathUtil.cpp
 # End Source File
 # Begin Source File
@@ -425,6 +445,10 @@ SOURCE=.\CPath.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\CPathFinder.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\CPlayer.cpp
 # End Source File
 # Begin Source File
@@ -445,6 +469,10 @@ SOURCE=.\CRISOLEngine.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\CrisolBuilder\CAreaFileConverter.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\CRoof.cpp
 # End Source File
 # Begin Source File
@@ -477,6 +505,10 @@ SOURCE=.\CSprite.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\CTagIndex.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\CTimer.cpp
 # End Source File
 # Begin Source File
@@ -529,6 +561,18 @@ SOURCE=.\CArea.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\CAreaLoadProfiler.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\CAreaPrefetcher.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\CAreaStateWriter.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\CAudioSystem.h
 # End Source File
 # Begin Source File
@@ -545,6 +589,10 @@ SOURCE=.\CCBTParser.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\CCellEntities.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\CCharFont.h
 # End Source File
 # Begin Source File
@@ -581,6 +629,10 @@ SOURCE=.\CCriature.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\CCriatureGrid.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\CCRISOLEngine.h
 # End Source File
 # Begin Source File
@@ -601,6 +653,10 @@ SOURCE=.\CEntitySelector.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\CEntityTable.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\CEquipmentSlots.h
 # End Source File
 # Begin Source File
@@ -821,6 +877,10 @@ SOURCE=.\CLogger.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\CLZCodec.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\CMathUtil.h
 # End Source File
 # Begin Source File
@@ -845,6 +905,10 @@ SOURCE=.\CPath.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\CPathFinder.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\CPlayer.h
 # End Source File
 # Begin Source File
@@ -861,6 +925,10 @@ SOURCE=.\CResourceManager.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\CrisolBuilder\CAreaFileConverter.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\CRoof.h
 # End Source File
 # Begin Source File
@@ -893,6 +961,10 @@ SOURCE=.\CSprite.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\CTagIndex.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\CTimer.h
 # End Source File
 # Begin Source File
@@ -1165,6 +1237,10 @@ SOURCE=.\iCMathUtil.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\iCPathFinderMap.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\iCResourceManager.h
 # End Source File
 # Begin Source File
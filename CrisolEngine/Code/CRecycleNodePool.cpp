@@ -30,7 +30,9 @@
 #define _CRECYCLENODEPOOL_CPP_
 #include "CRecycleNodePool.h"
 
-#include "SYSEngine.h"
+#ifdef _CRISOLENGINE
+ #include "SYSEngine.h"
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
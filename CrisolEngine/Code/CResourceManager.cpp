@@ -31,6 +31,10 @@
 #include "iCGraphicSystem.h"
 #include "iCAudioSystem.h"
 #include "iCMathUtil.h"
+#include "CAreaLoadProfiler.h"
+#ifdef AREA_LOAD_PROFILE
+  #include "iCTimer.h"
+#endif
 #include <list>
 #include <algorithm>
 
@@ -334,6 +338,11 @@ CResourceManager::CreateTexture(const std::string& szResDesc,
   }
 
   // No se encontro textura
+  #ifdef AREA_LOAD_PROFILE
+	// Se toma el instante de inicio de la creacion
+	const dword udTextureInitTime = SYSEngine::GetTimer()->GetTime(TimerDefs::TIMER_UNITS_US);
+  #endif
+
   // Se crea un nuevo nodo en memoria
   sNTexture* const pIndexNode = new sNTexture;
   ASSERT(pIndexNode);
@@ -391,6 +400,10 @@ CResourceManager::CreateTexture(const std::string& szResDesc,
     
   // Se inserta el recurso en el arbol y se retorna
   m_TextureBank.insert(TextureInfoValType(hTextureReturn, pIndexNode));
+  #ifdef AREA_LOAD_PROFILE
+	// Se registra la creacion en el perfilador de carga de areas
+	CAreaLoadProfiler::AddTexture(SYSEngine::GetTimer()->GetTime(TimerDefs::TIMER_UNITS_US) - udTextureInitTime);
+  #endif
   return hTextureReturn; 
 }
 
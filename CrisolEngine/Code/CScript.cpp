@@ -848,6 +848,10 @@ CScript::ReadCode(const FileDefs::FileHandle& hFile,
 		pInstr = new CWOSetScriptAtInstr;
 	  } break;
 
+	  case ScriptDefs::SI_WORLDOBJ_CALCULEBOUNDEDPATHLENGHT: {
+		pInstr = new CWOCalculeBoundedPathLenghtInstr;
+	  } break;
+
 	  case ScriptDefs::SI_ENTITYOBJ_GETNAME: {
 	    pInstr = new CEOGetNameInstr;
 	  } break;
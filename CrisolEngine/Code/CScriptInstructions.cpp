@@ -3638,8 +3638,8 @@ CWOGetDistanceInstr::Execute(iCScript* const pScript)
   ASSERT(pXPosSrc);
     
   // Se calcula la distancia absoluta, si las pos. no son validas se retornara -1
-  const sword swDist = SYSEngine::GetWorld()->CalculeAbsoluteDistance(AreaDefs::sTilePos(pXPosSrc->GetFloatValue(), pXPosSrc->GetFloatValue()),
-																	  AreaDefs::sTilePos(pYPosSrc->GetFloatValue(), pYPosSrc->GetFloatValue()));
+  const sword swDist = SYSEngine::GetWorld()->CalculeAbsoluteDistance(AreaDefs::sTilePos(pXPosSrc->GetFloatValue(), pYPosSrc->GetFloatValue()),
+																	  AreaDefs::sTilePos(pXPosDest->GetFloatValue(), pYPosDest->GetFloatValue()));
   CScriptStackValue* const pDistance = new CScriptStackValue(float(swDist));
   ASSERT(pDistance);
   pScript->Push(pDistance);
@@ -3680,8 +3680,8 @@ CWOCalculePathLenghtInstr::Execute(iCScript* const pScript)
   ASSERT(pXPosSrc);
     
   // Se calcula la longitud del camino
-  const sword swLenght = SYSEngine::GetWorld()->CalculePathLenght(AreaDefs::sTilePos(pXPosSrc->GetFloatValue(), pXPosSrc->GetFloatValue()),
-																  AreaDefs::sTilePos(pYPosSrc->GetFloatValue(), pYPosSrc->GetFloatValue()));
+  const sword swLenght = SYSEngine::GetWorld()->CalculePathLenght(AreaDefs::sTilePos(pXPosSrc->GetFloatValue(), pYPosSrc->GetFloatValue()),
+																  AreaDefs::sTilePos(pXPosDest->GetFloatValue(), pYPosDest->GetFloatValue()));
   CScriptStackValue* const pLenght = new CScriptStackValue(float(swLenght));
   ASSERT(pLenght);
   pScript->Push(pLenght);
@@ -4901,6 +4901,55 @@ CWOSetScriptAtInstr::Execute(iCScript* const pScript)
   delete pScriptType;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene la longitud del camino que existira entre dos posiciones SOLO si
+//   esta no supera una longitud maxima. En caso de que alguna posicion no sea
+//   valida, el camino no sea posible o su longitud supere la maxima, se
+//   retornara -1.
+// Parametros:
+// - pScript. Instancia al script.
+// Devuelve:
+// Notas:
+// - Una longitud maxima negativa se interpretara como 0.
+///////////////////////////////////////////////////////////////////////////////
+void
+CWOCalculeBoundedPathLenghtInstr::Execute(iCScript* const pScript)
+{
+  // SOLO si instancia inicializada
+  ASSERT(Inherited::IsInitOk());
+  // SOLO si parametros correctos
+  ASSERT(pScript);
+
+  // Se toman los parametros  
+  CScriptStackValue* pMaxLenght = pScript->Pop();
+  ASSERT(pMaxLenght);
+  CScriptStackValue* pYPosDest = pScript->Pop();
+  ASSERT(pYPosDest);
+  CScriptStackValue* pXPosDest = pScript->Pop();
+  ASSERT(pXPosDest);
+  CScriptStackValue* pYPosSrc = pScript->Pop();
+  ASSERT(pYPosSrc);
+  CScriptStackValue* pXPosSrc = pScript->Pop();
+  ASSERT(pXPosSrc);
+    
+  // Se calcula la longitud del camino acotada
+  const sword swMaxLenght = sword(pMaxLenght->GetFloatValue());
+  const sword swLenght = SYSEngine::GetWorld()->CalculeBoundedPathLenght(AreaDefs::sTilePos(pXPosSrc->GetFloatValue(), pYPosSrc->GetFloatValue()),
+																		 AreaDefs::sTilePos(pXPosDest->GetFloatValue(), pYPosDest->GetFloatValue()),
+																		 swMaxLenght > 0 ? word(swMaxLenght) : 0);
+  CScriptStackValue* const pLenght = new CScriptStackValue(float(swLenght));
+  ASSERT(pLenght);
+  pScript->Push(pLenght);
+
+  // Elimina parametros
+  delete pXPosSrc;
+  delete pYPosSrc;
+  delete pXPosDest;
+  delete pYPosDest;
+  delete pMaxLenght;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Obtiene el nombre de una entidad y lo deposita. En caso de que no exista
@@ -6716,8 +6765,9 @@ CEOBlockAccessInstr::Execute(iCScript* const pScript)
   // Toma instancia a la pared
   CWall* const pWall = SYSEngine::GetWorld()->GetWall(pHandle->GetDWordValue());
   if (pWall) {
-	// Es pared, se toma orientacion
+	// Es pared, se cambia el acceso y se notifica al universo
 	pWall->BlockAccess();
+	SYSEngine::GetWorld()->UpdateAccessInfoAt(pWall->GetTilePos());
   } else {
 	pScript->ErrorInterrupt();
   }
@@ -6750,8 +6800,9 @@ CEOUnblockAccessInstr::Execute(iCScript* const pScript)
   // Toma instancia a la pared
   CWall* const pWall = SYSEngine::GetWorld()->GetWall(pHandle->GetDWordValue());
   if (pWall) {
-	// Es pared, se toma orientacion
+	// Es pared, se cambia el acceso y se notifica al universo
 	pWall->UnblockAccess();
+	SYSEngine::GetWorld()->UpdateAccessInfoAt(pWall->GetTilePos());
   } else {
 	pScript->ErrorInterrupt();
   }
@@ -2883,6 +2883,27 @@ public:
   }
 };
 
+// Clase CWOCalculeBoundedPathLenghtInstr
+class CWOCalculeBoundedPathLenghtInstr: public CScriptInstruction
+{
+public:
+  // Tipos
+  // Clase base
+  typedef CScriptInstruction Inherited;
+
+public:
+  // Ejecucion
+  void Execute(iCScript* const pScript);
+
+public:
+  // Operaciones de consulta
+  ScriptDefs::eScriptInstruction GetScriptInstruction(void) const {
+	ASSERT(Inherited::IsInitOk());
+	// Retorna codigo	
+	return ScriptDefs::SI_WORLDOBJ_CALCULEBOUNDEDPATHLENGHT;
+  }
+};
+
 // Clase CEOGetNameInstr
 class CEOGetNameInstr: public CScriptInstruction
 {
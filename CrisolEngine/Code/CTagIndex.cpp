@@ -0,0 +1,327 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CTagIndex.cpp
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Consultar CTagIndex.h para mas detalles.
+///////////////////////////////////////////////////////////////////////////////
+#include "CTagIndex.h"
+
+#include "SYSAssert.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Asocia el tag szTag a la entidad hEntity. Si el tag ya existia, pasara
+//   a estar asociado a hEntity y si hEntity ya tenia un tag distinto, este
+//   sera eliminado.
+// Parametros:
+// - hEntity. Handle a la entidad.
+// - szTag. Tag en minusculas.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CTagIndex::Insert(const AreaDefs::EntHandle& hEntity,
+				  const std::string& szTag)
+{
+  // SOLO si parametros validos
+  ASSERT(hEntity);
+  ASSERT(!szTag.empty());
+
+  // Existia ya el tag?
+  const dword udTagHash = CalculeTagHash(szTag);
+  word uwEntry = FindByTag(szTag, udTagHash);
+  if (uwEntry != NO_ENTRY) {
+	// Si, esta ya asociado a la entidad?
+	if (m_Entries[uwEntry].hEntity == hEntity) {
+	  return;
+	}
+
+	// No, se elimina el posible tag previo de la entidad y se reasigna
+	Remove(hEntity);
+	UnlinkByHandle(uwEntry);
+	m_Entries[uwEntry].hEntity = hEntity;
+	LinkByHandle(uwEntry);
+	return;
+  }
+
+  // Se elimina el posible tag previo de la entidad
+  Remove(hEntity);
+
+  // Es necesario ampliar las tablas?
+  if (m_uwNumTags >= m_TagBuckets.size()) {
+	Rehash(m_TagBuckets.size() * 2);
+  }
+
+  // Se toma una entrada libre o se crea una nueva
+  if (!m_FreeEntries.empty()) {
+	uwEntry = m_FreeEntries.back();
+	m_FreeEntries.pop_back();
+  } else {
+	uwEntry = m_Entries.size();
+	m_Entries.push_back(sTagEntry());
+  }
+
+  // Se establece y enlaza
+  sTagEntry& Entry = m_Entries[uwEntry];
+  Entry.szTag = szTag;
+  Entry.udTagHash = udTagHash;
+  Entry.hEntity = hEntity;
+  LinkByTag(uwEntry);
+  LinkByHandle(uwEntry);
+  ++m_uwNumTags;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Elimina el posible tag asociado a la entidad hEntity.
+// Parametros:
+// - hEntity. Handle a la entidad.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CTagIndex::Remove(const AreaDefs::EntHandle& hEntity)
+{
+  // Tiene tag la entidad?
+  const word uwEntry = FindByHandle(hEntity);
+  if (uwEntry != NO_ENTRY) {
+	// Si, se desenlaza y libera la entrada
+	UnlinkByTag(uwEntry);
+	UnlinkByHandle(uwEntry);
+	sTagEntry& Entry = m_Entries[uwEntry];
+	Entry.szTag.erase();
+	Entry.hEntity = 0;
+	m_FreeEntries.push_back(uwEntry);
+	--m_uwNumTags;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Vacia el indice, dejando las tablas con su tamao minimo.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CTagIndex::Clear(void)
+{
+  // Se liberan entradas y cubetas
+  m_Entries.clear();
+  m_FreeEntries.clear();
+  m_TagBuckets.assign(MIN_NUM_BUCKETS, word(NO_ENTRY));
+  m_HandleBuckets.assign(MIN_NUM_BUCKETS, word(NO_ENTRY));
+  m_uwNumTags = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el handle de la entidad asociada al tag szTag.
+// Parametros:
+// - szTag. Tag en minusculas.
+// Devuelve:
+// - El handle de la entidad o 0 si el tag no existe.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+AreaDefs::EntHandle
+CTagIndex::GetHandle(const std::string& szTag) const
+{
+  // Localiza y retorna
+  const word uwEntry = FindByTag(szTag, CalculeTagHash(szTag));
+  return (uwEntry != NO_ENTRY) ? m_Entries[uwEntry].hEntity : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el tag asociado a la entidad hEntity.
+// Parametros:
+// - hEntity. Handle a la entidad.
+// Devuelve:
+// - El tag internado o una cadena vacia si la entidad no tiene tag.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+const std::string&
+CTagIndex::GetTag(const AreaDefs::EntHandle& hEntity) const
+{
+  // Cadena para entidades sin tag
+  static const std::string szNoTag;
+
+  // Localiza y retorna
+  const word uwEntry = FindByHandle(hEntity);
+  return (uwEntry != NO_ENTRY) ? m_Entries[uwEntry].szTag : szNoTag;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Localiza la entrada asociada a un tag.
+// Parametros:
+// - szTag. Tag.
+// - udTagHash. Hash del tag.
+// Devuelve:
+// - Indice de la entrada o NO_ENTRY si no se halla.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+word
+CTagIndex::FindByTag(const std::string& szTag,
+					 const dword udTagHash) const
+{
+  // Recorre la cubeta
+  word uwEntry = m_TagBuckets[GetTagBucket(udTagHash)];
+  while (uwEntry != NO_ENTRY) {
+	const sTagEntry& Entry = m_Entries[uwEntry];
+	if (Entry.udTagHash == udTagHash && Entry.szTag == szTag) {
+	  return uwEntry;
+	}
+	uwEntry = Entry.uwNextByTag;
+  }
+
+  // No se hallo
+  return NO_ENTRY;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Localiza la entrada asociada a una entidad.
+// Parametros:
+// - hEntity. Handle a la entidad.
+// Devuelve:
+// - Indice de la entrada o NO_ENTRY si no se halla.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+word
+CTagIndex::FindByHandle(const AreaDefs::EntHandle& hEntity) const
+{
+  // Recorre la cubeta
+  word uwEntry = m_HandleBuckets[GetHandleBucket(hEntity)];
+  while (uwEntry != NO_ENTRY) {
+	const sTagEntry& Entry = m_Entries[uwEntry];
+	if (Entry.hEntity == hEntity) {
+	  return uwEntry;
+	}
+	uwEntry = Entry.uwNextByHandle;
+  }
+
+  // No se hallo
+  return NO_ENTRY;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Enlaza / desenlaza una entrada en las cubetas de tags o handles.
+// Parametros:
+// - uwEntry. Indice de la entrada.
+// Devuelve:
+// Notas:
+// - El desenlace exigira que la entrada este enlazada.
+///////////////////////////////////////////////////////////////////////////////
+void
+CTagIndex::LinkByTag(const word uwEntry)
+{
+  // Se inserta al comienzo de la cubeta
+  word& uwHead = m_TagBuckets[GetTagBucket(m_Entries[uwEntry].udTagHash)];
+  m_Entries[uwEntry].uwNextByTag = uwHead;
+  uwHead = uwEntry;
+}
+
+void
+CTagIndex::LinkByHandle(const word uwEntry)
+{
+  // Se inserta al comienzo de la cubeta
+  word& uwHead = m_HandleBuckets[GetHandleBucket(m_Entries[uwEntry].hEntity)];
+  m_Entries[uwEntry].uwNextByHandle = uwHead;
+  uwHead = uwEntry;
+}
+
+void
+CTagIndex::UnlinkByTag(const word uwEntry)
+{
+  // Se localiza el enlace que apunta a la entrada y se salta
+  word* puwLink = &m_TagBuckets[GetTagBucket(m_Entries[uwEntry].udTagHash)];
+  while (*puwLink != uwEntry) {
+	ASSERT((*puwLink != NO_ENTRY) != 0);
+	puwLink = &m_Entries[*puwLink].uwNextByTag;
+  }
+  *puwLink = m_Entries[uwEntry].uwNextByTag;
+}
+
+void
+CTagIndex::UnlinkByHandle(const word uwEntry)
+{
+  // Se localiza el enlace que apunta a la entrada y se salta
+  word* puwLink = &m_HandleBuckets[GetHandleBucket(m_Entries[uwEntry].hEntity)];
+  while (*puwLink != uwEntry) {
+	ASSERT((*puwLink != NO_ENTRY) != 0);
+	puwLink = &m_Entries[*puwLink].uwNextByHandle;
+  }
+  *puwLink = m_Entries[uwEntry].uwNextByHandle;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Redimensiona las tablas de cubetas, volviendo a enlazar todas las
+//   entradas ocupadas.
+// Parametros:
+// - uwNumBuckets. Nuevo numero de cubetas (potencia de 2).
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CTagIndex::Rehash(const word uwNumBuckets)
+{
+  // SOLO si parametros validos
+  ASSERT(uwNumBuckets);
+  ASSERT((0 == (uwNumBuckets & (uwNumBuckets - 1))) != 0);
+
+  // Se vacian cubetas y se enlazan de nuevo las entradas ocupadas
+  m_TagBuckets.assign(uwNumBuckets, word(NO_ENTRY));
+  m_HandleBuckets.assign(uwNumBuckets, word(NO_ENTRY));
+  word uwEntry = 0;
+  for (; uwEntry < m_Entries.size(); ++uwEntry) {
+	if (!m_Entries[uwEntry].szTag.empty()) {
+	  LinkByTag(uwEntry);
+	  LinkByHandle(uwEntry);
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Calcula el hash de un tag (FNV-1a de 32 bits).
+// Parametros:
+// - szTag. Tag.
+// Devuelve:
+// - El hash calculado.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+dword
+CTagIndex::CalculeTagHash(const std::string& szTag)
+{
+  // Se calcula
+  dword udHash = 2166136261UL;
+  std::string::const_iterator It(szTag.begin());
+  for (; It != szTag.end(); ++It) {
+	udHash ^= byte(*It);
+	udHash *= 16777619UL;
+  }
+  return udHash;
+}
@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CTagIndex.h
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Clase:
+// - CTagIndex
+//
+// Descripcion:
+// - Indice bidireccional entre los tags de las entidades y sus handles. Cada
+//   tag se almacenara una sola vez (internado) en una entrada y dicha
+//   entrada se enlazara en dos tablas hash encadenadas: una indexada por el
+//   propio tag y otra indexada por el handle de la entidad. De esta forma,
+//   tanto la obtencion del handle a partir del tag como la del tag a partir
+//   del handle seran inmediatas.
+// - Una entidad solo podra tener un tag y un tag solo podra estar asociado
+//   a una entidad.
+//
+// Notas:
+// - Los tags se recibiran siempre en minusculas, el indice no realizara
+//   ningun tipo de conversion.
+// - Las tablas creceran automaticamente cuando el numero de tags supere el
+//   de cubetas.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _CTAGINDEX_H_
+#define _CTAGINDEX_H_
+
+// Pragmas <VC6 / Warnings sobre la stl>
+#pragma warning(disable:4786)
+
+// Cabeceras
+#ifndef _SYSDEFS_H_
+#include "SYSDefs.h"
+#endif
+#ifndef _AREADEFS_H_
+#include "AreaDefs.h"
+#endif
+#ifndef _STRING_H_
+#define _STRING_H_
+#include <string>
+#endif
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+#include <vector>
+#endif
+
+// Clase CTagIndex
+class CTagIndex
+{
+private:
+  // Enumerados
+  enum {
+	NO_ENTRY        = 0xFFFF, // Entrada nula
+	MIN_NUM_BUCKETS = 64      // Num. minimo de cubetas (potencia de 2)
+  };
+
+private:
+  // Estructuras
+  struct sTagEntry {
+	// Entrada asociada a un tag
+	std::string         szTag;          // Tag internado (vacio si libre)
+	dword               udTagHash;      // Hash del tag
+	AreaDefs::EntHandle hEntity;        // Entidad con el tag
+	word                uwNextByTag;    // Sig. entrada en cubeta de tags
+	word                uwNextByHandle; // Sig. entrada en cubeta de handles
+	// Constructor
+	sTagEntry(void): udTagHash(0),
+					 hEntity(0),
+					 uwNextByTag(NO_ENTRY),
+					 uwNextByHandle(NO_ENTRY) { }
+  };
+
+private:
+  // Tipos
+  typedef std::vector<sTagEntry> EntriesVector; // Entradas
+  typedef std::vector<word>      IndexVector;   // Cubetas / entradas libres
+
+private:
+  // Vbles de miembro
+  EntriesVector m_Entries;        // Entradas con los tags internados
+  IndexVector   m_FreeEntries;    // Entradas libres
+  IndexVector   m_TagBuckets;     // Cubetas indexadas por tag
+  IndexVector   m_HandleBuckets;  // Cubetas indexadas por handle
+  word          m_uwNumTags;      // Numero de tags indexados
+
+public:
+  // Constructor / destructor
+  CTagIndex(void): m_uwNumTags(0) { Clear(); }
+  ~CTagIndex(void) { }
+
+public:
+  // Operaciones de insercion / borrado
+  void Insert(const AreaDefs::EntHandle& hEntity,
+			  const std::string& szTag);
+  void Remove(const AreaDefs::EntHandle& hEntity);
+  void Clear(void);
+
+public:
+  // Operaciones de consulta
+  AreaDefs::EntHandle GetHandle(const std::string& szTag) const;
+  const std::string& GetTag(const AreaDefs::EntHandle& hEntity) const;
+  inline word GetNumTags(void) const { return m_uwNumTags; }
+
+private:
+  // Metodos de apoyo
+  word FindByTag(const std::string& szTag,
+				 const dword udTagHash) const;
+  word FindByHandle(const AreaDefs::EntHandle& hEntity) const;
+  void UnlinkByHandle(const word uwEntry);
+  void UnlinkByTag(const word uwEntry);
+  void LinkByHandle(const word uwEntry);
+  void LinkByTag(const word uwEntry);
+  void Rehash(const word uwNumBuckets);
+  static dword CalculeTagHash(const std::string& szTag);
+  inline word GetTagBucket(const dword udTagHash) const {
+	// Las cubetas seran potencia de 2
+	return word(udTagHash & (m_TagBuckets.size() - 1));
+  }
+  inline word GetHandleBucket(const AreaDefs::EntHandle& hEntity) const {
+	// Hash multiplicativo sobre el handle
+	return word(((dword(hEntity) * 40503UL) >> 4) & (m_HandleBuckets.size() - 1));
+  }
+}; // ~ CTagIndex
+
+#endif // ~ #ifdef _CTAGINDEX_H_
@@ -355,6 +355,42 @@ CVirtualMachine::ReleaseScripts(iCScriptClient* const pClient,
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprueba si el cliente recibido tiene scripts pendientes de ejecucion
+//   o pausados en espera de continuar.
+// Parametros:
+// - pClient. Cliente a consultar.
+// Devuelve:
+// - Si tiene scripts asociados true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CVirtualMachine::IsClientWithScripts(iCScriptClient* const pClient)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se busca entre la lista de scripts solicitados
+  ScriptsToExecuteListIt ToExecuteIt(m_ScriptsToExecute.begin());
+  for (; ToExecuteIt != m_ScriptsToExecute.end(); ++ToExecuteIt) {
+	if (pClient == (*ToExecuteIt)->pClient) {
+	  return true;
+	}
+  }
+
+  // Se busca entre la lista de scripts pausados en ejecucion
+  PausedScriptsListIt PausedIt(m_PausedScripts.begin());
+  for (; PausedIt != m_PausedScripts.end(); ++PausedIt) {
+	if (pClient == (*PausedIt)->pClient) {
+	  return true;
+	}
+  }
+
+  // No tiene scripts asociados
+  return false;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Elimina las peticiones y los scripts en ejecucion, asociados a los 
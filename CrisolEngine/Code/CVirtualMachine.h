@@ -248,6 +248,7 @@ public:
   void ReleaseScripts(iCScriptClient* const pClient);
   void ReleaseScripts(iCScriptClient* const pClient,
 					  const RulesDefs::eScriptEvents& Event);
+  bool IsClientWithScripts(iCScriptClient* const pClient);
 private:
   // Metodos de apoyo
   void UpdateReleaseScripts(void);
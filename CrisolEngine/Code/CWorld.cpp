@@ -39,6 +39,7 @@
 #include "iCAudioSystem.h"
 #include "iCFileSystem.h"
 #include "CrisolBuilder\\CBDefs.h"
+#include "CAreaLoadProfiler.h"
 #include "io.h"
 #include "CCBTEngineParser.h"
 
@@ -84,6 +85,14 @@ CWorld::Init(void)
   
   // Toma la instancia al motor isometrico y se inicializa este 
   m_IsoEngine.Init();
+
+  // Se inicializa la precarga de areas
+  // Nota: Si no se pudiera lanzar, las areas se cargaran de la forma habitual
+  m_AreaPrefetcher.Init();
+
+  // Se inicializa el volcado a disco del estado de las areas
+  // Nota: Si no se pudiera lanzar, el volcado se realizara de forma sincrona
+  m_AreaStateWriter.Init();
   
   // Por defecto, se comenzara en modo real
   m_ModeInfo.Mode = WorldDefs::REAL_MODE;
@@ -153,6 +162,13 @@ CWorld::End(void)
 	// Finaliza motor isometrico
 	ASSERT(!m_Area.IsInitOk());
 	m_IsoEngine.End();
+
+	// Finaliza la precarga de areas
+	m_AreaPrefetcher.End();
+	m_AreaTransitions.clear();
+
+	// Finaliza el volcado a disco del estado de las areas
+	m_AreaStateWriter.End();
 	
 	// Baja flag	
 	#ifdef ENGINE_TRACE
@@ -391,6 +407,9 @@ CWorld::StartWorld(const word uwIDArea,
 	SYSEngine::FatalError("Problemas inicializando el rea con identificador: %u.\n", uwIDArea);
 	return false;
   }
+
+  // Se precargan las areas conocidas a las que se pasa desde la inicial
+  PrefetchAdjacentAreas(uwIDArea);
   
   // Prepara el script global por primera vez
   m_pVMachine->PrepareScripts();
@@ -616,6 +635,9 @@ CWorld::ChangeArea(const word uwIDArea,
   #ifdef ENGINE_TRACE    
      SYSEngine::GetLogger()->Write("CWorld::ChangeArea> Cambiando al rea %u.\n", uwIDArea);
   #endif 
+  #ifdef AREA_LOAD_PROFILE
+	CAreaLoadProfiler::Begin(m_Area.GetIDArea(), uwIDArea);
+  #endif
 
   // Se acaba posible combate activo  
   SYSEngine::GetCombatSystem()->EndCombat();  
@@ -623,6 +645,17 @@ CWorld::ChangeArea(const word uwIDArea,
   // Se liberan sonidos anonimos abiertos
   ReleaseWAVSounds();
 
+  // Se mantiene en memoria la imagen tmp del area que se abandona, de tal
+  // forma que su guardado y posterior recuperacion no accedan a disco. El
+  // area destino se reconstruira igualmente por completo
+  const word uwPrevIDArea = m_Area.GetIDArea();
+  if (uwPrevIDArea != uwIDArea) {
+	m_pFileSys->CreateMemFile(GetAreaTmpFileName(uwPrevIDArea));
+  }
+
+  // Se recoge lo que se hubiera precargado del area destino
+  CommitPrefetchedArea(uwIDArea);
+
   // Se inicializa el area actual, indicando que es un cambio de area
   if (!m_Area.ChangeArea(uwIDArea, PlayerPos)) {
 	SYSEngine::FatalError("Problemas cambiando al rea %u posicin <%d, %d>.\n", 
@@ -630,7 +663,25 @@ CWorld::ChangeArea(const word uwIDArea,
 	return false;
   }
 
+  // Se descarta el fichero base precargado, que ya no se necesita
+  m_pFileSys->ReleaseMemFile(GetAreaBaseFileName(uwIDArea));
+
+  // Se actualizan las imagenes tmp en memoria
+  if (uwPrevIDArea != uwIDArea) {
+	UpdateAreaTmpImages(uwPrevIDArea, uwIDArea);
+  }
+
+  // Se registra la transicion y se precargan las areas a las que
+  // se suele pasar desde el area actual
+  if (uwPrevIDArea != uwIDArea) {
+	m_AreaTransitions[uwPrevIDArea].insert(uwIDArea);
+  }
+  PrefetchAdjacentAreas(uwIDArea);
+
   // El area no usa el la luz ambiental del universo de juego?
+  #ifdef AREA_LOAD_PROFILE
+	CAreaLoadProfiler::SetPhase(CAreaLoadProfiler::PHASE_LIGHTING);
+  #endif
   if (m_Area.GetAmbientLight() != 0) {
 	// No la ultiliza, luego se establece la adecuada al area
 	m_pGraphSys->SetDarkFactor(m_Area.GetAmbientLight());
@@ -642,6 +693,9 @@ CWorld::ChangeArea(const word uwIDArea,
   // Se establece area en el motor isometrico y ventana de dibujado   				
   // Nota: Para reestablecer el area, antes se eliminara la informacion posterior
   // * Se debera de contemplar la forma de hacer esto de manera mucho mas elegante
+  #ifdef AREA_LOAD_PROFILE
+	CAreaLoadProfiler::SetPhase(CAreaLoadProfiler::PHASE_ISOENGINE);
+  #endif
   m_IsoEngine.SetArea(NULL);    
   m_IsoEngine.SetArea(&m_Area);    
   m_IsoEngine.SetDrawWindow(m_pGraphSys->GetVideoWidth(),
@@ -652,12 +706,18 @@ CWorld::ChangeArea(const word uwIDArea,
 
   // Se ejecutan los eventos asociados a la creacion de entidades
   // Nota: SOLO si el area cambiada es no temporal
+  #ifdef AREA_LOAD_PROFILE
+	CAreaLoadProfiler::SetPhase(CAreaLoadProfiler::PHASE_SCRIPTS);
+  #endif
   ExecuteOnEntityCreatedEvent();
 
   // Se lanza el evento asociado a entrada en area
   m_pVMachine->OnEnterInArea(this,
 							 GetScriptEventFile(RulesDefs::SE_ONENTERINAREA),
 							 m_Area.GetIDArea());
+  #ifdef AREA_LOAD_PROFILE
+	CAreaLoadProfiler::End();
+  #endif
   
   // Todo correcto  
   #ifdef ENGINE_TRACE    
@@ -883,6 +943,13 @@ CWorld::SaveGame(const word uwIDSaveSlot,
   // Valores del script global  
   m_pVMachine->SaveGlobals(hFile, udOffset);
 
+  // Se espera a que se completen los volcados a disco pendientes, pues
+  // CArea leera los archivos temporales de las areas
+  if (m_AreaStateWriter.IsInitOk() &&
+	  !m_AreaStateWriter.WaitAll()) {
+	SYSEngine::FatalError("Problemas guardando el estado de las reas.\n");
+  }
+
   // Se completa la informacion del archivo pasando la responsabilidad a
   // CArea que guardara los datos del jugador y los archivos temporales
   // de las areas
@@ -1070,6 +1137,7 @@ CWorld::LoadGame(const word uwIDLoadSlot)
   // Se inicializa area y se carga
   m_Area.Init();  
   m_Area.LoadGame(hFile, udOffset);  
+  PrefetchAdjacentAreas(m_Area.GetIDArea());
   
   // Inicializa sesion 
   InitSesion(ubHour, ubMinute, szWAVAmbientSound, szMIDIMusic, MIDIPlayMode);  
@@ -1463,13 +1531,33 @@ CWorld::RemoveTmpDir(void)
   // Tipos
   typedef std::list<std::string> FileNameList;
   typedef FileNameList::iterator FileNameListIt;
+
+  // Se cancelan las precargas y los volcados pendientes y se descartan
+  // las imagenes tmp de areas mantenidas en memoria
+  if (m_AreaPrefetcher.IsInitOk()) {
+	m_AreaPrefetcher.CancelAll();
+  }
+  if (m_AreaStateWriter.IsInitOk()) {
+	m_AreaStateWriter.CancelAll();
+  }
+  ReleaseAreaTmpImages();
+
+  // Se borran los ficheros auxiliares que pudiera haber dejado un volcado
+  // interrumpido en una ejecucion previa
+  FileNameList List;
+  m_pFileSys->GetFileNamesFromPath("tmp\\*.new", List);
+  FileNameListIt It(List.begin());
+  for (; It != List.end(); ++It) {
+	const std::string szFileWithPath("tmp\\" + *It);
+	remove(szFileWithPath.c_str());
+  }
   
   // Se obtiene la lista de archivos cbb
-  FileNameList List;
+  List.clear();
   m_pFileSys->GetFileNamesFromPath("tmp\\*.cbb", List);
 
   // Se recorre y aquellos de tipo area tmp, se borra
-  FileNameListIt It(List.begin());
+  It = List.begin();
   for (; It != List.end(); ++It) {
 	// Es el archivo de area temporal?
 	const std::string szFileWithPath("tmp\\" + *It);
@@ -1484,6 +1572,250 @@ CWorld::RemoveTmpDir(void)
   }  
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Actualiza la lista de imagenes tmp en memoria tras un cambio de area.
+//   La imagen del area abandonada pasara a ser la mas reciente y la del
+//   area actual se descartara, pues su estado estara vivo en m_Area. Si se
+//   supera el presupuesto, se volcaran a disco las imagenes menos recientes.
+// Parametros:
+// - uwPrevIDArea. Area abandonada, cuya imagen tmp ya esta en memoria.
+// - uwIDArea. Area actual.
+// Devuelve:
+// Notas:
+// - El presupuesto solo contabiliza los bytes de las imagenes.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CWorld::UpdateAreaTmpImages(const word uwPrevIDArea,
+							const word uwIDArea)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+  // SOLO si parametros validos
+  ASSERT((uwPrevIDArea != uwIDArea) != 0);
+
+  // Se descarta el estado del area actual, que ya ha sido cargado
+  RemoveAreaTmpImage(uwIDArea);
+  m_pFileSys->ReleaseMemFile(GetAreaTmpFileName(uwIDArea));
+
+  // Se registra el area abandonada como la mas reciente
+  RemoveAreaTmpImage(uwPrevIDArea);
+  const dword udSize = m_pFileSys->GetMemFileSize(GetAreaTmpFileName(uwPrevIDArea));
+  m_AreaTmpImages.Images.push_front(sAreaTmpImage(uwPrevIDArea, udSize));
+  m_AreaTmpImages.udSize += udSize;
+  #ifdef ENGINE_TRACE    
+    SYSEngine::GetLogger()->Write("                  | Imagen tmp del rea %u en memoria (%u bytes, total %u bytes).\n", 
+								  uwPrevIDArea, udSize, m_AreaTmpImages.udSize);
+  #endif 
+
+  // Se vuelcan a disco las imagenes menos recientes mientras se exceda
+  // el presupuesto de memoria
+  while (m_AreaTmpImages.udSize > MAX_AREA_TMP_IMAGES_SIZE) {
+	ASSERT(!m_AreaTmpImages.Images.empty());
+	const sAreaTmpImage& LRUImage = m_AreaTmpImages.Images.back();
+	const std::string szTmpFileName(GetAreaTmpFileName(LRUImage.uwIDArea));
+	const sbyte* const psbData = m_pFileSys->GetMemFileData(szTmpFileName);
+	if (m_AreaStateWriter.IsInitOk() && psbData) {
+	  // Se solicita el volcado en segundo plano y se descarta de memoria
+	  if (!m_AreaStateWriter.Request(szTmpFileName, 
+									 psbData, 
+									 m_pFileSys->GetMemFileSize(szTmpFileName))) {
+		SYSEngine::FatalError("Problemas guardando el estado de las reas.\n");
+	  }
+	  m_pFileSys->ReleaseMemFile(szTmpFileName);
+	} else if (!m_pFileSys->FlushMemFile(szTmpFileName)) {
+	  SYSEngine::FatalError("Problemas guardando el estado del rea %u.\n", 
+							LRUImage.uwIDArea);
+	}
+	#ifdef ENGINE_TRACE    
+	  SYSEngine::GetLogger()->Write("                  | rea %u volcada a disco (%u bytes).\n", 
+									LRUImage.uwIDArea, LRUImage.udSize);
+	#endif 
+	m_AreaTmpImages.udSize -= LRUImage.udSize;
+	m_AreaTmpImages.Images.pop_back();
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Quita la imagen de un area de la lista de imagenes tmp, si se halla en ella.
+// Parametros:
+// - uwIDArea. Identificador del area.
+// Devuelve:
+// Notas:
+// - No se modificara el fichero en memoria asociado.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CWorld::RemoveAreaTmpImage(const word uwIDArea)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se localiza y, si procede, se quita
+  AreaTmpImageListIt It(m_AreaTmpImages.Images.begin());
+  for (; It != m_AreaTmpImages.Images.end(); ++It) {
+	if (It->uwIDArea == uwIDArea) {
+	  m_AreaTmpImages.udSize -= It->udSize;
+	  m_AreaTmpImages.Images.erase(It);
+	  break;
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Descarta todas las imagenes tmp en memoria sin volcarlas a disco.
+// Parametros:
+// Devuelve:
+// Notas:
+// - Se utilizara al descartar los archivos temporales de la sesion.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CWorld::ReleaseAreaTmpImages(void)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Se descartan las imagenes tmp
+  AreaTmpImageListIt It(m_AreaTmpImages.Images.begin());
+  for (; It != m_AreaTmpImages.Images.end(); ++It) {
+	m_pFileSys->ReleaseMemFile(GetAreaTmpFileName(It->uwIDArea));
+  }
+  m_AreaTmpImages.Images.clear();
+  m_AreaTmpImages.udSize = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el nombre del archivo temporal asociado a un area.
+// Parametros:
+// - uwIDArea. Identificador del area.
+// Devuelve:
+// - El nombre del archivo.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+std::string 
+CWorld::GetAreaTmpFileName(const word uwIDArea) const
+{
+  // Se forma el nombre y retorna
+  std::string szFileName;
+  SYSEngine::PassToString(szFileName, "tmp\\Area%utmp.cbb", uwIDArea);
+  return szFileName;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Entrega al subsistema de ficheros los ficheros de un area que se
+//   hubieran precargado o cuyo volcado a disco siga pendiente, para que su
+//   carga se realice desde memoria.
+// Parametros:
+// - uwIDArea. Identificador del area.
+// Devuelve:
+// Notas:
+// - Los ficheros no precargados, o cuya lectura no se completo, se leeran
+//   de disco de la forma habitual.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CWorld::CommitPrefetchedArea(const word uwIDArea)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Volcado a disco pendiente del fichero temporal?
+  // Nota: Su copia sera la version valida, luego se recogera antes que 
+  // cualquier precarga del fichero
+  if (m_AreaStateWriter.IsInitOk()) {
+	m_AreaStateWriter.Commit(GetAreaTmpFileName(uwIDArea), m_pFileSys);
+  }
+
+  // Precarga activa?
+  if (m_AreaPrefetcher.IsInitOk()) {
+	// Se recogen fichero base y, si procede, temporal
+	m_AreaPrefetcher.Commit(GetAreaBaseFileName(uwIDArea), m_pFileSys);
+	m_AreaPrefetcher.Commit(GetAreaTmpFileName(uwIDArea), m_pFileSys);	
+	#ifdef ENGINE_TRACE    
+	  SYSEngine::GetLogger()->Write("                  | rea %u: base %s, temporal %s.\n", 
+									uwIDArea,
+									m_pFileSys->IsMemFile(GetAreaBaseFileName(uwIDArea)) ? "en memoria" : "en disco",
+									m_pFileSys->IsMemFile(GetAreaTmpFileName(uwIDArea)) ? "en memoria" : "en disco");
+	#endif 
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Solicita la precarga de las areas a las que se ha pasado alguna vez
+//   desde el area uwIDArea, descartando las precargas previas.
+// - Si aun no se conocen transiciones desde el area (primera visita), se
+//   solicitaran las areas de identificador contiguo, pues los cambios de 
+//   area los ordenan los scripts y no se pueden conocer de antemano. Las 
+//   que no existan seran ignoradas.
+// Parametros:
+// - uwIDArea. Identificador del area actual.
+// Devuelve:
+// Notas:
+// - Se precargara el fichero base y el temporal, salvo que este ultimo 
+//   ya tenga su imagen en memoria o un volcado a disco pendiente.
+///////////////////////////////////////////////////////////////////////////////
+void 
+CWorld::PrefetchAdjacentAreas(const word uwIDArea)
+{
+  // SOLO si instancia inicializada
+  ASSERT(IsInitOk());
+
+  // Precarga activa?
+  if (m_AreaPrefetcher.IsInitOk()) {
+	// Se descartan las precargas previas
+	m_AreaPrefetcher.CancelAll();
+
+	// Se toman las transiciones conocidas desde el area o, si no las hay,
+	// las areas contiguas
+	AreaSet Areas;
+	const AreaTransitionsMapIt MapIt(m_AreaTransitions.find(uwIDArea));
+	if (MapIt != m_AreaTransitions.end()) {
+	  Areas = MapIt->second;
+	} else {
+	  if (uwIDArea > 0) {
+		Areas.insert(uwIDArea - 1);
+	  }
+	  if (uwIDArea < 0xFFFF) {
+		Areas.insert(uwIDArea + 1);
+	  }
+	}
+
+	// Se solicitan
+	AreaSetIt It(Areas.begin());
+	for (; It != Areas.end(); ++It) {
+	  m_AreaPrefetcher.Request(GetAreaBaseFileName(*It), m_pFileSys, true);
+	  const std::string szTmpFileName(GetAreaTmpFileName(*It));
+	  if (!m_pFileSys->IsMemFile(szTmpFileName) &&
+		  !(m_AreaStateWriter.IsInitOk() && m_AreaStateWriter.IsPending(szTmpFileName))) {
+		m_AreaPrefetcher.Request(szTmpFileName, m_pFileSys);
+	  }
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el nombre del archivo base asociado a un area.
+// Parametros:
+// - uwIDArea. Identificador del area.
+// Devuelve:
+// - El nombre del archivo.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+std::string 
+CWorld::GetAreaBaseFileName(const word uwIDArea) const
+{
+  // Se forma el nombre y retorna
+  std::string szFileName;
+  SYSEngine::PassToString(szFileName, 
+						  "%sArea%u.cbb", 
+						  m_pGDBase->GetAreaFilesPath().c_str(), uwIDArea);
+  return szFileName;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Se encarga de comprobar cuantos items existen en una determinada celda.
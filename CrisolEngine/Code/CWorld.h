@@ -62,6 +62,12 @@
 #ifndef _CAREA_H_
 #include "CArea.h"
 #endif
+#ifndef _CAREAPREFETCHER_H_
+#include "CAreaPrefetcher.h"
+#endif
+#ifndef _CAREASTATEWRITER_H_
+#include "CAreaStateWriter.h"
+#endif
 #ifndef _ICALARMCLIENT_H_
 #include "iCAlarmClient.h"
 #endif
@@ -82,6 +88,10 @@
 #define _MAP_H_
 #include <map>
 #endif
+#ifndef _SET_H_
+#define _SET_H_
+#include <set>
+#endif
 #ifndef _STRING_H_
 #define _STRING_H_
 #include <string>
@@ -155,6 +165,38 @@ private:
 	bool bInNotify; // Se esta en proceso de notificacion?
   };
 
+  struct sAreaTmpImage {
+	// Imagen del fichero tmp de un area abandonada mantenida en memoria
+	word  uwIDArea; // Identificador del area
+	dword udSize;   // Bytes ocupados por la imagen
+	// Constructor
+	sAreaTmpImage(const word auwIDArea,
+				  const dword audSize): uwIDArea(auwIDArea),
+										udSize(audSize) { }
+  };
+
+private:
+  // Tipos
+  // Lista de imagenes tmp, de la mas a la menos recientemente abandonada
+  typedef std::list<sAreaTmpImage>     AreaTmpImageList;
+  typedef AreaTmpImageList::iterator   AreaTmpImageListIt;
+  // Map de transiciones entre areas observadas durante el juego
+  typedef std::set<word>                 AreaSet;
+  typedef AreaSet::iterator              AreaSetIt;
+  typedef std::map<word, AreaSet>        AreaTransitionsMap;
+  typedef AreaTransitionsMap::iterator   AreaTransitionsMapIt;
+  typedef AreaTransitionsMap::value_type AreaTransitionsMapValType;
+
+private:
+  // Estructuras
+  struct sAreaTmpImagesInfo {
+	// Info asociada a las imagenes tmp de areas mantenidas en memoria
+	AreaTmpImageList Images; // Imagenes en memoria
+	dword            udSize; // Bytes totales de las imagenes
+	// Constructor
+	sAreaTmpImagesInfo(void): udSize(0) { }
+  };
+
 private:
   // Enumerados
   enum eStartMode {
@@ -162,6 +204,12 @@ private:
 	SM_NEWGAME, // Se ha comenzado una nueva partida
 	SM_LOADGAME // Se ha recuperado una partida previamente guardada
   };
+
+  enum {
+	// Bytes maximos para las imagenes tmp en memoria (solo se contabiliza
+	// el tamao de las imagenes serializadas, no las estructuras de CArea)
+	MAX_AREA_TMP_IMAGES_SIZE = 4 * 1024 * 1024
+  };
   
 private:
   // Instancia singlenton
@@ -177,8 +225,20 @@ private:
   iCVirtualMachine*  m_pVMachine;     // Maquina virtual para scripts
   
   // Areas y motor isometrico
-  CArea      m_Area;      // Area <deberia de existir una lista>
-  CIsoEngine m_IsoEngine; // Motor isometrico
+  // Nota: Solo el area actual estara viva. De las areas abandonadas
+  // recientemente solo se mantendra en memoria la imagen serializada de su
+  // fichero tmp, en lugar de escribirla y leerla de disco. Cada cambio de
+  // area seguira reconstruyendo el area completa con CArea::ChangeArea
+  CArea              m_Area;            // Area actual
+  sAreaTmpImagesInfo m_AreaTmpImages;   // Imagenes tmp en memoria
+  CAreaStateWriter   m_AreaStateWriter; // Volcado a disco en segundo plano
+  CIsoEngine         m_IsoEngine;       // Motor isometrico
+
+  // Precarga de areas
+  // Nota: Los cambios de area se realizan desde scripts, por lo que las
+  // areas adyacentes a una dada se conoceran observando las transiciones
+  CAreaPrefetcher    m_AreaPrefetcher;  // Precarga en segundo plano
+  AreaTransitionsMap m_AreaTransitions; // Transiciones observadas
   
   // Controla el modo de juego
   sModeInfo m_ModeInfo; // Info asociada al modo actual de universo de juego
@@ -289,6 +349,18 @@ private:
   void RemoveTmpDir(void);
   void InitGlobalScriptEvents(void);
   void ExecuteOnEntityCreatedEvent(void);
+private:
+  // Metodos de apoyo para las imagenes tmp en memoria
+  void UpdateAreaTmpImages(const word uwPrevIDArea,
+						   const word uwIDArea);
+  void RemoveAreaTmpImage(const word uwIDArea);
+  void ReleaseAreaTmpImages(void);
+  std::string GetAreaTmpFileName(const word uwIDArea) const;
+private:
+  // Metodos de apoyo para la precarga de areas
+  void CommitPrefetchedArea(const word uwIDArea);
+  void PrefetchAdjacentAreas(const word uwIDArea);
+  std::string GetAreaBaseFileName(const word uwIDArea) const;
 
 public:
   // iCWorld / Trabajo con el establecimiento de los distintos eventos
@@ -587,6 +659,18 @@ public:
 	return m_IsoEngine.CalculePathLenght(TileSrc, TileDest);
 	
   }
+  sword CalculeBoundedPathLenght(const AreaDefs::sTilePos& TileSrc,
+								 const AreaDefs::sTilePos& TileDest,
+								 const word uwMaxLenght) {
+	ASSERT(IsInitOk());
+	// Calcula la longitud del camino SOLO si no supera uwMaxLenght
+	return m_IsoEngine.CalculeBoundedPathLenght(TileSrc, TileDest, uwMaxLenght);
+  }
+  void UpdateAccessInfoAt(const AreaDefs::sTilePos& TilePos) {
+	ASSERT(IsInitOk());
+	// Notifica al area un cambio en los accesos de TilePos
+	m_Area.UpdateAccessInfoAt(TilePos);
+  }
   sword CalculeAdjacentPosInDestination(const AreaDefs::sTilePos& TileSrc,
 									    const AreaDefs::sTilePos& TileDest,
 										AreaDefs::sTilePos& AdjacentTilePos) {
@@ -782,6 +866,16 @@ public:
 	// Obtiene el cojunto de criaturas que contienen a la recibida en su rango
 	m_Area.FindCriaturesContainingCriatureInRange(hCriature, InRangeSet);
   }
+  void FindCriaturesRangeDelta(const AreaDefs::sTilePos& Pos,
+							   const RulesDefs::CriatureRange& Range,
+							   const std::set<AreaDefs::EntHandle>& InRangeSet,
+							   std::set<AreaDefs::EntHandle>& EnteredSet,
+							   std::set<AreaDefs::EntHandle>& LeftSet) {
+	ASSERT(IsInitOk());
+	// Obtiene las criaturas que han entrado y salido del rango asociado a una
+	// posicion, respecto a las que se hallaban en el
+	m_Area.FindCriaturesRangeDelta(Pos, Range, InRangeSet, EnteredSet, LeftSet);
+  }
 
 public:
   // iCWorld / Trabajo con los observadores
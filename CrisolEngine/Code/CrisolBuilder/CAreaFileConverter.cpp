@@ -0,0 +1,585 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolBuilder - CrisolEngine's Config files processor
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CAreaFileConverter.cpp
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Consultar CAreaFileConverter.h para mas detalles.
+///////////////////////////////////////////////////////////////////////////////
+#include "CAreaFileConverter.h"
+
+#include <fstream>
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Convierte el archivo de area base szV1FileName, en formato v1, al
+//   archivo szV2FileName en formato v2.
+// Parametros:
+// - szV1FileName. Archivo de origen.
+// - szV2FileName. Archivo de destino. Podra ser el mismo que el de origen.
+// Devuelve:
+// - Si todo ha ido bien true. En caso contrario false, pudiendose consultar
+//   el motivo con GetError.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaFileConverter::Convert(const std::string& szV1FileName,
+							const std::string& szV2FileName)
+{
+  // SOLO si parametros validos
+  ASSERT(!szV1FileName.empty());
+  ASSERT(!szV2FileName.empty());
+
+  // Se carga y procesa el archivo de origen
+  Reset();
+  word uwIDArea;
+  CBDefs::sAreaV2Header Header;
+  if (!ReadSource(szV1FileName) ||
+	  !ParseSource(szV1FileName, uwIDArea, Header)) {
+	return false;
+  }
+
+  // Se construye y escribe el archivo de destino
+  std::vector<sbyte> V2Data;
+  BuildTarget(uwIDArea, Header, V2Data);
+  return WriteTarget(szV2FileName, V2Data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Convierte en memoria el contenido de un archivo de area base en formato
+//   v1 al contenido equivalente en formato v2.
+// Parametros:
+// - psbV1Data, udV1Size. Contenido del archivo de origen y su tamao.
+// - V2Data. Vector donde depositar el contenido en formato v2.
+// Devuelve:
+// - Si todo ha ido bien true. En caso contrario false, pudiendose consultar
+//   el motivo con GetError.
+// Notas:
+// - El contenido de origen no se copiara, luego debera de permanecer
+//   valido durante la llamada.
+// - El resultado sera identico, byte a byte, al del archivo escrito por la
+//   conversion entre ficheros.
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaFileConverter::Convert(const sbyte* const psbV1Data,
+							const dword udV1Size,
+							std::vector<sbyte>& V2Data)
+{
+  // SOLO si parametros validos
+  ASSERT(psbV1Data);
+
+  // Se procesa el contenido de origen
+  Reset();
+  m_psbSource = psbV1Data;
+  m_udSourceSize = udV1Size;
+  word uwIDArea;
+  CBDefs::sAreaV2Header Header;
+  if (!ParseSource("(memoria)", uwIDArea, Header)) {
+	return false;
+  }
+
+  // Se construye el contenido de destino
+  BuildTarget(uwIDArea, Header, V2Data);
+  m_psbSource = NULL;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Procesa el contenido de origen, construyendo las secciones v2.
+// Parametros:
+// - szSourceName. Nombre del origen, para los mensajes de error.
+// - uwIDArea. Referencia donde depositar el identificador del area.
+// - Header. Cabecera donde depositar los datos generales del area.
+// Devuelve:
+// - Si todo ha ido bien true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaFileConverter::ParseSource(const std::string& szSourceName,
+								word& uwIDArea,
+								CBDefs::sAreaV2Header& Header)
+{
+  // Se comprueba el tipo y la version
+  const byte ubFileType = ReadByte();
+  const byte ubHVersion = ReadByte();
+  ReadByte();
+  if (ubFileType != CBDefs::CBBAreaBaseFile ||
+	  ubHVersion != CBDefs::HVersion) {
+	m_szError = "\"" + szSourceName + "\" no es un archivo de rea base v1";
+	return false;
+  }
+
+  // Se leen los datos generales del area
+  uwIDArea = ReadWord();
+  memset(&Header, 0, sizeof(CBDefs::sAreaV2Header));
+  Header.udName = ReadString();
+  Header.uwWidth = ReadWord();
+  Header.uwHeight = ReadWord();
+  Header.AmbientLight = ReadByte();
+  Header.uwNumRooms = ReadWord();
+
+  // Se leen las celdas, que se hallaran por filas
+  word uwYTile = 0;
+  for (; uwYTile < Header.uwHeight && m_bSourceOk; ++uwYTile) {
+	word uwXTile = 0;
+	for (; uwXTile < Header.uwWidth && m_bSourceOk; ++uwXTile) {
+	  // Se leen los flags de secciones y, si hay celda, sus datos
+	  bool bSectionFlags[5];
+	  Read(bSectionFlags, sizeof(bool) * 5);
+	  if (bSectionFlags[0]) {
+		ReadCell(uwXTile, uwYTile, bSectionFlags);
+	  }
+	}
+  }
+
+  // Se salio del archivo de origen?
+  if (!m_bSourceOk) {
+	m_szError = "\"" + szSourceName + "\" est truncado o daado";
+	return false;
+  }
+
+  // Todo correcto
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Vacia las secciones y el archivo de origen de una conversion previa.
+// Parametros:
+// Devuelve:
+// Notas:
+// - La seccion de cadenas comenzara siempre con la cadena vacia.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaFileConverter::Reset(void)
+{
+  // Se vacia todo
+  m_Source.clear();
+  m_psbSource = NULL;
+  m_udSourceSize = 0;
+  m_udPos = 0;
+  m_bSourceOk = true;
+  m_szStrings.assign(1, '\0');
+  m_StrOffsets.clear();
+  m_Cells.clear();
+  m_Roofs.clear();
+  m_Entities.clear();
+  m_Items.clear();
+  m_udV2Size = 0;
+  m_szError = "";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Carga en memoria el contenido completo del archivo de origen.
+// Parametros:
+// - szFileName. Nombre del archivo.
+// Devuelve:
+// - Si se pudo leer true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaFileConverter::ReadSource(const std::string& szFileName)
+{
+  // Se abre y se obtiene el tamao
+  std::ifstream File(szFileName.c_str(), std::ios::binary);
+  if (File.fail()) {
+	m_szError = "No se pudo abrir el archivo \"" + szFileName + "\"";
+	return false;
+  }
+  File.seekg(0, std::ios::end);
+  const dword udSize = File.tellg();
+  File.seekg(0, std::ios::beg);
+
+  // Se lee
+  if (udSize) {
+	m_Source.resize(udSize);
+	File.read(&m_Source[0], udSize);
+  }
+  if (!udSize || File.fail()) {
+	m_szError = "No se pudo leer el archivo \"" + szFileName + "\"";
+	return false;
+  }
+  m_psbSource = &m_Source[0];
+  m_udSourceSize = udSize;
+
+  // Todo correcto
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee los datos de una celda con contenido, registrando su floor, techo,
+//   items y entidades en las secciones que procedan.
+// Parametros:
+// - uwXTile, uwYTile. Posicion de la celda.
+// - pbSectionFlags. Flags de secciones presentes en la celda.
+// Devuelve:
+// Notas:
+// - Consultar CCrisolBuilder::BuildAreaFiles para ver el formato v1.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaFileConverter::ReadCell(const word uwXTile,
+							 const word uwYTile,
+							 const bool* const pbSectionFlags)
+{
+  // SOLO si parametros validos
+  ASSERT(pbSectionFlags);
+  ASSERT(pbSectionFlags[0]);
+
+  // Floor, items sobre el suelo y habitacion
+  CBDefs::sAreaV2Cell Cell;
+  memset(&Cell, 0, sizeof(CBDefs::sAreaV2Cell));
+  Cell.uwXTile = uwXTile;
+  Cell.uwYTile = uwYTile;
+  Cell.udFloorProfile = ReadString();
+  Cell.Elevation = ReadWord();
+  Cell.udFirstItem = m_Items.size();
+  ReadItems(false);
+  Cell.uwNumItems = m_Items.size() - Cell.udFirstItem;
+  Cell.Room = ReadWord();
+
+  // Posible techo
+  Cell.udRoof = CBDefs::AreaV2NoRecord;
+  if (pbSectionFlags[1]) {
+	CBDefs::sAreaV2Roof Roof;
+	memset(&Roof, 0, sizeof(CBDefs::sAreaV2Roof));
+	Roof.udProfile = ReadString();
+	Roof.Elevation = ReadWord();
+	Roof.ubShowUnder = ReadBool() ? 1 : 0;
+	Cell.udRoof = m_Roofs.size();
+	m_Roofs.push_back(Roof);
+  }
+
+  // Entidades
+  Cell.udFirstEntity = m_Entities.size();
+  if (pbSectionFlags[2]) {
+	ReadSceneObjs();
+  }
+  if (pbSectionFlags[3]) {
+	ReadCriatures();
+  }
+  if (pbSectionFlags[4]) {
+	ReadWalls();
+  }
+  Cell.uwNumEntities = m_Entities.size() - Cell.udFirstEntity;
+
+  // Se registra la celda
+  m_Cells.push_back(Cell);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee una lista de items (sobre el suelo, contenidos o equipados) y los
+//   aade a la seccion de items.
+// Parametros:
+// - bEquipped. Lista de items equipados?
+// Devuelve:
+// Notas:
+// - Los items equipados se escriben en v1 como tag, slot, perfil y luz. El
+//   resto como perfil, tag y luz.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaFileConverter::ReadItems(const bool bEquipped)
+{
+  // Se leen
+  word uwNumItems = ReadWord();
+  for (; uwNumItems > 0 && m_bSourceOk; --uwNumItems) {
+	CBDefs::sAreaV2Item Item;
+	memset(&Item, 0, sizeof(CBDefs::sAreaV2Item));
+	if (bEquipped) {
+	  Item.udTag = ReadString();
+	  dword udSlot = 0;
+	  Read(&udSlot, sizeof(dword));
+	  Item.ubSlot = byte(udSlot);
+	  Item.udProfile = ReadString();
+	} else {
+	  Item.udProfile = ReadString();
+	  Item.udTag = ReadString();
+	  Item.ubSlot = CBDefs::AreaV2NoSlot;
+	}
+	Item.Light = ReadByte();
+	m_Items.push_back(Item);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Leen las entidades de una celda y las aaden a la seccion de entidades,
+//   junto a sus posibles items.
+// Parametros:
+// Devuelve:
+// - Numero de entidades leidas.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+word
+CAreaFileConverter::ReadSceneObjs(void)
+{
+  // Se leen
+  const word uwNumSceneObjs = ReadWord();
+  word uwIt = 0;
+  for (; uwIt < uwNumSceneObjs && m_bSourceOk; ++uwIt) {
+	CBDefs::sAreaV2Entity Entity;
+	memset(&Entity, 0, sizeof(CBDefs::sAreaV2Entity));
+	Entity.ubType = CBDefs::AREAV2_SCENE_OBJ;
+	Entity.udProfile = ReadString();
+	Entity.udTag = ReadString();
+	Entity.Elevation = ReadWord();
+	Entity.Light = ReadByte();
+	Entity.udFirstItem = m_Items.size();
+	ReadItems(false);
+	Entity.uwNumItems = m_Items.size() - Entity.udFirstItem;
+	m_Entities.push_back(Entity);
+  }
+  return uwIt;
+}
+
+word
+CAreaFileConverter::ReadCriatures(void)
+{
+  // Se leen
+  const word uwNumCriatures = ReadWord();
+  word uwIt = 0;
+  for (; uwIt < uwNumCriatures && m_bSourceOk; ++uwIt) {
+	CBDefs::sAreaV2Entity Entity;
+	memset(&Entity, 0, sizeof(CBDefs::sAreaV2Entity));
+	Entity.ubType = CBDefs::AREAV2_CRIATURE;
+	Entity.udProfile = ReadString();
+	Entity.ubFlags = ReadBool() ? CBDefs::AREAV2_TMP_CRIATURE : 0;
+	Entity.udTag = ReadString();
+	Entity.Elevation = ReadWord();
+	Entity.Light = ReadByte();
+	Entity.udFirstItem = m_Items.size();
+	ReadItems(false);
+	ReadItems(true);
+	Entity.uwNumItems = m_Items.size() - Entity.udFirstItem;
+	m_Entities.push_back(Entity);
+  }
+  return uwIt;
+}
+
+word
+CAreaFileConverter::ReadWalls(void)
+{
+  // Se leen
+  const word uwNumWalls = ReadWord();
+  word uwIt = 0;
+  for (; uwIt < uwNumWalls && m_bSourceOk; ++uwIt) {
+	CBDefs::sAreaV2Entity Entity;
+	memset(&Entity, 0, sizeof(CBDefs::sAreaV2Entity));
+	Entity.ubType = CBDefs::AREAV2_WALL;
+	Entity.udProfile = ReadString();
+	Entity.udTag = ReadString();
+	Entity.Elevation = ReadWord();
+	Entity.Light = ReadByte();
+	Entity.ubFlags = ReadBool() ? CBDefs::AREAV2_BLOCK_ACCESS : 0;
+	Entity.udFirstItem = m_Items.size();
+	m_Entities.push_back(Entity);
+  }
+  return uwIt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Construye el contenido v2 a partir de las secciones.
+// Parametros:
+// - uwIDArea. Identificador del area.
+// - Header. Cabecera, a la que se le completara la tabla de secciones.
+// - V2Data. Vector donde depositar el contenido.
+// Devuelve:
+// Notas:
+// - Cada seccion comenzara en un offset multiplo de 4. El relleno quedara
+//   a cero.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaFileConverter::BuildTarget(const word uwIDArea,
+								CBDefs::sAreaV2Header& Header,
+								std::vector<sbyte>& V2Data)
+{
+  // Se establece la tabla de secciones
+  const dword udSectionSizes[CBDefs::AREAV2_MAX_SECTIONS] = {
+	m_szStrings.size(),
+	m_Cells.size() * sizeof(CBDefs::sAreaV2Cell),
+	m_Roofs.size() * sizeof(CBDefs::sAreaV2Roof),
+	m_Entities.size() * sizeof(CBDefs::sAreaV2Entity),
+	m_Items.size() * sizeof(CBDefs::sAreaV2Item)
+  };
+  const sbyte* const psbSections[CBDefs::AREAV2_MAX_SECTIONS] = {
+	m_szStrings.data(),
+	m_Cells.empty() ? NULL : (const sbyte*)(&m_Cells[0]),
+	m_Roofs.empty() ? NULL : (const sbyte*)(&m_Roofs[0]),
+	m_Entities.empty() ? NULL : (const sbyte*)(&m_Entities[0]),
+	m_Items.empty() ? NULL : (const sbyte*)(&m_Items[0])
+  };
+  Header.Sections[CBDefs::AREAV2_STRINGS].udNumRecords = m_szStrings.size();
+  Header.Sections[CBDefs::AREAV2_CELLS].udNumRecords = m_Cells.size();
+  Header.Sections[CBDefs::AREAV2_ROOFS].udNumRecords = m_Roofs.size();
+  Header.Sections[CBDefs::AREAV2_ENTITIES].udNumRecords = m_Entities.size();
+  Header.Sections[CBDefs::AREAV2_ITEMS].udNumRecords = m_Items.size();
+  dword udOffset = CBDefs::AreaV2HeaderPos + sizeof(CBDefs::sAreaV2Header);
+  byte ubIt = 0;
+  for (; ubIt < CBDefs::AREAV2_MAX_SECTIONS; ++ubIt) {
+	udOffset = (udOffset + 3) & ~dword(3);
+	Header.Sections[ubIt].udOffset = udOffset;
+	udOffset += udSectionSizes[ubIt];
+  }
+
+  // Se aloja el contenido y se copian tipo, version, identificador y 
+  // cabecera
+  V2Data.assign(udOffset, 0);
+  sbyte* const psbData = &V2Data[0];
+  psbData[0] = CBDefs::CBBAreaBaseFile;
+  psbData[1] = CBDefs::AreaV2HVersion;
+  psbData[2] = CBDefs::LVersion;
+  memcpy(psbData + 3, &uwIDArea, sizeof(word));
+  memcpy(psbData + CBDefs::AreaV2HeaderPos, &Header, sizeof(CBDefs::sAreaV2Header));
+
+  // Se copian las secciones
+  for (ubIt = 0; ubIt < CBDefs::AREAV2_MAX_SECTIONS; ++ubIt) {
+	if (udSectionSizes[ubIt]) {
+	  memcpy(psbData + Header.Sections[ubIt].udOffset, 
+			 psbSections[ubIt], 
+			 udSectionSizes[ubIt]);
+	}
+  }
+  m_udV2Size = udOffset;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Escribe el archivo v2.
+// Parametros:
+// - szFileName. Nombre del archivo.
+// - V2Data. Contenido construido con BuildTarget.
+// Devuelve:
+// - Si se pudo escribir true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+CAreaFileConverter::WriteTarget(const std::string& szFileName,
+								const std::vector<sbyte>& V2Data)
+{
+  // SOLO si parametros validos
+  ASSERT(!V2Data.empty());
+
+  // Se abre el archivo y se escribe
+  std::ofstream File(szFileName.c_str(), std::ios::binary | std::ios::trunc);
+  if (File.fail()) {
+	m_szError = "No se pudo abrir el archivo \"" + szFileName + "\"";
+	return false;
+  }
+  File.write(&V2Data[0], V2Data.size());
+  if (File.fail()) {
+	m_szError = "No se pudo escribir el archivo \"" + szFileName + "\"";
+	return false;
+  }
+
+  // Todo correcto
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee datos del archivo de origen, avanzando la posicion de lectura.
+// Parametros:
+// - pDest. Destino.
+// - udSize. Bytes a leer.
+// Devuelve:
+// Notas:
+// - Si se intenta leer mas alla del final se bajara m_bSourceOk y no se
+//   leera nada.
+///////////////////////////////////////////////////////////////////////////////
+void
+CAreaFileConverter::Read(void* const pDest,
+						 const dword udSize)
+{
+  // SOLO si parametros validos
+  ASSERT(pDest);
+
+  // Hay datos suficientes?
+  if (m_bSourceOk && m_udPos + udSize <= m_udSourceSize) {
+	memcpy(pDest, m_psbSource + m_udPos, udSize);
+	m_udPos += udSize;
+  } else {
+	m_bSourceOk = false;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee una cadena del archivo de origen (tamao en un word y caracteres) y
+//   la registra en la seccion de cadenas.
+// Parametros:
+// Devuelve:
+// - Offset de la cadena en la seccion de cadenas.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+dword
+CAreaFileConverter::ReadString(void)
+{
+  // Se lee
+  const word uwSize = ReadWord();
+  if (!m_bSourceOk || m_udPos + uwSize > m_udSourceSize) {
+	m_bSourceOk = false;
+	return 0;
+  }
+  const std::string szString(m_psbSource + m_udPos,
+							 m_psbSource + m_udPos + uwSize);
+  m_udPos += uwSize;
+
+  // Se registra
+  return AddString(szString);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Registra una cadena en la seccion de cadenas. Las cadenas repetidas
+//   (perfiles, habitualmente) se guardaran una sola vez.
+// Parametros:
+// - szString. Cadena.
+// Devuelve:
+// - Offset de la cadena en la seccion de cadenas.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+dword
+CAreaFileConverter::AddString(const std::string& szString)
+{
+  // Cadena vacia?
+  if (szString.empty()) {
+	return 0;
+  }
+
+  // Ya registrada?
+  const StrOffsetMapIt It(m_StrOffsets.find(szString));
+  if (It != m_StrOffsets.end()) {
+	return It->second;
+  }
+
+  // Se aade con su terminador
+  const dword udOffset = m_szStrings.size();
+  m_szStrings.append(szString);
+  m_szStrings.append(1, '\0');
+  m_StrOffsets.insert(StrOffsetMapValType(szString, udOffset));
+  return udOffset;
+}
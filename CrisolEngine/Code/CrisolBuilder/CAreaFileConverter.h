@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolBuilder - CrisolEngine's Config files processor
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CAreaFileConverter.h
+// Autor: Fernando Rodrguez Martnez
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Clases:
+// - CAreaFileConverter
+//
+// Descripcion:
+// - Convierte un archivo de area base del formato original (v1), en el que
+//   los datos de cada celda se hallan encadenados con cadenas de longitud
+//   variable, al formato v2, formado por secciones de registros de tamao
+//   fijo que el motor podra usar en memoria sin procesarlos.
+// - Consultar CBDefs.h para conocer la disposicion del formato v2.
+//
+// Notas:
+// - Solo se convertiran archivos de area base. Los archivos temporales los
+//   escribe el motor y mantendran su formato.
+// - La clase se compila tambien en el motor, que convertira en memoria los
+//   archivos de area base v1 al cargarlos o precargarlos. Una instancia no
+//   compartira datos con otras, luego podra usarse desde cualquier hilo si
+//   se enlaza con la CRT multihilo.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _CAREAFILECONVERTER_H_
+#define _CAREAFILECONVERTER_H_
+
+// Pragmas <VC6 / Warnings sobre la stl>
+#pragma warning(disable:4786)
+
+// Cabeceras
+#ifndef _SYSDEFS_H_
+#include "..\\SYSDefs.h"
+#endif
+#ifndef _CBDEFS_H_
+#include "CBDefs.h"
+#endif
+#ifndef _STRING_H_
+#define _STRING_H_
+#include <string>
+#endif
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+#include <vector>
+#endif
+#ifndef _MAP_H_
+#define _MAP_H_
+#include <map>
+#endif
+
+// Defincion de clases / estructuras / espacios de nombres
+
+// Clase CAreaFileConverter
+class CAreaFileConverter
+{
+private:
+  // Tipos
+  // Map de cadenas registradas y su offset en la seccion de cadenas
+  typedef std::map<std::string, dword> StrOffsetMap;
+  typedef StrOffsetMap::iterator       StrOffsetMapIt;
+  typedef StrOffsetMap::value_type     StrOffsetMapValType;
+  // Vectores de registros
+  typedef std::vector<CBDefs::sAreaV2Cell>   CellVector;
+  typedef std::vector<CBDefs::sAreaV2Roof>   RoofVector;
+  typedef std::vector<CBDefs::sAreaV2Entity> EntityVector;
+  typedef std::vector<CBDefs::sAreaV2Item>   ItemVector;
+
+private:
+  // Vbles de miembro
+  std::vector<sbyte> m_Source;       // Contenido del archivo v1 leido
+  const sbyte*       m_psbSource;    // Contenido del archivo v1
+  dword              m_udSourceSize; // Tamao del archivo v1
+  dword              m_udPos;        // Posicion de lectura en el origen
+  bool               m_bSourceOk;    // Lectura sin salirse del origen?
+  std::string        m_szStrings;    // Seccion de cadenas
+  StrOffsetMap       m_StrOffsets;   // Cadenas ya registradas
+  CellVector         m_Cells;        // Seccion de celdas
+  RoofVector         m_Roofs;        // Seccion de techos
+  EntityVector       m_Entities;     // Seccion de entidades
+  ItemVector         m_Items;        // Seccion de items
+  dword              m_udV2Size;     // Tamao del ultimo archivo v2 escrito
+  std::string        m_szError;      // Descripcion del ultimo error
+
+public:
+  // Constructor / Destructor
+  CAreaFileConverter(void): m_psbSource(NULL),
+							m_udSourceSize(0),
+							m_udPos(0),
+							m_bSourceOk(false),
+							m_udV2Size(0) { }
+  ~CAreaFileConverter(void) { }
+
+public:
+  // Conversion
+  bool Convert(const std::string& szV1FileName,
+			   const std::string& szV2FileName);
+  bool Convert(const sbyte* const psbV1Data,
+			   const dword udV1Size,
+			   std::vector<sbyte>& V2Data);
+  inline dword GetV1Size(void) const { return m_udSourceSize; }
+  inline dword GetV2Size(void) const { return m_udV2Size; }
+  inline const std::string& GetError(void) const { return m_szError; }
+private:
+  // Metodos de apoyo
+  void Reset(void);
+  bool ReadSource(const std::string& szFileName);
+  bool ParseSource(const std::string& szSourceName,
+				   word& uwIDArea,
+				   CBDefs::sAreaV2Header& Header);
+  void BuildTarget(const word uwIDArea,
+				   CBDefs::sAreaV2Header& Header,
+				   std::vector<sbyte>& V2Data);
+  bool WriteTarget(const std::string& szFileName,
+				   const std::vector<sbyte>& V2Data);
+  void ReadCell(const word uwXTile,
+			    const word uwYTile,
+				const bool* const pbSectionFlags);
+  void ReadItems(const bool bEquipped);
+  word ReadSceneObjs(void);
+  word ReadCriatures(void);
+  word ReadWalls(void);
+
+private:
+  // Lectura del archivo v1
+  void Read(void* const pDest,
+			const dword udSize);
+  dword ReadString(void);
+  inline byte ReadByte(void) {
+	// Lee y retorna un byte
+	byte ubValue = 0;
+	Read(&ubValue, sizeof(byte));
+	return ubValue;
+  }
+  inline word ReadWord(void) {
+	// Lee y retorna un word
+	word uwValue = 0;
+	Read(&uwValue, sizeof(word));
+	return uwValue;
+  }
+  inline bool ReadBool(void) {
+	// Lee y retorna un flag
+	bool bValue = false;
+	Read(&bValue, sizeof(bool));
+	return bValue;
+  }
+
+private:
+  // Trabajo con la seccion de cadenas
+  dword AddString(const std::string& szString);
+};
+
+#endif // ~ CAreaFileConverter
@@ -82,6 +82,9 @@ CCrisolBuilder::Init(const std::string& szInitFileName)
 	  }
 	}
 
+	// Flag de conversion de los archivos de area al formato v2
+	m_ParamsInfo.bAreaFilesV2 = Parser.ReadFlag("AreaFilesV2Flag", false);
+
 	// Flags de escritura de perfiles localizados
 	Parser.SetVarPrefix("ReportProfilesUsed.");
 	m_ParamsInfo.bReportAnimTemplates = Parser.ReadFlag("AnimTemplates", false);
@@ -485,12 +488,52 @@ CCrisolBuilder::BuildAreaFiles(const word uwNumAreas)
 			  << ".";
 	  WriteMsg(StrText.str(), CCrisolBuilder::MSG_NORMAL);
 	}
+
+	// Se desea el archivo en formato v2?
+	if (m_ParamsInfo.bAreaFilesV2) {
+	  if (!ConvertAreaFile(StrAreaFileName.str() + ".cbb")) {
+		return false;
+	  }
+	}
   }
   
   // Todo correcto
   return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Convierte un archivo de area base recien construido al formato v2,
+//   sobreescribiendolo.
+// Parametros:
+// - szFileName. Nombre del archivo de area.
+// Devuelve:
+// - Si todo ha ido bien true, en caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool
+CCrisolBuilder::ConvertAreaFile(const std::string& szFileName)
+{
+  // Se convierte
+  CAreaFileConverter Converter;
+  if (!Converter.Convert(szFileName, szFileName)) {
+	WriteMsg(Converter.GetError(), CCrisolBuilder::MSG_ERROR);
+	return false;
+  }
+
+  // Se informa de los tamaos
+  std::ostringstream StrText;
+  StrText << "* Convertido a formato v2 ("
+		  << Converter.GetV1Size()
+		  << " -> "
+		  << Converter.GetV2Size()
+		  << " bytes).";
+  WriteMsg(StrText.str(), CCrisolBuilder::MSG_NORMAL);
+
+  // Todo correcto
+  return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Se encarga de leer la informacion de tag de un perfil y escribirla a 
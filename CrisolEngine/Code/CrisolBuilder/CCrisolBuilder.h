@@ -49,6 +49,9 @@
 #ifndef _CRULESDATABASE_H_
 #include "..\\CRulesDataBase.h"
 #endif
+#ifndef _CAREAFILECONVERTER_H_
+#include "CAreaFileConverter.h"
+#endif
 #ifndef _FSTREAM_H_
 #define _FSTREAM_H_
 #include <fstream>
@@ -128,6 +131,7 @@ private:
 	bool bReportSceneObjProfiles; // Informar de los perfiles de obj. de escenario?
 	bool bReportFloorProfiles;    // Informar de los perfiles de suelos?
 	bool bReportRoofProfiles;     // Informar de los perfiles de techos?	
+	bool bAreaFilesV2;            // Convertir las areas al formato v2?
   };
 
 private:
@@ -184,6 +188,7 @@ private:
 						std::ofstream& CBBFile,
 						StrSet& TagSet,
 						const std::string& szTmpPrefix = "");
+  bool ConvertAreaFile(const std::string& szFileName);
 
 private:
   // Chequeo del archivo de perfil de entidades
@@ -31,16 +31,21 @@
 
 // Includes
 #include "CCrisolBuilder.h"
+#include "CAreaFileConverter.h"
 #include <iostream>
+#include <string.h>
 
 // Prototipos de funciones
 void WriteHead(void);
+int ConvertAreaFiles(int argc, char**argv);
 
 ///////////////////////////////////////////////////////////////////////////////
 // Descripcion:
 // - Entrada a la utilidad.
 //   Por defecto, el archivo CrisolBuilder.ini sera el que se busque para
 //   leer la configuracion.
+// - Si el primer argumento es -v2, los restantes se tomaran como archivos
+//   de area base ya construidos a convertir al formato v2.
 // Parametros:
 // - argc. Numero de argumentos pasados, incluidos el nombre del programa.
 // - argv. Cadena con el nombre de los argumentos
@@ -54,6 +59,11 @@ main(int argc, char**argv)
   // Escribe cabecera
   WriteHead();
 
+  // Se desea convertir archivos de area?
+  if (argc > 1 && 0 == strcmp(argv[1], "-v2")) {
+	return ConvertAreaFiles(argc - 2, argv + 2);
+  }
+
   // Construye archivos
   CCrisolBuilder CBuilder;
   if (CBuilder.Init("CrisolBuilder.ini")) {
@@ -87,3 +97,38 @@ WriteHead(void)
   std::cout << "CrisolEngine web: <http://usuarios.tripod.es/crisolengine/>.\n";  
   std::cout << "<V:1.0>\n\n";
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Convierte al formato v2 los archivos de area base recibidos,
+//   sobreescribiendolos e informando de los tamaos resultantes.
+// Parametros:
+// - argc. Numero de archivos.
+// - argv. Nombres de los archivos.
+// Devuelve:
+// - Codigo de retorno para exit.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+int
+ConvertAreaFiles(int argc, char**argv)
+{
+  // Se convierten los archivos
+  CAreaFileConverter Converter;
+  int nNumErrors = 0;
+  int nIt = 0;
+  for (; nIt < argc; ++nIt) {
+	if (Converter.Convert(argv[nIt], argv[nIt])) {
+	  std::cout << argv[nIt] << ": " 
+				<< Converter.GetV1Size() << " -> "
+				<< Converter.GetV2Size() << " bytes" << std::endl;
+	} else {
+	  std::cout << "Error: " << Converter.GetError() << std::endl;
+	  ++nNumErrors;
+	}
+  }
+
+  // Se muestran resultados
+  std::cout << std::endl;
+  std::cout << "Errores: " << nNumErrors << std::endl;
+  return 0;
+}
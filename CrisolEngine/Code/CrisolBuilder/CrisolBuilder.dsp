@@ -87,6 +87,10 @@ LINK32=link.exe
 # PROP Default_Filter "cpp;c;cxx;rc;def;r;odl;idl;hpj;bat"
 # Begin Source File
 
+SOURCE=.\CAreaFileConverter.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\CCBTParser.cpp
 # End Source File
 # Begin Source File
@@ -119,6 +123,10 @@ SOURCE=..\SYSAssert.cpp
 # PROP Default_Filter "h;hpp;hxx;hm;inl"
 # Begin Source File
 
+SOURCE=.\CAreaFileConverter.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\CBDefs.h
 # End Source File
 # Begin Source File
@@ -59,6 +59,117 @@ namespace CBDefs {
   const byte HVersion = 1; // Version alta
   const byte LVersion = 0; // Version baja
 
+  // Formato v2 de los ficheros de area base
+  // Nota: Tras el tipo de fichero, la version y el identificador del area
+  // (comunes a ambos formatos) se hallara la cabecera sAreaV2Header con la
+  // tabla de secciones. Cada seccion sera un array de registros de tamao
+  // fijo en little-endian, alineado a 4 bytes, que se podra usar en memoria
+  // tal cual se lea. Las referencias a cadenas seran offsets en la seccion
+  // de cadenas (terminadas en 0), siendo el offset 0 la cadena vacia.
+  const byte  AreaV2HVersion   = 2;          // Version alta del formato v2
+  const dword AreaV2HeaderPos  = 5;          // Offset de la cabecera v2
+  const dword AreaV2NoRecord   = 0xFFFFFFFF; // Referencia a registro nulo
+  const byte  AreaV2NoSlot     = 0xFF;       // Item no equipado
+
+  enum eAreaV2Section {
+	// Secciones del formato v2
+	AREAV2_STRINGS = 0,  // Cadenas (perfiles, tags y nombre del area)
+	AREAV2_CELLS,        // Celdas con contenido (sAreaV2Cell)
+	AREAV2_ROOFS,        // Techos (sAreaV2Roof)
+	AREAV2_ENTITIES,     // Obj. de escenario, criaturas y paredes (sAreaV2Entity)
+	AREAV2_ITEMS,        // Items (sAreaV2Item)
+	AREAV2_MAX_SECTIONS
+  };
+
+  enum eAreaV2EntityType {
+	// Tipos de entidad en la seccion AREAV2_ENTITIES
+	AREAV2_SCENE_OBJ = 1, // Objeto de escenario
+	AREAV2_CRIATURE,      // Criatura
+	AREAV2_WALL           // Pared
+  };
+
+  enum {
+	// Flags de las entidades
+	AREAV2_TMP_CRIATURE = 0x01, // Criatura temporal
+	AREAV2_BLOCK_ACCESS = 0x02  // Pared que bloquea el acceso
+  };
+
+  // Formato delta de los ficheros de area temporal
+  // Nota: Lo escribira el motor para areas cuyo archivo base sea v2. Tras
+  // la cabecera comun se hallaran el tamao del archivo de area base (dword)
+  // sobre el que se aplica y el numero de celdas (word). Por cada celda, en
+  // orden creciente de indice, su indice (word) seguido de sus datos en el
+  // formato de los ficheros temporales v1. El resto de celdas se tomaran del
+  // archivo de area base.
+  const byte AreaTmpDeltaHVersion = 3; // Version alta del formato delta
+
+// Obliga al compilador a que las estructuras las alinee en bytes
+#pragma pack(push, 1)
+
+  struct sAreaV2Section {
+	// Entrada de la tabla de secciones, 8 bytes
+	dword udOffset;     // Offset desde el comienzo del fichero
+	dword udNumRecords; // Num. de registros (bytes en la seccion de cadenas)
+  };
+
+  struct sAreaV2Header {
+	// Cabecera del formato v2, 12 bytes mas la tabla de secciones
+	dword          udName;       // Nombre del area (cadena)
+	word           uwWidth;      // Anchura
+	word           uwHeight;     // Altura
+	byte           AmbientLight; // Luz ambiente (GraphDefs::Light)
+	byte           ubPad;        // Relleno
+	word           uwNumRooms;   // Num. de habitaciones
+	sAreaV2Section Sections[AREAV2_MAX_SECTIONS]; // Tabla de secciones
+  };
+
+  struct sAreaV2Cell {
+	// Celda con contenido, 28 bytes
+	word  uwXTile;        // Posicion en x
+	word  uwYTile;        // Posicion en y
+	dword udFloorProfile; // Perfil del floor (cadena)
+	word  Elevation;      // Elevacion (RulesDefs::Elevation)
+	word  Room;           // Habitacion o 0 (AreaDefs::RoomID)
+	dword udRoof;         // Techo o AreaV2NoRecord
+	dword udFirstItem;    // Primer item sobre el suelo
+	dword udFirstEntity;  // Primera entidad
+	word  uwNumItems;     // Num. de items sobre el suelo
+	word  uwNumEntities;  // Num. de entidades
+  };
+
+  struct sAreaV2Roof {
+	// Techo, 8 bytes
+	dword udProfile;   // Perfil (cadena)
+	word  Elevation;   // Elevacion (RulesDefs::Elevation)
+	byte  ubShowUnder; // Muestra lo que tiene debajo?
+	byte  ubPad;       // Relleno
+  };
+
+  struct sAreaV2Entity {
+	// Objeto de escenario, criatura o pared, 20 bytes
+	dword udProfile;   // Perfil (cadena)
+	dword udTag;       // Tag (cadena)
+	dword udFirstItem; // Primer item contenido o equipado
+	word  uwNumItems;  // Num. de items contenidos o equipados
+	word  Elevation;   // Elevacion (RulesDefs::Elevation)
+	byte  ubType;      // Tipo (eAreaV2EntityType)
+	byte  ubFlags;     // Flags
+	byte  Light;       // Luz asociada (GraphDefs::Light)
+	byte  ubPad;       // Relleno
+  };
+
+  struct sAreaV2Item {
+	// Item, 12 bytes
+	dword udProfile; // Perfil (cadena)
+	dword udTag;     // Tag (cadena)
+	byte  Light;     // Luz asociada (GraphDefs::Light)
+	byte  ubSlot;    // Slot de equipamiento o AreaV2NoSlot
+	word  uwPad;     // Relleno
+  };
+
+// Se retorna a la alineacion de estructuras por defecto
+#pragma pack(pop)
+
 
   // Enumerados
   enum eFileTypes {
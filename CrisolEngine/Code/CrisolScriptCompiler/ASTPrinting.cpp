@@ -915,6 +915,10 @@ ASTPrintExp(const sExp* pExp,
 		  case WORLDOBJ_SETSCRIPTAT: {
 			fprintf(pOutputFile, "World.SetScriptAt(");
 		  } break;
+
+		  case WORLDOBJ_CALCULEBOUNDEDPATHLENGHT: {
+			fprintf(pOutputFile, "World.CalculeBoundedPathLenght(");
+		  } break;
 	  }; // ~ switch
 
   	    ASTPrintParams(pExp->ExpWorldObjInvoke.pParams, pOutputFile);
@@ -1315,6 +1315,10 @@ MakeWorldObjMethodCallOpcode(eExpWorldObjMethod Method,
 	  pNode->OpcodeType = OP_WORLDOBJ_SETSCRIPTAT;
 	} break;
 
+	case WORLDOBJ_CALCULEBOUNDEDPATHLENGHT: {
+	  pNode->OpcodeType = OP_WORLDOBJ_CALCULEBOUNDEDPATHLENGHT;
+	} break;
+
 	default:
 	  assert(0);
   }; // ~ switch
@@ -182,6 +182,7 @@ typedef struct sOpcode {
 	OP_WORLDOBJ_GETLIGHTAT,
 	OP_WORLDOBJ_PLAYWAVSOUND,
 	OP_WORLDOBJ_SETSCRIPTAT,
+	OP_WORLDOBJ_CALCULEBOUNDEDPATHLENGHT,
 							
 	// Opcodes asociados a los metodos entity
 	// 4000..4999
@@ -445,6 +446,7 @@ typedef enum {
   WORLDOBJ_GETLIGHTAT,
   WORLDOBJ_PLAYWAVSOUND,
   WORLDOBJ_SETSCRIPTAT,
+  WORLDOBJ_CALCULEBOUNDEDPATHLENGHT,
 } eExpWorldObjMethod;
 
 typedef enum {		
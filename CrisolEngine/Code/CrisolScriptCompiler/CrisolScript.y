@@ -124,6 +124,7 @@ extern sbyte*   szGlobalsFile;
 	   tCREATEITEMABANDONED tCREATEITEMWITHOWNER tSETWORLDTIMEPAUSE 
 	   tISWORLDTIMEINPAUSE tSETELEVATIONAT tGETELEVATIONAT 
 	   tNEXTTURN tGETLIGHTAT tPLAYWAVSOUND tSETSCRIPTAT
+	   tCALCULEBOUNDEDPATHLENGHT
 
  /* Objeto entity / metodos comunes */
 %token tGETNAME tSETNAME tGETTYPE tGETENTITYTYPE tSAY tSHUTUP tISSAYING tATTACHGFX 
@@ -956,6 +957,8 @@ worldobj_method_call:   tGETAREANAME '(' params ')'
 					    { $$ = MakeExpWorldObj(WORLDOBJ_PLAYWAVSOUND, $3); }
 					  | tSETSCRIPTAT '(' params ')'
 					    { $$ = MakeExpWorldObj(WORLDOBJ_SETSCRIPTAT, $3); }
+					  | tCALCULEBOUNDEDPATHLENGHT '(' params ')'
+					    { $$ = MakeExpWorldObj(WORLDOBJ_CALCULEBOUNDEDPATHLENGHT, $3); }
 ;
 
 entityobj_method_call:  tGETNAME '(' params ')'
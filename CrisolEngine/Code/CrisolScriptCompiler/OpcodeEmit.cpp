@@ -623,6 +623,10 @@ EmitOpcodeList(sOpcode* pOpList,
 	  case OP_WORLDOBJ_SETSCRIPTAT: {
 		fprintf(pFile, " world.set_script_at\n");
 	  } break;
+
+	  case OP_WORLDOBJ_CALCULEBOUNDEDPATHLENGHT: {
+		fprintf(pFile, " world.calcule_bounded_path_lenght\n");
+	  } break;
 	  
 	  case OP_ENTITYOBJ_GETNAME: {
 		fprintf(pFile, " entity.get_name\n");
@@ -1133,6 +1133,13 @@ FindStackSize(sOpcode* pOpList,
 		*punMaxStackSize = GetMax(unActStackSize, *punMaxStackSize);
 	  } break;
 
+	  case OP_WORLDOBJ_CALCULEBOUNDEDPATHLENGHT: {
+		// (NNNNN)N
+		unActStackSize -= 5;
+		unActStackSize += 1;
+		*punMaxStackSize = GetMax(unActStackSize, *punMaxStackSize);
+	  } break;
+
 	  // Nota: A partir de aqui se contabilizan la llamada a metodos de
 	  // entidades. En estos casos, siempre se pasara como primer parametro
 	  // y de forma invisible para el programador, el identificador de la
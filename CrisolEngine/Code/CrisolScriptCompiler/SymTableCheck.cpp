@@ -1005,6 +1005,9 @@ SymTableExpCheck(const sExp* pExp,
 
 		  case WORLDOBJ_SETSCRIPTAT: {
 		  } break;
+
+		  case WORLDOBJ_CALCULEBOUNDEDPATHLENGHT: {
+		  } break;
 		}; // ~ switch  	    
 	  } break;
 		
@@ -1961,6 +1961,12 @@ TypeCheckExp(sExp* pExp,
 			CheckArguments(pArgs, &pExp->ExpWorldObjInvoke.pParams, pExp->unSrcLine, szActFileName);
 			pExp->pExpType = pVoidAuxType;
 		  } break;
+
+		  case WORLDOBJ_CALCULEBOUNDEDPATHLENGHT: {
+			sType* pArgs[] = { pNumberAuxType, pNumberAuxType, pNumberAuxType, pNumberAuxType, pNumberAuxType, NULL	};
+			CheckArguments(pArgs, &pExp->ExpWorldObjInvoke.pParams, pExp->unSrcLine, szActFileName);
+			pExp->pExpType = pNumberAuxType;
+		  } break;
 		}; // ~ switch  	    
 	  } break;
 		
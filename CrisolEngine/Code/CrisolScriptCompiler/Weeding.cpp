@@ -834,6 +834,9 @@ WeedExp(sExp* pExp,
 
 		  case WORLDOBJ_SETSCRIPTAT: {
 		  } break;
+
+		  case WORLDOBJ_CALCULEBOUNDEDPATHLENGHT: {
+		  } break;
 		}; // ~ switch  	    
 	  } break;
 		
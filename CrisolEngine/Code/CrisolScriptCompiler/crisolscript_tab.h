@@ -239,107 +239,108 @@ typedef union {
 #define	tGETLIGHTAT	478
 #define	tPLAYWAVSOUND	479
 #define	tSETSCRIPTAT	480
-#define	tGETNAME	481
-#define	tSETNAME	482
-#define	tGETTYPE	483
-#define	tGETENTITYTYPE	484
-#define	tSAY	485
-#define	tSHUTUP	486
-#define	tISSAYING	487
-#define	tATTACHGFX	488
-#define	tRELEASEGFX	489
-#define	tRELEASEALLGFX	490
-#define	tISGFXATTACHED	491
-#define	tGETNUMITEMSINCONTAINER	492
-#define	tISITEMINCONTAINER	493
-#define	tTRANSFERITEMTOCONTAINER	494
-#define	tINSERTITEMINCONTAINER	495
-#define	tREMOVEITEMOFCONTAINER	496
-#define	tSETANIMTEMPLATESTATE	497
-#define	tSETPORTRAITANIMTEMPLATESTATE	498
-#define	tSETLIGHT	499
-#define	tGETLIGHT	500
-#define	tGETXPOS	501
-#define	tGETYPOS	502
-#define	tGETELEVATION	503
-#define	tSETELEVATION	504
-#define	tGETLOCALATTRIBUTE	505
-#define	tSETLOCALATTRIBUTE	506
-#define	tGETOWNER	507
-#define	tGETCLASS	508
-#define	tGETINCOMBATUSECOST	509
-#define	tGETGLOBALATTRIBUTE	510
-#define	tSETGLOBALATTRIBUTE	511
-#define	tGETWALLORIENTATION	512
-#define	tBLOCKACCESS	513
-#define	tUNBLOCKACCESS	514
-#define	tISACCESSBLOCKED	515
-#define	tSETSYMPTOM	516
-#define	tISSYMPTOMACTIVE	517
-#define	tGETGENRE	518
-#define	tGETHEALTH	519
-#define	tSETHEALTH	520
-#define	tGETEXTENDEDATTRIBUTE	521
-#define	tSETEXTENDEDATTRIBUTE	522
-#define	tGETLEVEL	523
-#define	tSETLEVEL	524
-#define	tGETEXPERIENCE	525
-#define	tSETEXPERIENCE	526
-#define	tGETACTIONPOINTS	527
-#define	tSETACTIONPOINTS	528
-#define	tISHABILITYACTIVE	529
-#define	tSETHABILITY	530
-#define	tUSEHABILITY	531
-#define	tISRUNMODEACTIVE	532
-#define	tSETRUNMODE	533
-#define	tMOVETO	534
-#define	tISMOVING	535
-#define	tSTOPMOVING	536
-#define	tEQUIPITEM	537
-#define	tREMOVEITEMEQUIPPED	538
-#define	tISITEMEQUIPPED	539
-#define	tDROPITEM	540
-#define	tUSEITEM	541
-#define	tMANIPULATE	542
-#define	tSETTRANSPARENTMODE	543
-#define	tISTRANSPARENTMODEACTIVE	544
-#define	tCHANGEANIMORIENTATION	545
-#define	tGETANIMORIENTATION	546
-#define	tSETALINGMENT	547
-#define	tSETALINGMENTWITH	548
-#define	tSETALINGMENTAGAINST	549
-#define	tGETALINGMENT	550
-#define	tHITENTITY	551
-#define	tGETITEMEQUIPPED	552
-#define	tGETINCOMBATACTIONPOINTS	553
-#define	tISGHOSTMOVEMODEACTIVE	554
-#define	tSETGHOSTMOVEMODE	555
-#define	tGETRANGE	556
-#define	tISINRANGE	557
-#define	tAPIPASSTORGBCOLOR	558
-#define	tAPIGETREDCOMPONENT	559
-#define	tAPIGETGREENCOMPONENT	560
-#define	tAPIGETBLUECOMPONENT	561
-#define	tAPIRAND	562
-#define	tAPIGETINTEGERVALUE	563
-#define	tAPIGETDECIMALVALUE	564
-#define	tAPIGETSTRINGSIZE	565
-#define	tAPIWRITETOLOGGER	566
-#define	tAPIENABLECRISOLSCRIPTWARNINGS	567
-#define	tAPIDISABLECRISOLSCRIPTWARNINGS	568
-#define	tAPISHOWFPS	569
-#define	tAPIWAIT	570
-#define	tNUMBER_VALUE	571
-#define	tSTRING_VALUE	572
-#define	tIDENTIFIER	573
-#define	IFX	574
-#define	tASSING	575
-#define	tOR	576
-#define	tAND	577
-#define	tEQ	578
-#define	tNEQ	579
-#define	tGEQ	580
-#define	tLEQ	581
+#define	tCALCULEBOUNDEDPATHLENGHT	481
+#define	tGETNAME	482
+#define	tSETNAME	483
+#define	tGETTYPE	484
+#define	tGETENTITYTYPE	485
+#define	tSAY	486
+#define	tSHUTUP	487
+#define	tISSAYING	488
+#define	tATTACHGFX	489
+#define	tRELEASEGFX	490
+#define	tRELEASEALLGFX	491
+#define	tISGFXATTACHED	492
+#define	tGETNUMITEMSINCONTAINER	493
+#define	tISITEMINCONTAINER	494
+#define	tTRANSFERITEMTOCONTAINER	495
+#define	tINSERTITEMINCONTAINER	496
+#define	tREMOVEITEMOFCONTAINER	497
+#define	tSETANIMTEMPLATESTATE	498
+#define	tSETPORTRAITANIMTEMPLATESTATE	499
+#define	tSETLIGHT	500
+#define	tGETLIGHT	501
+#define	tGETXPOS	502
+#define	tGETYPOS	503
+#define	tGETELEVATION	504
+#define	tSETELEVATION	505
+#define	tGETLOCALATTRIBUTE	506
+#define	tSETLOCALATTRIBUTE	507
+#define	tGETOWNER	508
+#define	tGETCLASS	509
+#define	tGETINCOMBATUSECOST	510
+#define	tGETGLOBALATTRIBUTE	511
+#define	tSETGLOBALATTRIBUTE	512
+#define	tGETWALLORIENTATION	513
+#define	tBLOCKACCESS	514
+#define	tUNBLOCKACCESS	515
+#define	tISACCESSBLOCKED	516
+#define	tSETSYMPTOM	517
+#define	tISSYMPTOMACTIVE	518
+#define	tGETGENRE	519
+#define	tGETHEALTH	520
+#define	tSETHEALTH	521
+#define	tGETEXTENDEDATTRIBUTE	522
+#define	tSETEXTENDEDATTRIBUTE	523
+#define	tGETLEVEL	524
+#define	tSETLEVEL	525
+#define	tGETEXPERIENCE	526
+#define	tSETEXPERIENCE	527
+#define	tGETACTIONPOINTS	528
+#define	tSETACTIONPOINTS	529
+#define	tISHABILITYACTIVE	530
+#define	tSETHABILITY	531
+#define	tUSEHABILITY	532
+#define	tISRUNMODEACTIVE	533
+#define	tSETRUNMODE	534
+#define	tMOVETO	535
+#define	tISMOVING	536
+#define	tSTOPMOVING	537
+#define	tEQUIPITEM	538
+#define	tREMOVEITEMEQUIPPED	539
+#define	tISITEMEQUIPPED	540
+#define	tDROPITEM	541
+#define	tUSEITEM	542
+#define	tMANIPULATE	543
+#define	tSETTRANSPARENTMODE	544
+#define	tISTRANSPARENTMODEACTIVE	545
+#define	tCHANGEANIMORIENTATION	546
+#define	tGETANIMORIENTATION	547
+#define	tSETALINGMENT	548
+#define	tSETALINGMENTWITH	549
+#define	tSETALINGMENTAGAINST	550
+#define	tGETALINGMENT	551
+#define	tHITENTITY	552
+#define	tGETITEMEQUIPPED	553
+#define	tGETINCOMBATACTIONPOINTS	554
+#define	tISGHOSTMOVEMODEACTIVE	555
+#define	tSETGHOSTMOVEMODE	556
+#define	tGETRANGE	557
+#define	tISINRANGE	558
+#define	tAPIPASSTORGBCOLOR	559
+#define	tAPIGETREDCOMPONENT	560
+#define	tAPIGETGREENCOMPONENT	561
+#define	tAPIGETBLUECOMPONENT	562
+#define	tAPIRAND	563
+#define	tAPIGETINTEGERVALUE	564
+#define	tAPIGETDECIMALVALUE	565
+#define	tAPIGETSTRINGSIZE	566
+#define	tAPIWRITETOLOGGER	567
+#define	tAPIENABLECRISOLSCRIPTWARNINGS	568
+#define	tAPIDISABLECRISOLSCRIPTWARNINGS	569
+#define	tAPISHOWFPS	570
+#define	tAPIWAIT	571
+#define	tNUMBER_VALUE	572
+#define	tSTRING_VALUE	573
+#define	tIDENTIFIER	574
+#define	IFX	575
+#define	tASSING	576
+#define	tOR	577
+#define	tAND	578
+#define	tEQ	579
+#define	tNEQ	580
+#define	tGEQ	581
+#define	tLEQ	582
 
 
 extern YYSTYPE yylval;
@@ -281,291 +281,292 @@ static void yy_fatal_error YY_PROTO(( yyconst char msg[] ));
 	*yy_cp = '\0'; \
 	yy_c_buf_p = yy_cp;
 
-#define YY_NUM_RULES 349
-#define YY_END_OF_BUFFER 350
-static yyconst short int yy_accept[2554] =
+#define YY_NUM_RULES 350
+#define YY_END_OF_BUFFER 351
+static yyconst short int yy_accept[2571] =
     {   0,
-        0,    0,    5,    5,  350,  348,    7,    9,  333,  348,
-      338,  348,  339,  340,  336,  334,  341,  335,  343,  337,
-      344,  348,  342,  331,  348,  332,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  348,
-        5,    1,    6,    6,    7,  328,    0,  346,  324,    8,
-       10,    0,  344,  326,  330,  327,  329,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-       30,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,   22,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  325,    5,    2,    3,
-        4,   10,  345,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,   29,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,   26,  347,  347,  347,  347,  347,  132,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,   13,  347,  347,  347,  347,  347,    4,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,   23,  347,  347,  347,  347,  347,   14,   65,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  218,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,   31,  347,  220,  347,  347,
-      347,   21,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,   28,  347,
-      347,  347,  347,   12,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  219,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  257,  258,  259,  260,
-      261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
-      271,  272,  273,  274,  275,  276,  277,  278,  279,  280,
-      281,  282,  283,  284,  285,  286,  287,  288,  289,  290,
-      291,  292,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,   24,   88,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,   20,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,   11,  347,   17,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  245,  246,  247,
-      248,  249,  250,  251,  252,  253,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  320,  347,
-      347,  347,  182,  347,  347,  347,  347,  347,   18,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,   25,  347,   16,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      133,  347,  347,  347,  347,  347,  347,   19,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  209,  347,  217,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,   15,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,   93,  347,  347,  347,  347,  347,
-      347,  128,  347,  347,  347,  347,  347,  130,  347,  148,
-      149,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      301,  347,  347,  347,  347,  244,  254,  255,  256,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  294,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,   48,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,   95,  347,  347,  347,  347,
-      347,  129,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  190,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  189,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,   27,  347,  347,
-      347,  347,  347,  347,  347,  347,  155,  347,  347,  347,
-      347,  347,  347,  347,  165,  347,  347,  347,  347,  347,
-      170,  147,  347,  347,  347,  347,  154,  347,  203,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      140,  347,  183,  347,  134,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  293,  347,  321,  347,  347,  323,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  103,  347,  124,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,   66,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  171,  146,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  135,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  108,  347,  347,  347,  347,  347,  347,  347,  185,
-      347,  347,  347,  347,   90,  347,  347,  347,  347,  347,
-      347,  347,   97,  347,  347,  347,  166,  347,   64,  347,
-      347,  347,   94,  347,  347,   98,  347,  200,  347,  347,
-      347,  347,  347,  347,  347,  204,  347,  347,  347,  347,
-      347,  347,  310,  311,  312,  313,  314,  315,  316,  317,
-      318,  319,  347,  302,  305,  347,  347,  347,  347,  347,
-      347,  347,  304,  347,  322,  347,  296,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,   43,  347,  347,  347,  347,   38,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,   60,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      167,  347,  347,   96,  347,  347,   63,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  216,  347,  347,  234,  347,  347,  347,  347,  347,
-      347,  347,  347,  116,  347,  347,  347,  347,  347,  347,
-
-      238,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  125,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  303,  347,  299,  347,  347,  347,  295,  300,  347,
-      191,  347,  347,  347,  347,  347,  347,  347,  347,   44,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  136,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  181,  347,  163,  347,  347,  347,  347,  347,
-      347,  347,  184,  347,  235,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  160,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,   86,  347,  240,  347,  347,  239,  347,
-      347,  347,  347,  347,   89,  347,  347,  347,  101,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  307,  308,  347,  347,  309,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,   55,  347,  347,  347,  347,  347,
-       49,  347,  347,  347,   32,  347,   61,  347,   40,  347,
-      347,  347,  347,  347,  143,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  178,  347,  347,  347,
-      127,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  179,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  199,  347,  347,  347,   91,  110,  347,  150,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  142,  347,  347,   99,  347,  347,  347,  347,   87,
-      347,  347,  347,  347,  297,  347,  298,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-       59,   34,  347,   35,  347,  347,  347,   41,  347,  347,
-      347,  347,  347,  347,  347,  126,  347,  347,  347,  347,
-      347,  196,  347,  151,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,   85,  347,  347,  347,  347,
-      347,  347,  347,  347,  114,  347,  347,  236,  347,  347,
-      347,   92,  347,  347,  347,  131,  172,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  138,
-      347,  347,  347,  347,  347,  347,  347,  306,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,   39,
-      347,  347,  347,  347,  347,  347,  347,  347,   52,  347,
-       74,  347,  137,  347,  347,  347,  347,  347,  347,  347,
-      347,  173,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,   75,  347,  347,  347,  347,  347,
-      161,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  115,  347,  347,  347,  347,
-      225,  347,  347,  347,  347,  347,  347,  123,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  188,  347,  347,  347,  347,  222,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,   46,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  122,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  229,   67,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  175,  347,  347,  347,  347,
-      347,  347,  347,  187,  347,  347,  347,  347,  347,  162,
-      347,  347,  347,  180,  164,  347,  347,  347,  223,  347,
-      347,  347,  347,  347,  347,  347,   37,   62,  347,  347,
-       45,  347,   42,  347,  347,  347,  347,  347,  347,  347,
-      221,  176,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  227,  347,  347,  347,  347,  347,
-      242,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  212,  347,  213,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      237,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  177,  347,  347,  347,  347,
-      347,  347,   33,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  197,  347,  347,
-      202,  347,  347,  347,  347,  347,  347,   84,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  205,
-      347,  347,  102,  347,  347,  347,  347,  347,  347,  347,
-      347,  112,  347,  347,  347,  347,  347,  152,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,   57,  347,  347,  347,  347,  347,   36,   56,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  113,  153,
-      347,  347,  120,  347,  347,  347,  243,  347,  347,   68,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      211,  347,  210,  206,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  195,  347,  347,  157,  347,  156,  347,
-
-      100,  139,  347,  159,  107,  347,  347,  121,  347,  347,
-      347,   53,  347,  347,  347,   47,  347,  347,  347,  186,
-      347,  347,  347,  347,  347,  158,  347,  192,  347,  347,
-      347,  241,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  208,  347,  347,  347,  347,  347,  118,  119,
-      117,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      231,  224,  230,  347,  347,  347,  347,  347,   76,  347,
-      347,  198,  347,  347,  347,  226,  228,   77,  347,  347,
-       69,  347,  347,  347,  347,  347,  347,  347,  207,  105,
-      347,  347,  104,  347,  347,  347,  168,  347,  347,  347,
-
-      347,  347,   58,   54,  347,  347,  347,  347,  347,  144,
-      169,  347,  141,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  194,  347,  347,  347,  347,  111,  347,  201,
-      347,  347,  347,  347,  347,  347,  347,  347,   70,  347,
-      347,  347,  347,  347,  347,  106,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  109,  174,  347,
-      193,   50,  347,  232,  347,  347,  347,  347,   73,   78,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,   81,  347,  347,  347,  347,  347,  347,  347,   51,
-
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  347,  347,  347,   82,  233,  347,
-      347,  347,  145,  347,   71,  347,  214,  347,  347,  347,
-       79,  215,  347,  347,  347,  347,  347,  347,   83,  347,
-       72,   80,    0
+        0,    0,    5,    5,  351,  349,    7,    9,  334,  349,
+      339,  349,  340,  341,  337,  335,  342,  336,  344,  338,
+      345,  349,  343,  332,  349,  333,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  349,
+        5,    1,    6,    6,    7,  329,    0,  347,  325,    8,
+       10,    0,  345,  327,  331,  328,  330,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+       30,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,   22,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  326,    5,    2,    3,
+        4,   10,  346,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,   29,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,   26,  348,  348,  348,  348,  348,  133,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,   13,  348,  348,  348,  348,  348,    4,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,   23,  348,  348,  348,  348,  348,   14,   65,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  219,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,   31,  348,  221,  348,  348,
+      348,   21,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,   28,  348,
+      348,  348,  348,   12,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  220,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  258,  259,  260,  261,
+      262,  263,  264,  265,  266,  267,  268,  269,  270,  271,
+      272,  273,  274,  275,  276,  277,  278,  279,  280,  281,
+      282,  283,  284,  285,  286,  287,  288,  289,  290,  291,
+      292,  293,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,   24,   88,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,   20,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,   11,  348,   17,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  246,  247,  248,
+      249,  250,  251,  252,  253,  254,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  321,  348,
+      348,  348,  183,  348,  348,  348,  348,  348,   18,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,   25,  348,   16,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      134,  348,  348,  348,  348,  348,  348,   19,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  210,  348,  218,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,   15,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,   93,  348,  348,  348,  348,  348,
+      348,  129,  348,  348,  348,  348,  348,  131,  348,  149,
+      150,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      302,  348,  348,  348,  348,  245,  255,  256,  257,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  295,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,   48,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,   95,  348,  348,  348,  348,
+      348,  130,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  191,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  190,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,   27,  348,
+      348,  348,  348,  348,  348,  348,  348,  156,  348,  348,
+      348,  348,  348,  348,  348,  166,  348,  348,  348,  348,
+      348,  171,  148,  348,  348,  348,  348,  155,  348,  204,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  141,  348,  184,  348,  135,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  294,  348,  322,  348,  348,  324,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  103,  348,
+
+      124,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,   66,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  172,  147,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  136,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  108,  348,  348,  348,  348,  348,  348,
+      348,  186,  348,  348,  348,  348,   90,  348,  348,  348,
+      348,  348,  348,  348,   97,  348,  348,  348,  167,  348,
+       64,  348,  348,  348,   94,  348,  348,   98,  348,  201,
+      348,  348,  348,  348,  348,  348,  348,  205,  348,  348,
+      348,  348,  348,  348,  311,  312,  313,  314,  315,  316,
+      317,  318,  319,  320,  348,  303,  306,  348,  348,  348,
+      348,  348,  348,  348,  305,  348,  323,  348,  297,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,   43,  348,  348,  348,  348,
+       38,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,   60,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  168,  348,  348,   96,  348,  348,   63,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  217,  348,  348,  235,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  116,  348,  348,  348,
+
+      348,  348,  348,  239,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  125,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  304,  348,  300,  348,  348,  348,
+      296,  301,  348,  192,  348,  348,  348,  348,  348,  348,
+      348,  348,   44,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  137,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  182,  348,  164,  348,  348,
+      348,  348,  348,  348,  348,  185,  348,  236,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  161,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,   86,  348,  241,
+      348,  348,  240,  348,  348,  348,  348,  348,   89,  348,
+      348,  348,  101,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  308,  309,  348,
+
+      348,  310,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,   55,  348,
+      348,  348,  348,  348,   49,  348,  348,  348,   32,  348,
+       61,  348,   40,  348,  348,  348,  348,  348,  144,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      179,  348,  348,  348,  127,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  180,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  200,  348,  348,  348,
+       91,  110,  348,  151,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  143,  348,  348,   99,
+      348,  348,  348,  348,   87,  348,  348,  348,  348,  298,
+      348,  299,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,   59,   34,  348,   35,  348,
+      348,  348,   41,  348,  348,  348,  348,  348,  348,  348,
+      126,  348,  348,  348,  348,  348,  197,  348,  152,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+       85,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      114,  348,  348,  237,  348,  348,  348,   92,  348,  348,
+      348,  132,  173,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  139,  348,  348,  348,  348,
+      348,  348,  348,  307,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,   39,  348,  348,  348,  348,
+      348,  348,  348,  348,   52,  348,   74,  348,  138,  348,
+      348,  348,  348,  348,  348,  348,  348,  174,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+       75,  348,  348,  348,  348,  348,  162,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  115,  348,  348,  348,  348,  226,  348,  348,
+      348,  348,  348,  348,  123,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  189,
+      348,  348,  348,  348,  223,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,   46,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  122,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  230,   67,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  176,  348,  348,  348,  348,  348,  348,
+      348,  188,  348,  348,  348,  348,  348,  163,  348,  348,
+      348,  181,  165,  348,  348,  348,  224,  348,  348,  348,
+      348,  348,  348,  348,   37,   62,  348,  348,   45,  348,
+       42,  348,  348,  348,  348,  348,  348,  348,  222,  177,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  228,  348,  348,  348,  348,  348,  243,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  213,  348,  214,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  238,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  178,  348,  348,  348,  348,  348,
+      348,   33,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  198,  348,  348,  203,
+      348,  348,  348,  348,  348,  348,   84,  348,  348,  348,
+
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  206,  348,
+      348,  348,  102,  348,  348,  348,  348,  348,  348,  348,
+      348,  112,  348,  348,  348,  348,  348,  153,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,   57,  348,  348,  348,  348,  348,   36,   56,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  113,  154,
+      348,  348,  120,  348,  348,  348,  244,  348,  348,   68,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      212,  348,  211,  207,  348,  348,  348,  348,  348,  348,
+
+      348,  348,  348,  348,  196,  348,  348,  158,  348,  157,
+      348,  100,  140,  348,  160,  107,  348,  348,  121,  348,
+      348,  348,   53,  348,  348,  348,   47,  348,  348,  348,
+      187,  348,  348,  348,  348,  348,  159,  348,  193,  348,
+      348,  348,  242,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  209,  348,  348,  348,  348,  348,  348,
+      118,  119,  117,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  232,  225,  231,  348,  348,  348,  348,  348,
+       76,  348,  348,  199,  348,  348,  348,  227,  229,   77,
+      348,  348,   69,  348,  348,  348,  348,  348,  348,  348,
+
+      208,  105,  348,  348,  348,  104,  348,  348,  348,  169,
+      348,  348,  348,  348,  348,   58,   54,  348,  348,  348,
+      348,  348,  145,  170,  348,  142,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  195,  348,  348,  348,
+      348,  111,  348,  202,  348,  348,  348,  348,  348,  348,
+      348,  348,   70,  348,  348,  348,  348,  348,  348,  106,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  109,  175,  348,  194,   50,  348,  233,
+      348,  348,  348,  348,   73,   78,  348,  348,  348,  348,
+
+      128,  348,  348,  348,  348,  348,  348,  348,   81,  348,
+      348,  348,  348,  348,  348,  348,   51,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,   82,  234,  348,  348,  348,  146,
+      348,   71,  348,  215,  348,  348,  348,   79,  216,  348,
+      348,  348,  348,  348,  348,   83,  348,   72,   80,    0
     } ;
 
 static yyconst int yy_ec[256] =
@@ -610,80 +611,80 @@ static yyconst int yy_meta[59] =
         6,    6,    6,    6,    6,    6,    6,    1
     } ;
 
-static yyconst short int yy_base[2562] =
+static yyconst short int yy_base[2579] =
     {   0,
-        0,    0,   56,   57, 2591, 2592, 2588, 2592, 2560, 2583,
-     2592, 2580, 2592, 2592, 2592, 2592, 2592, 2592, 2592,   53,
-     2572, 2556, 2592, 2555, 2554, 2553,    0,   27,   33,   38,
-       37,   47,   48,   53, 2541,   54, 2544,   57,   56,   61,
-     2534, 2535, 2525,   65,   76,   70,   66,   82,   84, 2518,
-        0, 2592, 2560,  111, 2572, 2592, 2568, 2592, 2592, 2592,
-        0,    0, 2558, 2592, 2592, 2592, 2592,    0, 2520, 2535,
-     2529, 2517, 2517, 2528, 2519, 2521, 2531,   37, 2526, 2511,
-        0, 2514, 2509, 2508,   89, 2505, 2513, 2510, 2510, 2502,
-     2506, 2500,    0, 2503, 2499,  109, 2492, 2510, 2514, 2500,
-
-     2491, 2488,   86,   88,  132, 2510, 2501,  148, 2502, 2483,
-     2489, 2486,   90, 2484,   88,   20, 2499,   86, 2501, 2497,
-     2483, 2491, 2480, 2489, 2479, 2487, 2592,    0, 2592, 2592,
-        0,    0,    0, 2486, 2479,  158, 2492, 2487, 2482, 2487,
-     2486, 2474, 2471, 2467, 2484,  122, 2468, 2463, 2477, 2478,
-     2467, 2470, 2469, 2458, 2473, 2470,  181, 2472, 2468, 2457,
-     2466, 2467, 2454, 2456,  113, 2466,   94, 2461, 2450, 2443,
-      123, 2445, 2447, 2461, 2440, 2455, 2449, 2452, 2436, 2452,
-     2434, 2441, 2450, 2448,  113,  108, 2436, 2437, 2443, 2438,
-     2432, 2440, 2443, 2438, 2440, 2436,  129,  155, 2421, 2424,
-
-     2413, 2417,    0, 2431, 2420, 2429, 2412, 2424,    0, 2422,
-      206, 2407, 2409, 2408, 2411, 2417, 2409, 2404, 2409, 2408,
-     2416, 2408,  149,    0, 2415, 2398, 2405, 2404, 2395,    0,
-     2392, 2397, 2403, 2397, 2405, 2408, 2407, 2399,  165, 2403,
-     2405, 2390, 2392, 2381, 2394, 2391, 2379, 2378, 2394, 2378,
-     2386, 2394,    0,  149, 2368, 2372, 2375, 2385, 2369,    0,
-      209,  157, 2379,  186,  166,  187,  189,  223, 2378,  158,
-      164, 2374, 2384, 2359, 2382, 2366, 2365, 2379, 2365, 2360,
-     2359, 2373, 2362, 2359, 2349, 2357, 2369, 2352, 2364, 2343,
-     2345, 2352, 2340, 2351, 2362, 2344,  254, 2361, 2359, 2343,
-
-     2338, 2337, 2341, 2347,    0, 2349, 2333, 2343, 2342, 2349,
-     2334,  213, 2343, 2327, 2326, 2326, 2319, 2329, 2319, 2322,
-      217, 2320, 2338, 2326, 2336, 2331, 2317,  276, 2327, 2332,
-     2310, 2311, 2312, 2309, 2312,  279,  225,  223,  282, 2323,
-      279, 2317, 2324, 2309, 2302,  282, 2304, 2306, 2304, 2298,
-     2310,  273, 2303, 2316, 2315,    0, 2295,    0, 2298, 2311,
-     2291,    0, 2310, 2304, 2304, 2302, 2301, 2285, 2285, 2302,
-     2282, 2282, 2286, 2284, 2289, 2288, 2288, 2273, 2291, 2292,
-     2280, 2286, 2278,    0, 2284, 2268, 2272, 2266, 2281, 2271,
-     2263, 2266, 2256, 2271,    0, 2270, 2258, 2268, 2267, 2270,
-
-     2273, 2260, 2263, 2252, 2265, 2249,  282, 2254, 2252, 2265,
-     2244, 2261, 2258, 2240, 2254, 2257, 2245, 2245, 2244, 2236,
-     2241, 2253, 2239, 2236, 2239, 2235, 2234, 2236, 2227, 2226,
-     2225, 2239, 2241, 2227, 2240, 2221, 2230, 2237, 2224, 2220,
-     2226, 2221, 2224, 2216, 2217, 2218, 2229, 2228, 2227, 2226,
-     2225, 2224, 2223, 2222, 2221, 2220,  288, 2218,    0,  286,
-     2199,  325,    0,    0, 2203,    0,    0,  301,  300,    0,
-        0,    0,    0,  319, 2200, 2214, 2198,    0,    0,    0,
-        0,    0, 2205, 2194, 2190, 2195, 2188, 2195,  303, 2189,
-     2197, 2202, 2203,  188, 2187, 2199,  318, 2196, 2191, 2194,
-
-     2193, 2181, 2187, 2187, 2189, 2178, 2171,  316, 2173, 2179,
-     2185,  242, 2176, 2169, 2177, 2184, 2183, 2164, 2177, 2166,
-     2166, 2179, 2158, 2157, 2167, 2166, 2169,  313, 2158, 2157,
-     2169, 2169, 2148, 2156, 2145, 2159, 2162, 2150, 2150, 2144,
-     2147, 2142, 2146, 2157, 2139, 2138, 2139,  330,  325, 2153,
-     2146, 2130,  324, 2145, 2147, 2147, 2143, 2143,    0,    0,
-     2126,  338, 2136, 2143, 2141,  342, 2123, 2137, 2117, 2119,
-     2118,  340, 2136, 2115, 2132, 2129,  347, 2128,  347, 2123,
-     2106, 2125, 2120, 2126, 2108, 2114, 2125, 2104, 2108, 2113,
-     2107, 2107, 2118, 2099, 2115, 2115, 2095, 2092, 2104, 2107,
-
-     2106, 2092, 2107, 2096, 2089, 2091, 2092, 2099, 2095, 2101,
-     2080, 2095, 2097, 2089, 2092, 2071, 2088, 2089, 2081, 2073,
-     2072,    0, 2081,    0, 2080, 2069, 2086, 2068, 2065, 2064,
-     2071, 2068,  354, 2063, 2066, 2064, 2064, 2057, 2057, 2071,
-     2058, 2057, 2056, 2055, 2054, 2053, 2052, 2051, 2050, 2049,
-     2056, 2034, 2033,   60,   76,  107,  141,  382,    0,    0,
+        0,    0,   56,   57, 2608, 2609, 2605, 2609, 2577, 2600,
+     2609, 2597, 2609, 2609, 2609, 2609, 2609, 2609, 2609,   53,
+     2589, 2573, 2609, 2572, 2571, 2570,    0,   27,   33,   38,
+       37,   47,   48,   53, 2558,   54, 2561,   57,   56,   61,
+     2551, 2552, 2542,   65,   76,   70,   66,   82,   84, 2535,
+        0, 2609, 2577,  111, 2589, 2609, 2585, 2609, 2609, 2609,
+        0,    0, 2575, 2609, 2609, 2609, 2609,    0, 2537, 2552,
+     2546, 2534, 2534, 2545, 2536, 2538, 2548,   37, 2543, 2528,
+        0, 2531, 2526, 2525,   89, 2522, 2530, 2527, 2527, 2519,
+     2523, 2517,    0, 2520, 2516,  109, 2509, 2527, 2531, 2517,
+
+     2508, 2505,   86,   88,  132, 2527, 2518,  148, 2519, 2500,
+     2506, 2503,   90, 2501,   88,   20, 2516,   86, 2518, 2514,
+     2500, 2508, 2497, 2506, 2496, 2504, 2609,    0, 2609, 2609,
+        0,    0,    0, 2503, 2496,  158, 2509, 2504, 2499, 2504,
+     2503, 2491, 2488, 2484, 2501,  122, 2485, 2480, 2494, 2495,
+     2484, 2487, 2486, 2475, 2490, 2487,  181, 2489, 2485, 2474,
+     2483, 2484, 2471, 2473,  113, 2483,   94, 2478, 2467, 2460,
+      123, 2462, 2464, 2478, 2457, 2472, 2466, 2469, 2453, 2469,
+     2451, 2458, 2467, 2465,  113,  108, 2453, 2454, 2460, 2455,
+     2449, 2457, 2460, 2455, 2457, 2453,  129,  155, 2438, 2441,
+
+     2430, 2434,    0, 2448, 2437, 2446, 2429, 2441,    0, 2439,
+      206, 2424, 2426, 2425, 2428, 2434, 2426, 2421, 2426, 2425,
+     2433, 2425,  149,    0, 2432, 2415, 2422, 2421, 2412,    0,
+     2409, 2414, 2420, 2414, 2422, 2425, 2424, 2416,  165, 2420,
+     2422, 2407, 2409, 2398, 2411, 2408, 2396, 2395, 2411, 2395,
+     2403, 2411,    0,  149, 2385, 2389, 2392, 2402, 2386,    0,
+      209,  157, 2396,  186,  166,  187,  189,  223, 2395,  158,
+      164, 2391, 2401, 2376, 2399, 2383, 2382, 2396, 2382, 2377,
+     2376, 2390, 2379, 2376, 2366, 2374, 2386, 2369, 2381, 2360,
+     2362, 2369, 2357, 2368, 2379, 2361,  254, 2378, 2376, 2360,
+
+     2355, 2354, 2358, 2364,    0, 2366, 2350, 2360, 2359, 2366,
+     2351,  213, 2360, 2344, 2343, 2343, 2336, 2346, 2336, 2339,
+      217, 2337, 2355, 2343, 2353, 2348, 2334,  276, 2344, 2349,
+     2327, 2328, 2329, 2326, 2329,  279,  225,  223,  282, 2340,
+      279, 2334, 2341, 2326, 2319,  282, 2321, 2323, 2321, 2315,
+     2327,  273, 2320, 2333, 2332,    0, 2312,    0, 2315, 2328,
+     2308,    0, 2327, 2321, 2321, 2319, 2318, 2302, 2302, 2319,
+     2299, 2299, 2303, 2301, 2306, 2305, 2305, 2290, 2308, 2309,
+     2297, 2303, 2295,    0, 2301, 2285, 2289, 2283, 2298, 2288,
+     2280, 2283, 2273, 2288,    0, 2287, 2275, 2285, 2284, 2287,
+
+     2290, 2277, 2280, 2269, 2282, 2266,  282, 2271, 2269, 2282,
+     2261, 2278, 2275, 2257, 2271, 2274, 2262, 2262, 2261, 2253,
+     2258, 2270, 2256, 2253, 2256, 2252, 2251, 2253, 2244, 2243,
+     2242, 2256, 2258, 2244, 2257, 2238, 2247, 2254, 2241, 2237,
+     2243, 2238, 2241, 2233, 2234, 2235, 2246, 2245, 2244, 2243,
+     2242, 2241, 2240, 2239, 2238, 2237,  288, 2235,    0,  286,
+     2216,  325,    0,    0, 2220,    0,    0,  301,  300,    0,
+        0,    0,    0,  319, 2217, 2231, 2215,    0,    0,    0,
+        0,    0, 2222, 2211, 2207, 2212, 2205, 2212,  303, 2206,
+     2214, 2219, 2220,  188, 2204, 2216,  318, 2213, 2208, 2211,
+
+     2210, 2198, 2204, 2204, 2206, 2195, 2188,  316, 2190, 2196,
+     2202,  242, 2193, 2186, 2194, 2201, 2200, 2181, 2194, 2183,
+     2183, 2196, 2175, 2174, 2184, 2183, 2186,  313, 2175, 2174,
+     2186, 2186, 2165, 2173, 2162, 2176, 2179, 2167, 2167, 2161,
+     2164, 2159, 2163, 2174, 2156, 2155, 2156,  330,  325, 2170,
+     2163, 2147,  324, 2162, 2164, 2164, 2160, 2160,    0,    0,
+     2143,  338, 2153, 2160, 2158,  342, 2140, 2154, 2134, 2136,
+     2135,  340, 2153, 2132, 2149, 2146,  347, 2145,  347, 2140,
+     2123, 2142, 2137, 2143, 2125, 2131, 2142, 2121, 2125, 2130,
+     2124, 2124, 2135, 2116, 2132, 2132, 2112, 2109, 2121, 2124,
+
+     2123, 2109, 2124, 2113, 2106, 2108, 2109, 2116, 2112, 2118,
+     2097, 2112, 2114, 2106, 2109, 2088, 2105, 2106, 2098, 2090,
+     2089,    0, 2098,    0, 2097, 2086, 2103, 2085, 2082, 2081,
+     2088, 2085,  354, 2080, 2083, 2081, 2081, 2074, 2074, 2088,
+     2075, 2074, 2073, 2072, 2071, 2070, 2069, 2068, 2067, 2066,
+     2073, 2051, 2050,   60,   76,  107,  141,  382,    0,    0,
         0,    0,    0,    0,    0,    0,  197,  219,  246,  245,
       276,  293,  317,  355,  330,  346,  356,  360,    0,  363,
       360,  360,    0,  355,  372,  372,  376,  373,    0,  357,
@@ -698,491 +699,493 @@ static yyconst short int yy_base[2562] =
       437,  431,  443,  438,  441,  438,  443,  438,  450,  440,
       435,  452,  443,  457,  448,  449,  457,  445,  450,  460,
       446,  447,    0,  462,    0,  464,  470,  466,  461,  454,
-      472,  460,  463,  464,    0,  461,  460,  478,  481,  461,
-
-      479,  472,  468,  486,  485,  488,  481,  486,  478,  478,
-      487,  481,  493,  479,  498,  483,  505,  507,  489,  492,
-      497,  507,  512,  494,    0,  502,  516,  506,  499,  508,
-      502,    0,  518,  509,  507,  521,  522,    0,  513,    0,
-        0,  509,  510,  512,  512,  511,  514,  522,  527,  530,
-      521,  525,  535,  534,  538,  536,  529,  529,  526,  546,
-      547,  548,  549,  550,  551,  552,  553,  554,  555,  557,
-      551,  558,  549,  561,  548,    0,    0,    0,    0,  558,
-      550,  545,  557,  546,  568,  555,  569,  550,  564,  564,
-      571,    0,  561,  575,  576,  564,  578,  571,  562,  563,
-
-      582,  576,  564,  577,    0,  567,  575,  580,  565,  576,
-      587,  573,  574,  590,  575,  576,  576,  594,  582,  595,
-      582,  600,  589,  596,  604,  603,  600,  607,  602,  611,
-      608,  613,  595,  596,  616,  603,  612,  601,  622,  606,
-      611,  606,  626,  616,  609,    0,  612,  620,  613,  622,
-      615,    0,  618,  622,  622,  619,  621,  637,  623,  634,
-      625,  626,  637,  638,  647,  637,  644,  644,  652,  635,
-      653,  643,    0,  638,  654,  636,  645,  655,  637,  661,
-      649,  652,  660,  645,  664,  663,  649,  666,  653,  657,
-      657,  654,  662,  652,  656,  659,  674,  679,  672,  662,
-
-      674,  679,  680,  674,  682,  674,    0,  684,  670,  686,
-      667,  673,  678,  683,  693,  696,  685,    0,  685,  687,
-      683,  697,  699,  695,  704,  697,    0,  687,  687,  695,
-      690,  686,  703,  709,    0,  702,  707,  714,  697,  701,
-        0,  718,  719,  716,  704,  709,    0,  706,    0,  707,
-      701,  722,  726,  716,  729,  730,  717,  713,  729,  714,
-        0,  717,    0,  732,    0,  725,  738,  731,  737,  738,
-      739,  740,  741,  742,  743,  744,  745,  746,  735,  734,
-      746,    0,  738,    0,  737,  736,    0,  751,  739,  743,
-      740,  754,  744,  743,  758,  760,  762,    0,  747,    0,
-
-      748,  751,  750,  751,  752,  758,  756,  753,  771,  775,
-      764,  776,  767,  768,  773,  774,  765,  774,  769,  783,
-      783,  785,  779,  777,  778,  793,  790,  776,  788,  785,
-      795,  785,  788,  789,  788,    0,  792,  799,  786,  802,
-      799,  795,  796,  798,  807,  793,  805,  811,  803,  805,
-      809,  811,  817,    0,    0,  820,  817,  822,  820,  805,
-      811,  811,  808,  824,  812,  811,  812,  820,  820,  822,
-      815,  817,  830,  829,  831,  838,  833,  838,  829,  836,
-      824,  828,  828,  845,  830,  846,  849,  848,  845,  850,
-      851,  854,  849,  841,  841,  846,  857,    0,  858,  861,
-
-      846,  846,  854,  859,  868,  857,  857,  860,  870,  854,
-      872,    0,  862,  872,  873,  876,  879,  876,  870,    0,
-      867,  879,  876,  877,    0,  880,  875,  885,  889,  873,
-      889,  884,  874,  890,  891,  896,    0,  897,    0,  878,
-      880,  881,    0,  887,  897,    0,  895,    0,  892,  894,
-      892,  896,  906,  888,  886,    0,  903,  894,  913,  914,
-      898,  904,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  917,    0,    0,  918,  900,  903,  902,  923,
-      923,  907,    0,  912,    0,  907,    0,  928,  924,  930,
-      926,  932,  933,  929,  914,  931,  936,  925,  938,  939,
-
-      923,  938,  941,    0,  924,  931,  927,  946,    0,  943,
-      931,  947,  936,  946,  940,  941,  941,  951,  945,    0,
-      946,  946,  939,  959,  941,  951,  940,  960,  953,  952,
-      964,  953,  965,  958,  963,  968,  969,  960,  975,  957,
-        0,  960,  959,    0,  971,  976,  981,  970,  983,  976,
-      972,  982,  988,  989,  969,  984,  990,  988,  994,  975,
-      975,  977,  995,  979,  997,  987,  999,  998,  984,  987,
-     1002,  993, 1006,  992, 1008,  999,  999, 1007, 1000, 1002,
-     1010,    0, 1006, 1001,    0, 1015, 1002, 1014, 1008, 1004,
-     1005, 1025, 1026,    0, 1013, 1020, 1010, 1026, 1014, 1020,
-
-        0, 1009, 1021, 1024, 1022, 1024, 1034, 1033, 1033, 1037,
-     1023, 1030, 1040, 1041, 1032, 1024, 1036, 1047, 1032, 1033,
-     1045,    0, 1035, 1050, 1039, 1053, 1050, 1045, 1057, 1053,
-     1055, 1059, 1064, 1050, 1062, 1065, 1066, 1065, 1066, 1068,
-     1069,    0, 1059,    0, 1059, 1072, 1062,    0,    0, 1059,
-        0, 1078, 1077, 1077, 1078, 1079, 1066, 1076, 1066,    0,
-     1067, 1070, 1084, 1078, 1091, 1068, 1089, 1090, 1076, 1083,
-     1083, 1079, 1085, 1095, 1100, 1098, 1084, 1092, 1097, 1102,
-     1106, 1090, 1101, 1097, 1105,    0, 1100, 1109, 1101, 1116,
-     1102, 1104, 1103, 1105, 1107, 1118, 1101, 1104, 1100, 1117,
-
-     1107, 1108,    0, 1109,    0, 1112, 1118, 1112, 1130, 1130,
-     1131, 1117,    0, 1128,    0, 1128, 1139, 1121, 1136, 1137,
-     1118, 1124, 1126, 1141, 1129, 1139, 1144, 1145, 1142, 1149,
-     1135, 1145, 1140, 1155, 1154, 1153, 1146, 1153, 1159, 1147,
-     1162, 1150,    0, 1153, 1148, 1142, 1147, 1168, 1162, 1154,
-     1159, 1154, 1166,    0, 1176,    0, 1172, 1173,    0, 1170,
-     1160, 1167, 1174, 1163,    0, 1176, 1165, 1177,    0, 1173,
-     1172, 1186, 1189, 1171, 1191, 1177, 1176, 1192, 1181, 1183,
-     1184, 1196, 1195, 1198, 1198, 1191, 1202, 1190, 1203, 1188,
-     1189, 1196, 1202,    0,    0, 1201, 1213,    0, 1203, 1204,
-
-     1205, 1198, 1210, 1211, 1202, 1206, 1209, 1203, 1220, 1213,
-     1222, 1227, 1224, 1210,    0, 1214, 1228, 1228, 1214, 1222,
-        0, 1218, 1225, 1237,    0, 1230,    0, 1220,    0, 1240,
-     1233, 1238, 1240, 1239,    0, 1229, 1228, 1229, 1240, 1230,
-     1239, 1238, 1250, 1253, 1250, 1236,    0, 1241, 1240, 1258,
-        0, 1255, 1256, 1261, 1243, 1255, 1256, 1257, 1262, 1247,
-     1259, 1250, 1258, 1253,    0, 1264, 1259, 1271, 1257, 1262,
-     1277, 1267, 1260, 1266, 1277, 1274, 1265, 1272, 1274, 1272,
-     1270, 1273, 1271, 1288, 1285, 1273, 1289, 1290, 1287, 1285,
-     1280, 1298, 1280, 1276, 1280, 1278, 1289, 1302, 1288, 1307,
-
-     1294,    0, 1289, 1290, 1298,    0,    0, 1298, 1312, 1309,
-     1310, 1296, 1299, 1315, 1300, 1304, 1312, 1307, 1303, 1311,
-     1305,    0, 1315, 1326,    0, 1324, 1314, 1310, 1326,    0,
-     1323, 1324, 1314, 1321,    0, 1332,    0, 1322, 1329, 1330,
-     1322, 1323, 1317, 1342, 1326, 1325, 1342, 1332, 1347, 1329,
-        0,    0, 1329,    0, 1346, 1343, 1348,    0, 1339, 1335,
-     1336, 1332, 1338, 1356, 1346,    0, 1337, 1341, 1354, 1352,
-     1351, 1365, 1366, 1367, 1364, 1350, 1358, 1354, 1353, 1365,
-     1361, 1362, 1361, 1358, 1370, 1362, 1363, 1379, 1369, 1365,
-     1364, 1377, 1367, 1370, 1375, 1379, 1383, 1392, 1380, 1391,
-
-     1391, 1392, 1384, 1375, 1381, 1386, 1386, 1381, 1391, 1383,
-     1391, 1398, 1393, 1402, 1395,    0, 1397, 1407, 1398, 1409,
-     1401, 1408, 1402, 1413,    0, 1405, 1405,    0, 1406, 1402,
-     1422,    0, 1409, 1422, 1406,    0,    0, 1407, 1419, 1409,
-     1425, 1426, 1430, 1420, 1429, 1432, 1435, 1432, 1435,    0,
-     1435, 1431, 1437, 1420, 1421, 1431, 1429,    0, 1426, 1433,
-     1433, 1444, 1445, 1438, 1438, 1452, 1439, 1436, 1452,    0,
-     1452, 1449, 1445, 1440, 1444, 1447, 1450, 1439,    0, 1465,
-        0, 1446,    0, 1458, 1454, 1454, 1451, 1465, 1464, 1454,
-     1455,    0, 1456, 1462, 1469, 1459, 1478, 1472, 1462, 1482,
-
-     1475, 1470, 1481, 1482,    0, 1468, 1469, 1471, 1485, 1477,
-        0, 1479, 1489, 1494, 1476, 1493, 1493, 1496, 1487, 1479,
-     1482, 1488, 1492, 1490, 1505, 1491, 1507, 1495, 1484, 1499,
-     1507, 1508, 1507, 1501, 1513,    0, 1513, 1503, 1517, 1503,
-        0, 1509, 1521, 1505, 1505, 1522, 1512,    0, 1510, 1527,
-     1521, 1528, 1528, 1512, 1532, 1522, 1521, 1517, 1534, 1519,
-     1535, 1519,    0, 1537, 1538, 1529, 1544,    0, 1539, 1533,
-     1545, 1546, 1534, 1546, 1538, 1547, 1529, 1550, 1552, 1541,
-     1538, 1534, 1539, 1543, 1547, 1542,    0, 1563, 1546, 1550,
-     1564, 1548, 1550, 1569, 1551, 1567,    0, 1555, 1570, 1573,
-
-     1567, 1556, 1565, 1566, 1559, 1566, 1568, 1580, 1582, 1567,
-     1578, 1568, 1564, 1585,    0,    0, 1579, 1577, 1584, 1576,
-     1575, 1577, 1592, 1579, 1587, 1581, 1587, 1590, 1588, 1592,
-     1600, 1601, 1592, 1590, 1595, 1595, 1603, 1592, 1612, 1599,
-     1592, 1606, 1598, 1616, 1609,    0, 1611, 1616, 1609, 1614,
-     1603, 1610, 1611,    0, 1607, 1627, 1610, 1616, 1622,    0,
-     1623, 1632, 1629,    0,    0, 1631, 1615, 1624,    0, 1618,
-     1619, 1620, 1629, 1635, 1625, 1631,    0,    0, 1632, 1637,
-        0, 1638,    0, 1644, 1631, 1638, 1636, 1636, 1638, 1649,
-        0,    0, 1646, 1648, 1638, 1649, 1654, 1639, 1648, 1642,
-
-     1643, 1649, 1646, 1652,    0, 1647, 1648, 1654, 1664, 1662,
-        0, 1658, 1658, 1656, 1674, 1672, 1662, 1669, 1661, 1675,
-     1662, 1679, 1678, 1663, 1671, 1665, 1673,    0, 1670,    0,
-     1669, 1687, 1671, 1691, 1673, 1680, 1681, 1691, 1696, 1697,
-        0, 1684, 1688, 1699, 1700, 1683, 1690, 1686, 1701, 1687,
-     1707, 1687, 1695, 1689, 1709,    0, 1708, 1695, 1710, 1708,
-     1709, 1704,    0, 1715, 1720, 1706, 1718, 1704, 1709, 1721,
-     1713, 1719, 1708, 1725, 1717, 1708, 1719,    0, 1714, 1733,
-        0, 1716, 1732, 1733, 1734, 1736, 1736,    0, 1733, 1734,
-     1723, 1720, 1740, 1727, 1741, 1740, 1738, 1742, 1734, 1739,
-
-     1735, 1743, 1753, 1739, 1744, 1754, 1755, 1756, 1742,    0,
-     1754, 1763,    0, 1745, 1757, 1762, 1763, 1766, 1750, 1751,
-     1758,    0, 1772, 1753, 1770, 1760, 1757,    0, 1777, 1759,
-     1766, 1776, 1768, 1778, 1764, 1784, 1781, 1773, 1773, 1774,
-     1777,    0, 1777, 1772, 1779, 1769, 1782,    0,    0, 1782,
-     1783, 1794, 1777, 1780, 1782, 1801, 1782, 1799,    0,    0,
-     1792, 1801,    0, 1792, 1793, 1795,    0, 1785, 1802,    0,
-     1798, 1798, 1813, 1811, 1796, 1816, 1813, 1801, 1811, 1801,
-        0, 1808,    0,    0, 1803, 1804, 1816, 1811, 1823, 1810,
-     1809, 1815, 1831,    0, 1812, 1813,    0, 1819,    0, 1821,
-
-        0,    0, 1818,    0,    0, 1828, 1835,    0, 1819, 1826,
-     1827,    0, 1835, 1828, 1824,    0, 1840, 1839, 1843,    0,
-     1843, 1830, 1830, 1831, 1832,    0, 1837,    0, 1840, 1841,
-     1852,    0, 1837, 1838, 1852, 1848, 1852, 1857, 1843, 1861,
-     1856, 1850,    0, 1847, 1843, 1860, 1855, 1857,    0,    0,
-        0, 1854, 1872, 1854, 1870, 1867, 1857, 1859, 1857, 1860,
-        0,    0,    0, 1876, 1869, 1864, 1870, 1872,    0, 1868,
-     1882,    0, 1883, 1884, 1878,    0,    0,    0, 1866, 1887,
-        0, 1878, 1893, 1877, 1881, 1877, 1882, 1879,    0,    0,
-     1885, 1887,    0, 1893, 1891, 1883,    0, 1891, 1887, 1906,
-
-     1903, 1900,    0,    0, 1898, 1891, 1907, 1894, 1902,    0,
-        0, 1914,    0, 1898, 1910, 1906, 1913, 1902, 1906, 1902,
-     1900, 1910,    0, 1911, 1917, 1909, 1908,    0, 1909,    0,
-     1908, 1916, 1913, 1919, 1933, 1930, 1916, 1931,    0, 1923,
-     1938, 1931, 1923, 1919, 1942,    0, 1924, 1931, 1932, 1928,
-     1933, 1944, 1930, 1939, 1932, 1933, 1951, 1950, 1955, 1950,
-     1932, 1945, 1956, 1960, 1944, 1958, 1957,    0,    0, 1947,
-        0,    0, 1951,    0, 1952, 1948, 1950, 1944,    0,    0,
-     1951, 1963, 1955, 1960, 1957, 1963, 1968, 1958, 1961, 1965,
-     1961,    0, 1977, 1982, 1970, 1976, 1980, 1982, 1974,    0,
-
-     1980, 1972, 1990, 1974, 1981, 1985, 1981, 1995, 1983, 1978,
-     1985, 1996, 1981, 1996, 1988, 1990, 1998, 1980, 1987, 2003,
-     1989, 2001, 2006, 2011, 2006, 2007, 1996,    0,    0, 1998,
-     2012, 2017,    0, 1993,    0, 2001,    0, 2015, 2004, 2011,
-        0,    0, 2023, 2019, 2011, 2001, 2027, 2022,    0, 2004,
-        0,    0, 2592, 2061, 2067, 2070, 2071, 2077, 2083, 2074,
-     2089
+      472,  474,  463,  464,    0,  461,  460,  478,  481,  461,
+
+      479,  472,  468,  486,  485,  488,  482,  487,  479,  479,
+      488,  482,  494,  480,  499,  484,  506,  508,  490,  493,
+      498,  508,  513,  495,    0,  503,  517,  507,  500,  509,
+      503,    0,  519,  510,  508,  522,  523,    0,  514,    0,
+        0,  510,  511,  513,  513,  512,  515,  523,  528,  531,
+      522,  526,  536,  535,  539,  537,  530,  530,  527,  547,
+      548,  549,  550,  551,  552,  553,  554,  555,  556,  558,
+      552,  559,  550,  562,  549,    0,    0,    0,    0,  559,
+      551,  546,  558,  547,  569,  556,  570,  551,  565,  565,
+      572,    0,  562,  576,  577,  565,  579,  572,  563,  564,
+
+      583,  577,  565,  578,    0,  568,  576,  581,  566,  577,
+      588,  574,  575,  591,  576,  577,  577,  595,  583,  596,
+      583,  601,  590,  597,  605,  604,  601,  608,  603,  612,
+      609,  614,  596,  597,  617,  604,  613,  602,  623,  607,
+      612,  607,  627,  617,  610,    0,  613,  621,  614,  623,
+      616,    0,  619,  623,  623,  620,  622,  638,  624,  635,
+      626,  627,  638,  639,  648,  638,  645,  645,  653,  636,
+      654,  644,    0,  639,  655,  637,  646,  656,  638,  662,
+      650,  653,  661,  646,  665,  664,  650,  667,  654,  658,
+      658,  655,  663,  653,  657,  660,  675,  666,  681,  674,
+
+      664,  676,  681,  682,  676,  684,  676,    0,  686,  672,
+      688,  669,  675,  680,  685,  695,  698,  687,    0,  687,
+      689,  685,  699,  701,  697,  706,  699,    0,  689,  689,
+      697,  692,  688,  705,  711,    0,  704,  709,  716,  699,
+      703,    0,  720,  721,  718,  706,  711,    0,  708,    0,
+      709,  703,  724,  728,  718,  731,  732,  719,  715,  731,
+      716,    0,  719,    0,  734,    0,  727,  740,  733,  739,
+      740,  741,  742,  743,  744,  745,  746,  747,  748,  737,
+      736,  748,    0,  740,    0,  739,  738,    0,  753,  741,
+      745,  742,  756,  746,  745,  760,  762,  764,    0,  749,
+
+        0,  750,  753,  752,  753,  754,  760,  758,  755,  773,
+      777,  766,  778,  769,  770,  775,  776,  767,  776,  771,
+      785,  785,  787,  781,  779,  780,  795,  792,  778,  790,
+      787,  797,  787,  790,  791,  790,    0,  794,  801,  788,
+      804,  801,  797,  798,  800,  809,  795,  807,  813,  805,
+      807,  811,  813,  819,    0,    0,  822,  819,  824,  822,
+      807,  813,  813,  810,  826,  814,  813,  814,  822,  822,
+      824,  817,  819,  832,  831,  833,  840,  835,  840,  831,
+      838,  826,  830,  830,  847,  832,  848,  851,  850,  847,
+      852,  853,  856,  851,  843,  843,  848,  859,    0,  860,
+
+      863,  848,  847,  849,  857,  862,  871,  860,  860,  863,
+      873,  857,  875,    0,  865,  875,  876,  879,  882,  879,
+      873,    0,  870,  882,  879,  880,    0,  883,  878,  888,
+      892,  876,  892,  887,  877,  893,  894,  899,    0,  900,
+        0,  881,  883,  884,    0,  890,  900,    0,  898,    0,
+      895,  897,  895,  899,  909,  891,  889,    0,  906,  897,
+      916,  917,  901,  907,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  920,    0,    0,  921,  903,  906,
+      905,  926,  926,  910,    0,  915,    0,  910,    0,  931,
+      927,  933,  929,  935,  936,  932,  917,  934,  939,  928,
+
+      941,  942,  926,  941,  944,    0,  927,  934,  930,  949,
+        0,  946,  934,  950,  939,  949,  943,  944,  944,  954,
+      948,    0,  949,  949,  942,  962,  944,  954,  943,  963,
+      956,  955,  967,  956,  968,  961,  966,  971,  972,  963,
+      978,  960,    0,  963,  962,    0,  974,  979,  984,  973,
+      986,  979,  975,  985,  991,  992,  972,  987,  993,  991,
+      997,  978,  978,  980,  998,  982, 1000,  990, 1002, 1001,
+      987,  990, 1005,  996, 1009,  995, 1011, 1002, 1002, 1010,
+     1003, 1005, 1013,    0, 1009, 1004,    0, 1018, 1005, 1011,
+     1018, 1012, 1008, 1009, 1029, 1030,    0, 1017, 1024, 1014,
+
+     1030, 1018, 1024,    0, 1013, 1025, 1028, 1026, 1028, 1038,
+     1037, 1037, 1041, 1027, 1034, 1044, 1045, 1036, 1028, 1040,
+     1051, 1036, 1037, 1049,    0, 1039, 1054, 1043, 1057, 1054,
+     1049, 1061, 1057, 1059, 1063, 1068, 1054, 1066, 1069, 1070,
+     1069, 1070, 1072, 1073,    0, 1063,    0, 1063, 1076, 1066,
+        0,    0, 1063,    0, 1082, 1081, 1081, 1082, 1083, 1070,
+     1080, 1070,    0, 1071, 1074, 1088, 1082, 1095, 1072, 1093,
+     1094, 1080, 1087, 1087, 1083, 1089, 1099, 1104, 1102, 1088,
+     1096, 1101, 1106, 1110, 1094, 1105, 1101, 1109,    0, 1104,
+     1113, 1105, 1120, 1106, 1108, 1107, 1109, 1111, 1122, 1105,
+
+     1108, 1104, 1121, 1111, 1112,    0, 1113,    0, 1116, 1122,
+     1116, 1134, 1134, 1135, 1121,    0, 1132,    0, 1132, 1143,
+     1125, 1140, 1141, 1122, 1128, 1130, 1145, 1133, 1143, 1148,
+     1149, 1146, 1153, 1139, 1149, 1144, 1159, 1158, 1157, 1150,
+     1157, 1163, 1151, 1166, 1154,    0, 1165, 1158, 1153, 1147,
+     1153, 1173, 1167, 1159, 1164, 1159, 1171,    0, 1181,    0,
+     1177, 1178,    0, 1175, 1165, 1172, 1179, 1168,    0, 1181,
+     1170, 1182,    0, 1178, 1177, 1191, 1194, 1176, 1196, 1182,
+     1181, 1197, 1186, 1188, 1189, 1201, 1200, 1203, 1203, 1196,
+     1207, 1195, 1208, 1193, 1194, 1201, 1207,    0,    0, 1206,
+
+     1218,    0, 1208, 1209, 1210, 1203, 1215, 1216, 1207, 1211,
+     1214, 1208, 1225, 1218, 1227, 1232, 1229, 1215,    0, 1219,
+     1233, 1233, 1219, 1227,    0, 1223, 1230, 1242,    0, 1235,
+        0, 1225,    0, 1245, 1238, 1243, 1245, 1244,    0, 1234,
+     1233, 1234, 1245, 1235, 1244, 1243, 1255, 1258, 1255, 1241,
+        0, 1246, 1245, 1263,    0, 1260, 1261, 1266, 1248, 1260,
+     1261, 1262, 1267, 1252, 1264, 1255, 1263, 1258,    0, 1269,
+     1264, 1276, 1262, 1267, 1282, 1272, 1265, 1271, 1282, 1279,
+     1270, 1277, 1279, 1277, 1275, 1278, 1276, 1293, 1290, 1278,
+     1294, 1295, 1296, 1293, 1291, 1286, 1304, 1286, 1282, 1286,
+
+     1284, 1295, 1308, 1294, 1313, 1300,    0, 1295, 1296, 1304,
+        0,    0, 1304, 1318, 1315, 1316, 1302, 1305, 1321, 1306,
+     1310, 1318, 1313, 1309, 1317, 1311,    0, 1321, 1332,    0,
+     1330, 1320, 1316, 1332,    0, 1329, 1330, 1320, 1327,    0,
+     1338,    0, 1328, 1335, 1336, 1328, 1329, 1323, 1348, 1332,
+     1331, 1348, 1338, 1353, 1335,    0,    0, 1335,    0, 1352,
+     1349, 1354,    0, 1345, 1341, 1342, 1338, 1344, 1362, 1352,
+        0, 1343, 1347, 1360, 1358, 1357, 1371, 1372, 1373, 1370,
+     1356, 1364, 1360, 1359, 1371, 1367, 1368, 1367, 1364, 1376,
+     1368, 1369, 1385, 1375, 1371, 1370, 1383, 1373, 1376, 1381,
+
+     1385, 1389, 1398, 1386, 1397, 1397, 1398, 1390, 1381, 1387,
+     1392, 1392, 1387, 1397, 1389, 1397, 1404, 1399, 1408, 1401,
+        0, 1413, 1404, 1414, 1405, 1416, 1408, 1415, 1409, 1420,
+        0, 1412, 1412,    0, 1413, 1409, 1429,    0, 1416, 1429,
+     1413,    0,    0, 1414, 1426, 1416, 1432, 1433, 1437, 1427,
+     1436, 1439, 1442, 1439, 1442,    0, 1442, 1438, 1444, 1427,
+     1428, 1438, 1436,    0, 1433, 1440, 1440, 1451, 1452, 1445,
+     1445, 1459, 1446, 1443, 1459,    0, 1459, 1456, 1452, 1447,
+     1451, 1454, 1457, 1446,    0, 1472,    0, 1453,    0, 1465,
+     1461, 1461, 1458, 1472, 1471, 1461, 1462,    0, 1463, 1469,
+
+     1476, 1466, 1485, 1479, 1469, 1489, 1482, 1477, 1488, 1489,
+        0, 1475, 1476, 1478, 1492, 1484,    0, 1486, 1496, 1501,
+     1483, 1500, 1500, 1503, 1494, 1486, 1489, 1495, 1499, 1497,
+     1512, 1498, 1514, 1502, 1491, 1506, 1514, 1515, 1505, 1515,
+     1509, 1521,    0, 1521, 1511, 1526, 1511,    0, 1517, 1529,
+     1513, 1513, 1530, 1520,    0, 1518, 1535, 1529, 1536, 1536,
+     1520, 1540, 1530, 1529, 1525, 1542, 1527, 1543, 1527,    0,
+     1545, 1546, 1537, 1552,    0, 1547, 1541, 1553, 1554, 1542,
+     1554, 1546, 1555, 1537, 1558, 1560, 1549, 1546, 1542, 1547,
+     1551, 1555, 1550,    0, 1571, 1554, 1558, 1572, 1556, 1558,
+
+     1577, 1559, 1575,    0, 1563, 1578, 1581, 1575, 1564, 1573,
+     1574, 1567, 1574, 1576, 1588, 1590, 1575, 1586, 1576, 1572,
+     1593,    0,    0, 1587, 1585, 1592, 1584, 1583, 1585, 1600,
+     1587, 1595, 1589, 1595, 1598, 1596, 1600, 1608, 1609, 1600,
+     1598, 1603, 1603, 1618, 1612, 1601, 1621, 1608, 1601, 1615,
+     1607, 1625, 1618,    0, 1620, 1625, 1618, 1623, 1612, 1619,
+     1620,    0, 1616, 1636, 1619, 1625, 1631,    0, 1632, 1641,
+     1638,    0,    0, 1640, 1624, 1633,    0, 1627, 1628, 1629,
+     1638, 1644, 1634, 1640,    0,    0, 1641, 1646,    0, 1647,
+        0, 1653, 1640, 1647, 1645, 1645, 1647, 1658,    0,    0,
+
+     1655, 1657, 1647, 1658, 1663, 1648, 1657, 1651, 1652, 1658,
+     1655, 1661,    0, 1656, 1657, 1663, 1673, 1671,    0, 1667,
+     1667, 1665, 1683, 1681, 1671, 1678, 1670, 1684, 1671, 1688,
+     1687, 1672, 1680, 1674, 1682,    0, 1679,    0, 1678, 1696,
+     1680, 1681, 1701, 1683, 1690, 1691, 1701, 1706, 1707,    0,
+     1694, 1698, 1709, 1710, 1693, 1700, 1696, 1711, 1697, 1717,
+     1697, 1705, 1699, 1719,    0, 1718, 1705, 1720, 1718, 1719,
+     1714,    0, 1725, 1730, 1716, 1728, 1714, 1719, 1731, 1723,
+     1729, 1718, 1735, 1727, 1718, 1729,    0, 1724, 1743,    0,
+     1726, 1742, 1743, 1744, 1746, 1746,    0, 1743, 1744, 1733,
+
+     1730, 1750, 1737, 1751, 1750, 1748, 1752, 1744, 1749, 1745,
+     1753, 1763, 1749, 1754, 1764, 1765, 1766, 1752,    0, 1764,
+     1773, 1767,    0, 1756, 1768, 1773, 1774, 1777, 1761, 1762,
+     1769,    0, 1783, 1764, 1781, 1771, 1768,    0, 1788, 1770,
+     1777, 1787, 1779, 1789, 1775, 1795, 1792, 1784, 1784, 1785,
+     1788,    0, 1788, 1783, 1790, 1780, 1793,    0,    0, 1793,
+     1794, 1805, 1788, 1791, 1793, 1812, 1793, 1810,    0,    0,
+     1803, 1812,    0, 1803, 1804, 1806,    0, 1796, 1813,    0,
+     1809, 1809, 1824, 1822, 1807, 1827, 1824, 1812, 1822, 1812,
+        0, 1819,    0,    0, 1814, 1815, 1824, 1828, 1823, 1835,
+
+     1822, 1821, 1827, 1843,    0, 1824, 1825,    0, 1831,    0,
+     1833,    0,    0, 1830,    0,    0, 1840, 1847,    0, 1831,
+     1838, 1839,    0, 1847, 1840, 1836,    0, 1852, 1851, 1855,
+        0, 1855, 1842, 1842, 1843, 1844,    0, 1849,    0, 1852,
+     1853, 1864,    0, 1849, 1850, 1864, 1860, 1864, 1869, 1855,
+     1873, 1868, 1862,    0, 1859, 1855, 1872, 1877, 1868, 1870,
+        0,    0,    0, 1867, 1885, 1867, 1883, 1880, 1870, 1872,
+     1870, 1873,    0,    0,    0, 1889, 1882, 1877, 1883, 1885,
+        0, 1881, 1895,    0, 1896, 1897, 1891,    0,    0,    0,
+     1879, 1900,    0, 1891, 1906, 1890, 1894, 1890, 1895, 1892,
+
+        0,    0, 1898, 1900, 1901,    0, 1907, 1905, 1897,    0,
+     1905, 1901, 1920, 1917, 1914,    0,    0, 1912, 1905, 1921,
+     1908, 1916,    0,    0, 1928,    0, 1912, 1924, 1920, 1927,
+     1916, 1920, 1916, 1914, 1924, 1932,    0, 1926, 1932, 1924,
+     1923,    0, 1924,    0, 1923, 1931, 1928, 1934, 1948, 1945,
+     1931, 1946,    0, 1938, 1953, 1946, 1938, 1934, 1957,    0,
+     1951, 1940, 1947, 1948, 1944, 1949, 1960, 1946, 1955, 1948,
+     1949, 1967, 1966, 1971, 1966, 1948, 1961, 1972, 1976, 1960,
+     1959, 1975, 1974,    0,    0, 1964,    0,    0, 1968,    0,
+     1969, 1965, 1967, 1961,    0,    0, 1968, 1980, 1972, 1977,
+
+        0, 1974, 1980, 1985, 1975, 1978, 1982, 1978,    0, 1994,
+     1999, 1987, 1993, 1997, 1999, 1991,    0, 1997, 1989, 2007,
+     1991, 1998, 2002, 1998, 2012, 2000, 1995, 2002, 2013, 1998,
+     2013, 2005, 2007, 2015, 1997, 2004, 2020, 2006, 2018, 2023,
+     2028, 2023, 2024, 2013,    0,    0, 2015, 2029, 2034,    0,
+     2010,    0, 2018,    0, 2032, 2021, 2028,    0,    0, 2040,
+     2036, 2028, 2018, 2044, 2039,    0, 2021,    0,    0, 2609,
+     2078, 2084, 2087, 2088, 2094, 2100, 2091, 2106
     } ;
 
-static yyconst short int yy_def[2562] =
+static yyconst short int yy_def[2579] =
     {   0,
-     2553,    1, 2554, 2554, 2553, 2553, 2553, 2553, 2553, 2555,
-     2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-     2556, 2553, 2553, 2553, 2553, 2553, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2553,
-     2558, 2553, 2553, 2553, 2553, 2553, 2555, 2553, 2553, 2553,
-     2559, 2560, 2556, 2553, 2553, 2553, 2553, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2553, 2558, 2553, 2553,
-     2561, 2559, 2560, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2561,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2553, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557, 2557,
-     2557, 2557,    0, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-     2553
+     2570,    1, 2571, 2571, 2570, 2570, 2570, 2570, 2570, 2572,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
+     2573, 2570, 2570, 2570, 2570, 2570, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2570,
+     2575, 2570, 2570, 2570, 2570, 2570, 2572, 2570, 2570, 2570,
+     2576, 2577, 2573, 2570, 2570, 2570, 2570, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2570, 2575, 2570, 2570,
+     2578, 2576, 2577, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2578,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2570, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,
+     2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574, 2574,    0,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570
     } ;
 
-static yyconst short int yy_nxt[2651] =
+static yyconst short int yy_nxt[2668] =
     {   0,
         6,    7,    8,    9,   10,   11,   12,   13,   14,   15,
        16,   17,   18,   19,   20,   21,   21,   21,   21,   21,
@@ -1239,12 +1242,12 @@ static yyconst short int yy_nxt[2651] =
       972,  973,  974,  975,  976,  977,  978,  979,  981,  982,
       983,  984,  985,  986,  987,  988,  989,  990,  991,  992,
 
-      980,  993,  994,  995,  996,  997,  998,  999, 1000, 1001,
-     1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011,
-     1012, 1017, 1018, 1019, 1020, 1013, 1021, 1014, 1027, 1028,
-     1015, 1022, 1023, 1029, 1016, 1024, 1030, 1025, 1031, 1032,
-     1033, 1034, 1035, 1036, 1037, 1038, 1026, 1039, 1041, 1042,
-     1043, 1040, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051,
+      980,  993,  994,  995,  996,  997,  998, 1000, 1001, 1002,
+     1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012,
+      999, 1013, 1018, 1019, 1020, 1021, 1014, 1022, 1015, 1028,
+     1029, 1016, 1023, 1024, 1030, 1017, 1025, 1031, 1026, 1032,
+     1033, 1034, 1035, 1036, 1037, 1038, 1039, 1027, 1040, 1042,
+     1043, 1044, 1041, 1045, 1046, 1047, 1048, 1049, 1050, 1051,
      1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061,
      1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
      1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081,
@@ -1253,10 +1256,10 @@ static yyconst short int yy_nxt[2651] =
      1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101,
      1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111,
      1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121,
-     1122, 1123, 1124, 1125, 1127, 1128, 1129, 1126, 1130, 1131,
-     1132, 1133, 1134, 1136, 1137, 1140, 1141, 1142, 1143, 1144,
-     1138, 1145, 1139, 1146, 1147, 1148, 1149, 1150, 1151, 1152,
-     1135, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161,
+     1122, 1123, 1124, 1125, 1126, 1128, 1129, 1130, 1127, 1131,
+     1132, 1133, 1134, 1135, 1137, 1138, 1141, 1142, 1143, 1144,
+     1145, 1139, 1146, 1140, 1147, 1148, 1149, 1150, 1151, 1152,
+     1153, 1136, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161,
      1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171,
      1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181,
      1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191,
@@ -1273,7 +1276,7 @@ static yyconst short int yy_nxt[2651] =
      1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291,
 
      1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301,
-     1303, 1304, 1305, 1306, 1307, 1302, 1308, 1309, 1310, 1311,
+     1302, 1303, 1305, 1306, 1307, 1308, 1309, 1304, 1310, 1311,
      1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321,
      1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331,
      1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341,
@@ -1299,28 +1302,28 @@ static yyconst short int yy_nxt[2651] =
      1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521,
      1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531,
      1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541,
-     1542, 1543, 1544, 1545, 1546, 1547, 1548, 1550, 1551, 1552,
-     1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562,
-     1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1549, 1571,
-     1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581,
+     1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551,
+     1552, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562,
+     1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572,
+     1573, 1574, 1553, 1575, 1576, 1577, 1578, 1579, 1580, 1581,
      1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591,
 
      1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601,
-     1602, 1603, 1604, 1605, 1606, 1607, 1609, 1610, 1611, 1612,
-     1613, 1608, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621,
+     1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611,
+     1613, 1614, 1615, 1616, 1617, 1612, 1618, 1619, 1620, 1621,
      1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631,
      1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641,
      1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651,
      1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661,
      1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671,
-     1672, 1673, 1674, 1676, 1677, 1678, 1679, 1680, 1681, 1682,
-     1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1675,
+     1672, 1673, 1674, 1675, 1676, 1677, 1678, 1680, 1681, 1682,
+     1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692,
 
-     1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701,
+     1693, 1694, 1695, 1679, 1696, 1697, 1698, 1699, 1700, 1701,
      1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711,
-     1712, 1713, 1714, 1716, 1717, 1718, 1720, 1721, 1722, 1723,
-     1724, 1719, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732,
-     1733, 1734, 1715, 1735, 1736, 1737, 1738, 1739, 1740, 1741,
+     1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1721, 1722,
+     1723, 1725, 1726, 1727, 1728, 1729, 1724, 1730, 1731, 1732,
+     1733, 1734, 1735, 1736, 1737, 1738, 1739, 1720, 1740, 1741,
      1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751,
      1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761,
      1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771,
@@ -1336,33 +1339,33 @@ static yyconst short int yy_nxt[2651] =
      1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861,
      1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871,
      1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881,
-     1882, 1883, 1884, 1885, 1886, 1887, 1888, 1890, 1891, 1892,
+     1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891,
 
-     1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902,
-     1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1889, 1911,
-     1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921,
+     1892, 1893, 1894, 1896, 1897, 1898, 1899, 1900, 1901, 1902,
+     1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912,
+     1913, 1914, 1915, 1916, 1895, 1917, 1918, 1919, 1920, 1921,
      1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931,
      1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941,
      1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
      1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961,
      1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971,
      1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981,
-     1982, 1983, 1984, 1985, 1987, 1988, 1989, 1990, 1991, 1992,
+     1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991,
 
-     1986, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001,
+     1992, 1994, 1995, 1996, 1997, 1998, 1999, 1993, 2000, 2001,
      2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011,
      2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021,
      2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031,
-     2032, 2033, 2034, 2035, 2037, 2038, 2039, 2040, 2041, 2042,
-     2036, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051,
+     2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041,
+     2042, 2044, 2045, 2046, 2047, 2048, 2049, 2043, 2050, 2051,
      2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061,
      2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071,
      2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081,
-     2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2091, 2092,
+     2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091,
 
-     2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102,
-     2103, 2104, 2105, 2106, 2090, 2107, 2108, 2109, 2110, 2111,
-     2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121,
+     2092, 2093, 2094, 2095, 2096, 2097, 2099, 2100, 2101, 2102,
+     2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112,
+     2113, 2114, 2098, 2115, 2116, 2117, 2118, 2119, 2120, 2121,
      2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131,
      2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141,
      2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151,
@@ -1374,9 +1377,9 @@ static yyconst short int yy_nxt[2651] =
      2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201,
      2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211,
      2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221,
-     2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2232,
-     2233, 2234, 2235, 2236, 2237, 2238, 2231, 2239, 2240, 2241,
-     2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251,
+     2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231,
+     2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2242,
+     2243, 2244, 2245, 2246, 2247, 2248, 2241, 2249, 2250, 2251,
      2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261,
      2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271,
      2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281,
@@ -1410,74 +1413,76 @@ static yyconst short int yy_nxt[2651] =
      2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531,
      2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541,
      2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551,
-     2552,   51,   51,   51,   51,   51,   51,   57,   57,   57,
-       57,   57,   57,   63,   63,   68,   68,  128,  133,  872,
-      128,  128,  128,  132,  871,  132,  132,  132,  132,  230,
-      870,  230,  230,  230,  230,  869,  868,  867,  866,  865,
-
-      864,  863,  862,  861,  860,  859,  858,  857,  856,  855,
-      854,  853,  850,  849,  848,  847,  846,  845,  844,  843,
-      842,  841,  840,  839,  838,  837,  836,  835,  834,  833,
-      832,  831,  830,  829,  828,  827,  826,  825,  824,  823,
-      822,  821,  820,  819,  818,  817,  816,  815,  814,  813,
-      812,  811,  810,  809,  808,  807,  806,  805,  804,  803,
-      802,  801,  800,  795,  792,  791,  790,  789,  786,  785,
-      784,  783,  782,  775,  774,  773,  768,  767,  766,  765,
-      764,  763,  759,  758,  757,  751,  750,  749,  748,  747,
-      746,  745,  744,  743,  742,  741,  740,  739,  738,  737,
-
-      736,  735,  734,  733,  730,  729,  728,  727,  726,  725,
-      724,  723,  722,  721,  720,  719,  718,  717,  716,  713,
-      712,  711,  708,  707,  706,  705,  704,  703,  702,  701,
-      700,  699,  696,  695,  692,  691,  690,  689,  685,  684,
-      683,  682,  681,  680,  679,  678,  677,  667,  657,  654,
-      650,  649,  648,  647,  646,  645,  644,  643,  642,  641,
-      640,  639,  638,  637,  636,  635,  634,  633,  632,  631,
-      630,  629,  628,  627,  626,  625,  624,  623,  622,  621,
-      620,  619,  618,  617,  616,  615,  614,  613,  612,  611,
-      610,  609,  608,  607,  606,  605,  604,  603,  602,  599,
-
-      598,  597,  596,  595,  594,  593,  592,  591,  590,  589,
-      588,  587,  586,  585,  584,  583,  582,  581,  580,  579,
-      578,  577,  576,  575,  574,  573,  572,  571,  570,  569,
-      568,  567,  566,  565,  564,  563,  562,  561,  560,  559,
-      558,  557,  556,  555,  554,  553,  552,  551,  548,  547,
-      546,  545,  544,  541,  540,  539,  538,  534,  523,  522,
-      521,  520,  519,  518,  517,  513,  512,  511,  510,  509,
-      508,  505,  504,  503,  502,  501,  500,  499,  498,  495,
-      494,  493,  492,  491,  490,  489,  488,  487,  486,  485,
-      484,  483,  446,  445,  444,  443,  442,  441,  440,  439,
-
-      438,  437,  436,  435,  434,  433,  432,  431,  430,  429,
-      428,  427,  426,  425,  424,  423,  422,  417,  404,  396,
-      395,  394,  393,  392,  389,  388,  387,  386,  385,  384,
-      383,  382,  381,  380,  379,  378,  377,  374,  373,  372,
-      371,  370,  369,  368,  367,  366,  365,  364,  363,  362,
-      359,  358,  357,  356,  355,  354,  353,  352,  351,  350,
-      349,  335,  334,  333,  332,  331,  330,  329,  328,  327,
-      326,  321,  320,  319,  318,  317,  316,  315,  314,  313,
-      312,  307,  306,  305,  304,  303,  302,  301,  300,  299,
-      298,  297,  296,  295,  292,  291,  290,  287,  284,  283,
-
-      282,  281,  280,  279,  278,  260,  259,  258,  257,  256,
-      255,  254,  253,  252,  251,  248,  247,  246,  245,  244,
-      243,  242,  241,  240,  232,  231,  229,  228,  227,  226,
-      225,  224,  223,  222,  219,  214,  211,  210,  209,  208,
-      202,  201,  179,  178,  177,  176,  175,  174,  161,  160,
-      159,  158,  157,  156,  155,  154,  153,  149,  148,  147,
-      146,  145,  142,  141,  140,  139,  138,  137,  136,  135,
-      134,   62,   58,   55,  129,  127,  107,  106,  105,   97,
-       92,   67,   66,   65,   64,   62,   59,   58,   56,   55,
-     2553,    5, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-
-     2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-     2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-     2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-     2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-     2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553
+     2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561,
+     2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569,   51,   51,
+       51,   51,   51,   51,   57,   57,   57,   57,   57,   57,
+       63,   63,   68,   68,  128,  133,  872,  128,  128,  128,
+
+      132,  871,  132,  132,  132,  132,  230,  870,  230,  230,
+      230,  230,  869,  868,  867,  866,  865,  864,  863,  862,
+      861,  860,  859,  858,  857,  856,  855,  854,  853,  850,
+      849,  848,  847,  846,  845,  844,  843,  842,  841,  840,
+      839,  838,  837,  836,  835,  834,  833,  832,  831,  830,
+      829,  828,  827,  826,  825,  824,  823,  822,  821,  820,
+      819,  818,  817,  816,  815,  814,  813,  812,  811,  810,
+      809,  808,  807,  806,  805,  804,  803,  802,  801,  800,
+      795,  792,  791,  790,  789,  786,  785,  784,  783,  782,
+      775,  774,  773,  768,  767,  766,  765,  764,  763,  759,
+
+      758,  757,  751,  750,  749,  748,  747,  746,  745,  744,
+      743,  742,  741,  740,  739,  738,  737,  736,  735,  734,
+      733,  730,  729,  728,  727,  726,  725,  724,  723,  722,
+      721,  720,  719,  718,  717,  716,  713,  712,  711,  708,
+      707,  706,  705,  704,  703,  702,  701,  700,  699,  696,
+      695,  692,  691,  690,  689,  685,  684,  683,  682,  681,
+      680,  679,  678,  677,  667,  657,  654,  650,  649,  648,
+      647,  646,  645,  644,  643,  642,  641,  640,  639,  638,
+      637,  636,  635,  634,  633,  632,  631,  630,  629,  628,
+      627,  626,  625,  624,  623,  622,  621,  620,  619,  618,
+
+      617,  616,  615,  614,  613,  612,  611,  610,  609,  608,
+      607,  606,  605,  604,  603,  602,  599,  598,  597,  596,
+      595,  594,  593,  592,  591,  590,  589,  588,  587,  586,
+      585,  584,  583,  582,  581,  580,  579,  578,  577,  576,
+      575,  574,  573,  572,  571,  570,  569,  568,  567,  566,
+      565,  564,  563,  562,  561,  560,  559,  558,  557,  556,
+      555,  554,  553,  552,  551,  548,  547,  546,  545,  544,
+      541,  540,  539,  538,  534,  523,  522,  521,  520,  519,
+      518,  517,  513,  512,  511,  510,  509,  508,  505,  504,
+      503,  502,  501,  500,  499,  498,  495,  494,  493,  492,
+
+      491,  490,  489,  488,  487,  486,  485,  484,  483,  446,
+      445,  444,  443,  442,  441,  440,  439,  438,  437,  436,
+      435,  434,  433,  432,  431,  430,  429,  428,  427,  426,
+      425,  424,  423,  422,  417,  404,  396,  395,  394,  393,
+      392,  389,  388,  387,  386,  385,  384,  383,  382,  381,
+      380,  379,  378,  377,  374,  373,  372,  371,  370,  369,
+      368,  367,  366,  365,  364,  363,  362,  359,  358,  357,
+      356,  355,  354,  353,  352,  351,  350,  349,  335,  334,
+      333,  332,  331,  330,  329,  328,  327,  326,  321,  320,
+      319,  318,  317,  316,  315,  314,  313,  312,  307,  306,
+
+      305,  304,  303,  302,  301,  300,  299,  298,  297,  296,
+      295,  292,  291,  290,  287,  284,  283,  282,  281,  280,
+      279,  278,  260,  259,  258,  257,  256,  255,  254,  253,
+      252,  251,  248,  247,  246,  245,  244,  243,  242,  241,
+      240,  232,  231,  229,  228,  227,  226,  225,  224,  223,
+      222,  219,  214,  211,  210,  209,  208,  202,  201,  179,
+      178,  177,  176,  175,  174,  161,  160,  159,  158,  157,
+      156,  155,  154,  153,  149,  148,  147,  146,  145,  142,
+      141,  140,  139,  138,  137,  136,  135,  134,   62,   58,
+       55,  129,  127,  107,  106,  105,   97,   92,   67,   66,
+
+       65,   64,   62,   59,   58,   56,   55, 2570,    5, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570
     } ;
 
-static yyconst short int yy_chk[2651] =
+static yyconst short int yy_chk[2668] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -1536,240 +1541,242 @@ static yyconst short int yy_chk[2651] =
 
       772,  787,  788,  789,  790,  791,  792,  793,  794,  796,
       797,  798,  799,  800,  801,  802,  803,  804,  805,  806,
-      807,  808,  809,  810,  811,  807,  812,  807,  814,  815,
-      807,  813,  813,  816,  807,  813,  817,  813,  818,  819,
-      820,  821,  822,  823,  824,  826,  813,  827,  828,  829,
-      830,  827,  831,  833,  834,  835,  836,  837,  839,  842,
-      843,  844,  845,  846,  847,  848,  849,  850,  851,  852,
-      853,  854,  855,  856,  857,  858,  859,  860,  861,  862,
-      863,  864,  865,  866,  867,  868,  869,  870,  871,  872,
-      873,  874,  875,  880,  881,  882,  883,  884,  885,  886,
-
-      887,  888,  889,  890,  891,  893,  894,  895,  896,  897,
-      898,  899,  900,  901,  902,  903,  904,  906,  907,  908,
-      909,  910,  911,  912,  913,  914,  915,  916,  917,  918,
-      919,  920,  921,  922,  923,  924,  925,  922,  926,  927,
-      928,  929,  930,  931,  932,  933,  934,  935,  936,  937,
-      932,  938,  932,  939,  940,  941,  942,  943,  944,  945,
-      930,  947,  948,  949,  950,  951,  953,  954,  955,  956,
-      957,  958,  959,  960,  961,  962,  963,  964,  965,  966,
-      967,  968,  969,  970,  971,  972,  974,  975,  976,  977,
-      978,  979,  980,  981,  982,  983,  984,  985,  986,  987,
-
-      988,  989,  990,  991,  992,  993,  994,  995,  996,  997,
-      998,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1008,
-     1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1019,
-     1020, 1021, 1022, 1023, 1024, 1025, 1026, 1028, 1029, 1030,
-     1031, 1032, 1033, 1034, 1036, 1037, 1038, 1039, 1040, 1042,
-     1043, 1044, 1045, 1046, 1048, 1050, 1051, 1052, 1053, 1054,
-     1055, 1056, 1057, 1058, 1059, 1060, 1062, 1064, 1066, 1067,
-     1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077,
-     1078, 1079, 1080, 1081, 1083, 1085, 1086, 1088, 1089, 1090,
-     1091, 1092, 1093, 1094, 1095, 1096, 1097, 1099, 1101, 1102,
-
-     1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112,
-     1113, 1114, 1115, 1116, 1117, 1112, 1118, 1119, 1120, 1121,
-     1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131,
-     1132, 1133, 1134, 1135, 1137, 1138, 1139, 1140, 1141, 1142,
-     1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152,
-     1153, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164,
-     1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174,
-     1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184,
-     1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
-     1195, 1196, 1197, 1199, 1200, 1201, 1202, 1203, 1204, 1205,
-
-     1206, 1207, 1208, 1209, 1210, 1211, 1213, 1214, 1215, 1216,
-     1217, 1218, 1219, 1221, 1222, 1223, 1224, 1226, 1227, 1228,
-     1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1238, 1240,
-     1241, 1242, 1244, 1245, 1247, 1249, 1250, 1251, 1252, 1253,
-     1254, 1255, 1257, 1258, 1259, 1260, 1261, 1262, 1273, 1276,
-     1277, 1278, 1279, 1280, 1281, 1282, 1284, 1286, 1288, 1289,
-     1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299,
-     1300, 1301, 1302, 1303, 1305, 1306, 1307, 1308, 1310, 1311,
-     1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1321, 1322,
-     1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332,
-
-     1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1342, 1343,
-     1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354,
-     1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364,
-     1365, 1366, 1367, 1368, 1369, 1370, 1370, 1371, 1372, 1373,
-     1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1383, 1384,
-     1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1395, 1396,
-     1397, 1398, 1399, 1400, 1402, 1403, 1404, 1405, 1406, 1407,
-     1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1392, 1416,
-     1417, 1418, 1419, 1420, 1421, 1423, 1424, 1425, 1426, 1427,
-     1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437,
-
-     1438, 1439, 1440, 1441, 1443, 1445, 1446, 1447, 1450, 1452,
-     1453, 1454, 1455, 1456, 1457, 1458, 1459, 1461, 1462, 1463,
-     1464, 1458, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472,
-     1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482,
-     1483, 1484, 1485, 1487, 1488, 1489, 1490, 1491, 1492, 1493,
-     1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1504,
-     1506, 1507, 1508, 1509, 1510, 1511, 1512, 1514, 1516, 1517,
-     1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527,
-     1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537,
-     1538, 1539, 1540, 1541, 1542, 1544, 1545, 1546, 1547, 1530,
-
-     1548, 1549, 1550, 1551, 1552, 1553, 1555, 1557, 1558, 1560,
-     1561, 1562, 1563, 1564, 1566, 1567, 1568, 1570, 1571, 1572,
-     1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582,
-     1583, 1578, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591,
-     1592, 1593, 1575, 1596, 1597, 1599, 1600, 1601, 1602, 1603,
-     1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613,
-     1614, 1616, 1617, 1618, 1619, 1620, 1622, 1623, 1624, 1626,
-     1628, 1630, 1631, 1632, 1633, 1634, 1636, 1637, 1638, 1639,
-     1640, 1641, 1642, 1643, 1644, 1645, 1646, 1648, 1649, 1650,
-     1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661,
+      792,  807,  808,  809,  810,  811,  807,  812,  807,  814,
+      815,  807,  813,  813,  816,  807,  813,  817,  813,  818,
+      819,  820,  821,  822,  823,  824,  826,  813,  827,  828,
+      829,  830,  827,  831,  833,  834,  835,  836,  837,  839,
+      842,  843,  844,  845,  846,  847,  848,  849,  850,  851,
+      852,  853,  854,  855,  856,  857,  858,  859,  860,  861,
+      862,  863,  864,  865,  866,  867,  868,  869,  870,  871,
+      872,  873,  874,  875,  880,  881,  882,  883,  884,  885,
+
+      886,  887,  888,  889,  890,  891,  893,  894,  895,  896,
+      897,  898,  899,  900,  901,  902,  903,  904,  906,  907,
+      908,  909,  910,  911,  912,  913,  914,  915,  916,  917,
+      918,  919,  920,  921,  922,  923,  924,  925,  922,  926,
+      927,  928,  929,  930,  931,  932,  933,  934,  935,  936,
+      937,  932,  938,  932,  939,  940,  941,  942,  943,  944,
+      945,  930,  947,  948,  949,  950,  951,  953,  954,  955,
+      956,  957,  958,  959,  960,  961,  962,  963,  964,  965,
+      966,  967,  968,  969,  970,  971,  972,  974,  975,  976,
+      977,  978,  979,  980,  981,  982,  983,  984,  985,  986,
+
+      987,  988,  989,  990,  991,  992,  993,  994,  995,  996,
+      997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+     1007, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
+     1018, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1029,
+     1030, 1031, 1032, 1033, 1034, 1035, 1037, 1038, 1039, 1040,
+     1041, 1043, 1044, 1045, 1046, 1047, 1049, 1051, 1052, 1053,
+     1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1063, 1065,
+     1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
+     1077, 1078, 1079, 1080, 1081, 1082, 1084, 1086, 1087, 1089,
+     1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1100,
 
-     1662, 1663, 1664, 1666, 1667, 1668, 1669, 1670, 1671, 1672,
-     1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682,
-     1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692,
-     1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1703,
-     1704, 1705, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715,
-     1716, 1717, 1718, 1719, 1720, 1721, 1723, 1724, 1726, 1727,
-     1728, 1729, 1731, 1732, 1733, 1734, 1736, 1738, 1739, 1740,
-     1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750,
-     1753, 1755, 1756, 1757, 1759, 1760, 1761, 1762, 1763, 1764,
-     1765, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775,
-
-     1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785,
-     1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1772, 1794,
-     1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804,
-     1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814,
-     1815, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1826,
-     1827, 1829, 1830, 1831, 1833, 1834, 1835, 1838, 1839, 1840,
-     1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1851,
-     1852, 1853, 1854, 1855, 1856, 1857, 1859, 1860, 1861, 1862,
-     1863, 1864, 1865, 1866, 1867, 1868, 1869, 1871, 1872, 1873,
-     1874, 1875, 1876, 1877, 1878, 1880, 1882, 1884, 1885, 1886,
-
-     1877, 1887, 1888, 1889, 1890, 1891, 1893, 1894, 1895, 1896,
-     1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1906, 1907,
-     1908, 1909, 1910, 1912, 1913, 1914, 1915, 1916, 1917, 1918,
-     1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928,
-     1929, 1930, 1931, 1932, 1933, 1934, 1935, 1937, 1938, 1939,
-     1932, 1940, 1942, 1943, 1944, 1945, 1946, 1947, 1949, 1950,
-     1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960,
-     1961, 1962, 1964, 1965, 1966, 1967, 1969, 1970, 1971, 1972,
-     1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982,
-     1983, 1984, 1985, 1986, 1988, 1989, 1990, 1991, 1992, 1993,
-
-     1994, 1995, 1996, 1998, 1999, 2000, 2001, 2002, 2003, 2004,
-     2005, 2006, 2007, 2008, 1991, 2009, 2010, 2011, 2012, 2013,
-     2014, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025,
-     2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035,
-     2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045,
-     2047, 2048, 2049, 2050, 2051, 2052, 2053, 2055, 2056, 2057,
-     2058, 2059, 2061, 2062, 2063, 2066, 2067, 2068, 2070, 2071,
-     2072, 2073, 2074, 2075, 2076, 2079, 2080, 2082, 2084, 2085,
-     2086, 2087, 2088, 2089, 2090, 2093, 2094, 2095, 2096, 2097,
-     2098, 2099, 2100, 2101, 2102, 2103, 2104, 2106, 2107, 2108,
-
-     2109, 2110, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119,
-     2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2129, 2131,
-     2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2142,
-     2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152,
-     2153, 2154, 2155, 2157, 2158, 2159, 2151, 2160, 2161, 2162,
-     2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173,
-     2174, 2175, 2176, 2177, 2179, 2180, 2182, 2183, 2184, 2185,
-     2186, 2187, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196,
-     2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206,
-     2207, 2208, 2209, 2211, 2212, 2214, 2215, 2216, 2217, 2218,
-
-     2219, 2220, 2221, 2223, 2224, 2225, 2226, 2227, 2229, 2230,
-     2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240,
-     2241, 2243, 2244, 2245, 2246, 2247, 2250, 2251, 2252, 2253,
-     2254, 2255, 2256, 2257, 2258, 2261, 2262, 2264, 2265, 2266,
-     2268, 2269, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278,
-     2279, 2280, 2282, 2285, 2286, 2287, 2288, 2289, 2290, 2291,
-     2292, 2293, 2295, 2296, 2298, 2300, 2303, 2306, 2307, 2309,
-     2310, 2311, 2313, 2314, 2315, 2317, 2318, 2319, 2321, 2322,
-     2323, 2324, 2325, 2327, 2329, 2330, 2331, 2333, 2334, 2335,
-     2336, 2337, 2338, 2339, 2340, 2341, 2342, 2344, 2345, 2346,
-
-     2347, 2348, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359,
-     2360, 2364, 2365, 2366, 2367, 2368, 2370, 2371, 2373, 2374,
-     2375, 2379, 2380, 2382, 2383, 2384, 2385, 2386, 2387, 2388,
-     2391, 2392, 2394, 2395, 2396, 2398, 2399, 2400, 2401, 2402,
-     2405, 2406, 2407, 2408, 2409, 2412, 2414, 2415, 2416, 2417,
-     2418, 2419, 2420, 2421, 2422, 2424, 2425, 2426, 2427, 2429,
-     2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2440, 2441,
-     2442, 2443, 2444, 2445, 2447, 2448, 2449, 2450, 2451, 2452,
-     2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462,
-     2463, 2464, 2465, 2466, 2467, 2470, 2473, 2475, 2476, 2477,
-
-     2478, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489,
-     2490, 2491, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2501,
-     2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511,
-     2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521,
-     2522, 2523, 2524, 2525, 2526, 2527, 2530, 2531, 2532, 2534,
-     2536, 2538, 2539, 2540, 2543, 2544, 2545, 2546, 2547, 2548,
-     2550, 2554, 2554, 2554, 2554, 2554, 2554, 2555, 2555, 2555,
-     2555, 2555, 2555, 2556, 2556, 2557, 2557, 2558, 2560,  653,
-     2558, 2558, 2558, 2559,  652, 2559, 2559, 2559, 2559, 2561,
-      651, 2561, 2561, 2561, 2561,  650,  649,  648,  647,  646,
-
-      645,  644,  643,  642,  641,  640,  639,  638,  637,  636,
-      635,  634,  632,  631,  630,  629,  628,  627,  626,  625,
-      623,  621,  620,  619,  618,  617,  616,  615,  614,  613,
-      612,  611,  610,  609,  608,  607,  606,  605,  604,  603,
-      602,  601,  600,  599,  598,  597,  596,  595,  594,  593,
-      592,  591,  590,  589,  588,  587,  586,  585,  584,  583,
-      582,  581,  580,  578,  576,  575,  574,  573,  571,  570,
-      569,  568,  567,  565,  564,  563,  561,  558,  557,  556,
-      555,  554,  552,  551,  550,  547,  546,  545,  544,  543,
-      542,  541,  540,  539,  538,  537,  536,  535,  534,  533,
-
-      532,  531,  530,  529,  527,  526,  525,  524,  523,  522,
-      521,  520,  519,  518,  517,  516,  515,  514,  513,  511,
-      510,  509,  507,  506,  505,  504,  503,  502,  501,  500,
-      499,  498,  496,  495,  493,  492,  491,  490,  488,  487,
-      486,  485,  484,  483,  477,  476,  475,  465,  461,  458,
-      456,  455,  454,  453,  452,  451,  450,  449,  448,  447,
-      446,  445,  444,  443,  442,  441,  440,  439,  438,  437,
-      436,  435,  434,  433,  432,  431,  430,  429,  428,  427,
-      426,  425,  424,  423,  422,  421,  420,  419,  418,  417,
-      416,  415,  414,  413,  412,  411,  410,  409,  408,  406,
-
-      405,  404,  403,  402,  401,  400,  399,  398,  397,  396,
-      394,  393,  392,  391,  390,  389,  388,  387,  386,  385,
-      383,  382,  381,  380,  379,  378,  377,  376,  375,  374,
-      373,  372,  371,  370,  369,  368,  367,  366,  365,  364,
-      363,  361,  360,  359,  357,  355,  354,  353,  351,  350,
-      349,  348,  347,  345,  344,  343,  342,  340,  335,  334,
-      333,  332,  331,  330,  329,  327,  326,  325,  324,  323,
-      322,  320,  319,  318,  317,  316,  315,  314,  313,  311,
-      310,  309,  308,  307,  306,  304,  303,  302,  301,  300,
-      299,  298,  296,  295,  294,  293,  292,  291,  290,  289,
-
-      288,  287,  286,  285,  284,  283,  282,  281,  280,  279,
-      278,  277,  276,  275,  274,  273,  272,  269,  263,  259,
-      258,  257,  256,  255,  252,  251,  250,  249,  248,  247,
-      246,  245,  244,  243,  242,  241,  240,  238,  237,  236,
-      235,  234,  233,  232,  231,  229,  228,  227,  226,  225,
-      222,  221,  220,  219,  218,  217,  216,  215,  214,  213,
-      212,  210,  208,  207,  206,  205,  204,  202,  201,  200,
-      199,  196,  195,  194,  193,  192,  191,  190,  189,  188,
-      187,  184,  183,  182,  181,  180,  179,  178,  177,  176,
-      175,  174,  173,  172,  170,  169,  168,  166,  164,  163,
-
-      162,  161,  160,  159,  158,  156,  155,  154,  153,  152,
-      151,  150,  149,  148,  147,  145,  144,  143,  142,  141,
-      140,  139,  138,  137,  135,  134,  126,  125,  124,  123,
-      122,  121,  120,  119,  117,  114,  112,  111,  110,  109,
-      107,  106,  102,  101,  100,   99,   98,   97,   95,   94,
-       92,   91,   90,   89,   88,   87,   86,   84,   83,   82,
-       80,   79,   77,   76,   75,   74,   73,   72,   71,   70,
-       69,   63,   57,   55,   53,   50,   43,   42,   41,   37,
-       35,   26,   25,   24,   22,   21,   12,   10,    9,    7,
-        5, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-
-     2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-     2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-     2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-     2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553,
-     2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553, 2553
+     1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111,
+     1112, 1113, 1114, 1115, 1116, 1117, 1118, 1113, 1119, 1120,
+     1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130,
+     1131, 1132, 1133, 1134, 1135, 1136, 1138, 1139, 1140, 1141,
+     1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
+     1152, 1153, 1154, 1157, 1158, 1159, 1160, 1161, 1162, 1163,
+     1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
+     1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+     1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193,
+     1194, 1195, 1196, 1197, 1198, 1200, 1201, 1202, 1203, 1204,
+
+     1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1215,
+     1216, 1217, 1218, 1219, 1220, 1221, 1223, 1224, 1225, 1226,
+     1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237,
+     1238, 1240, 1242, 1243, 1244, 1246, 1247, 1249, 1251, 1252,
+     1253, 1254, 1255, 1256, 1257, 1259, 1260, 1261, 1262, 1263,
+     1264, 1275, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1286,
+     1288, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298,
+     1299, 1300, 1301, 1302, 1303, 1304, 1305, 1307, 1308, 1309,
+     1310, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320,
+     1321, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331,
+
+     1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341,
+     1342, 1344, 1345, 1347, 1348, 1349, 1350, 1351, 1352, 1353,
+     1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363,
+     1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1372,
+     1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382,
+     1383, 1385, 1386, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
+     1395, 1396, 1398, 1399, 1400, 1401, 1402, 1403, 1405, 1406,
+     1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416,
+     1417, 1418, 1395, 1419, 1420, 1421, 1422, 1423, 1424, 1426,
+     1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436,
+
+     1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1446, 1448,
+     1449, 1450, 1453, 1455, 1456, 1457, 1458, 1459, 1460, 1461,
+     1462, 1464, 1465, 1466, 1467, 1461, 1468, 1469, 1470, 1471,
+     1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481,
+     1482, 1483, 1484, 1485, 1486, 1487, 1488, 1490, 1491, 1492,
+     1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502,
+     1503, 1504, 1505, 1507, 1509, 1510, 1511, 1512, 1513, 1514,
+     1515, 1517, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526,
+     1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536,
+     1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1547,
+
+     1548, 1549, 1550, 1533, 1551, 1552, 1553, 1554, 1555, 1556,
+     1557, 1559, 1561, 1562, 1564, 1565, 1566, 1567, 1568, 1570,
+     1571, 1572, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581,
+     1582, 1583, 1584, 1585, 1586, 1587, 1582, 1588, 1589, 1590,
+     1591, 1592, 1593, 1594, 1595, 1596, 1597, 1579, 1600, 1601,
+     1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612,
+     1613, 1614, 1615, 1616, 1617, 1618, 1620, 1621, 1622, 1623,
+     1624, 1626, 1627, 1628, 1630, 1632, 1634, 1635, 1636, 1637,
+     1638, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648,
+     1649, 1650, 1652, 1653, 1654, 1656, 1657, 1658, 1659, 1660,
+
+     1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1670, 1671,
+     1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681,
+     1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691,
+     1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701,
+     1702, 1703, 1704, 1705, 1706, 1708, 1709, 1710, 1713, 1714,
+     1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724,
+     1725, 1726, 1728, 1729, 1731, 1732, 1733, 1734, 1736, 1737,
+     1738, 1739, 1741, 1743, 1744, 1745, 1746, 1747, 1748, 1749,
+     1750, 1751, 1752, 1753, 1754, 1755, 1758, 1760, 1761, 1762,
+     1764, 1765, 1766, 1767, 1768, 1769, 1770, 1772, 1773, 1774,
+
+     1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
+     1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794,
+     1795, 1796, 1797, 1798, 1777, 1799, 1800, 1801, 1802, 1803,
+     1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813,
+     1814, 1815, 1816, 1817, 1818, 1819, 1820, 1822, 1823, 1824,
+     1825, 1826, 1827, 1828, 1829, 1830, 1832, 1833, 1835, 1836,
+     1837, 1839, 1840, 1841, 1844, 1845, 1846, 1847, 1848, 1849,
+     1850, 1851, 1852, 1853, 1854, 1855, 1857, 1858, 1859, 1860,
+     1861, 1862, 1863, 1865, 1866, 1867, 1868, 1869, 1870, 1871,
+     1872, 1873, 1874, 1875, 1877, 1878, 1879, 1880, 1881, 1882,
+
+     1883, 1884, 1886, 1888, 1890, 1891, 1892, 1883, 1893, 1894,
+     1895, 1896, 1897, 1899, 1900, 1901, 1902, 1903, 1904, 1905,
+     1906, 1907, 1908, 1909, 1910, 1912, 1913, 1914, 1915, 1916,
+     1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927,
+     1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937,
+     1938, 1939, 1940, 1941, 1942, 1944, 1945, 1938, 1946, 1947,
+     1949, 1950, 1951, 1952, 1953, 1954, 1956, 1957, 1958, 1959,
+     1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969,
+     1971, 1972, 1973, 1974, 1976, 1977, 1978, 1979, 1980, 1981,
+     1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991,
+
+     1992, 1993, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002,
+     2003, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013,
+     2014, 2015, 1998, 2016, 2017, 2018, 2019, 2020, 2021, 2024,
+     2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
+     2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044,
+     2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2055,
+     2056, 2057, 2058, 2059, 2060, 2061, 2063, 2064, 2065, 2066,
+     2067, 2069, 2070, 2071, 2074, 2075, 2076, 2078, 2079, 2080,
+     2081, 2082, 2083, 2084, 2087, 2088, 2090, 2092, 2093, 2094,
+     2095, 2096, 2097, 2098, 2101, 2102, 2103, 2104, 2105, 2106,
+
+     2107, 2108, 2109, 2110, 2111, 2112, 2114, 2115, 2116, 2117,
+     2118, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128,
+     2129, 2130, 2131, 2132, 2133, 2134, 2135, 2137, 2139, 2140,
+     2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2151,
+     2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161,
+     2162, 2163, 2164, 2166, 2167, 2168, 2160, 2169, 2170, 2171,
+     2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182,
+     2183, 2184, 2185, 2186, 2188, 2189, 2191, 2192, 2193, 2194,
+     2195, 2196, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205,
+     2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215,
+
+     2216, 2217, 2218, 2220, 2221, 2222, 2224, 2225, 2226, 2227,
+     2228, 2229, 2230, 2231, 2233, 2234, 2235, 2236, 2237, 2239,
+     2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249,
+     2250, 2251, 2253, 2254, 2255, 2256, 2257, 2260, 2261, 2262,
+     2263, 2264, 2265, 2266, 2267, 2268, 2271, 2272, 2274, 2275,
+     2276, 2278, 2279, 2281, 2282, 2283, 2284, 2285, 2286, 2287,
+     2288, 2289, 2290, 2292, 2295, 2296, 2297, 2298, 2299, 2300,
+     2301, 2302, 2303, 2304, 2306, 2307, 2309, 2311, 2314, 2317,
+     2318, 2320, 2321, 2322, 2324, 2325, 2326, 2328, 2329, 2330,
+     2332, 2333, 2334, 2335, 2336, 2338, 2340, 2341, 2342, 2344,
+
+     2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2355,
+     2356, 2357, 2358, 2359, 2360, 2364, 2365, 2366, 2367, 2368,
+     2369, 2370, 2371, 2372, 2376, 2377, 2378, 2379, 2380, 2382,
+     2383, 2385, 2386, 2387, 2391, 2392, 2394, 2395, 2396, 2397,
+     2398, 2399, 2400, 2403, 2404, 2405, 2407, 2408, 2409, 2411,
+     2412, 2413, 2414, 2415, 2418, 2419, 2420, 2421, 2422, 2425,
+     2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436,
+     2438, 2439, 2440, 2441, 2443, 2445, 2446, 2447, 2448, 2449,
+     2450, 2451, 2452, 2454, 2455, 2456, 2457, 2458, 2459, 2461,
+     2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471,
+
+     2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481,
+     2482, 2483, 2486, 2489, 2491, 2492, 2493, 2494, 2497, 2498,
+     2499, 2500, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2510,
+     2511, 2512, 2513, 2514, 2515, 2516, 2518, 2519, 2520, 2521,
+     2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531,
+     2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541,
+     2542, 2543, 2544, 2547, 2548, 2549, 2551, 2553, 2555, 2556,
+     2557, 2560, 2561, 2562, 2563, 2564, 2565, 2567, 2571, 2571,
+     2571, 2571, 2571, 2571, 2572, 2572, 2572, 2572, 2572, 2572,
+     2573, 2573, 2574, 2574, 2575, 2577,  653, 2575, 2575, 2575,
+
+     2576,  652, 2576, 2576, 2576, 2576, 2578,  651, 2578, 2578,
+     2578, 2578,  650,  649,  648,  647,  646,  645,  644,  643,
+      642,  641,  640,  639,  638,  637,  636,  635,  634,  632,
+      631,  630,  629,  628,  627,  626,  625,  623,  621,  620,
+      619,  618,  617,  616,  615,  614,  613,  612,  611,  610,
+      609,  608,  607,  606,  605,  604,  603,  602,  601,  600,
+      599,  598,  597,  596,  595,  594,  593,  592,  591,  590,
+      589,  588,  587,  586,  585,  584,  583,  582,  581,  580,
+      578,  576,  575,  574,  573,  571,  570,  569,  568,  567,
+      565,  564,  563,  561,  558,  557,  556,  555,  554,  552,
+
+      551,  550,  547,  546,  545,  544,  543,  542,  541,  540,
+      539,  538,  537,  536,  535,  534,  533,  532,  531,  530,
+      529,  527,  526,  525,  524,  523,  522,  521,  520,  519,
+      518,  517,  516,  515,  514,  513,  511,  510,  509,  507,
+      506,  505,  504,  503,  502,  501,  500,  499,  498,  496,
+      495,  493,  492,  491,  490,  488,  487,  486,  485,  484,
+      483,  477,  476,  475,  465,  461,  458,  456,  455,  454,
+      453,  452,  451,  450,  449,  448,  447,  446,  445,  444,
+      443,  442,  441,  440,  439,  438,  437,  436,  435,  434,
+      433,  432,  431,  430,  429,  428,  427,  426,  425,  424,
+
+      423,  422,  421,  420,  419,  418,  417,  416,  415,  414,
+      413,  412,  411,  410,  409,  408,  406,  405,  404,  403,
+      402,  401,  400,  399,  398,  397,  396,  394,  393,  392,
+      391,  390,  389,  388,  387,  386,  385,  383,  382,  381,
+      380,  379,  378,  377,  376,  375,  374,  373,  372,  371,
+      370,  369,  368,  367,  366,  365,  364,  363,  361,  360,
+      359,  357,  355,  354,  353,  351,  350,  349,  348,  347,
+      345,  344,  343,  342,  340,  335,  334,  333,  332,  331,
+      330,  329,  327,  326,  325,  324,  323,  322,  320,  319,
+      318,  317,  316,  315,  314,  313,  311,  310,  309,  308,
+
+      307,  306,  304,  303,  302,  301,  300,  299,  298,  296,
+      295,  294,  293,  292,  291,  290,  289,  288,  287,  286,
+      285,  284,  283,  282,  281,  280,  279,  278,  277,  276,
+      275,  274,  273,  272,  269,  263,  259,  258,  257,  256,
+      255,  252,  251,  250,  249,  248,  247,  246,  245,  244,
+      243,  242,  241,  240,  238,  237,  236,  235,  234,  233,
+      232,  231,  229,  228,  227,  226,  225,  222,  221,  220,
+      219,  218,  217,  216,  215,  214,  213,  212,  210,  208,
+      207,  206,  205,  204,  202,  201,  200,  199,  196,  195,
+      194,  193,  192,  191,  190,  189,  188,  187,  184,  183,
+
+      182,  181,  180,  179,  178,  177,  176,  175,  174,  173,
+      172,  170,  169,  168,  166,  164,  163,  162,  161,  160,
+      159,  158,  156,  155,  154,  153,  152,  151,  150,  149,
+      148,  147,  145,  144,  143,  142,  141,  140,  139,  138,
+      137,  135,  134,  126,  125,  124,  123,  122,  121,  120,
+      119,  117,  114,  112,  111,  110,  109,  107,  106,  102,
+      101,  100,   99,   98,   97,   95,   94,   92,   91,   90,
+       89,   88,   87,   86,   84,   83,   82,   80,   79,   77,
+       76,   75,   74,   73,   72,   71,   70,   69,   63,   57,
+       55,   53,   50,   43,   42,   41,   37,   35,   26,   25,
+
+       24,   22,   21,   12,   10,    9,    7,    5, 2570, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,
+     2570, 2570, 2570, 2570, 2570, 2570, 2570
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1843,7 +1850,7 @@ static void ChangeToBuffer(sbyte* szFileName,
 static void ChangeToPrevBuffer(void);
 static void IncActLine(void);
 static int yywrap(void);
-#line 1847 "lex.yy.c"
+#line 1854 "lex.yy.c"
 
 /* Macros after this point can all be overridden by user definitions in
  * section 1.
@@ -1994,7 +2001,7 @@ YY_DECL
 
 
  /* Estado COMMENTSTATE para reconocer comentarios multilinea */
-#line 1998 "lex.yy.c"
+#line 2005 "lex.yy.c"
 
 	if ( yy_init )
 		{
@@ -2045,13 +2052,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 2554 )
+				if ( yy_current_state >= 2571 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 2592 );
+		while ( yy_base[yy_current_state] != 2609 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -2745,1114 +2752,1119 @@ YY_RULE_SETUP
 #line 228 "crisolscript.l"
 { return tSETSCRIPTAT;             }
 	YY_BREAK
-/* Objeto Entity / Metodos comunes */
 case 128:
 YY_RULE_SETUP
-#line 231 "crisolscript.l"
-{ return tGETNAME;                      }
+#line 229 "crisolscript.l"
+{ return tCALCULEBOUNDEDPATHLENGHT; }
 	YY_BREAK
+/* Objeto Entity / Metodos comunes */
 case 129:
 YY_RULE_SETUP
 #line 232 "crisolscript.l"
-{ return tSETNAME;                      }
+{ return tGETNAME;                      }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 233 "crisolscript.l"
-{ return tGETTYPE;                      }
+{ return tSETNAME;                      }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 234 "crisolscript.l"
-{ return tGETENTITYTYPE;                }
+{ return tGETTYPE;                      }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 235 "crisolscript.l"
-{ return tSAY;                          }
+{ return tGETENTITYTYPE;                }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
 #line 236 "crisolscript.l"
-{ return tSHUTUP;                       }
+{ return tSAY;                          }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
 #line 237 "crisolscript.l"
-{ return tISSAYING;                     }
+{ return tSHUTUP;                       }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
 #line 238 "crisolscript.l"
-{ return tATTACHGFX;                    }
+{ return tISSAYING;                     }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
 #line 239 "crisolscript.l"
-{ return tRELEASEGFX;                   }
+{ return tATTACHGFX;                    }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
 #line 240 "crisolscript.l"
-{ return tRELEASEALLGFX;                }
+{ return tRELEASEGFX;                   }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
 #line 241 "crisolscript.l"
-{ return tISGFXATTACHED;                }
+{ return tRELEASEALLGFX;                }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
 #line 242 "crisolscript.l"
-{ return tGETNUMITEMSINCONTAINER;       }
+{ return tISGFXATTACHED;                }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
 #line 243 "crisolscript.l"
-{ return tISITEMINCONTAINER;            }
+{ return tGETNUMITEMSINCONTAINER;       }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
 #line 244 "crisolscript.l"
-{ return tTRANSFERITEMTOCONTAINER;      }
+{ return tISITEMINCONTAINER;            }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 245 "crisolscript.l"
-{ return tINSERTITEMINCONTAINER;        }
+{ return tTRANSFERITEMTOCONTAINER;      }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
 #line 246 "crisolscript.l"
-{ return tREMOVEITEMOFCONTAINER;        }
+{ return tINSERTITEMINCONTAINER;        }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
 #line 247 "crisolscript.l"
-{ return tSETANIMTEMPLATESTATE;         }
+{ return tREMOVEITEMOFCONTAINER;        }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
 #line 248 "crisolscript.l"
-{ return tSETPORTRAITANIMTEMPLATESTATE; }
+{ return tSETANIMTEMPLATESTATE;         }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
 #line 249 "crisolscript.l"
-{ return tSETLIGHT;                     }
+{ return tSETPORTRAITANIMTEMPLATESTATE; }
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
 #line 250 "crisolscript.l"
-{ return tGETLIGHT;                     }
+{ return tSETLIGHT;                     }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
 #line 251 "crisolscript.l"
-{ return tGETXPOS;                      }
+{ return tGETLIGHT;                     }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
 #line 252 "crisolscript.l"
-{ return tGETYPOS;                      }
+{ return tGETXPOS;                      }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 253 "crisolscript.l"
-{ return tGETELEVATION;                 }
+{ return tGETYPOS;                      }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 254 "crisolscript.l"
-{ return tSETELEVATION;                 }
+{ return tGETELEVATION;                 }
 	YY_BREAK
-/* Objeto Entity / Metodos comunes para Items / Obj. de escenario / Paredes */
 case 152:
 YY_RULE_SETUP
-#line 257 "crisolscript.l"
-{ return tGETLOCALATTRIBUTE;            }
+#line 255 "crisolscript.l"
+{ return tSETELEVATION;                 }
 	YY_BREAK
+/* Objeto Entity / Metodos comunes para Items / Obj. de escenario / Paredes */
 case 153:
 YY_RULE_SETUP
 #line 258 "crisolscript.l"
-{ return tSETLOCALATTRIBUTE;            }
+{ return tGETLOCALATTRIBUTE;            }
 	YY_BREAK
-/* Objeto Entity / Items / Metodos */
 case 154:
 YY_RULE_SETUP
-#line 261 "crisolscript.l"
-{ return tGETOWNER;           }
+#line 259 "crisolscript.l"
+{ return tSETLOCALATTRIBUTE;            }
 	YY_BREAK
+/* Objeto Entity / Items / Metodos */
 case 155:
 YY_RULE_SETUP
 #line 262 "crisolscript.l"
-{ return tGETCLASS;           } /* Valida tambien para criaturas */
+{ return tGETOWNER;           }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 263 "crisolscript.l"
-{ return tGETINCOMBATUSECOST; }
+{ return tGETCLASS;           } /* Valida tambien para criaturas */
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 264 "crisolscript.l"
-{ return tGETGLOBALATTRIBUTE; }
+{ return tGETINCOMBATUSECOST; }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 265 "crisolscript.l"
-{ return tSETGLOBALATTRIBUTE; }
+{ return tGETGLOBALATTRIBUTE; }
 	YY_BREAK
-/* Objeto Entity / Paredes / Metodos */
 case 159:
 YY_RULE_SETUP
-#line 268 "crisolscript.l"
-{ return tGETWALLORIENTATION; }
+#line 266 "crisolscript.l"
+{ return tSETGLOBALATTRIBUTE; }
 	YY_BREAK
+/* Objeto Entity / Paredes / Metodos */
 case 160:
 YY_RULE_SETUP
 #line 269 "crisolscript.l"
-{ return tBLOCKACCESS;        }
+{ return tGETWALLORIENTATION; }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 270 "crisolscript.l"
-{ return tUNBLOCKACCESS;      }
+{ return tBLOCKACCESS;        }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 271 "crisolscript.l"
-{ return tISACCESSBLOCKED;    }
+{ return tUNBLOCKACCESS;      }
 	YY_BREAK
-/* Objeto Entity / Criaturas / Metodos */
 case 163:
 YY_RULE_SETUP
-#line 274 "crisolscript.l"
-{ return tSETSYMPTOM;              }
+#line 272 "crisolscript.l"
+{ return tISACCESSBLOCKED;    }
 	YY_BREAK
+/* Objeto Entity / Criaturas / Metodos */
 case 164:
 YY_RULE_SETUP
 #line 275 "crisolscript.l"
-{ return tISSYMPTOMACTIVE;         }
+{ return tSETSYMPTOM;              }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 276 "crisolscript.l"
-{ return tGETGENRE;                }
+{ return tISSYMPTOMACTIVE;         }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
 #line 277 "crisolscript.l"
-{ return tGETHEALTH;               }
+{ return tGETGENRE;                }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
 #line 278 "crisolscript.l"
-{ return tSETHEALTH;               }
+{ return tGETHEALTH;               }
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
 #line 279 "crisolscript.l"
-{ return tGETEXTENDEDATTRIBUTE;    }
+{ return tSETHEALTH;               }
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
 #line 280 "crisolscript.l"
-{ return tSETEXTENDEDATTRIBUTE;    }
+{ return tGETEXTENDEDATTRIBUTE;    }
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
 #line 281 "crisolscript.l"
-{ return tGETLEVEL;                }
+{ return tSETEXTENDEDATTRIBUTE;    }
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
 #line 282 "crisolscript.l"
-{ return tSETLEVEL;                }
+{ return tGETLEVEL;                }
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
 #line 283 "crisolscript.l"
-{ return tGETEXPERIENCE;           }
+{ return tSETLEVEL;                }
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
 #line 284 "crisolscript.l"
-{ return tSETEXPERIENCE;           }
+{ return tGETEXPERIENCE;           }
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
 #line 285 "crisolscript.l"
-{ return tGETINCOMBATACTIONPOINTS; }
+{ return tSETEXPERIENCE;           }
 	YY_BREAK
 case 175:
 YY_RULE_SETUP
 #line 286 "crisolscript.l"
-{ return tGETACTIONPOINTS;         }
+{ return tGETINCOMBATACTIONPOINTS; }
 	YY_BREAK
 case 176:
 YY_RULE_SETUP
 #line 287 "crisolscript.l"
-{ return tSETACTIONPOINTS;         }
+{ return tGETACTIONPOINTS;         }
 	YY_BREAK
 case 177:
 YY_RULE_SETUP
 #line 288 "crisolscript.l"
-{ return tISHABILITYACTIVE;        }
+{ return tSETACTIONPOINTS;         }
 	YY_BREAK
 case 178:
 YY_RULE_SETUP
 #line 289 "crisolscript.l"
-{ return tSETHABILITY;             }
+{ return tISHABILITYACTIVE;        }
 	YY_BREAK
 case 179:
 YY_RULE_SETUP
 #line 290 "crisolscript.l"
-{ return tUSEHABILITY;             }         
+{ return tSETHABILITY;             }
 	YY_BREAK
 case 180:
 YY_RULE_SETUP
 #line 291 "crisolscript.l"
-{ return tISRUNMODEACTIVE;         }
+{ return tUSEHABILITY;             }         
 	YY_BREAK
 case 181:
 YY_RULE_SETUP
 #line 292 "crisolscript.l"
-{ return tSETRUNMODE;              }
+{ return tISRUNMODEACTIVE;         }
 	YY_BREAK
 case 182:
 YY_RULE_SETUP
 #line 293 "crisolscript.l"
-{ return tMOVETO;                  }
+{ return tSETRUNMODE;              }
 	YY_BREAK
 case 183:
 YY_RULE_SETUP
 #line 294 "crisolscript.l"
-{ return tISMOVING;                }
+{ return tMOVETO;                  }
 	YY_BREAK
 case 184:
 YY_RULE_SETUP
 #line 295 "crisolscript.l"
-{ return tSTOPMOVING;              }
+{ return tISMOVING;                }
 	YY_BREAK
 case 185:
 YY_RULE_SETUP
 #line 296 "crisolscript.l"
-{ return tEQUIPITEM;               }
+{ return tSTOPMOVING;              }
 	YY_BREAK
 case 186:
 YY_RULE_SETUP
 #line 297 "crisolscript.l"
-{ return tREMOVEITEMEQUIPPED;      }
+{ return tEQUIPITEM;               }
 	YY_BREAK
 case 187:
 YY_RULE_SETUP
 #line 298 "crisolscript.l"
-{ return tGETITEMEQUIPPED;         }
+{ return tREMOVEITEMEQUIPPED;      }
 	YY_BREAK
 case 188:
 YY_RULE_SETUP
 #line 299 "crisolscript.l"
-{ return tISITEMEQUIPPED;          }
+{ return tGETITEMEQUIPPED;         }
 	YY_BREAK
 case 189:
 YY_RULE_SETUP
 #line 300 "crisolscript.l"
-{ return tDROPITEM;                }
+{ return tISITEMEQUIPPED;          }
 	YY_BREAK
 case 190:
 YY_RULE_SETUP
 #line 301 "crisolscript.l"
-{ return tUSEITEM;                 }
+{ return tDROPITEM;                }
 	YY_BREAK
 case 191:
 YY_RULE_SETUP
 #line 302 "crisolscript.l"
-{ return tMANIPULATE;              }
+{ return tUSEITEM;                 }
 	YY_BREAK
 case 192:
 YY_RULE_SETUP
 #line 303 "crisolscript.l"
-{ return tSETTRANSPARENTMODE;      }
+{ return tMANIPULATE;              }
 	YY_BREAK
 case 193:
 YY_RULE_SETUP
 #line 304 "crisolscript.l"
-{ return tISTRANSPARENTMODEACTIVE; }
+{ return tSETTRANSPARENTMODE;      }
 	YY_BREAK
 case 194:
 YY_RULE_SETUP
 #line 305 "crisolscript.l"
-{ return tCHANGEANIMORIENTATION;   }
+{ return tISTRANSPARENTMODEACTIVE; }
 	YY_BREAK
 case 195:
 YY_RULE_SETUP
 #line 306 "crisolscript.l"
-{ return tGETANIMORIENTATION;      }
+{ return tCHANGEANIMORIENTATION;   }
 	YY_BREAK
 case 196:
 YY_RULE_SETUP
 #line 307 "crisolscript.l"
-{ return tSETALINGMENT;            }
+{ return tGETANIMORIENTATION;      }
 	YY_BREAK
 case 197:
 YY_RULE_SETUP
 #line 308 "crisolscript.l"
-{ return tSETALINGMENTWITH;        }
+{ return tSETALINGMENT;            }
 	YY_BREAK
 case 198:
 YY_RULE_SETUP
 #line 309 "crisolscript.l"
-{ return tSETALINGMENTAGAINST;     }
+{ return tSETALINGMENTWITH;        }
 	YY_BREAK
 case 199:
 YY_RULE_SETUP
 #line 310 "crisolscript.l"
-{ return tGETALINGMENT;            }
+{ return tSETALINGMENTAGAINST;     }
 	YY_BREAK
 case 200:
 YY_RULE_SETUP
 #line 311 "crisolscript.l"
-{ return tHITENTITY;               }
+{ return tGETALINGMENT;            }
 	YY_BREAK
 case 201:
 YY_RULE_SETUP
 #line 312 "crisolscript.l"
-{ return tISGHOSTMOVEMODEACTIVE;   }
+{ return tHITENTITY;               }
 	YY_BREAK
 case 202:
 YY_RULE_SETUP
 #line 313 "crisolscript.l"
-{ return tSETGHOSTMOVEMODE;        }
+{ return tISGHOSTMOVEMODEACTIVE;   }
 	YY_BREAK
 case 203:
 YY_RULE_SETUP
 #line 314 "crisolscript.l"
-{ return tGETRANGE;                }
+{ return tSETGHOSTMOVEMODE;        }
 	YY_BREAK
 case 204:
 YY_RULE_SETUP
 #line 315 "crisolscript.l"
-{ return tISINRANGE;               }
+{ return tGETRANGE;                }
 	YY_BREAK
-/* Funciones de API */
 case 205:
 YY_RULE_SETUP
-#line 318 "crisolscript.l"
-{ return tAPIPASSTORGBCOLOR;              }
+#line 316 "crisolscript.l"
+{ return tISINRANGE;               }
 	YY_BREAK
+/* Funciones de API */
 case 206:
 YY_RULE_SETUP
 #line 319 "crisolscript.l"
-{ return tAPIGETREDCOMPONENT;             }
+{ return tAPIPASSTORGBCOLOR;              }
 	YY_BREAK
 case 207:
 YY_RULE_SETUP
 #line 320 "crisolscript.l"
-{ return tAPIGETGREENCOMPONENT;           }
+{ return tAPIGETREDCOMPONENT;             }
 	YY_BREAK
 case 208:
 YY_RULE_SETUP
 #line 321 "crisolscript.l"
-{ return tAPIGETBLUECOMPONENT;            }
+{ return tAPIGETGREENCOMPONENT;           }
 	YY_BREAK
 case 209:
 YY_RULE_SETUP
 #line 322 "crisolscript.l"
-{ return tAPIRAND;                        }
+{ return tAPIGETBLUECOMPONENT;            }
 	YY_BREAK
 case 210:
 YY_RULE_SETUP
 #line 323 "crisolscript.l"
-{ return tAPIGETINTEGERVALUE;             }
+{ return tAPIRAND;                        }
 	YY_BREAK
 case 211:
 YY_RULE_SETUP
 #line 324 "crisolscript.l"
-{ return tAPIGETDECIMALVALUE;             }
+{ return tAPIGETINTEGERVALUE;             }
 	YY_BREAK
 case 212:
 YY_RULE_SETUP
 #line 325 "crisolscript.l"
-{ return tAPIGETSTRINGSIZE;               }
+{ return tAPIGETDECIMALVALUE;             }
 	YY_BREAK
 case 213:
 YY_RULE_SETUP
 #line 326 "crisolscript.l"
-{ return tAPIWRITETOLOGGER;               }
+{ return tAPIGETSTRINGSIZE;               }
 	YY_BREAK
 case 214:
 YY_RULE_SETUP
 #line 327 "crisolscript.l"
-{ return tAPIENABLECRISOLSCRIPTWARNINGS;  }
+{ return tAPIWRITETOLOGGER;               }
 	YY_BREAK
 case 215:
 YY_RULE_SETUP
 #line 328 "crisolscript.l"
-{ return tAPIDISABLECRISOLSCRIPTWARNINGS; }
+{ return tAPIENABLECRISOLSCRIPTWARNINGS;  }
 	YY_BREAK
 case 216:
 YY_RULE_SETUP
 #line 329 "crisolscript.l"
-{ return tAPISHOWFPS;                     }
+{ return tAPIDISABLECRISOLSCRIPTWARNINGS; }
 	YY_BREAK
 case 217:
 YY_RULE_SETUP
 #line 330 "crisolscript.l"
-{ return tAPIWAIT;                        }
+{ return tAPISHOWFPS;                     }
 	YY_BREAK
-/* Constantes internas globales */
 case 218:
 YY_RULE_SETUP
-#line 333 "crisolscript.l"
-{ return tNULL;                         }
+#line 331 "crisolscript.l"
+{ return tAPIWAIT;                        }
 	YY_BREAK
+/* Constantes internas globales */
 case 219:
 YY_RULE_SETUP
 #line 334 "crisolscript.l"
-{ return tFALSE;                        }
+{ return tNULL;                         }
 	YY_BREAK
 case 220:
 YY_RULE_SETUP
 #line 335 "crisolscript.l"
-{ return tTRUE;                         }  
+{ return tFALSE;                        }
 	YY_BREAK
 case 221:
 YY_RULE_SETUP
 #line 336 "crisolscript.l"
-{ return tRIGHT_HAND_SLOT;              }
+{ return tTRUE;                         }  
 	YY_BREAK
 case 222:
 YY_RULE_SETUP
 #line 337 "crisolscript.l"
-{ return tLEFT_HAND_SLOT;               }
+{ return tRIGHT_HAND_SLOT;              }
 	YY_BREAK
 case 223:
 YY_RULE_SETUP
 #line 338 "crisolscript.l"
-{ return tNORTH_DIRECTION;              }
+{ return tLEFT_HAND_SLOT;               }
 	YY_BREAK
 case 224:
 YY_RULE_SETUP
 #line 339 "crisolscript.l"
-{ return tNORTHEAST_DIRECTION;          }
+{ return tNORTH_DIRECTION;              }
 	YY_BREAK
 case 225:
 YY_RULE_SETUP
 #line 340 "crisolscript.l"
-{ return tEAST_DIRECTION;               }
+{ return tNORTHEAST_DIRECTION;          }
 	YY_BREAK
 case 226:
 YY_RULE_SETUP
 #line 341 "crisolscript.l"
-{ return tSOUTHEAST_DIRECTION;          }
+{ return tEAST_DIRECTION;               }
 	YY_BREAK
 case 227:
 YY_RULE_SETUP
 #line 342 "crisolscript.l"
-{ return tSOUTH_DIRECTION;              }
+{ return tSOUTHEAST_DIRECTION;          }
 	YY_BREAK
 case 228:
 YY_RULE_SETUP
 #line 343 "crisolscript.l"
-{ return tSOUTHWEST_DIRECTION;          }
+{ return tSOUTH_DIRECTION;              }
 	YY_BREAK
 case 229:
 YY_RULE_SETUP
 #line 344 "crisolscript.l"
-{ return tWEST_DIRECTION;               }
+{ return tSOUTHWEST_DIRECTION;          }
 	YY_BREAK
 case 230:
 YY_RULE_SETUP
 #line 345 "crisolscript.l"
-{ return tNORTHWEST_DIRECTION;          }
+{ return tWEST_DIRECTION;               }
 	YY_BREAK
 case 231:
 YY_RULE_SETUP
 #line 346 "crisolscript.l"
-{ return tNO_COMBAT_ALINGMENT;          }
+{ return tNORTHWEST_DIRECTION;          }
 	YY_BREAK
 case 232:
 YY_RULE_SETUP
 #line 347 "crisolscript.l"
-{ return tPLAYER_COMBAT_ALINGMENT;      }
+{ return tNO_COMBAT_ALINGMENT;          }
 	YY_BREAK
 case 233:
 YY_RULE_SETUP
 #line 348 "crisolscript.l"
-{ return tENEMYPLAYER_COMBAT_ALINGMENT; }
+{ return tPLAYER_COMBAT_ALINGMENT;      }
 	YY_BREAK
 case 234:
 YY_RULE_SETUP
 #line 349 "crisolscript.l"
-{ return tBASE_VALUE;                   }
+{ return tENEMYPLAYER_COMBAT_ALINGMENT; }
 	YY_BREAK
 case 235:
 YY_RULE_SETUP
 #line 350 "crisolscript.l"
-{ return tTEMP_VALUE;                   }
+{ return tBASE_VALUE;                   }
 	YY_BREAK
 case 236:
 YY_RULE_SETUP
 #line 351 "crisolscript.l"
-{ return tENTITY_PLAYER;                }
+{ return tTEMP_VALUE;                   }
 	YY_BREAK
 case 237:
 YY_RULE_SETUP
 #line 352 "crisolscript.l"
-{ return tENTITY_SCENE_OBJ;             }
+{ return tENTITY_PLAYER;                }
 	YY_BREAK
 case 238:
 YY_RULE_SETUP
 #line 353 "crisolscript.l"
-{ return tENTITY_NPC;                   }
+{ return tENTITY_SCENE_OBJ;             }
 	YY_BREAK
 case 239:
 YY_RULE_SETUP
 #line 354 "crisolscript.l"
-{ return tENTITY_WALL;                  }
+{ return tENTITY_NPC;                   }
 	YY_BREAK
 case 240:
 YY_RULE_SETUP
 #line 355 "crisolscript.l"
-{ return tENTITY_ITEM;                  }
+{ return tENTITY_WALL;                  }
 	YY_BREAK
 case 241:
 YY_RULE_SETUP
 #line 356 "crisolscript.l"
-{ return tTEXT_RIGHT_JUSTIFY;           }
+{ return tENTITY_ITEM;                  }
 	YY_BREAK
 case 242:
 YY_RULE_SETUP
 #line 357 "crisolscript.l"
-{ return tTEXT_UP_JUSTIFY;              }
+{ return tTEXT_RIGHT_JUSTIFY;           }
 	YY_BREAK
 case 243:
 YY_RULE_SETUP
 #line 358 "crisolscript.l"
-{ return tTEXT_LEFT_JUSTIFY;            }
+{ return tTEXT_UP_JUSTIFY;              }
 	YY_BREAK
 case 244:
 YY_RULE_SETUP
 #line 359 "crisolscript.l"
-{ return tKEY_ESC;                      } 
+{ return tTEXT_LEFT_JUSTIFY;            }
 	YY_BREAK
 case 245:
 YY_RULE_SETUP
 #line 360 "crisolscript.l"
-{ return tKEY_F1;                       }
+{ return tKEY_ESC;                      } 
 	YY_BREAK
 case 246:
 YY_RULE_SETUP
 #line 361 "crisolscript.l"
-{ return tKEY_F2;                       }
+{ return tKEY_F1;                       }
 	YY_BREAK
 case 247:
 YY_RULE_SETUP
 #line 362 "crisolscript.l"
-{ return tKEY_F3;                       }
+{ return tKEY_F2;                       }
 	YY_BREAK
 case 248:
 YY_RULE_SETUP
 #line 363 "crisolscript.l"
-{ return tKEY_F4;                       }
+{ return tKEY_F3;                       }
 	YY_BREAK
 case 249:
 YY_RULE_SETUP
 #line 364 "crisolscript.l"
-{ return tKEY_F5;                       }
+{ return tKEY_F4;                       }
 	YY_BREAK
 case 250:
 YY_RULE_SETUP
 #line 365 "crisolscript.l"
-{ return tKEY_F6;                       }
+{ return tKEY_F5;                       }
 	YY_BREAK
 case 251:
 YY_RULE_SETUP
 #line 366 "crisolscript.l"
-{ return tKEY_F7;                       }
+{ return tKEY_F6;                       }
 	YY_BREAK
 case 252:
 YY_RULE_SETUP
 #line 367 "crisolscript.l"
-{ return tKEY_F8;                       }
+{ return tKEY_F7;                       }
 	YY_BREAK
 case 253:
 YY_RULE_SETUP
 #line 368 "crisolscript.l"
-{ return tKEY_F9;                       }
+{ return tKEY_F8;                       }
 	YY_BREAK
 case 254:
 YY_RULE_SETUP
 #line 369 "crisolscript.l"
-{ return tKEY_F10;                      }
+{ return tKEY_F9;                       }
 	YY_BREAK
 case 255:
 YY_RULE_SETUP
 #line 370 "crisolscript.l"
-{ return tKEY_F11;                      }
+{ return tKEY_F10;                      }
 	YY_BREAK
 case 256:
 YY_RULE_SETUP
 #line 371 "crisolscript.l"
-{ return tKEY_F12;                      }
+{ return tKEY_F11;                      }
 	YY_BREAK
 case 257:
 YY_RULE_SETUP
 #line 372 "crisolscript.l"
-{ return tKEY_0;                        }
+{ return tKEY_F12;                      }
 	YY_BREAK
 case 258:
 YY_RULE_SETUP
 #line 373 "crisolscript.l"
-{ return tKEY_1;                        }
+{ return tKEY_0;                        }
 	YY_BREAK
 case 259:
 YY_RULE_SETUP
 #line 374 "crisolscript.l"
-{ return tKEY_2;                        }
+{ return tKEY_1;                        }
 	YY_BREAK
 case 260:
 YY_RULE_SETUP
 #line 375 "crisolscript.l"
-{ return tKEY_3;                        }
+{ return tKEY_2;                        }
 	YY_BREAK
 case 261:
 YY_RULE_SETUP
 #line 376 "crisolscript.l"
-{ return tKEY_4;                        }
+{ return tKEY_3;                        }
 	YY_BREAK
 case 262:
 YY_RULE_SETUP
 #line 377 "crisolscript.l"
-{ return tKEY_5;                        }
+{ return tKEY_4;                        }
 	YY_BREAK
 case 263:
 YY_RULE_SETUP
 #line 378 "crisolscript.l"
-{ return tKEY_6;                        }
+{ return tKEY_5;                        }
 	YY_BREAK
 case 264:
 YY_RULE_SETUP
 #line 379 "crisolscript.l"
-{ return tKEY_7;                        }
+{ return tKEY_6;                        }
 	YY_BREAK
 case 265:
 YY_RULE_SETUP
 #line 380 "crisolscript.l"
-{ return tKEY_8;                        }
+{ return tKEY_7;                        }
 	YY_BREAK
 case 266:
 YY_RULE_SETUP
 #line 381 "crisolscript.l"
-{ return tKEY_9;                        } 
+{ return tKEY_8;                        }
 	YY_BREAK
 case 267:
 YY_RULE_SETUP
 #line 382 "crisolscript.l"
-{ return tKEY_A;                        } 
+{ return tKEY_9;                        } 
 	YY_BREAK
 case 268:
 YY_RULE_SETUP
 #line 383 "crisolscript.l"
-{ return tKEY_B;                        } 
+{ return tKEY_A;                        } 
 	YY_BREAK
 case 269:
 YY_RULE_SETUP
 #line 384 "crisolscript.l"
-{ return tKEY_C;                        } 
+{ return tKEY_B;                        } 
 	YY_BREAK
 case 270:
 YY_RULE_SETUP
 #line 385 "crisolscript.l"
-{ return tKEY_D;                        } 
+{ return tKEY_C;                        } 
 	YY_BREAK
 case 271:
 YY_RULE_SETUP
 #line 386 "crisolscript.l"
-{ return tKEY_E;                        } 
+{ return tKEY_D;                        } 
 	YY_BREAK
 case 272:
 YY_RULE_SETUP
 #line 387 "crisolscript.l"
-{ return tKEY_F;                        } 
+{ return tKEY_E;                        } 
 	YY_BREAK
 case 273:
 YY_RULE_SETUP
 #line 388 "crisolscript.l"
-{ return tKEY_G;                        }
+{ return tKEY_F;                        } 
 	YY_BREAK
 case 274:
 YY_RULE_SETUP
 #line 389 "crisolscript.l"
-{ return tKEY_H;                        } 
+{ return tKEY_G;                        }
 	YY_BREAK
 case 275:
 YY_RULE_SETUP
 #line 390 "crisolscript.l"
-{ return tKEY_I;                        } 
+{ return tKEY_H;                        } 
 	YY_BREAK
 case 276:
 YY_RULE_SETUP
 #line 391 "crisolscript.l"
-{ return tKEY_J;                        }  
+{ return tKEY_I;                        } 
 	YY_BREAK
 case 277:
 YY_RULE_SETUP
 #line 392 "crisolscript.l"
-{ return tKEY_K;                        } 
+{ return tKEY_J;                        }  
 	YY_BREAK
 case 278:
 YY_RULE_SETUP
 #line 393 "crisolscript.l"
-{ return tKEY_L;                        } 
+{ return tKEY_K;                        } 
 	YY_BREAK
 case 279:
 YY_RULE_SETUP
 #line 394 "crisolscript.l"
-{ return tKEY_M;                        }  
+{ return tKEY_L;                        } 
 	YY_BREAK
 case 280:
 YY_RULE_SETUP
 #line 395 "crisolscript.l"
-{ return tKEY_N;                        }  
+{ return tKEY_M;                        }  
 	YY_BREAK
 case 281:
 YY_RULE_SETUP
 #line 396 "crisolscript.l"
-{ return tKEY_O;                        }  
+{ return tKEY_N;                        }  
 	YY_BREAK
 case 282:
 YY_RULE_SETUP
 #line 397 "crisolscript.l"
-{ return tKEY_P;                        }  
+{ return tKEY_O;                        }  
 	YY_BREAK
 case 283:
 YY_RULE_SETUP
 #line 398 "crisolscript.l"
-{ return tKEY_Q;                        }  
+{ return tKEY_P;                        }  
 	YY_BREAK
 case 284:
 YY_RULE_SETUP
 #line 399 "crisolscript.l"
-{ return tKEY_R;                        }  
+{ return tKEY_Q;                        }  
 	YY_BREAK
 case 285:
 YY_RULE_SETUP
 #line 400 "crisolscript.l"
-{ return tKEY_S;                        }  
+{ return tKEY_R;                        }  
 	YY_BREAK
 case 286:
 YY_RULE_SETUP
 #line 401 "crisolscript.l"
-{ return tKEY_T;                        }  
+{ return tKEY_S;                        }  
 	YY_BREAK
 case 287:
 YY_RULE_SETUP
 #line 402 "crisolscript.l"
-{ return tKEY_U;                        }  
+{ return tKEY_T;                        }  
 	YY_BREAK
 case 288:
 YY_RULE_SETUP
 #line 403 "crisolscript.l"
-{ return tKEY_V;                        }  
+{ return tKEY_U;                        }  
 	YY_BREAK
 case 289:
 YY_RULE_SETUP
 #line 404 "crisolscript.l"
-{ return tKEY_W;                        }  
+{ return tKEY_V;                        }  
 	YY_BREAK
 case 290:
 YY_RULE_SETUP
 #line 405 "crisolscript.l"
-{ return tKEY_X;                        }  
+{ return tKEY_W;                        }  
 	YY_BREAK
 case 291:
 YY_RULE_SETUP
 #line 406 "crisolscript.l"
-{ return tKEY_Y;                        }  
+{ return tKEY_X;                        }  
 	YY_BREAK
 case 292:
 YY_RULE_SETUP
 #line 407 "crisolscript.l"
-{ return tKEY_Z;                        } 
+{ return tKEY_Y;                        }  
 	YY_BREAK
 case 293:
 YY_RULE_SETUP
 #line 408 "crisolscript.l"
-{ return tKEY_BACK;                     }  
+{ return tKEY_Z;                        } 
 	YY_BREAK
 case 294:
 YY_RULE_SETUP
 #line 409 "crisolscript.l"
-{ return tKEY_TAB;                      }  
+{ return tKEY_BACK;                     }  
 	YY_BREAK
 case 295:
 YY_RULE_SETUP
 #line 410 "crisolscript.l"
-{ return tKEY_RETURN;                   }  
+{ return tKEY_TAB;                      }  
 	YY_BREAK
 case 296:
 YY_RULE_SETUP
 #line 411 "crisolscript.l"
-{ return tKEY_SPACE;                    }  
+{ return tKEY_RETURN;                   }  
 	YY_BREAK
 case 297:
 YY_RULE_SETUP
 #line 412 "crisolscript.l"
-{ return tKEY_LCONTROL;                 }   
+{ return tKEY_SPACE;                    }  
 	YY_BREAK
 case 298:
 YY_RULE_SETUP
 #line 413 "crisolscript.l"
-{ return tKEY_RCONTROL;                 }  
+{ return tKEY_LCONTROL;                 }   
 	YY_BREAK
 case 299:
 YY_RULE_SETUP
 #line 414 "crisolscript.l"
-{ return tKEY_LSHIFT;                   }  
+{ return tKEY_RCONTROL;                 }  
 	YY_BREAK
 case 300:
 YY_RULE_SETUP
 #line 415 "crisolscript.l"
-{ return tKEY_RSHIFT;                   }  
+{ return tKEY_LSHIFT;                   }  
 	YY_BREAK
 case 301:
 YY_RULE_SETUP
 #line 416 "crisolscript.l"
-{ return tKEY_ALT;                      }  
+{ return tKEY_RSHIFT;                   }  
 	YY_BREAK
 case 302:
 YY_RULE_SETUP
 #line 417 "crisolscript.l"
-{ return tKEY_ALTGR;                    }  
+{ return tKEY_ALT;                      }  
 	YY_BREAK
 case 303:
 YY_RULE_SETUP
 #line 418 "crisolscript.l"
-{ return tKEY_INSERT;                   }   
+{ return tKEY_ALTGR;                    }  
 	YY_BREAK
 case 304:
 YY_RULE_SETUP
 #line 419 "crisolscript.l"
-{ return tKEY_REPAG;                    }  
+{ return tKEY_INSERT;                   }   
 	YY_BREAK
 case 305:
 YY_RULE_SETUP
 #line 420 "crisolscript.l"
-{ return tKEY_AVPAG;                    }  
+{ return tKEY_REPAG;                    }  
 	YY_BREAK
 case 306:
 YY_RULE_SETUP
 #line 421 "crisolscript.l"
-{ return tKEY_MINUS_PAD;                }  
+{ return tKEY_AVPAG;                    }  
 	YY_BREAK
 case 307:
 YY_RULE_SETUP
 #line 422 "crisolscript.l"
-{ return tKEY_ADD_PAD;                  }  
+{ return tKEY_MINUS_PAD;                }  
 	YY_BREAK
 case 308:
 YY_RULE_SETUP
 #line 423 "crisolscript.l"
-{ return tKEY_DIV_PAD;                  }  
+{ return tKEY_ADD_PAD;                  }  
 	YY_BREAK
 case 309:
 YY_RULE_SETUP
 #line 424 "crisolscript.l"
-{ return tKEY_MUL_PAD;                  }  
+{ return tKEY_DIV_PAD;                  }  
 	YY_BREAK
 case 310:
 YY_RULE_SETUP
 #line 425 "crisolscript.l"
-{ return tKEY_0_PAD;                    }   
+{ return tKEY_MUL_PAD;                  }  
 	YY_BREAK
 case 311:
 YY_RULE_SETUP
 #line 426 "crisolscript.l"
-{ return tKEY_1_PAD;                    }    
+{ return tKEY_0_PAD;                    }   
 	YY_BREAK
 case 312:
 YY_RULE_SETUP
 #line 427 "crisolscript.l"
-{ return tKEY_2_PAD;                    }    
+{ return tKEY_1_PAD;                    }    
 	YY_BREAK
 case 313:
 YY_RULE_SETUP
 #line 428 "crisolscript.l"
-{ return tKEY_3_PAD;                    }    
+{ return tKEY_2_PAD;                    }    
 	YY_BREAK
 case 314:
 YY_RULE_SETUP
 #line 429 "crisolscript.l"
-{ return tKEY_4_PAD;                    }    
+{ return tKEY_3_PAD;                    }    
 	YY_BREAK
 case 315:
 YY_RULE_SETUP
 #line 430 "crisolscript.l"
-{ return tKEY_5_PAD;                    }    
+{ return tKEY_4_PAD;                    }    
 	YY_BREAK
 case 316:
 YY_RULE_SETUP
 #line 431 "crisolscript.l"
-{ return tKEY_6_PAD;                    }    
+{ return tKEY_5_PAD;                    }    
 	YY_BREAK
 case 317:
 YY_RULE_SETUP
 #line 432 "crisolscript.l"
-{ return tKEY_7_PAD;                    }    
+{ return tKEY_6_PAD;                    }    
 	YY_BREAK
 case 318:
 YY_RULE_SETUP
 #line 433 "crisolscript.l"
-{ return tKEY_8_PAD;                    }    
+{ return tKEY_7_PAD;                    }    
 	YY_BREAK
 case 319:
 YY_RULE_SETUP
 #line 434 "crisolscript.l"
-{ return tKEY_9_PAD;                    }   
+{ return tKEY_8_PAD;                    }    
 	YY_BREAK
 case 320:
 YY_RULE_SETUP
 #line 435 "crisolscript.l"
-{ return tKEY_UP;                       }   
+{ return tKEY_9_PAD;                    }   
 	YY_BREAK
 case 321:
 YY_RULE_SETUP
 #line 436 "crisolscript.l"
-{ return tKEY_DOWN;                     }   
+{ return tKEY_UP;                       }   
 	YY_BREAK
 case 322:
 YY_RULE_SETUP
 #line 437 "crisolscript.l"
-{ return tKEY_RIGHT;                    }   
+{ return tKEY_DOWN;                     }   
 	YY_BREAK
 case 323:
 YY_RULE_SETUP
 #line 438 "crisolscript.l"
-{ return tKEY_LEFT;                     }   
+{ return tKEY_RIGHT;                    }   
 	YY_BREAK
-/* Operadores */
 case 324:
 YY_RULE_SETUP
-#line 441 "crisolscript.l"
-{ return tAND;    }
+#line 439 "crisolscript.l"
+{ return tKEY_LEFT;                     }   
 	YY_BREAK
+/* Operadores */
 case 325:
 YY_RULE_SETUP
 #line 442 "crisolscript.l"
-{ return tOR;     }
+{ return tAND;    }
 	YY_BREAK
 case 326:
 YY_RULE_SETUP
 #line 443 "crisolscript.l"
-{ return tASSING; }
+{ return tOR;     }
 	YY_BREAK
 case 327:
 YY_RULE_SETUP
 #line 444 "crisolscript.l"
-{ return tEQ;     }
+{ return tASSING; }
 	YY_BREAK
 case 328:
 YY_RULE_SETUP
 #line 445 "crisolscript.l"
-{ return tNEQ;    }
+{ return tEQ;     }
 	YY_BREAK
 case 329:
 YY_RULE_SETUP
 #line 446 "crisolscript.l"
-{ return tGEQ;    }
+{ return tNEQ;    }
 	YY_BREAK
 case 330:
 YY_RULE_SETUP
 #line 447 "crisolscript.l"
-{ return tLEQ;    }
+{ return tGEQ;    }
 	YY_BREAK
 case 331:
 YY_RULE_SETUP
 #line 448 "crisolscript.l"
-{ return '<';     }
+{ return tLEQ;    }
 	YY_BREAK
 case 332:
 YY_RULE_SETUP
 #line 449 "crisolscript.l"
-{ return '>';     }
+{ return '<';     }
 	YY_BREAK
 case 333:
 YY_RULE_SETUP
 #line 450 "crisolscript.l"
-{ return '!';     }
+{ return '>';     }
 	YY_BREAK
 case 334:
 YY_RULE_SETUP
 #line 451 "crisolscript.l"
-{ return '+';     }
+{ return '!';     }
 	YY_BREAK
 case 335:
 YY_RULE_SETUP
 #line 452 "crisolscript.l"
-{ return '-';     }
+{ return '+';     }
 	YY_BREAK
 case 336:
 YY_RULE_SETUP
 #line 453 "crisolscript.l"
-{ return '*';     }
+{ return '-';     }
 	YY_BREAK
 case 337:
 YY_RULE_SETUP
 #line 454 "crisolscript.l"
-{ return '/';     }
+{ return '*';     }
 	YY_BREAK
 case 338:
 YY_RULE_SETUP
 #line 455 "crisolscript.l"
-{ return '%';     }
+{ return '/';     }
 	YY_BREAK
 case 339:
 YY_RULE_SETUP
 #line 456 "crisolscript.l"
-{ return '(';     }
+{ return '%';     }
 	YY_BREAK
 case 340:
 YY_RULE_SETUP
 #line 457 "crisolscript.l"
-{ return ')';     }
+{ return '(';     }
 	YY_BREAK
 case 341:
 YY_RULE_SETUP
 #line 458 "crisolscript.l"
-{ return ',';     }
+{ return ')';     }
 	YY_BREAK
 case 342:
 YY_RULE_SETUP
 #line 459 "crisolscript.l"
-{ return ';';     }
+{ return ',';     }
 	YY_BREAK
 case 343:
 YY_RULE_SETUP
 #line 460 "crisolscript.l"
+{ return ';';     }
+	YY_BREAK
+case 344:
+YY_RULE_SETUP
+#line 461 "crisolscript.l"
 { return '.';     }
 	YY_BREAK
 /* Valor numerico / Cadenas / Identificadores */
-case 344:
+case 345:
 YY_RULE_SETUP
-#line 463 "crisolscript.l"
+#line 464 "crisolscript.l"
 { /* Valor numerico entero */
                         yylval.fNumber = (float)atoi(yytext); 
 						return tNUMBER_VALUE;
                        }
 	YY_BREAK
-case 345:
+case 346:
 YY_RULE_SETUP
-#line 467 "crisolscript.l"
+#line 468 "crisolscript.l"
 { /* Valor numerico real */
                         yylval.fNumber = (float) atof(yytext);
 						return tNUMBER_VALUE;
                        }
 	YY_BREAK
-case 346:
+case 347:
 YY_RULE_SETUP
-#line 471 "crisolscript.l"
+#line 472 "crisolscript.l"
 { /* Cadena de caracteres */
                         /* Se devolvera sin las comillas */
 				        yytext[strlen(yytext) - 1] = '\0';
@@ -3864,9 +3876,9 @@ YY_RULE_SETUP
 					    return tSTRING_VALUE;
                        }
 	YY_BREAK
-case 347:
+case 348:
 YY_RULE_SETUP
-#line 481 "crisolscript.l"
+#line 482 "crisolscript.l"
 { /* Identificador */
                          yylval.szIdentifier = strdup(yytext);
 					     /*
@@ -3878,7 +3890,7 @@ YY_RULE_SETUP
 	YY_BREAK
 /* Fin de archivo */
 case YY_STATE_EOF(INITIAL):
-#line 490 "crisolscript.l"
+#line 491 "crisolscript.l"
 { /* Se cambiara unicamente al buffer previo */		  
           /* Estamos en un estado distinto al global */		  
 		  if (l_eBuffState != NO_BUFF) {
@@ -3896,9 +3908,9 @@ case YY_STATE_EOF(INITIAL):
         }   
 	YY_BREAK
 /* Resto */
-case 348:
+case 349:
 YY_RULE_SETUP
-#line 507 "crisolscript.l"
+#line 508 "crisolscript.l"
 { /* Error, caracter no reconocible */
     ReportErrorf(GetActFileName(), 
 				 yytext, 
@@ -3906,12 +3918,12 @@ YY_RULE_SETUP
 	             "Error> Caracter %s no reconocibile.", yytext);
   }
 	YY_BREAK
-case 349:
+case 350:
 YY_RULE_SETUP
-#line 514 "crisolscript.l"
+#line 515 "crisolscript.l"
 ECHO;
 	YY_BREAK
-#line 3915 "lex.yy.c"
+#line 3927 "lex.yy.c"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4198,7 +4210,7 @@ static yy_state_type yy_get_previous_state()
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 2554 )
+			if ( yy_current_state >= 2571 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -4233,11 +4245,11 @@ yy_state_type yy_current_state;
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 2554 )
+		if ( yy_current_state >= 2571 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 2553);
+	yy_is_jam = (yy_current_state == 2570);
 
 	return yy_is_jam ? 0 : yy_current_state;
 	}
@@ -4769,7 +4781,7 @@ int main()
 	return 0;
 	}
 #endif
-#line 514 "crisolscript.l"
+#line 515 "crisolscript.l"
 
  
  /* Establece el buffer primario donde comenzar a compilar */
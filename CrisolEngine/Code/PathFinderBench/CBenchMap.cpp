@@ -0,0 +1,540 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+// 
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//  
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CBenchMap.cpp
+// Autor: Fernando Rodrguez Martnez 
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Consultar CBenchMap.h para mas detalles.
+///////////////////////////////////////////////////////////////////////////////
+// Pragmas <VC6 / Warnings sobre la stl>
+#pragma warning(disable:4786)
+#include "CBenchMap.h"
+
+#include <algorithm>
+#include <fstream>
+
+// Constantes para la generacion de mapas
+// Nota: Las probabilidades estaran expresadas sobre 1000
+const word ROOM_WIDTH          = 8;  // Anchura de una habitacion (con pared)
+const word ROOM_HEIGHT         = 16; // Altura de una habitacion (con pared)
+const word NO_CONTENT_PROB     = 10; // Tiles sin contenido
+const word SCENE_OBJ_PROB      = 40; // Objetos de escenario
+const word CRIATURE_PROB       = 20; // Criaturas
+const word FLOOR_MASK_PROB     = 10; // Floors con un acceso bloqueado
+const word CLOSED_SEGMENT_PROB = 125; // Tramos de pared sin puerta
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Inicializa las tablas de deltas para hallar las posiciones adyacentes,
+//   con los mismos valores que CArea::InitDeltasValues.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void
+CBenchMap::InitDeltasValues(void)
+{
+  // Para Y par
+  const sbyte EvenDeltas[IsoDefs::MAX_DIRECTIONS][2] = {
+	{ 0, -2 }, { 0, -1 }, { 1, 0 }, { 0, 1 }, 
+	{ 0, 2 }, { -1, 1 }, { -1, 0 }, { -1, -1 }
+  };
+  // Para Y impar
+  const sbyte OddDeltas[IsoDefs::MAX_DIRECTIONS][2] = {
+	{ 0, -2 }, { 1, -1 }, { 1, 0 }, { 1, 1 }, 
+	{ 0, 2 }, { 0, 1 }, { -1, 0 }, { 0, -1 }
+  };
+
+  // Se establecen
+  byte ubIt = 0;
+  for (; ubIt < IsoDefs::MAX_DIRECTIONS; ++ubIt) {
+	m_EvenDeltas[ubIt].sbXDelta = EvenDeltas[ubIt][0];
+	m_EvenDeltas[ubIt].sbYDelta = EvenDeltas[ubIt][1];
+	m_OddDeltas[ubIt].sbXDelta = OddDeltas[ubIt][0];
+	m_OddDeltas[ubIt].sbYDelta = OddDeltas[ubIt][1];
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Genera un mapa de forma determinista a partir de sus dimensiones y de
+//   una semilla. El mapa se dividira en habitaciones separadas por paredes
+//   con una puerta en cada tramo (salvo algunos tramos cerrados, de tal forma
+//   que existan zonas aisladas), y se repartiran objetos de escenario, 
+//   criaturas, floors con algun acceso bloqueado y tiles sin contenido.
+// Parametros:
+// - uwWidth, uwHeight. Dimensiones del mapa (entre 1 y 256).
+// - udSeed. Semilla.
+// Devuelve:
+// - Si se ha podido crear true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CBenchMap::Create(const word uwWidth, 
+				  const word uwHeight,
+				  const dword udSeed)
+{
+  // Dimensiones validas?
+  if (!uwWidth || uwWidth > AreaDefs::MAX_AREA_WIDTH ||
+	  !uwHeight || uwHeight > AreaDefs::MAX_AREA_HEIGHT) {
+	return false;
+  }
+
+  // Se inicializa
+  Reset(uwWidth, uwHeight);
+  m_udSeed = udSeed;
+
+  // Se establece el contenido de cada tile
+  AreaDefs::sTilePos TilePos;
+  for (TilePos.YTile = 0; TilePos.YTile < m_uwHeight; ++TilePos.YTile) {
+	for (TilePos.XTile = 0; TilePos.XTile < m_uwWidth; ++TilePos.XTile) {
+	  // Pared?
+	  if (ROOM_WIDTH - 1 == TilePos.XTile % ROOM_WIDTH ||
+		  ROOM_HEIGHT - 1 == TilePos.YTile % ROOM_HEIGHT) {
+		SetTile(TilePos, '#');
+		continue;
+	  }
+
+	  // No, se elige el contenido
+	  const word uwValue = NextRandom() % 1000;
+	  if (uwValue < NO_CONTENT_PROB) {
+		SetTile(TilePos, ' ');
+	  } else if (uwValue < NO_CONTENT_PROB + SCENE_OBJ_PROB) {
+		SetTile(TilePos, 'o');
+	  } else if (uwValue < NO_CONTENT_PROB + SCENE_OBJ_PROB + CRIATURE_PROB) {
+		SetTile(TilePos, 'c');
+	  } else {
+		SetTile(TilePos, '.');
+		if (uwValue < NO_CONTENT_PROB + SCENE_OBJ_PROB + CRIATURE_PROB + FLOOR_MASK_PROB) {
+		  // Se bloquea un acceso del floor en ambas mascaras
+		  const AreaDefs::TileAccessInfo Flag = IsoDefs::NORTH_FLAG << (NextRandom() % IsoDefs::MAX_DIRECTIONS);
+		  m_AccessGrid[GetTileIdx(TilePos)] |= Flag | (Flag << AreaDefs::TILE_ADJ_ACCESS_SHIFT);
+		}
+	  }
+	}
+  }
+
+  // Se abren las puertas en los tramos de pared horizontales
+  for (TilePos.YTile = ROOM_HEIGHT - 1; TilePos.YTile < m_uwHeight; TilePos.YTile += ROOM_HEIGHT) {
+	word uwInitX = 0;
+	for (; uwInitX < m_uwWidth; uwInitX += ROOM_WIDTH) {
+	  if (NextRandom() % 1000 >= CLOSED_SEGMENT_PROB) {
+		TilePos.XTile = uwInitX + NextRandom() % (ROOM_WIDTH - 1);
+		if (TilePos.XTile < m_uwWidth) {
+		  SetTile(TilePos, '.');
+		}
+	  }
+	}
+  }
+
+  // Se abren las puertas en los tramos de pared verticales
+  // Nota: Las puertas ocuparan dos filas para que exista paso en diagonal
+  for (TilePos.XTile = ROOM_WIDTH - 1; TilePos.XTile < m_uwWidth; TilePos.XTile += ROOM_WIDTH) {
+	word uwInitY = 0;
+	for (; uwInitY < m_uwHeight; uwInitY += ROOM_HEIGHT) {
+	  if (NextRandom() % 1000 >= CLOSED_SEGMENT_PROB) {
+		TilePos.YTile = uwInitY + NextRandom() % (ROOM_HEIGHT - 2);
+		byte ubIt = 0;
+		for (; ubIt < 2 && TilePos.YTile < m_uwHeight; ++ubIt, ++TilePos.YTile) {
+		  SetTile(TilePos, '.');
+		}
+	  }
+	}
+  }
+
+  // Se calcula la conectividad
+  BuildConnectivity();
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee el mapa desde un fichero de texto (ver CBenchMap.h). La anchura 
+//   sera la de la linea mas larga y los tiles que falten en las lineas mas
+//   cortas se consideraran sin contenido.
+// Parametros:
+// - szFileName. Nombre del fichero.
+// Devuelve:
+// - Si se ha podido leer true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CBenchMap::Load(const std::string& szFileName)
+{
+  // Se abre el fichero
+  std::ifstream File(szFileName.c_str());
+  if (!File) {
+	return false;
+  }
+
+  // Se leen las lineas
+  std::vector<std::string> Lines;
+  std::string szLine;
+  word uwWidth = 0;
+  while (std::getline(File, szLine)) {
+	// Se descarta un posible retorno de carro
+	if (!szLine.empty() && '\r' == szLine[szLine.size() - 1]) {
+	  szLine.erase(szLine.size() - 1);
+	}
+	if (szLine.size() > uwWidth) {
+	  uwWidth = szLine.size() < AreaDefs::MAX_AREA_WIDTH ? 
+				word(szLine.size()) : AreaDefs::MAX_AREA_WIDTH;
+	}
+	Lines.push_back(szLine);
+  }
+  if (!uwWidth || Lines.empty() || Lines.size() > AreaDefs::MAX_AREA_HEIGHT) {
+	return false;
+  }
+
+  // Se establece el contenido de cada tile
+  Reset(uwWidth, word(Lines.size()));
+  AreaDefs::sTilePos TilePos;
+  for (TilePos.YTile = 0; TilePos.YTile < m_uwHeight; ++TilePos.YTile) {
+	const std::string& szRow = Lines[TilePos.YTile];
+	for (TilePos.XTile = 0; TilePos.XTile < m_uwWidth; ++TilePos.XTile) {
+	  SetTile(TilePos, 
+			  word(TilePos.XTile) < szRow.size() ? szRow[TilePos.XTile] : ' ');
+	}
+  }
+
+  // Se calcula la conectividad
+  BuildConnectivity();
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Dimensiona el mapa dejando todos sus tiles libres.
+// Parametros:
+// - uwWidth, uwHeight. Dimensiones.
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CBenchMap::Reset(const word uwWidth, 
+				 const word uwHeight)
+{
+  // Se dimensiona
+  m_uwWidth = uwWidth;
+  m_uwHeight = uwHeight;
+  m_AccessGrid.assign(dword(uwWidth) * uwHeight, AreaDefs::TILE_WALKABLE);
+  m_Components.assign(dword(uwWidth) * uwHeight, AreaDefs::NO_COMPONENT);
+  m_uwNumComponents = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Establece la informacion de acceso de un tile a partir del caracter que
+//   lo representa, tal y como BuildAccessGrid la hallaria en CArea.
+// Parametros:
+// - TilePos. Posicion del tile.
+// - cType. Caracter (ver CBenchMap.h). Los desconocidos seran tiles libres.
+// Devuelve:
+// Notas:
+// - No se simulara la influencia de las paredes sobre los tiles adyacentes
+//   (CArea::IsAdjWallBlocked).
+///////////////////////////////////////////////////////////////////////////////
+void 
+CBenchMap::SetTile(const AreaDefs::sTilePos& TilePos,
+				   const char cType)
+{
+  // SOLO si parametros validos
+  ASSERT(IsCellValid(TilePos));
+
+  // Se establece la info
+  const AreaDefs::TileAccessInfo NoAccess = AreaDefs::NO_TILE_ACCESS;
+  AreaDefs::TileAccessInfo& AccessInfo = m_AccessGrid[GetTileIdx(TilePos)];
+  switch (cType) {
+	case ' ': {
+	  AccessInfo = NoAccess | (NoAccess << AreaDefs::TILE_ADJ_ACCESS_SHIFT);
+	} break;
+
+	case '#': {
+	  AccessInfo = AreaDefs::TILE_WALKABLE | NoAccess | (NoAccess << AreaDefs::TILE_ADJ_ACCESS_SHIFT);
+	} break;
+
+	case 'o': {
+	  AccessInfo = AreaDefs::TILE_WALKABLE | NoAccess;
+	} break;
+
+	case 'c': {
+	  AccessInfo = AreaDefs::TILE_WALKABLE | AreaDefs::TILE_WITH_CRIATURE;
+	} break;
+
+	default: {
+	  AccessInfo = AreaDefs::TILE_WALKABLE;
+	} break;
+  }; // ~ switch
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Calcula las componentes conexas del mapa con las mismas reglas que
+//   CArea::BuildConnectivity.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+CBenchMap::BuildConnectivity(void)
+{
+  // Se resetean las componentes
+  std::fill(m_Components.begin(), m_Components.end(), AreaDefs::NO_COMPONENT);
+  m_uwNumComponents = 0;
+
+  // Se etiqueta cada tile con contenido aun no visitado
+  std::vector<AreaDefs::TileIndex> TilesToVisit;
+  const dword udSize = m_AccessGrid.size();
+  dword udIdx = 0;
+  for (; udIdx < udSize; ++udIdx) {
+	if (!(m_AccessGrid[udIdx] & AreaDefs::TILE_WALKABLE) ||
+		AreaDefs::NO_COMPONENT != m_Components[udIdx]) {
+	  continue;
+	}
+
+	// Se recorren todos los tiles alcanzables
+	const AreaDefs::ComponentID Component = ++m_uwNumComponents;
+	TilesToVisit.clear();
+	TilesToVisit.push_back(AreaDefs::TileIndex(udIdx));
+	while (!TilesToVisit.empty()) {
+	  // Se toma tile
+	  const AreaDefs::TileIndex ActIdx = TilesToVisit.back();
+	  TilesToVisit.pop_back();
+	  if (AreaDefs::NO_COMPONENT != m_Components[ActIdx]) {
+		continue;
+	  }
+	  m_Components[ActIdx] = Component;
+
+	  // Se exploran los adyacentes
+	  const AreaDefs::sTilePos ActPos(ActIdx % m_uwWidth, ActIdx / m_uwWidth);
+	  byte ubIt = 0;
+	  for (; ubIt < IsoDefs::MAX_DIRECTIONS; ++ubIt) {
+		const IsoDefs::eDirectionIndex Dir = IsoDefs::eDirectionIndex(ubIt);
+		AreaDefs::sTilePos AdjPos;
+		if (GetAdjacentTilePos(ActPos, Dir, AdjPos) &&
+			AreaDefs::NO_COMPONENT == m_Components[GetTileIdx(AdjPos)]) {
+		  const IsoDefs::eDirectionIndex InvDir = IsoDefs::eDirectionIndex((ubIt + 4) % IsoDefs::MAX_DIRECTIONS);
+		  if (CanCrossInConnectivity(ActPos, Dir) ||
+			  CanCrossInConnectivity(AdjPos, InvDir)) {
+			TilesToVisit.push_back(GetTileIdx(AdjPos));
+		  }
+		}
+	  }
+	}
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprueba si desde TileSrc se puede pasar al tile adyacente en la 
+//   direccion Dir, ver CArea::CanCrossInConnectivity.
+// Parametros:
+// - TileSrc. Tile origen.
+// - Dir. Direccion al tile destino.
+// Devuelve:
+// - Si se puede pasar true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CBenchMap::CanCrossInConnectivity(const AreaDefs::sTilePos& TileSrc,
+								  const IsoDefs::eDirectionIndex& Dir)
+{
+  // La mascara del tile destino permite la entrada?
+  AreaDefs::sTilePos TileDest;
+  if (!GetAdjacentTilePos(TileSrc, Dir, TileDest)) {
+	return false;
+  }
+  const byte ubInvFlag = IsoDefs::NORTH_FLAG << ((Dir + 4) % IsoDefs::MAX_DIRECTIONS);
+  if (m_AccessGrid[GetTileIdx(TileDest)] & ubInvFlag) {
+	return false;
+  }
+
+  // Es una direccion diagonal?
+  if (Dir & 1) {
+	return true;
+  }
+
+  // Se comprueba si alguna de las dos direcciones adyacentes a Dir puede
+  // ser accedida desde el origen
+  const IsoDefs::eDirectionIndex AdjacentDirs[2] = {
+	IsoDefs::eDirectionIndex((Dir + IsoDefs::MAX_DIRECTIONS - 1) % IsoDefs::MAX_DIRECTIONS),
+	IsoDefs::eDirectionIndex((Dir + 1) % IsoDefs::MAX_DIRECTIONS)
+  };
+  byte ubIt = 0;
+  for (; ubIt < 2; ++ubIt) {
+	AreaDefs::sTilePos AdjPos;
+	if (GetAdjacentTilePos(TileSrc, AdjacentDirs[ubIt], AdjPos)) {
+	  const byte ubAdjInvFlag = IsoDefs::NORTH_FLAG << ((AdjacentDirs[ubIt] + 4) % IsoDefs::MAX_DIRECTIONS);
+	  if (!((m_AccessGrid[GetTileIdx(AdjPos)] >> AreaDefs::TILE_ADJ_ACCESS_SHIFT) & ubAdjInvFlag)) {
+		return true;
+	  }
+	}
+  }
+
+  // No hay posibilidad de acceso
+  return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Localiza la celda adyacente en la direccion AdjTileDirection, ver
+//   CArea::GetAdjacentTilePos.
+// Parametros:
+// - TilePosSrc. Posicion desde donde obtener la celda adyacente.
+// - AdjTileDirection. Direccion hacia donde comprobar la celda adyacente.
+// - TilePosDest. Posicion donde depositar la celda adyacente.
+// Devuelve:
+// - Si existe celda adyacente con contenido true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CBenchMap::GetAdjacentTilePos(const AreaDefs::sTilePos& TilePosSrc,
+							  const IsoDefs::eDirectionIndex& AdjTileDirection,
+							  AreaDefs::sTilePos& TilePosDest)
+{
+  // Forma la POSIBLE posicion adyacente
+  const sDelta* const pDeltas = (TilePosSrc.YTile & 1) ? m_OddDeltas : m_EvenDeltas;
+  const sword swXTile = TilePosSrc.XTile + pDeltas[AdjTileDirection].sbXDelta;
+  if (swXTile < 0) { 
+	return false; 
+  }
+  const sword swYTile = TilePosSrc.YTile + pDeltas[AdjTileDirection].sbYDelta;
+  if (swYTile < 0) { 
+	return false; 
+  }
+  TilePosDest.XTile = swXTile;
+  TilePosDest.YTile = swYTile;
+
+  // Retorna el resultado
+  return (IsCellValid(TilePosDest) && IsCellWithContent(TilePosDest));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Calcula la direccion entre dos tiles, ver CArea::CalculeDirection.
+// Parametros:
+// - TilePosSrc. Posicion del tile origen.
+// - TilePosDest. Posicion del tile adyacente
+// Devuelve:
+// - Direccion que hay que tomar desde TilePosSrc para llegar a TilePosDest.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+IsoDefs::eDirectionIndex 
+CBenchMap::CalculeDirection(const AreaDefs::sTilePos& TilePosSrc,
+							const AreaDefs::sTilePos& TilePosDest)
+{
+  // Tiles adyacentes?
+  AreaDefs::sTilePos AdjTilePos;
+  byte ubIt = 0;
+  for (; ubIt < IsoDefs::MAX_DIRECTIONS; ++ubIt) {
+	const IsoDefs::eDirectionIndex DirIdx = IsoDefs::eDirectionIndex(ubIt);
+	if (GetAdjacentTilePos(TilePosSrc, DirIdx, AdjTilePos) &&
+		TilePosDest == AdjTilePos) {
+	  return DirIdx;
+	}
+  }
+
+  // No, se calcula la orientacion de forma aproximada
+  if (TilePosSrc.XTile < TilePosDest.XTile) {
+	if (TilePosSrc.YTile < TilePosDest.YTile) {
+	  return IsoDefs::SOUTHEAST_INDEX;
+	} else if (TilePosSrc.YTile > TilePosDest.YTile) {
+	  return IsoDefs::NORTHEAST_INDEX;
+	} 
+	return IsoDefs::EAST_INDEX;
+  } else if (TilePosSrc.XTile > TilePosDest.XTile) {
+	if (TilePosSrc.YTile < TilePosDest.YTile) {
+	  return IsoDefs::SOUTHWEST_INDEX;
+	} else if (TilePosSrc.YTile > TilePosDest.YTile) {
+	  return IsoDefs::NORTHWEST_INDEX;
+	} 
+	return IsoDefs::WEST_INDEX;
+  } else if (TilePosSrc.YTile < TilePosDest.YTile) {
+	return IsoDefs::SOUTH_INDEX;
+  } else if (TilePosSrc.YTile > TilePosDest.YTile) {
+	return IsoDefs::NORTH_INDEX;
+  }
+
+  // No hay direccion posible
+  return IsoDefs::NO_DIRECTION_INDEX;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Comprueba si el tile TileSrc es adyacente a TileDest, ver 
+//   CIsoEngine::IsAdjacentTo.
+// Parametros:
+// - TileSrc, TileDest. Tile de posicion origen y destino.
+// Devuelve:
+// - Si es adyacente true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+CBenchMap::IsAdjacentTo(const AreaDefs::sTilePos& TileSrc,
+						const AreaDefs::sTilePos& TileDest)
+{
+  // Se hallan los tiles adyacentes a TileDest comprobandose si alguno
+  // es igual a TileSrc
+  AreaDefs::sTilePos AdjacentTilePos;
+  byte ubDirIt = 0;
+  for (; ubDirIt < IsoDefs::MAX_DIRECTIONS; ++ubDirIt) {
+	if (GetAdjacentTilePos(TileDest, IsoDefs::eDirectionIndex(ubDirIt), AdjacentTilePos) &&
+		TileSrc == AdjacentTilePos) {
+	  return true;
+	}
+  }
+
+  // No es adyacente
+  return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene la mascara de acceso al tile desde la rejilla, ver 
+//   CArea::GetMaskTileAccess.
+// Parametros:
+// - TilePos. Posicion del tile.
+// - udNoEntitiesToCheck. Tipos de entidades que NO se desean chequear. Con
+//   PLAYER | CRIATURE se retornara la mascara de adyacentes y con cualquier 
+//   otro valor la estatica junto a las criaturas.
+// Devuelve:
+// - Mascara de acceso.
+// Notas:
+// - Las criaturas se consideraran siempre detenidas y bloqueando todos los
+//   accesos al tile.
+///////////////////////////////////////////////////////////////////////////////
+AreaDefs::MaskTileAccess 
+CBenchMap::GetMaskTileAccess(const AreaDefs::sTilePos& TilePos,
+							 const dword udNoEntitiesToCheck)
+{
+  // Se toma la info
+  const AreaDefs::TileAccessInfo AccessInfo = m_AccessGrid[GetTileIdx(TilePos)];
+
+  // Se excluyen criaturas?
+  if ((RulesDefs::PLAYER | RulesDefs::CRIATURE) == udNoEntitiesToCheck) {
+	return AreaDefs::MaskTileAccess((AccessInfo & AreaDefs::TILE_ADJ_ACCESS_MASK) >> 
+									AreaDefs::TILE_ADJ_ACCESS_SHIFT);
+  }
+
+  // No, se toma la estatica y se aaden las criaturas
+  return (AccessInfo & AreaDefs::TILE_WITH_CRIATURE) ? 
+		 AreaDefs::NO_TILE_ACCESS : AreaDefs::MaskTileAccess(AccessInfo & AreaDefs::TILE_ACCESS_MASK);
+}
@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+// 
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//  
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CBenchMap.h
+// Autor: Fernando Rodrguez Martnez 
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Clase:
+// - CBenchMap
+//
+// Descripcion:
+// - Mapa para el banco de pruebas del localizador de caminos. Implementara
+//   la interfaz iCPathFinderMap replicando la informacion de acceso que 
+//   mantiene CArea (rejilla de accesos empaquetada, adyacencia isometrica y
+//   componentes conexas) sin depender del resto del motor.
+// - El mapa podra generarse de forma determinista a partir de unas
+//   dimensiones y una semilla, o bien leerse desde un fichero de texto con
+//   un caracter por tile:
+//    * ' ' Tile sin contenido.
+//    * '.' Tile libre.
+//    * '#' Pared (bloquea tambien la mascara de adyacentes).
+//    * 'o' Objeto de escenario (solo bloquea la mascara estatica).
+//    * 'c' Criatura (bloquea solo al consultar con todas las entidades).
+//
+// Notas:
+// - Las reglas de acceso y de conectividad deberan de mantenerse a la par
+//   con las de CArea (GetAdjacentTilePos, GetMaskTileAccess, 
+//   BuildAccessGrid y CanCrossInConnectivity).
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _CBENCHMAP_H_
+#define _CBENCHMAP_H_
+
+// Pragmas <VC6 / Warnings sobre la stl>
+#pragma warning(disable:4786)
+
+// Cabeceras
+#ifndef _SYSDEFS_H_
+#include "SYSDefs.h"
+#endif
+#ifndef _ICPATHFINDERMAP_H_
+#include "iCPathFinderMap.h"
+#endif
+#ifndef _VECTOR_H_
+#define _VECTOR_H_
+#include <vector>
+#endif
+#ifndef _STRING_H_
+#define _STRING_H_
+#include <string>
+#endif
+
+// Clase CBenchMap
+class CBenchMap: public iCPathFinderMap
+{
+private:
+  // Estructuras
+  struct sDelta {
+	// Incrementos para hallar la posicion de un tile adyacente
+	sbyte sbXDelta;
+	sbyte sbYDelta;
+  };
+
+private:
+  // Vbles de miembro
+  std::vector<AreaDefs::TileAccessInfo> m_AccessGrid; // Rejilla de accesos
+  std::vector<AreaDefs::ComponentID>    m_Components; // Componentes conexas
+  sDelta m_EvenDeltas[IsoDefs::MAX_DIRECTIONS];       // Deltas en Y par
+  sDelta m_OddDeltas[IsoDefs::MAX_DIRECTIONS];        // Deltas en Y impar
+  word   m_uwWidth;                                   // Anchura
+  word   m_uwHeight;                                  // Altura
+  word   m_uwNumComponents;                           // Num. de componentes
+  dword  m_udSeed;                                    // Semilla de generacion
+
+public:
+  // Constructor / destructor
+  CBenchMap(void): m_uwWidth(0),
+				   m_uwHeight(0),
+				   m_uwNumComponents(0),
+				   m_udSeed(0) { InitDeltasValues(); }
+  ~CBenchMap(void) { }
+
+public:
+  // Creacion del mapa
+  bool Create(const word uwWidth, 
+			  const word uwHeight,
+			  const dword udSeed);
+  bool Load(const std::string& szFileName);
+private:
+  // Metodos de apoyo
+  void InitDeltasValues(void);
+  void Reset(const word uwWidth, 
+			 const word uwHeight);
+  void SetTile(const AreaDefs::sTilePos& TilePos,
+			   const char cType);
+  void BuildConnectivity(void);
+  bool CanCrossInConnectivity(const AreaDefs::sTilePos& TileSrc,
+							  const IsoDefs::eDirectionIndex& Dir);
+  inline dword NextRandom(void) {
+	// Generador congruencial lineal
+	m_udSeed = m_udSeed * 1664525 + 1013904223;
+	return (m_udSeed >> 8);
+  }
+
+public:
+  // Obtencion de informacion general
+  inline word GetWidth(void) const { return m_uwWidth; }
+  inline word GetHeight(void) const { return m_uwHeight; }
+  inline word GetNumComponents(void) const { return m_uwNumComponents; }
+  inline bool IsCellWithContent(const AreaDefs::sTilePos& TilePos) const {
+	// Comprueba si el tile tiene contenido
+	return (m_AccessGrid[TilePos.YTile * m_uwWidth + TilePos.XTile] & AreaDefs::TILE_WALKABLE) != 0;
+  }
+
+public:
+  // iCPathFinderMap / Manipulacion de posicion en tiles
+  bool IsCellValid(const AreaDefs::sTilePos& TilePos) {
+	// Se retorna flag de validez
+	return (TilePos.XTile >= 0 && TilePos.XTile < m_uwWidth &&
+			TilePos.YTile >= 0 && TilePos.YTile < m_uwHeight);
+  }
+  AreaDefs::TileIndex GetTileIdx(const AreaDefs::sTilePos& TilePos) {
+	// Se retorna posicion
+	return (TilePos.YTile * m_uwWidth + TilePos.XTile);
+  }
+  bool GetAdjacentTilePos(const AreaDefs::sTilePos& TilePosSrc,
+						  const IsoDefs::eDirectionIndex& AdjTileDirection,
+						  AreaDefs::sTilePos& TilePosDest);
+  IsoDefs::eDirectionIndex CalculeDirection(const AreaDefs::sTilePos& TilePosSrc,
+											const AreaDefs::sTilePos& TilePosDest);
+  bool IsAdjacentTo(const AreaDefs::sTilePos& TileSrc,
+					const AreaDefs::sTilePos& TileDest);
+
+public:
+  // iCPathFinderMap / Trabajo con la mascara de acceso y la conectividad
+  AreaDefs::MaskTileAccess GetMaskTileAccess(const AreaDefs::sTilePos& TilePos,
+											 const dword udNoEntitiesToCheck = RulesDefs::NO_ENTITY);
+  bool AreTilesConnected(const AreaDefs::sTilePos& TileSrc,
+						 const AreaDefs::sTilePos& TileDest) {
+	// Comprueba si ambos tiles pertenecen a la misma componente conexa
+	return (m_Components[GetTileIdx(TileSrc)] == m_Components[GetTileIdx(TileDest)]);
+  }
+}; // ~ CBenchMap
+
+#endif // ~ #ifdef _CBENCHMAP_H_
@@ -0,0 +1,506 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+// 
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//  
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// PathFinderBench.cpp
+// Autor: Fernando Rodrguez Martnez 
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Descripcion:
+// - Banco de pruebas del localizador de caminos (CPathFinder) desde la linea
+//   de comandos. Trabajara sin graficos, sonido ni resto de subsistemas del
+//   motor, sobre un mapa CBenchMap generado a partir de una semilla o leido
+//   desde un fichero de texto.
+// - Reproducira un fichero de consultas, creandolo antes si no existe, y
+//   mostrara la latencia de las mismas (percentiles 50 y 99), los nodos
+//   expandidos y tomados del banco, las reservas realizadas a traves del
+//   CMemoryPool de los nodos, las consultas descartadas por conectividad y
+//   una suma de control con las longitudes halladas.
+// - Cada consulta ocupara una linea con el formato
+//   "<tipo> <xorig> <yorig> <xdest> <ydest> <longmax>", siendo el tipo F
+//   (FindPath), L (CalculePathLenght) o B (CalculeBoundedPathLenght). La
+//   longitud maxima solo se tendra en cuenta en las consultas B.
+// - La longitud hallada en cada consulta (-1 si no hay camino) se escribira,
+//   una por linea, en el fichero de consultas + ".res". Si existe el fichero
+//   de consultas + ".ref", resultado de una ejecucion anterior, se comparara
+//   con el y se informara de las consultas cuyo resultado haya cambiado.
+//
+// Notas:
+// - Las reservas contadas seran solo las de los nodos de busqueda, que son
+//   las que pasan por CMemoryPool. Las del map de nodos, la Open y el propio
+//   CPath se realizaran a traves del heap y no se contaran.
+// - Con la opcion -v se comprobara, ademas, que cada consulta B devuelva la
+//   longitud minima en pasos cuando esta no supere la cota y -1 en otro caso.
+///////////////////////////////////////////////////////////////////////////////
+
+// Pragmas <VC6 / Warnings sobre la stl>
+#pragma warning(disable:4786)
+
+#include "SYSDefs.h"
+#include "SYSAssert.h"
+#include "CPathFinder.h"
+#include "CPath.h"
+#include "CBenchMap.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#ifndef _WIN32
+#include <time.h>
+#endif
+
+// Opciones de ejecucion
+struct sOptions {
+  std::string szMapFile;    // Fichero con el mapa (vacio si se genera)
+  std::string szQueryFile;  // Fichero de consultas
+  word        uwWidth;      // Anchura del mapa generado
+  word        uwHeight;     // Altura del mapa generado
+  dword       udSeed;       // Semilla del mapa generado y de las consultas
+  dword       udNumQueries; // Consultas a crear si no existe el fichero
+  bool        bVerify;      // Comprobar las consultas acotadas?
+  // Constructor
+  sOptions(void): szQueryFile("PathFinderBench.qry"),
+				  uwWidth(128),
+				  uwHeight(256),
+				  udSeed(1),
+				  udNumQueries(1000),
+				  bVerify(false) { }
+};
+
+// Funciones
+bool ReadOptions(int argc, 
+				 char* argv[], 
+				 sOptions& Options);
+bool WriteQueries(CBenchMap& Map, 
+				  const std::string& szQueryFile,
+				  const dword udNumQueries,
+				  const dword udSeed);
+bool RunQueries(CPathFinder& PathFinder,
+				CBenchMap& Map, 
+				const std::string& szQueryFile,
+				const bool bVerify);
+sqword GetTimeNs(void);
+void WriteHelp(void);
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Entrada de la aplicacion.
+// Parametros:
+// - argc. Numero de parametros, incluido el propio nombre de la aplicacion.
+// - argv. Array con los parametros.
+// Devuelve:
+// - 0 si todo ha ido bien y 1 en caso contrario.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+int 
+main(int argc, 
+	 char* argv[])
+{
+  // Se leen las opciones
+  sOptions Options;
+  if (!ReadOptions(argc, argv, Options)) {
+	WriteHelp();
+	return 1;
+  }
+
+  // Se crea el mapa
+  CBenchMap Map;
+  if (Options.szMapFile.empty()) {
+	if (!Map.Create(Options.uwWidth, Options.uwHeight, Options.udSeed)) {
+	  std::cout << "No se pudo generar el mapa.\n";
+	  return 1;
+	}
+	std::cout << "Mapa generado de " << Map.GetWidth() << "x" << Map.GetHeight()
+			  << " con semilla " << Options.udSeed;
+  } else {
+	if (!Map.Load(Options.szMapFile)) {
+	  std::cout << "No se pudo leer el mapa " << Options.szMapFile << ".\n";
+	  return 1;
+	}
+	std::cout << "Mapa " << Options.szMapFile << " de " 
+			  << Map.GetWidth() << "x" << Map.GetHeight();
+  }
+  std::cout << ", " << Map.GetNumComponents() << " componentes conexas.\n";
+
+  // No existe el fichero de consultas?
+  std::ifstream QueryFile(Options.szQueryFile.c_str());
+  if (!QueryFile) {
+	// Se crea
+	if (!WriteQueries(Map, Options.szQueryFile, Options.udNumQueries, Options.udSeed)) {
+	  std::cout << "No se pudo crear " << Options.szQueryFile << ".\n";
+	  return 1;
+	}
+	std::cout << "Creado " << Options.szQueryFile << " con " 
+			  << Options.udNumQueries << " consultas.\n";
+  }
+  QueryFile.close();
+
+  // Se inicializa el localizador de caminos y se reproducen las consultas
+  CPathFinder PathFinder;
+  if (!PathFinder.Init()) {
+	return 1;
+  }
+  PathFinder.SetMap(&Map);
+  const bool bResult = RunQueries(PathFinder, Map, Options.szQueryFile, Options.bVerify);
+  PathFinder.End();
+  return bResult ? 0 : 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Lee las opciones de la linea de comandos:
+//    * -s <ancho> <alto> <semilla>. Genera el mapa (por defecto 128 256 1).
+//    * -m <fichero>. Lee el mapa desde un fichero de texto.
+//    * -q <fichero>. Fichero de consultas (por defecto PathFinderBench.qry).
+//    * -n <num>. Consultas a crear si no existe el fichero (por defecto 1000).
+//    * -v. Comprueba las consultas acotadas.
+// Parametros:
+// - argc, argv. Parametros recibidos.
+// - Options. Opciones a establecer.
+// Devuelve:
+// - Si las opciones son validas true. En caso contrario false.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+bool 
+ReadOptions(int argc, 
+			char* argv[], 
+			sOptions& Options)
+{
+  // Se recorren los parametros
+  sword swIt = 1;
+  for (; swIt < argc; ++swIt) {
+	const std::string szOption(argv[swIt]);
+	if ("-s" == szOption && swIt + 3 < argc) {
+	  Options.uwWidth = atoi(argv[++swIt]);
+	  Options.uwHeight = atoi(argv[++swIt]);
+	  Options.udSeed = strtoul(argv[++swIt], NULL, 10);
+	} else if ("-m" == szOption && swIt + 1 < argc) {
+	  Options.szMapFile = argv[++swIt];
+	} else if ("-q" == szOption && swIt + 1 < argc) {
+	  Options.szQueryFile = argv[++swIt];
+	} else if ("-n" == szOption && swIt + 1 < argc) {
+	  Options.udNumQueries = strtoul(argv[++swIt], NULL, 10);
+	} else if ("-v" == szOption) {
+	  Options.bVerify = true;
+	} else {
+	  return false;
+	}
+  }
+
+  // Todo correcto
+  return (Options.udNumQueries > 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Escribe en szQueryFile udNumQueries consultas entre pares de tiles con 
+//   contenido del mapa, elegidos de forma determinista a partir de udSeed.
+// Parametros:
+// - Map. Mapa.
+// - szQueryFile. Fichero de consultas.
+// - udNumQueries. Numero de consultas.
+// - udSeed. Semilla para la eleccion de las consultas.
+// Devuelve:
+// - Si se ha podido escribir true. En caso contrario false.
+// Notas:
+// - No se usara rand para no depender del estado de la CRT.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+WriteQueries(CBenchMap& Map, 
+			 const std::string& szQueryFile,
+			 const dword udNumQueries,
+			 const dword udSeed)
+{
+  // Se reunen los tiles con contenido
+  std::vector<AreaDefs::sTilePos> Tiles;
+  AreaDefs::sTilePos TilePos;
+  for (TilePos.YTile = 0; TilePos.YTile < Map.GetHeight(); ++TilePos.YTile) {
+	for (TilePos.XTile = 0; TilePos.XTile < Map.GetWidth(); ++TilePos.XTile) {
+	  if (Map.IsCellWithContent(TilePos)) {
+		Tiles.push_back(TilePos);
+	  }
+	}
+  }
+  if (Tiles.empty()) {
+	return false;
+  }
+
+  // Se abre el fichero
+  std::ofstream QueryFile(szQueryFile.c_str());
+  if (!QueryFile) {
+	return false;
+  }
+
+  // Se escriben las consultas (generador congruencial lineal)
+  const char szKinds[] = { 'F', 'L', 'B' };
+  dword udSeedValue = udSeed;
+  dword udIt = 0;
+  for (; udIt < udNumQueries; ++udIt) {
+	udSeedValue = udSeedValue * 1664525 + 1013904223;
+	const AreaDefs::sTilePos& TileSrc = Tiles[((udSeedValue & 0xFFFFFFFF) >> 8) % Tiles.size()];
+	udSeedValue = udSeedValue * 1664525 + 1013904223;
+	const AreaDefs::sTilePos& TileDest = Tiles[((udSeedValue & 0xFFFFFFFF) >> 8) % Tiles.size()];
+	QueryFile << szKinds[udIt % 3] << " " 
+			  << TileSrc.XTile << " " << TileSrc.YTile << " " 
+			  << TileDest.XTile << " " << TileDest.YTile << " " 
+			  << (1 + (((udSeedValue & 0xFFFFFFFF) >> 4) % 64)) << "\n";
+  }
+
+  // Todo correcto
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Reproduce las consultas de szQueryFile sobre el mapa y muestra sus 
+//   estadisticas (ver cabecera del fichero).
+// Parametros:
+// - PathFinder. Localizador de caminos, con el mapa ya vinculado.
+// - Map. Mapa.
+// - szQueryFile. Fichero de consultas.
+// - bVerify. Comprobar las consultas acotadas?
+// Devuelve:
+// - Si se ha podido ejecutar true. En caso contrario false. Tambien se 
+//   retornara false si la comprobacion de las consultas acotadas falla.
+// Notas:
+// - La comprobacion se realizara tras la medicion, para no alterarla.
+///////////////////////////////////////////////////////////////////////////////
+bool 
+RunQueries(CPathFinder& PathFinder,
+		   CBenchMap& Map, 
+		   const std::string& szQueryFile,
+		   const bool bVerify)
+{
+  // Se abren los ficheros
+  std::ifstream QueryFile(szQueryFile.c_str());
+  if (!QueryFile) {
+	return false;
+  }
+  std::ofstream ResultFile((szQueryFile + ".res").c_str());
+  if (!ResultFile) {
+	return false;
+  }
+  std::ifstream RefFile((szQueryFile + ".ref").c_str());
+  const bool bWithRef = RefFile.good();
+
+  // Vbles
+  std::vector<sqword> Latencies;   // Latencias en nanosegundos
+  dword udNumQueries = 0;          // Consultas realizadas
+  dword udChecksum = 0;            // Suma de control
+  dword udFound = 0;               // Caminos hallados
+  dword udRejected = 0;            // Descartes por conectividad
+  dword udMismatches = 0;          // Resultados distintos a la referencia
+  dword udTotalExpanded = 0;       // Nodos expandidos en total
+  dword udMaxExpanded = 0;         // Maximo de nodos expandidos
+  dword udTotalPoolNodes = 0;      // Nodos tomados del banco en total
+  dword udTotalPoolAllocs = 0;     // Nodos pedidos al pool en total
+  dword udMaxPoolAllocs = 0;       // Maximo de nodos pedidos en una consulta
+  dword udTotalHeapAllocs = 0;     // Reservas del pool en el heap en total
+  dword udQueriesWithAllocs = 0;   // Consultas con algun nodo pedido al pool
+
+  // Se reproducen las consultas
+  char cKind;
+  AreaDefs::sTilePos TileSrc;
+  AreaDefs::sTilePos TileDest;
+  word uwMaxLenght;
+  std::vector<AreaDefs::sTilePos> BoundedSrc;
+  std::vector<AreaDefs::sTilePos> BoundedDest;
+  std::vector<word>               BoundedMax;
+  std::vector<sword>              BoundedLenght;
+  while (QueryFile >> cKind 
+				   >> TileSrc.XTile >> TileSrc.YTile 
+				   >> TileDest.XTile >> TileDest.YTile
+				   >> uwMaxLenght) {
+	// Consulta fuera del mapa?
+	if (!Map.IsCellValid(TileSrc) || !Map.IsCellValid(TileDest)) {
+	  std::cout << "Consulta " << udNumQueries << " fuera del mapa.\n";
+	  return false;
+	}
+
+	// Se realiza la consulta
+	sword swLenght = -1;
+	const sqword sqInitTime = GetTimeNs();
+	switch(cKind) {
+	  case 'L': {
+		swLenght = PathFinder.CalculePathLenght(TileSrc, TileDest);
+	  } break;
+
+	  case 'B': {
+		swLenght = PathFinder.CalculeBoundedPathLenght(TileSrc, TileDest, uwMaxLenght);
+	  } break;
+
+	  default: {
+		CPath* const pPath = PathFinder.FindPath(TileSrc, TileDest);
+		if (pPath) {
+		  swLenght = pPath->GetSize();
+		  delete pPath;
+		}
+	  } break;
+	}; // ~ switch
+	Latencies.push_back(GetTimeNs() - sqInitTime);
+
+	// Se actualizan estadisticas y suma de control
+	const CPathFinder::sSearchStats& Stats = PathFinder.GetLastSearchStats();
+	if (swLenght >= 0) { 
+	  ++udFound; 
+	}
+	if (Stats.bRejected) { 
+	  ++udRejected; 
+	}
+	udTotalExpanded += Stats.udExpandedNodes;
+	udTotalPoolNodes += Stats.udAllocatedNodes;
+	if (Stats.udExpandedNodes > udMaxExpanded) {
+	  udMaxExpanded = Stats.udExpandedNodes;
+	}
+	udTotalPoolAllocs += Stats.udPoolAllocs;
+	udTotalHeapAllocs += Stats.udHeapAllocs;
+	if (Stats.udPoolAllocs) {
+	  ++udQueriesWithAllocs;
+	}
+	if (Stats.udPoolAllocs > udMaxPoolAllocs) {
+	  udMaxPoolAllocs = Stats.udPoolAllocs;
+	}
+	udChecksum = ((udChecksum * 31) + word(swLenght)) & 0xFFFFFFFF;
+
+	// Se guarda la consulta acotada para su comprobacion
+	if ('B' == cKind) {
+	  BoundedSrc.push_back(TileSrc);
+	  BoundedDest.push_back(TileDest);
+	  BoundedMax.push_back(uwMaxLenght);
+	  BoundedLenght.push_back(swLenght);
+	}
+
+	// Se guarda el resultado y se compara con la referencia
+	ResultFile << swLenght << "\n";
+	sword swRefLenght;
+	if (bWithRef && RefFile >> swRefLenght && swRefLenght != swLenght) {
+	  if (udMismatches < 16) {
+		std::cout << "Consulta " << udNumQueries << ": " << swLenght 
+				  << " en lugar de " << swRefLenght << ".\n";
+	  }
+	  ++udMismatches;
+	}
+	++udNumQueries;
+  }
+  if (!udNumQueries) {
+	return false;
+  }
+
+  // Se hallan percentiles y se vuelca la informacion
+  std::sort(Latencies.begin(), Latencies.end());
+  const sqword sqP50 = Latencies[(Latencies.size() * 50) / 100];
+  const sqword sqP99 = Latencies[(Latencies.size() * 99) / 100];
+  std::cout << udNumQueries << " consultas de " << szQueryFile << ".\n"
+			<< " | Halladas: " << udFound 
+			<< ", descartadas por conectividad: " << udRejected << ".\n"
+			<< std::fixed << std::setprecision(1)
+			<< " | Latencia p50: " << double(sqP50) / 1000.0 
+			<< " us, p99: " << double(sqP99) / 1000.0 << " us.\n"
+			<< " | Nodos expandidos: " << udTotalExpanded 
+			<< " (medio " << udTotalExpanded / udNumQueries 
+			<< ", maximo " << udMaxExpanded 
+			<< "), tomados del banco: " << udTotalPoolNodes << ".\n"
+			<< " | Nodos pedidos al CMemoryPool: " << udTotalPoolAllocs
+			<< " (en " << udQueriesWithAllocs << " consultas, maximo " << udMaxPoolAllocs 
+			<< "), reservas del pool en el heap: " << udTotalHeapAllocs << ".\n"
+			<< " | Suma de control: 0x" << std::hex << std::uppercase 
+			<< std::setw(8) << std::setfill('0') << udChecksum 
+			<< std::dec << std::setfill(' ') << ".\n";
+  if (bWithRef) {
+	std::cout << " | Resultados distintos a la referencia: " << udMismatches << ".\n";
+  }
+
+  // Se comprueban las consultas acotadas?
+  bool bVerifyOk = true;
+  if (bVerify) {
+	// Cada consulta acotada debera de devolver la longitud minima en pasos,
+	// hallada sin cota efectiva, si esta no supera la cota y -1 en otro caso
+	dword udFailed = 0;
+	dword udIt = 0;
+	for (; udIt < BoundedSrc.size(); ++udIt) {
+	  const sword swMinLenght = PathFinder.CalculeBoundedPathLenght(BoundedSrc[udIt], 
+																	BoundedDest[udIt], 
+																	0xFFFF);
+	  const sword swExpected = (swMinLenght >= 0 && swMinLenght <= BoundedMax[udIt]) ? 
+							   swMinLenght : -1;
+	  if (swExpected != BoundedLenght[udIt]) {
+		if (udFailed < 16) {
+		  std::cout << "Consulta acotada " << udIt << " (" 
+					<< BoundedSrc[udIt].XTile << "," << BoundedSrc[udIt].YTile << " -> "
+					<< BoundedDest[udIt].XTile << "," << BoundedDest[udIt].YTile << ", cota "
+					<< BoundedMax[udIt] << "): " << BoundedLenght[udIt] 
+					<< " en lugar de " << swExpected << ".\n";
+		}
+		++udFailed;
+	  }
+	}
+	std::cout << " | Consultas acotadas comprobadas: " << BoundedSrc.size() 
+			  << ", erroneas: " << udFailed << ".\n";
+	bVerifyOk = (0 == udFailed);
+  }
+
+  // Retorna
+  return bVerifyOk;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Obtiene el tiempo actual en nanosegundos, para medir intervalos.
+// Parametros:
+// Devuelve:
+// - Tiempo actual en nanosegundos.
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+sqword 
+GetTimeNs(void)
+{
+  #ifdef _WIN32
+	LARGE_INTEGER Freq;
+	LARGE_INTEGER Count;
+	QueryPerformanceFrequency(&Freq);
+	QueryPerformanceCounter(&Count);
+	return sqword((double(Count.QuadPart) * 1000000000.0) / double(Freq.QuadPart));
+  #else
+	timespec Time;
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+	return sqword(Time.tv_sec) * 1000000000 + Time.tv_nsec;
+  #endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Descripcion:
+// - Muestra la ayuda.
+// Parametros:
+// Devuelve:
+// Notas:
+///////////////////////////////////////////////////////////////////////////////
+void 
+WriteHelp(void)
+{
+  std::cout << "\nPathFinderBench [-s <ancho> <alto> <semilla> | -m <mapa>] [-q <consultas>] [-n <num>] [-v]\n"
+			<< "  -s  Genera el mapa a partir de una semilla (por defecto 128 256 1).\n"
+			<< "  -m  Lee el mapa desde un fichero de texto (' ' sin contenido, '.' libre,\n"
+			<< "      '#' pared, 'o' objeto de escenario, 'c' criatura).\n"
+			<< "  -q  Fichero de consultas, se creara si no existe (por defecto PathFinderBench.qry).\n"
+			<< "  -n  Consultas a crear (por defecto 1000).\n"
+			<< "  -v  Comprueba que las consultas acotadas devuelvan la longitud minima.\n";
+}
@@ -0,0 +1,23 @@
+// stdafx.h : include file for standard system include files,
+//  or project specific include files that are used frequently, but
+//      are changed infrequently
+//
+// Nota: SYSDefs.h incluye "stdafx.h". En Windows se tomara el del motor, en
+// el directorio de SYSDefs.h, y este solo se alcanzara al compilar el banco
+// de pruebas en sistemas sin windows.h (ver Makefile).
+
+#if !defined(AFX_STDAFX_H__PATHFINDERBENCH__INCLUDED_)
+#define AFX_STDAFX_H__PATHFINDERBENCH__INCLUDED_
+
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN		// Exclude rarely-used stuff from Windows headers
+#include <windows.h>
+#else
+#define __int64 long long
+#endif
+
+#endif // !defined(AFX_STDAFX_H__PATHFINDERBENCH__INCLUDED_)
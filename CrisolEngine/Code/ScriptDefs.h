@@ -182,6 +182,7 @@ namespace ScriptDefs
 	SI_WORLDOBJ_GETLIGHTAT,
 	SI_WORLDOBJ_PLAYWAVSOUND,
 	SI_WORLDOBJ_SETSCRIPTAT,
+	SI_WORLDOBJ_CALCULEBOUNDEDPATHLENGHT,
 
 	// Opcodes asociados a los metodos entity
 	// 4000..4999
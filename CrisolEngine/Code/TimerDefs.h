@@ -40,8 +40,9 @@ namespace TimerDefs
   // Tipos enumerados
   enum TimeUnits
   { // Unidades de tiempo
-    TIMER_UNITS_SEC = 1,  // Unidades en segundos
-    TIMER_UNITS_MS = 1000 // Unidades en milisegundos    
+    TIMER_UNITS_SEC = 1,       // Unidades en segundos
+    TIMER_UNITS_MS = 1000,     // Unidades en milisegundos    
+    TIMER_UNITS_US = 1000000   // Unidades en microsegundos
   };
 }
 #endif // ~ #ifdef _TIMERDEFS_H_
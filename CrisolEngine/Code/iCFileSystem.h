@@ -82,8 +82,30 @@ public:
 public:
   // Trabajo con ficheros
   virtual dword GetFileSize(const FileDefs::FileHandle& hFile) = 0;
+  virtual const sbyte* const GetFileData(const FileDefs::FileHandle& hFile,
+										 dword& udSize) = 0;
+  virtual const sbyte* const GetFileStoredData(const FileDefs::FileHandle& hFile,
+											   dword& udStoredSize,
+											   dword& udSize,
+											   bool& bCompressed) = 0;
+  virtual bool UnpackFileData(const sbyte* const psbStored,
+							  const dword udStoredSize,
+							  sbyte* const psbDest,
+							  const dword udSize) const = 0;
   virtual void GetFileNamesFromPath(const std::string& szPath,
 									std::list<std::string>& DestList) = 0;
+
+public:
+  // Trabajo con ficheros residentes en memoria
+  virtual bool CreateMemFile(const std::string& szFileName) = 0;
+  virtual bool CreateMemFile(const std::string& szFileName,
+							 const sbyte* const psbData,
+							 const dword udSize) = 0;
+  virtual bool FlushMemFile(const std::string& szFileName) = 0;
+  virtual void ReleaseMemFile(const std::string& szFileName) = 0;
+  virtual bool IsMemFile(const std::string& szFileName) = 0;
+  virtual dword GetMemFileSize(const std::string& szFileName) = 0;
+  virtual const sbyte* const GetMemFileData(const std::string& szFileName) = 0;
 };
 
 #endif // ~ #ifdef _ICFILESYSTEM_H_
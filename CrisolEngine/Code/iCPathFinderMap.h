@@ -0,0 +1,77 @@
+///////////////////////////////////////////////////////////////////////////////
+// CrisolEngine - Computer Role-Play Game Engine
+// Copyright (C) 2002 Fernando Rodrguez Martnez
+// 
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//  
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// iCPathFinderMap.h
+// Autor: Fernando Rodrguez Martnez 
+//        <frodrig76@gmail.com | @_frodrig | www.frodrig.com>
+//
+// Interfaces:
+// - iCPathFinderMap
+//
+// Descripcion:
+// - Define la interfaz con la informacion de adyacencia y acceso de un mapa
+//   que necesitara CPathFinder para realizar sus busquedas. 
+// - Dentro del motor sera implementada por el motor isometrico sobre el area
+//   activa y, fuera del mismo, por las herramientas que quieran trabajar con
+//   el localizador de caminos sin depender del resto de subsistemas.
+///////////////////////////////////////////////////////////////////////////////
+#ifndef _ICPATHFINDERMAP_H_
+#define _ICPATHFINDERMAP_H_
+
+// Cabeceras
+#ifndef _SYSDEFS_H_
+#include "SYSDefs.h"
+#endif
+#ifndef _AREADEFS_H_
+#include "AreaDefs.h"
+#endif
+#ifndef _ISODEFS_H_
+#include "IsoDefs.h"
+#endif
+#ifndef _RULESDEFS_H_
+#include "RulesDefs.h"
+#endif
+
+// Defincion de clases / estructuras / espacios de nombres
+
+// Interfaz iCPathFinderMap
+struct iCPathFinderMap
+{
+public:
+  // Manipulacion de posicion en tiles
+  virtual bool IsCellValid(const AreaDefs::sTilePos& TilePos) = 0;
+  virtual AreaDefs::TileIndex GetTileIdx(const AreaDefs::sTilePos& TilePos) = 0;
+  virtual bool GetAdjacentTilePos(const AreaDefs::sTilePos& TilePosSrc,
+								  const IsoDefs::eDirectionIndex& AdjTileDirection,
+								  AreaDefs::sTilePos& TilePosDest) = 0;
+  virtual IsoDefs::eDirectionIndex CalculeDirection(const AreaDefs::sTilePos& TilePosSrc,
+													const AreaDefs::sTilePos& TilePosDest) = 0;
+  virtual bool IsAdjacentTo(const AreaDefs::sTilePos& TileSrc,
+							const AreaDefs::sTilePos& TileDest) = 0;
+
+public:
+  // Trabajo con la mascara de acceso y la conectividad
+  virtual AreaDefs::MaskTileAccess GetMaskTileAccess(const AreaDefs::sTilePos& TilePos,
+													 const dword udNoEntitiesToCheck = RulesDefs::NO_ENTITY) = 0;
+  virtual bool AreTilesConnected(const AreaDefs::sTilePos& TileSrc,
+								 const AreaDefs::sTilePos& TileDest) = 0;
+}; // ~ iCPathFinderMap
+
+#endif // ~ #ifdef _ICPATHFINDERMAP_H_
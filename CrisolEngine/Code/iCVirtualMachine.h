@@ -86,6 +86,7 @@ public:
   virtual void ReleaseScripts(iCScriptClient* const pClient) = 0;
   virtual void ReleaseScripts(iCScriptClient* const pClient,
 						      const RulesDefs::eScriptEvents& Event) = 0;
+  virtual bool IsClientWithScripts(iCScriptClient* const pClient) = 0;
 public:
   // Metodos de ejecucion de los eventos scripts
   virtual void OnStartGameEvent(iCScriptClient* const pClient,
@@ -218,6 +218,11 @@ public:
 								   const RulesDefs::CriatureRange& Range) = 0;
   virtual void FindCriaturesContainingCriatureInRange(const AreaDefs::EntHandle& hCriature,
 													  std::set<AreaDefs::EntHandle>& InRangeSet) = 0;
+  virtual void FindCriaturesRangeDelta(const AreaDefs::sTilePos& Pos,
+									   const RulesDefs::CriatureRange& Range,
+									   const std::set<AreaDefs::EntHandle>& InRangeSet,
+									   std::set<AreaDefs::EntHandle>& EnteredSet,
+									   std::set<AreaDefs::EntHandle>& LeftSet) = 0;
 
 public:
   // Trabajo con motor isometrico
@@ -269,6 +274,10 @@ public:
 						  const bool bGhostMode = false) = 0;  
   virtual sword CalculePathLenght(const AreaDefs::sTilePos& TileSrc,
 								  const AreaDefs::sTilePos& TileDest) = 0;
+  virtual sword CalculeBoundedPathLenght(const AreaDefs::sTilePos& TileSrc,
+										 const AreaDefs::sTilePos& TileDest,
+										 const word uwMaxLenght) = 0;
+  virtual void UpdateAccessInfoAt(const AreaDefs::sTilePos& TilePos) = 0;
   virtual sword CalculeAdjacentPosInDestination(const AreaDefs::sTilePos& TileSrc,
 											    const AreaDefs::sTilePos& TileDest,
 												AreaDefs::sTilePos& AdjacentTilePos) = 0;